@@ -134,6 +134,19 @@ void StartupCode(void)
     ASM_KEYWORD(" xor  r29, r29, r29");
     ASM_KEYWORD(" xor  r30, r30, r30");
     ASM_KEYWORD(" xor  r31, r31, r31");
+
+#ifdef BOOT_TIMELINE_ENABLE
+/*******************************************************************/
+/* Start the time base from reset for the Mcu boot timeline        */
+/*******************************************************************/
+    ASM_KEYWORD(" mtspr 284, r0    ");      /* TBL = 0 */
+    ASM_KEYWORD(" mtspr 285, r0    ");      /* TBU = 0 */
+    ASM_KEYWORD(" mfspr r3, 1008   ");      /* HID0 */
+    ASM_KEYWORD(" e_or2i r3, 0x4000 ");     /* HID0[TBEN] */
+    ASM_KEYWORD(" mtspr 1008, r3   ");
+    ASM_KEYWORD(" se_isync         ");
+    ASM_KEYWORD(" xor  r3, r3, r3");
+#endif
  
 
 /*******************************************************************/
@@ -676,6 +689,11 @@ void StartupCode(void)
      ASM_KEYWORD("e_bdnz   sram_loop"); /* loop for 64k of L2RAM */
 #endif
 
+#ifdef BOOT_TIMELINE_ENABLE
+/* End of the RAM initialization, kept in r14 until the timeline variables are initialized */
+     ASM_KEYWORD(" mfspr   r14, 268 ");
+#endif
+
 /************************/
 /* Erase ".sbss Section" */
 /************************/
@@ -992,6 +1010,17 @@ void StartupCode(void)
     init_runtime_check();
 #endif /* ENABLE_RCHECK */
 
+#ifdef BOOT_TIMELINE_ENABLE
+/******************************************************************/
+/* Record the start-up phases in Mcu_au32BootStartupTime          */
+/******************************************************************/
+    ASM_KEYWORD(" e_lis   r5, Mcu_au32BootStartupTime@h");
+    ASM_KEYWORD(" e_or2i  r5, Mcu_au32BootStartupTime@l");
+    ASM_KEYWORD(" e_stw   r14, 0(r5)");     /* end of the RAM initialization */
+    ASM_KEYWORD(" mfspr   r6, 268 ");
+    ASM_KEYWORD(" e_stw   r6, 4(r5)");      /* end of the start-up code */
+#endif
+
     ASM_KEYWORD ("e_bl main");
     /* main(); */
     
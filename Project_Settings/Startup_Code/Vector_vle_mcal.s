@@ -134,6 +134,8 @@
 /* ETH related								*/
     .globl Eth_TxIrqHdlr_0
     .globl Eth_RxIrqHdlr_0
+/* Only built with ETH_MII_BATCH_API, which alone unmasks the MII interrupt */
+    .weak Eth_MiiIrqHdlr_0
 
 
 /* IntcVectorTableHw						*/
@@ -728,7 +730,7 @@ IRQ195:
     e_b Eth_RxIrqHdlr_0         #interrupt 195
     .align ALIGN_SIZE
 IRQ196:
-    e_b .         #interrupt 196
+    e_b Eth_MiiIrqHdlr_0        #interrupt 196
     .align ALIGN_SIZE
 IRQ197:
     e_b .         #interrupt 197
@@ -189,6 +189,14 @@ extern "C"{
 
 #define MCL_CROSSBAR0_CRS_RESET_VALUE_U32     (0x00FF0000U) 
 
+/**
+*   @brief  Adds or removes the services Mcl_SetCrossbarProfile() and Mcl_MeasureCrossbarLatency()
+*           from the code.
+*        STD_ON: Crossbar priorities and parking can be switched at runtime. STD_OFF: they can not.
+*
+*/
+#define MCL_CROSSBAR_PROFILE_API         (STD_OFF)
+
 
 
  
@@ -299,6 +307,56 @@ extern "C"{
 #define MCL_TRANSFER_SIZE_8_BYTE 
 #define MCL_TRANSFER_SIZE_32_BYTE 
 
+/**
+*   @brief  Adds or removes the services Mcl_DmaMemcpy(), Mcl_DmaMemset() and Mcl_DmaMemcpyMainFunction()
+*           from the code.
+*        STD_ON: the asynchronous memory copy service can be used. STD_OFF: it can not be used.
+*        The buffers passed to these services shall be non-cacheable or maintained by the caller
+*        with the Mcl cache services.
+*
+*/
+#define MCL_DMA_MEMCPY_API                  (STD_OFF)
+
+/**
+* @brief      Number of logical eDma channels reserved for the memory copy service.
+*             The channels listed in MCL_DMA_MEMCPY_CHANNELS must not be used by any other user.
+*
+*/
+#define MCL_DMA_MEMCPY_CHANNELS_NO          (2U)
+
+/**
+* @brief      Logical eDma channels reserved for the memory copy service.
+*
+*/
+#define MCL_DMA_MEMCPY_CHANNELS             { MCL_DMA_LOGICAL_CHANNEL_0, MCL_DMA_LOGICAL_CHANNEL_1 }
+
+/**
+* @brief      Number of requests that can be pending in the memory copy queue.
+*
+*/
+#define MCL_DMA_MEMCPY_QUEUE_SIZE           (8U)
+
+/**
+* @brief      Number of bytes moved in one minor loop by the memory copy service.
+*             Must be a multiple of 32, smaller values shorten the time the channel holds the bus.
+*
+*/
+#define MCL_DMA_MEMCPY_MINOR_LOOP_BYTES     (256U)
+
+/**
+*   @brief  Adds or removes the services Mcl_DmaCaptureStart(), Mcl_DmaCaptureStop(),
+*           Mcl_DmaCaptureGetCount() and Mcl_DmaCaptureRead() from the code.
+*        STD_ON: eMios capture events can be streamed to RAM rings by eDma. STD_OFF: they can not.
+*
+*/
+#define MCL_DMA_CAPTURE_API                 (STD_OFF)
+
+/**
+* @brief      Number of eMios capture rings that can be active at the same time.
+*
+*/
+#define MCL_DMA_CAPTURE_RINGS_NO            (2U)
+
 
 
 /**
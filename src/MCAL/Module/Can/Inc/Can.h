@@ -189,9 +189,45 @@ extern "C"{
 #define CAN_SID_SET_BAUDRATE                  ((uint8)0x0FU)
 #define CAN_SID_SETCLOCKMODE                  ((uint8)0x0FU)
 #define CAN_SID_ABORT_MB                      ((uint8)0x10U)
+#define CAN_SID_SET_RXFIFO_BATCH_MODE         ((uint8)0x11U)
+#define CAN_SID_GET_RX_ADAPTIVE_STATS         ((uint8)0x12U)
+#define CAN_SID_GET_CONTROLLER_STATS          ((uint8)0x13U)
 
 /**@}*/
 
+/**
+* @brief          Can_Write_Unchecked skips the development error checks of Can_Write, for callers
+*                 which already guarantee an initialized driver, a transmit Hth and valid PduInfo pointers.
+*/
+#define CAN_UNCHECKED_API  (STD_OFF)
+
+/**
+* @brief          Can_SetRxFifoBatchMode replaces the per frame Rx FIFO interrupt of a controller by a drain of
+*                 up to CAN_RXFIFO_BATCH_BUDGET frames from Can_MainFunction_Read and from the FIFO warning interrupt.
+*/
+#define CAN_RXFIFO_BATCH_API      (STD_OFF)
+#define CAN_RXFIFO_BATCH_BUDGET   (6U)
+
+/**
+* @brief          Can_MainFunction_Read moves an Rx FIFO controller with Rx interrupts to batch mode when at
+*                 least CAN_RX_ADAPTIVE_POLL_THRESHOLD frames arrived during one period, and back to an interrupt
+*                 per frame when at most CAN_RX_ADAPTIVE_IRQ_THRESHOLD arrived. A controller given a mode with
+*                 Can_SetRxFifoBatchMode keeps it until Can_Init. Needs CAN_RXFIFO_BATCH_API.
+*/
+#define CAN_RX_ADAPTIVE_API             (STD_OFF)
+#define CAN_RX_ADAPTIVE_POLL_THRESHOLD  (16U)
+#define CAN_RX_ADAPTIVE_IRQ_THRESHOLD   (4U)
+
+#if ((CAN_RX_ADAPTIVE_API == STD_ON) && (CAN_RXFIFO_BATCH_API != STD_ON))
+    #error "CAN_RX_ADAPTIVE_API needs CAN_RXFIFO_BATCH_API"
+#endif
+
+/**
+* @brief          Per controller event counters, read by Can_GetControllerStats. The Rx FIFO and bus off events
+*                 are counted by the interrupt routines of Can_Flexcan.h, the CAN_BUSY returns by Can_Write.
+*/
+#define CAN_STATS_API  (STD_OFF)
+
 /*==================================================================================================
 *                                             ENUMS
 ==================================================================================================*/
@@ -314,6 +350,35 @@ typedef enum
 /*==================================================================================================
 *                                STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
+/**
+* @brief          Can_RxAdaptiveStatsType
+* @details        Mode residency of the adaptive Rx FIFO processing of a controller, counted in
+*                 Can_MainFunction_Read periods. Filled by Can_GetRxAdaptiveStats.
+*
+*/
+typedef struct
+    {
+        VAR(uint32, CAN_VAR) u32InterruptPeriods; /**< @brief Periods spent with an interrupt per frame */
+        VAR(uint32, CAN_VAR) u32BatchPeriods;     /**< @brief Periods spent in batch mode */
+        VAR(uint32, CAN_VAR) u32ModeSwitches;     /**< @brief Switches between the two modes */
+        VAR(uint32, CAN_VAR) u32LastFrames;       /**< @brief Frames received during the last period */
+        VAR(boolean, CAN_VAR) bBatchMode;         /**< @brief TRUE when the controller is in batch mode */
+    } Can_RxAdaptiveStatsType;
+
+/**
+* @brief          Can_ControllerStatsType
+* @details        Event counters of a controller since Can_Init. All wrap around. Filled by Can_GetControllerStats.
+*
+*/
+typedef struct
+    {
+        VAR(uint32, CAN_VAR) u32RxFifoFrames;    /**< @brief Frames read from the Rx FIFO, by interrupt or batch drain */
+        VAR(uint32, CAN_VAR) u32RxFifoOverflows; /**< @brief Rx FIFO overflow interrupts */
+        VAR(uint32, CAN_VAR) u32RxFifoWarnings;  /**< @brief Rx FIFO warning (almost full) interrupts */
+        VAR(uint32, CAN_VAR) u32BusOff;          /**< @brief Bus off events handled by interrupt */
+        VAR(uint32, CAN_VAR) u32TxBusy;          /**< @brief Can_Write calls returning CAN_BUSY */
+    } Can_ControllerStatsType;
+
 /**
 * @brief          Configuration of FlexCAN controller.
 * @details        This structure is initialized by Tresos considering user settings.
@@ -816,6 +881,19 @@ extern P2CONST(Can_ControlerDescriptorType, CAN_VAR, CAN_APPL_CONST) Can_pContro
 
 extern P2CONST(CanStatic_ConfigType, CAN_VAR, CAN_APPL_CONST) CanStatic_pCurrentConfig;
 extern P2CONST(CanStatic_ControlerDescriptorType, CAN_VAR, CAN_APPL_CONST) CanStatic_pControlerDescriptors;
+
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+/* Controllers whose Rx FIFO is drained in batches, set by Can_SetRxFifoBatchMode(). */
+extern VAR(boolean, CAN_VAR) Can_abRxFifoBatchMode[CAN_MAXCTRL_CONFIGURED];
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+/* Rx FIFO frames read per controller, in both modes. Wraps around. */
+extern VAR(uint32, CAN_VAR) Can_au32RxFifoFrames[CAN_MAXCTRL_CONFIGURED];
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
+#if (CAN_STATS_API == STD_ON)
+/* Event counters per controller, incremented by the interrupt routines of Can_Flexcan.h and by Can.c. */
+extern VAR(Can_ControllerStatsType, CAN_VAR) Can_aControllerStats[CAN_MAXCTRL_CONFIGURED];
+#endif /* (CAN_STATS_API == STD_ON) */
 #define CAN_STOP_SEC_VAR_INIT_UNSPECIFIED
 /*
 * @violates @ref Can_h_REF_4 Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h
@@ -908,6 +986,12 @@ extern FUNC(Can_ReturnType, CAN_CODE) Can_Write( VAR(Can_HwHandleType, AUTOMATIC
                                                  P2CONST(Can_PduType, AUTOMATIC, CAN_APPL_CONST) PduInfo
                                                );
 
+#if (CAN_UNCHECKED_API == STD_ON)
+extern FUNC(Can_ReturnType, CAN_CODE) Can_Write_Unchecked( VAR(Can_HwHandleType, AUTOMATIC) Hth,
+                                                 P2CONST(Can_PduType, AUTOMATIC, CAN_APPL_CONST) PduInfo
+                                               );
+#endif /* (CAN_UNCHECKED_API == STD_ON) */
+
 extern FUNC (Can_ReturnType, CAN_CODE) Can_CheckWakeup( VAR(uint8, AUTOMATIC) controller);
 
 
@@ -1031,8 +1115,14 @@ extern FUNC(void, CAN_CODE) Can_MainFunction_Read_10( void);
 #endif /* ifdef CAN_MAINFUNCTION_MULTIPLE_READ */
 
 #else /* (CAN_RXPOLL_SUPPORTED == STD_OFF) */
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+
+extern FUNC(void, CAN_CODE) Can_MainFunction_Read( void);
+
+#else
 /* @violates @ref Can_h_REF_1 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined.*/
 #define Can_MainFunction_Read()
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
 
 #endif /* (CAN_RXPOLL_SUPPORTED == STD_OFF) */
 
@@ -1080,6 +1170,27 @@ extern FUNC(Std_ReturnType, CAN_CODE) Can_SetClockMode( VAR(uint8, AUTOMATIC) ca
 
 #endif /* CAN_DUAL_CLOCK_MODE == STD_ON */
 
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+
+extern FUNC(Std_ReturnType, CAN_CODE) Can_SetRxFifoBatchMode( VAR(uint8, AUTOMATIC) Controller, VAR(boolean, AUTOMATIC) Enable);
+
+extern FUNC(void, CAN_CODE) Can_RxFifoBatchDrain( VAR(uint8, AUTOMATIC) Controller);
+
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+
+extern FUNC(Std_ReturnType, CAN_CODE) Can_GetRxAdaptiveStats( VAR(uint8, AUTOMATIC) Controller,
+                                                               P2VAR(Can_RxAdaptiveStatsType, AUTOMATIC, CAN_APPL_DATA) Stats);
+
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
+
+#if (CAN_STATS_API == STD_ON)
+
+extern FUNC(Std_ReturnType, CAN_CODE) Can_GetControllerStats( VAR(uint8, AUTOMATIC) Controller,
+                                                               P2VAR(Can_ControllerStatsType, AUTOMATIC, CAN_APPL_DATA) Stats);
+
+#endif /* (CAN_STATS_API == STD_ON) */
+
 
 #define CAN_STOP_SEC_CODE
 /*
@@ -316,6 +316,49 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
 *                                           MACROS
 =====================================================================================================*/
 /*==================================================================================================*/
+#if (CAN_RXFIFO_ENABLE == STD_ON)
+/**
+* @brief          Rx FIFO drain of a controller in batch mode, started by the FIFO warning interrupt.
+* @details        See Can_SetRxFifoBatchMode(). A frame available flag seen with the frame interrupt masked is
+*                 not discarded in batch mode. The frames read by the interrupt per frame are counted for
+*                 the adaptive mode of Can_MainFunction_Read. All expand to no-ops when CAN_RXFIFO_BATCH_API is STD_OFF.
+*
+*/
+  #if (CAN_RXFIFO_BATCH_API == STD_ON)
+    /* @violates @ref Can_Flexcan_h_REF_6 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+    #define CAN_RXFIFO_BATCH_DRAIN(controller)      (Can_RxFifoBatchDrain(controller))
+    /* @violates @ref Can_Flexcan_h_REF_6 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+    #define CAN_RXFIFO_BATCH_ACTIVE(controller)     (Can_abRxFifoBatchMode[(controller)])
+    #if (CAN_RX_ADAPTIVE_API == STD_ON)
+    /* @violates @ref Can_Flexcan_h_REF_6 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+    #define CAN_RXFIFO_FRAME_COUNT(controller)      (Can_au32RxFifoFrames[(controller)]++)
+    #else
+    /* @violates @ref Can_Flexcan_h_REF_6 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+    #define CAN_RXFIFO_FRAME_COUNT(controller)
+    #endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+  #else
+    /* @violates @ref Can_Flexcan_h_REF_6 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+    #define CAN_RXFIFO_BATCH_DRAIN(controller)
+    /* @violates @ref Can_Flexcan_h_REF_6 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+    #define CAN_RXFIFO_BATCH_ACTIVE(controller)     ((boolean)FALSE)
+    /* @violates @ref Can_Flexcan_h_REF_6 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+    #define CAN_RXFIFO_FRAME_COUNT(controller)
+  #endif /* (CAN_RXFIFO_BATCH_API == STD_ON) */
+#endif /* (CAN_RXFIFO_ENABLE == STD_ON) */
+
+/**
+* @brief          Event counter of Can_GetControllerStats, incremented by the interrupt routines below.
+* @details        Expands to a no-op when CAN_STATS_API is STD_OFF.
+*
+*/
+#if (CAN_STATS_API == STD_ON)
+    /* @violates @ref Can_Flexcan_h_REF_6 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+    #define CAN_STATS_COUNT(controller, counter)    (Can_aControllerStats[(controller)].counter++)
+#else
+    /* @violates @ref Can_Flexcan_h_REF_6 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+    #define CAN_STATS_COUNT(controller, counter)
+#endif /* (CAN_STATS_API == STD_ON) */
+
 /*ISR's for PPC*/
 #if (CAN_MULTIPLE_INTERRUPTS_SUPPORT==STD_ON)  
 
@@ -352,14 +395,20 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                         { \
                             if (FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 == (can_mask & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32)){ \
                                 Can_IPW_RxFifoFrameAvNotif(CAN_FC##FC##_INDEX); \
+                                CAN_RXFIFO_FRAME_COUNT(CAN_FC##FC##_INDEX); \
+                                CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoFrames); \
                             } \
-                            else {\
+                            else if ((boolean)FALSE == CAN_RXFIFO_BATCH_ACTIVE(CAN_FC##FC##_INDEX)) {\
                                 REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32)); \
+                            } \
+                            else { \
+                                /* Left in the FIFO for the batch drain */ \
                           } \
                         } \
                         if (FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32 == (can_status  & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32)) \
                         { \
                             REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32));\
+                            CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoOverflows); \
                             if ((NULL_PTR != Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoOverflowNotification) && (FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32 == (can_mask  & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32))){ \
                                 Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoOverflowNotification(); \
                             } \
@@ -367,6 +416,8 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                         if ( FLEXCAN_FIFO_WARNING_INT_MASK_U32== (can_status & FLEXCAN_FIFO_WARNING_INT_MASK_U32)) \
                         { \
                             REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_WARNING_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32));\
+                            CAN_RXFIFO_BATCH_DRAIN(CAN_FC##FC##_INDEX); \
+                            CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoWarnings); \
                             if ((NULL_PTR != Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoWarningNotification) && (FLEXCAN_FIFO_WARNING_INT_MASK_U32 == (can_mask  & FLEXCAN_FIFO_WARNING_INT_MASK_U32))){ \
                                     Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoWarningNotification(); \
                             } \
@@ -403,14 +454,20 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                         { \
                             if (FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 == (can_mask & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32)){ \
                                 Can_IPW_RxFifoFrameAvNotif(CAN_FC##FC##_INDEX); \
+                                CAN_RXFIFO_FRAME_COUNT(CAN_FC##FC##_INDEX); \
+                                CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoFrames); \
                             } \
-                            else {\
+                            else if ((boolean)FALSE == CAN_RXFIFO_BATCH_ACTIVE(CAN_FC##FC##_INDEX)) {\
                                 REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32));\
+                            } \
+                            else { \
+                                /* Left in the FIFO for the batch drain */ \
                           } \
                         } \
                         if (FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32 == (can_status  & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32)) \
                         { \
                             REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32));\
+                            CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoOverflows); \
                             if ((NULL_PTR != Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoOverflowNotification) && (FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32 == (can_mask  & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32))){ \
                                 Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoOverflowNotification(); \
                             } \
@@ -418,6 +475,8 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                         if ( FLEXCAN_FIFO_WARNING_INT_MASK_U32== (can_status & FLEXCAN_FIFO_WARNING_INT_MASK_U32)) \
                         { \
                             REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_WARNING_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32));\
+                            CAN_RXFIFO_BATCH_DRAIN(CAN_FC##FC##_INDEX); \
+                            CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoWarnings); \
                         if ((NULL_PTR != Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoWarningNotification) && (FLEXCAN_FIFO_WARNING_INT_MASK_U32 == (can_mask  & FLEXCAN_FIFO_WARNING_INT_MASK_U32))){ \
                                     Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoWarningNotification(); \
                             } \
@@ -469,6 +528,7 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                     if (FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32 == (can_status & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32)) \
                     { \
                         REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32)); \
+                        CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoOverflows); \
                         can_mask   = ((uint32)REG_READ32( FLEXCAN_IMASK1(FLEXCAN_##FC##_OFFSET)) & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32); \
                         if ((NULL_PTR != Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoOverflowNotification) && (FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32 == (can_mask & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32))) { \
                             Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoOverflowNotification(); \
@@ -511,6 +571,7 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                     if (FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32 == (can_status & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32)) \
                     { \
                         REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32));\
+                        CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoOverflows); \
                         can_mask   = ((uint32)REG_READ32( FLEXCAN_IMASK1(FLEXCAN_##FC##_OFFSET)) & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32); \
                         if ((NULL_PTR != Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoOverflowNotification) && (FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32 == (can_mask & FLEXCAN_FIFO_OVERFLOW_INT_MASK_U32))) { \
                             Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoOverflowNotification(); \
@@ -564,6 +625,8 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                     if ( FLEXCAN_FIFO_WARNING_INT_MASK_U32== (can_status & FLEXCAN_FIFO_WARNING_INT_MASK_U32)) \
                     { \
                         REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_WARNING_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32));\
+                        CAN_RXFIFO_BATCH_DRAIN(CAN_FC##FC##_INDEX); \
+                        CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoWarnings); \
                         can_mask   = ((uint32)REG_READ32( FLEXCAN_IMASK1(FLEXCAN_##FC##_OFFSET)) & FLEXCAN_FIFO_WARNING_INT_MASK_U32); \
                         if ((NULL_PTR != Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoWarningNotification) && (FLEXCAN_FIFO_WARNING_INT_MASK_U32 == (can_mask  & FLEXCAN_FIFO_WARNING_INT_MASK_U32))){ \
                             Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoWarningNotification(); \
@@ -598,6 +661,8 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                     if ( FLEXCAN_FIFO_WARNING_INT_MASK_U32== (can_status & FLEXCAN_FIFO_WARNING_INT_MASK_U32)) \
                     { \
                         REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_WARNING_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32));\
+                        CAN_RXFIFO_BATCH_DRAIN(CAN_FC##FC##_INDEX); \
+                        CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoWarnings); \
                         can_mask   = ((uint32)REG_READ32( FLEXCAN_IMASK1(FLEXCAN_##FC##_OFFSET)) & FLEXCAN_FIFO_WARNING_INT_MASK_U32); \
                         if ((NULL_PTR != Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoWarningNotification) && (FLEXCAN_FIFO_WARNING_INT_MASK_U32 == (can_mask  & FLEXCAN_FIFO_WARNING_INT_MASK_U32))){ \
                             Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX].Can_RxFifoWarningNotification(); \
@@ -644,11 +709,13 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                 else \
                 { \
                     can_status = ((uint32)REG_READ32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET)) & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32); \
-                    if (FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 == (can_status & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32)) \
+                    if ((FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 == (can_status & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32)) && ((boolean)FALSE == CAN_RXFIFO_BATCH_ACTIVE(CAN_FC##FC##_INDEX))) \
                     { \
                         can_mask = ((uint32)REG_READ32( FLEXCAN_IMASK1(FLEXCAN_##FC##_OFFSET)) & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32); \
                         if (FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 == (can_mask & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32)){ \
                             Can_IPW_RxFifoFrameAvNotif( CAN_FC##FC##_INDEX); \
+                            CAN_RXFIFO_FRAME_COUNT(CAN_FC##FC##_INDEX); \
+                            CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoFrames); \
                         } \
                     else {\
                             REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32));\
@@ -689,11 +756,13 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                 else \
                 { \
                     can_status = ((uint32)REG_READ32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET)) & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32); \
-                    if (FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 == (can_status & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32)) \
+                    if ((FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 == (can_status & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32)) && ((boolean)FALSE == CAN_RXFIFO_BATCH_ACTIVE(CAN_FC##FC##_INDEX))) \
                     { \
                         can_mask = ((uint32)REG_READ32( FLEXCAN_IMASK1(FLEXCAN_##FC##_OFFSET)) & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32); \
                         if (FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 == (can_mask & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32)){ \
                             Can_IPW_RxFifoFrameAvNotif( CAN_FC##FC##_INDEX); \
+                            CAN_RXFIFO_FRAME_COUNT(CAN_FC##FC##_INDEX); \
+                            CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32RxFifoFrames); \
                         } \
                         else {\
                             REG_WRITE32( FLEXCAN_IFLAG1(FLEXCAN_##FC##_OFFSET), (uint32)((can_status & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32) & FLEXCAN_IFLAG1_CONFIG_MASK_U32));\
@@ -906,6 +975,7 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                     /* Process BusOff condition for controller ID of FlexCAN FC */ \
                     if ( CAN_OK == (Can_ReturnType)Can_IPW_SetControllerMode( CAN_FC##FC##_INDEX,  &(Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX]), CAN_T_STOP,(boolean)FALSE) ) \
                     { \
+                        CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32BusOff); \
                         Can_IPW_ProcessBusOff(CAN_FC##FC##_INDEX); \
                         CanIf_ControllerBusOff(CAN_FC##FC##_INDEX); \
                     } \
@@ -964,6 +1034,7 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                     /* Process BusOff condition for controller ID of FlexCAN FC */ \
                     if ( CAN_OK == (Can_ReturnType)Can_IPW_SetControllerMode( CAN_FC##FC##_INDEX,  &(Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX]), CAN_T_STOP,(boolean)FALSE) ) \
                                 { \
+                                CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32BusOff); \
                                 Can_IPW_ProcessBusOff(CAN_FC##FC##_INDEX); \
                                 CanIf_ControllerBusOff(CAN_FC##FC##_INDEX); \
                                 } \
@@ -1075,6 +1146,7 @@ extern CONST(Can_MaskFlag, CAN_CONST) Can_IflagImask[(uint8)((uint8)CAN_MAXMB_SU
                     if ( CAN_OK == (Can_ReturnType)Can_IPW_SetControllerMode( CAN_FC##FC##_INDEX,  &(Can_pCurrentConfig->ControlerDescriptors[CAN_FC##FC##_INDEX]), CAN_T_STOP,(boolean)FALSE) ) \
                     { \
                         /* Process BusOff condition for controller ID of FlexCAN FC */ \
+                        CAN_STATS_COUNT(CAN_FC##FC##_INDEX, u32BusOff); \
                         Can_IPW_ProcessBusOff( CAN_FC##FC##_INDEX); \
                         CanIf_ControllerBusOff(CAN_FC##FC##_INDEX); \
                     } \
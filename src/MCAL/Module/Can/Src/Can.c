@@ -111,6 +111,9 @@ Driver Limitations:
 #if (CAN_DEV_ERROR_DETECT == STD_ON)
 #include "Det.h"
 #endif /* (CAN_DEV_ERROR_DETECT == STD_ON) */
+#if (CAN_STATS_API == STD_ON)
+#include "SchM_Can.h"
+#endif /* (CAN_STATS_API == STD_ON) */
 
 /*==================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
@@ -206,6 +209,28 @@ Driver Limitations:
 /*==================================================================================================
 *                                      LOCAL VARIABLES
 ==================================================================================================*/
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+#define CAN_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/* @violates @ref Can_c_REF_1 Violates MISRA 2004 Advisory Rule 19.1, #include preceded by non preproc directives. */
+/* @violates @ref Can_c_REF_2 Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h */
+#include "MemMap.h"
+
+/* Rx FIFO frame available and warning bits of the interrupt mask before the batch mode was entered */
+static VAR(uint32, CAN_VAR) Can_au32RxFifoBatchImask[CAN_MAXCTRL_CONFIGURED];
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+/* Mode residency of the adaptive Rx FIFO processing, read by Can_GetRxAdaptiveStats() */
+static VAR(Can_RxAdaptiveStatsType, CAN_VAR) Can_aRxAdaptiveStats[CAN_MAXCTRL_CONFIGURED];
+/* Value of Can_au32RxFifoFrames at the previous Can_MainFunction_Read period */
+static VAR(uint32, CAN_VAR) Can_au32RxAdaptiveFrameMark[CAN_MAXCTRL_CONFIGURED];
+/* Controllers whose mode was set by Can_SetRxFifoBatchMode(), left out of the adaptive choice until Can_Init */
+static VAR(boolean, CAN_VAR) Can_abRxAdaptiveManual[CAN_MAXCTRL_CONFIGURED];
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+
+#define CAN_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/* @violates @ref Can_c_REF_1 Violates MISRA 2004 Advisory Rule 19.1, #include preceded by non preproc directives. */
+/* @violates @ref Can_c_REF_2 Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h */
+#include "MemMap.h"
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
 
 
 /*==================================================================================================
@@ -245,6 +270,19 @@ P2CONST(Can_ConfigType, CAN_VAR, CAN_APPL_CONST) Can_pCurrentConfig = NULL_PTR;
 P2CONST(Can_ControlerDescriptorType, CAN_VAR, CAN_APPL_CONST) Can_pControlerDescriptors = NULL_PTR;
 P2CONST(CanStatic_ControlerDescriptorType, CAN_VAR, CAN_APPL_CONST) CanStatic_pControlerDescriptors = NULL_PTR;
 P2CONST(CanStatic_ConfigType, CAN_VAR, CAN_APPL_CONST) CanStatic_pCurrentConfig = NULL_PTR;
+
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+/* Controllers whose Rx FIFO is drained in batches. Read by the Rx FIFO interrupts. */
+VAR(boolean, CAN_VAR) Can_abRxFifoBatchMode[CAN_MAXCTRL_CONFIGURED] = { (boolean)FALSE };
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+/* Rx FIFO frames read per controller, counted by the frame available interrupt and by Can_RxFifoBatchDrain(). */
+VAR(uint32, CAN_VAR) Can_au32RxFifoFrames[CAN_MAXCTRL_CONFIGURED] = { 0U };
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
+#if (CAN_STATS_API == STD_ON)
+/* Event counters per controller, cleared by Can_Init() and read by Can_GetControllerStats(). */
+VAR(Can_ControllerStatsType, CAN_VAR) Can_aControllerStats[CAN_MAXCTRL_CONFIGURED] = { { 0U, 0U, 0U, 0U, 0U } };
+#endif /* (CAN_STATS_API == STD_ON) */
 #define CAN_STOP_SEC_VAR_INIT_UNSPECIFIED
 /*
 * @violates @ref Can_c_REF_1 Violates MISRA 2004 Advisory Rule 19.1, #include preceded by non preproc directives.
@@ -257,6 +295,16 @@ P2CONST(CanStatic_ConfigType, CAN_VAR, CAN_APPL_CONST) CanStatic_pCurrentConfig
 /*==================================================================================================
 *                                   LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+static FUNC(void, CAN_CODE) Can_RxFifoBatchApplyMask( VAR(uint8, AUTOMATIC) Controller);
+static FUNC(void, CAN_CODE) Can_RxFifoBatchSwitch( VAR(uint8, AUTOMATIC) Controller, VAR(boolean, AUTOMATIC) Enable);
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+static FUNC(void, CAN_CODE) Can_RxAdaptiveUpdate( VAR(uint8, AUTOMATIC) Controller);
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
+#if (CAN_STATS_API == STD_ON)
+static FUNC(void, CAN_CODE) Can_StatsTxBusy( VAR(Can_HwHandleType, AUTOMATIC) Hth);
+#endif /* (CAN_STATS_API == STD_ON) */
 
 
 /*==================================================================================================
@@ -270,6 +318,137 @@ P2CONST(CanStatic_ConfigType, CAN_VAR, CAN_APPL_CONST) CanStatic_pCurrentConfig
 
 #include "MemMap.h"
 
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+/*================================================================================================*/
+/**
+* @brief          Batch mode interrupt mask of the Rx FIFO.
+* @details        For a controller in batch mode, removes the frame available interrupt from the
+*                 pre-calculated interrupt mask and adds the FIFO warning interrupt, which starts a
+*                 drain before the FIFO overflows. The mask is written to the hardware by the next
+*                 Can_EnableControllerInterrupts or start of the controller.
+*
+* @param[in]      Controller CAN controller, based on configuration order list (CanControllerId)
+*
+*/
+static FUNC(void, CAN_CODE) Can_RxFifoBatchApplyMask( VAR(uint8, AUTOMATIC) Controller)
+{
+    if ( (boolean)TRUE == Can_abRxFifoBatchMode[Controller] )
+    {
+        Can_ControllerStatuses[Controller].u32MBInterruptMask[0U] = \
+            (Can_ControllerStatuses[Controller].u32MBInterruptMask[0U] & (uint32)(~FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32)) | \
+            FLEXCAN_FIFO_WARNING_INT_MASK_U32;
+    }
+}
+
+/*================================================================================================*/
+/**
+* @brief          Moves the Rx FIFO of a controller between interrupt per frame and batch mode.
+* @details        The frame available and warning bits of the pre-calculated interrupt mask are saved when
+*                 the batch mode is entered and restored when it is left. The mask is changed with the
+*                 controller interrupts held off and written to the hardware when they are enabled again.
+*
+* @param[in]      Controller CAN controller, based on configuration order list (CanControllerId)
+* @param[in]      Enable TRUE for batch mode, FALSE for an interrupt per frame
+*
+*/
+static FUNC(void, CAN_CODE) Can_RxFifoBatchSwitch( VAR(uint8, AUTOMATIC) Controller, VAR(boolean, AUTOMATIC) Enable)
+{
+    Can_IPW_DisableControllerInterrupts( Controller);
+    if ( (boolean)TRUE == Enable )
+    {
+        if ( (boolean)FALSE == Can_abRxFifoBatchMode[Controller] )
+        {
+            Can_au32RxFifoBatchImask[Controller] = Can_ControllerStatuses[Controller].u32MBInterruptMask[0U] & \
+                (FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 | FLEXCAN_FIFO_WARNING_INT_MASK_U32);
+            Can_abRxFifoBatchMode[Controller] = (boolean)TRUE;
+        }
+        Can_RxFifoBatchApplyMask( Controller);
+    }
+    else if ( (boolean)TRUE == Can_abRxFifoBatchMode[Controller] )
+    {
+        Can_abRxFifoBatchMode[Controller] = (boolean)FALSE;
+        Can_ControllerStatuses[Controller].u32MBInterruptMask[0U] = \
+            (Can_ControllerStatuses[Controller].u32MBInterruptMask[0U] & \
+             (uint32)(~(FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 | FLEXCAN_FIFO_WARNING_INT_MASK_U32))) | \
+            Can_au32RxFifoBatchImask[Controller];
+    }
+    else
+    {
+        /* Already an interrupt per frame. */
+    }
+    /* @violates @ref Can_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used  */
+    Can_IPW_EnableControllerInterrupts( Controller, &(Can_pCurrentConfig->ControlerDescriptors[Controller]));
+}
+
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Adaptive choice between interrupt per frame and batch mode for one controller.
+* @details        Counts the Rx FIFO frames read since the previous period. A controller with an interrupt
+*                 per frame goes to batch mode when at least CAN_RX_ADAPTIVE_POLL_THRESHOLD frames arrived,
+*                 a controller in batch mode goes back when at most CAN_RX_ADAPTIVE_IRQ_THRESHOLD arrived.
+*                 The gap between the two thresholds keeps a load near one of them from toggling the mode.
+*                 This routine is called by:
+*                 - Can_MainFunction_Read() from Can.c file.
+*
+* @param[in]      Controller CAN controller, based on configuration order list (CanControllerId)
+*
+*/
+static FUNC(void, CAN_CODE) Can_RxAdaptiveUpdate( VAR(uint8, AUTOMATIC) Controller)
+{
+    VAR(uint32, AUTOMATIC) u32Frames;
+    VAR(uint32, AUTOMATIC) u32Mark = Can_au32RxFifoFrames[Controller];
+
+    u32Frames = u32Mark - Can_au32RxAdaptiveFrameMark[Controller];
+    Can_au32RxAdaptiveFrameMark[Controller] = u32Mark;
+
+    if ( ((boolean)FALSE == Can_abRxFifoBatchMode[Controller]) && (u32Frames >= (uint32)CAN_RX_ADAPTIVE_POLL_THRESHOLD) )
+    {
+        Can_RxFifoBatchSwitch( Controller, (boolean)TRUE);
+        Can_aRxAdaptiveStats[Controller].u32ModeSwitches++;
+    }
+    else if ( ((boolean)TRUE == Can_abRxFifoBatchMode[Controller]) && (u32Frames <= (uint32)CAN_RX_ADAPTIVE_IRQ_THRESHOLD) )
+    {
+        Can_RxFifoBatchSwitch( Controller, (boolean)FALSE);
+        Can_aRxAdaptiveStats[Controller].u32ModeSwitches++;
+    }
+    else
+    {
+        /* The load is inside the hysteresis band, the mode is kept. */
+    }
+
+    if ( (boolean)TRUE == Can_abRxFifoBatchMode[Controller] )
+    {
+        Can_aRxAdaptiveStats[Controller].u32BatchPeriods++;
+    }
+    else
+    {
+        Can_aRxAdaptiveStats[Controller].u32InterruptPeriods++;
+    }
+    Can_aRxAdaptiveStats[Controller].u32LastFrames = u32Frames;
+    Can_aRxAdaptiveStats[Controller].bBatchMode = Can_abRxFifoBatchMode[Controller];
+}
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
+
+#if (CAN_STATS_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Counts a CAN_BUSY return of Can_Write for the controller of a transmit Hth.
+* @details        The increment is done in the exclusive area read by Can_GetControllerStats, as Can_Write
+*                 can be called from several tasks.
+*
+* @param[in]      Hth Configured hardware transmit handle.
+*
+*/
+static FUNC(void, CAN_CODE) Can_StatsTxBusy( VAR(Can_HwHandleType, AUTOMATIC) Hth)
+{
+    SchM_Enter_Can_CAN_EXCLUSIVE_AREA_30();
+    Can_aControllerStats[Can_pCurrentConfig->u8ControllerIdMapping[Hth]].u32TxBusy++;
+    SchM_Exit_Can_CAN_EXCLUSIVE_AREA_30();
+}
+#endif /* (CAN_STATS_API == STD_ON) */
+
 
 /*==================================================================================================
 *                                       GLOBAL FUNCTIONS
@@ -436,6 +615,26 @@ FUNC(void, CAN_CODE) Can_Init( P2CONST(Can_ConfigType, AUTOMATIC, CAN_APPL_CONST
                        (CAN239) The function Can_Init shall initialize all on-chip hardware resources that are used by the CAN controller.
                     */
                     Can_IPW_Init( can_controller);
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+                    /* Every controller starts with an interrupt per received Rx FIFO frame. */
+                    Can_abRxFifoBatchMode[can_controller] = (boolean)FALSE;
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+                    Can_aRxAdaptiveStats[can_controller].u32InterruptPeriods = 0U;
+                    Can_aRxAdaptiveStats[can_controller].u32BatchPeriods = 0U;
+                    Can_aRxAdaptiveStats[can_controller].u32ModeSwitches = 0U;
+                    Can_aRxAdaptiveStats[can_controller].u32LastFrames = 0U;
+                    Can_aRxAdaptiveStats[can_controller].bBatchMode = (boolean)FALSE;
+                    Can_au32RxAdaptiveFrameMark[can_controller] = Can_au32RxFifoFrames[can_controller];
+                    Can_abRxAdaptiveManual[can_controller] = (boolean)FALSE;
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
+#if (CAN_STATS_API == STD_ON)
+                    Can_aControllerStats[can_controller].u32RxFifoFrames = 0U;
+                    Can_aControllerStats[can_controller].u32RxFifoOverflows = 0U;
+                    Can_aControllerStats[can_controller].u32RxFifoWarnings = 0U;
+                    Can_aControllerStats[can_controller].u32BusOff = 0U;
+                    Can_aControllerStats[can_controller].u32TxBusy = 0U;
+#endif /* (CAN_STATS_API == STD_ON) */
 
                     /*
                         (CAN250) The function Can_Init shall initialize: static variables, including flags, Common setting for the
@@ -569,6 +768,10 @@ FUNC(Std_ReturnType, CAN_CODE) Can_ChangeBaudrate( VAR(uint8, AUTOMATIC) Control
                         */
                     /* @violates @ref Can_c_REF_9 Violates MISRA 2004 Required Rule 10.1 , prohibited Implicit Conversion: Non-constant argument to function, Implicit conversion of integer to smaller type */ 
                     eReturnValue = (Std_ReturnType)Can_IPW_ChangeBaudrate(Controller);
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+                    /* Keep the batch mode across the reinitialization of the controller. */
+                    Can_RxFifoBatchApplyMask(Controller);
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
                 }
 #if (CAN_DEV_ERROR_DETECT == STD_ON)
             }
@@ -958,6 +1161,12 @@ FUNC(Can_ReturnType, CAN_CODE) Can_Write( VAR(Can_HwHandleType, AUTOMATIC) Hth,
                             /* Call the IPW function for transmitting data. */
                             /* @violates @ref Can_c_REF_9 Violates MISRA 2004 Required Rule 10.1 , prohibited Implicit Conversion: Non-constant argument to function, Implicit conversion of integer to smaller type */ 
                             eReturnValue = (Can_ReturnType)Can_IPW_Write(Hth,PduInfo);
+#if (CAN_STATS_API == STD_ON)
+                            if ( CAN_BUSY == eReturnValue )
+                            {
+                                Can_StatsTxBusy( Hth);
+                            }
+#endif /* (CAN_STATS_API == STD_ON) */
 
 #if (CAN_DEV_ERROR_DETECT == STD_ON)
             }
@@ -967,6 +1176,252 @@ FUNC(Can_ReturnType, CAN_CODE) Can_Write( VAR(Can_HwHandleType, AUTOMATIC) Hth,
     return (eReturnValue);
 }
 
+/*================================================================================================*/
+#if (CAN_UNCHECKED_API == STD_ON)
+/**
+* @brief          Transmits a message without the development error checks. SID is 0x06.
+* @details        Same as Can_Write for callers which already guarantee an initialized driver, a
+*                 configured transmit Hth and non NULL PduInfo and PduInfo->sdu. No error is
+*                 reported to Det.
+*
+* @param[in]      Hth Information which HW-transmit handle shall be used for transmit.
+* @param[in]      PduInfo Pointer to SDU user memory, DLC and Identifier.
+* @return         Can_ReturnType   Result of the write operation.
+* @retval         CAN_OK   Write command has been accepted.
+* @retval         CAN_BUSY   No of TX hardware buffer available or preemtive call of Can_Write() that can't be implemented reentrant.
+*
+* @pre            Driver must be initialized and MB must be configured for Tx.
+*
+* @violates @ref Can_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Can_ReturnType, CAN_CODE) Can_Write_Unchecked( VAR(Can_HwHandleType, AUTOMATIC) Hth,
+                                          P2CONST(Can_PduType, AUTOMATIC, CAN_APPL_CONST) PduInfo 
+                                        )
+{
+    VAR(Can_ReturnType, AUTOMATIC)  eReturnValue;
+
+    /* @violates @ref Can_c_REF_9 Violates MISRA 2004 Required Rule 10.1 , prohibited Implicit Conversion: Non-constant argument to function, Implicit conversion of integer to smaller type */ 
+    eReturnValue = (Can_ReturnType)Can_IPW_Write(Hth,PduInfo);
+#if (CAN_STATS_API == STD_ON)
+    if ( CAN_BUSY == eReturnValue )
+    {
+        Can_StatsTxBusy( Hth);
+    }
+#endif /* (CAN_STATS_API == STD_ON) */
+    return (eReturnValue);
+}
+#endif /* (CAN_UNCHECKED_API == STD_ON) */
+
+/*================================================================================================*/
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+/**
+* @brief          Switches the Rx FIFO of a controller between interrupt per frame and batch mode. SID is 0x11.
+* @details        In batch mode the frame available interrupt is masked: the FIFO is drained by up to
+*                 CAN_RXFIFO_BATCH_BUDGET frames from Can_MainFunction_Read and from the FIFO warning interrupt,
+*                 raised when the FIFO is almost full. The receive indications are the same as in interrupt
+*                 mode, only grouped. The mode is kept across Can_ChangeBaudrate and Can_SetBaudrate and is
+*                 cleared by Can_Init. With CAN_RX_ADAPTIVE_API the controller is no longer switched by
+*                 Can_MainFunction_Read until the next Can_Init.
+*                 This routine is called by:
+*                 - CanIf or an upper layer.
+*
+* @param[in]      Controller CAN controller, based on configuration order list (CanControllerId).
+* @param[in]      Enable TRUE for batch mode, FALSE for an interrupt per frame.
+* @return         Std_ReturnType
+* @retval         E_OK the mode is set.
+* @retval         E_NOT_OK the controller does not use the Rx FIFO.
+*
+* @pre            Driver must be initialized. Can_MainFunction_Read must be scheduled while a controller is in batch mode.
+*
+* @violates @ref Can_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Std_ReturnType, CAN_CODE) Can_SetRxFifoBatchMode( VAR(uint8, AUTOMATIC) Controller, VAR(boolean, AUTOMATIC) Enable)
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturnValue = (uint8)E_NOT_OK;
+
+#if (CAN_DEV_ERROR_DETECT == STD_ON)
+    if ( CAN_UNINIT == Can_eDriverStatus )
+    {
+        (void)Det_ReportError( (uint16)CAN_MODULE_ID, (uint8)CAN_INSTANCE, (uint8)CAN_SID_SET_RXFIFO_BATCH_MODE, (uint8)CAN_E_UNINIT);
+    }
+    else if ( (Controller >= (uint8)CanStatic_pCurrentConfig->u8ControllersConfigured) ||
+              /* @violates @ref Can_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+              (CAN_NULL_OFFSET == (CanStatic_pControlerDescriptors[Controller].u8ControllerOffset))
+            )
+    {
+        (void)Det_ReportError( (uint16)CAN_MODULE_ID, (uint8)CAN_INSTANCE, (uint8)CAN_SID_SET_RXFIFO_BATCH_MODE, (uint8)CAN_E_PARAM_CONTROLLER);
+    }
+    else
+    {
+#endif /* (CAN_DEV_ERROR_DETECT == STD_ON) */
+        /* @violates @ref Can_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+        if ( CAN_CONTROLLERCONFIG_RXFIFO_U32 == (CAN_CONTROLLERCONFIG_RXFIFO_U32 & CanStatic_pControlerDescriptors[Controller].u32Options) )
+        {
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+            Can_abRxAdaptiveManual[Controller] = (boolean)TRUE;
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+            Can_RxFifoBatchSwitch( Controller, Enable);
+            eReturnValue = (uint8)E_OK;
+        }
+#if (CAN_DEV_ERROR_DETECT == STD_ON)
+        else
+        {
+            (void)Det_ReportError( (uint16)CAN_MODULE_ID, (uint8)CAN_INSTANCE, (uint8)CAN_SID_SET_RXFIFO_BATCH_MODE, (uint8)CAN_E_PARAM_CONTROLLER);
+        }
+    }
+#endif /* (CAN_DEV_ERROR_DETECT == STD_ON) */
+    return (eReturnValue);
+}
+
+/*================================================================================================*/
+/**
+* @brief          Reads up to CAN_RXFIFO_BATCH_BUDGET frames from the Rx FIFO of a controller in batch mode.
+* @details        Every frame is processed as by the frame available interrupt. Does nothing for a controller
+*                 which is not in batch mode or not started.
+*                 This routine is called by:
+*                 - Can_MainFunction_Read() with the controller interrupts disabled.
+*                 - The Rx FIFO warning interrupt.
+*
+* @param[in]      Controller CAN controller, based on configuration order list (CanControllerId).
+*
+* @violates @ref Can_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+*/
+FUNC(void, CAN_CODE) Can_RxFifoBatchDrain( VAR(uint8, AUTOMATIC) Controller)
+{
+    VAR(uint8, AUTOMATIC) u8Budget = (uint8)CAN_RXFIFO_BATCH_BUDGET;
+    VAR(uint8, AUTOMATIC) u8HwOffset;
+
+    if ( ((boolean)TRUE == Can_abRxFifoBatchMode[Controller]) && (CAN_STARTED == Can_ControllerStatuses[Controller].ControllerState) )
+    {
+        /* @violates @ref Can_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+        u8HwOffset = CanStatic_pControlerDescriptors[Controller].u8ControllerOffset;
+        while ( (0U < u8Budget) && \
+                (FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32 == ((uint32)REG_READ32( FLEXCAN_IFLAG1(u8HwOffset)) & FLEXCAN_FIFO_AVAILABLE_INT_MASK_U32)) )
+        {
+            Can_IPW_RxFifoFrameAvNotif( Controller);
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+            Can_au32RxFifoFrames[Controller]++;
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+#if (CAN_STATS_API == STD_ON)
+            Can_aControllerStats[Controller].u32RxFifoFrames++;
+#endif /* (CAN_STATS_API == STD_ON) */
+            u8Budget--;
+        }
+    }
+}
+
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Mode residency of the adaptive Rx FIFO processing of a controller. SID is 0x12.
+* @details        Copies the counters kept by Can_MainFunction_Read since Can_Init. A controller is only
+*                 counted while it is started, receives through the Rx FIFO in interrupt mode and has not been
+*                 given a mode by Can_SetRxFifoBatchMode.
+*                 This routine is called by:
+*                 - CanIf or an upper layer.
+*
+* @param[in]      Controller CAN controller, based on configuration order list (CanControllerId).
+* @param[out]     Stats Counters of the controller.
+* @return         Std_ReturnType
+* @retval         E_OK the counters are copied.
+* @retval         E_NOT_OK development error.
+*
+* @pre            Driver must be initialized.
+*
+* @violates @ref Can_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Std_ReturnType, CAN_CODE) Can_GetRxAdaptiveStats( VAR(uint8, AUTOMATIC) Controller,
+                                                       P2VAR(Can_RxAdaptiveStatsType, AUTOMATIC, CAN_APPL_DATA) Stats)
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturnValue = (uint8)E_NOT_OK;
+
+#if (CAN_DEV_ERROR_DETECT == STD_ON)
+    if ( CAN_UNINIT == Can_eDriverStatus )
+    {
+        (void)Det_ReportError( (uint16)CAN_MODULE_ID, (uint8)CAN_INSTANCE, (uint8)CAN_SID_GET_RX_ADAPTIVE_STATS, (uint8)CAN_E_UNINIT);
+    }
+    else if ( (Controller >= (uint8)CanStatic_pCurrentConfig->u8ControllersConfigured) ||
+              /* @violates @ref Can_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+              (CAN_NULL_OFFSET == (CanStatic_pControlerDescriptors[Controller].u8ControllerOffset))
+            )
+    {
+        (void)Det_ReportError( (uint16)CAN_MODULE_ID, (uint8)CAN_INSTANCE, (uint8)CAN_SID_GET_RX_ADAPTIVE_STATS, (uint8)CAN_E_PARAM_CONTROLLER);
+    }
+    else if ( NULL_PTR == Stats )
+    {
+        (void)Det_ReportError( (uint16)CAN_MODULE_ID, (uint8)CAN_INSTANCE, (uint8)CAN_SID_GET_RX_ADAPTIVE_STATS, (uint8)CAN_E_PARAM_POINTER);
+    }
+    else
+    {
+#endif /* (CAN_DEV_ERROR_DETECT == STD_ON) */
+        *Stats = Can_aRxAdaptiveStats[Controller];
+        eReturnValue = (uint8)E_OK;
+#if (CAN_DEV_ERROR_DETECT == STD_ON)
+    }
+#endif /* (CAN_DEV_ERROR_DETECT == STD_ON) */
+    return (eReturnValue);
+}
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
+
+#if (CAN_STATS_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Event counters of a controller. SID is 0x13.
+* @details        Copies the counters kept since Can_Init in one exclusive area, so the interrupt routines
+*                 of Can_Flexcan.h and Can_Write cannot update them during the copy.
+*                 This routine is called by:
+*                 - CanIf or an upper layer.
+*
+* @param[in]      Controller CAN controller, based on configuration order list (CanControllerId).
+* @param[out]     Stats Counters of the controller.
+* @return         Std_ReturnType
+* @retval         E_OK the counters are copied.
+* @retval         E_NOT_OK development error.
+*
+* @pre            Driver must be initialized.
+*
+* @violates @ref Can_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Std_ReturnType, CAN_CODE) Can_GetControllerStats( VAR(uint8, AUTOMATIC) Controller,
+                                                       P2VAR(Can_ControllerStatsType, AUTOMATIC, CAN_APPL_DATA) Stats)
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturnValue = (uint8)E_NOT_OK;
+
+#if (CAN_DEV_ERROR_DETECT == STD_ON)
+    if ( CAN_UNINIT == Can_eDriverStatus )
+    {
+        (void)Det_ReportError( (uint16)CAN_MODULE_ID, (uint8)CAN_INSTANCE, (uint8)CAN_SID_GET_CONTROLLER_STATS, (uint8)CAN_E_UNINIT);
+    }
+    else if ( (Controller >= (uint8)CanStatic_pCurrentConfig->u8ControllersConfigured) ||
+              /* @violates @ref Can_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+              (CAN_NULL_OFFSET == (CanStatic_pControlerDescriptors[Controller].u8ControllerOffset))
+            )
+    {
+        (void)Det_ReportError( (uint16)CAN_MODULE_ID, (uint8)CAN_INSTANCE, (uint8)CAN_SID_GET_CONTROLLER_STATS, (uint8)CAN_E_PARAM_CONTROLLER);
+    }
+    else if ( NULL_PTR == Stats )
+    {
+        (void)Det_ReportError( (uint16)CAN_MODULE_ID, (uint8)CAN_INSTANCE, (uint8)CAN_SID_GET_CONTROLLER_STATS, (uint8)CAN_E_PARAM_POINTER);
+    }
+    else
+    {
+#endif /* (CAN_DEV_ERROR_DETECT == STD_ON) */
+        SchM_Enter_Can_CAN_EXCLUSIVE_AREA_30();
+        *Stats = Can_aControllerStats[Controller];
+        SchM_Exit_Can_CAN_EXCLUSIVE_AREA_30();
+        eReturnValue = (uint8)E_OK;
+#if (CAN_DEV_ERROR_DETECT == STD_ON)
+    }
+#endif /* (CAN_DEV_ERROR_DETECT == STD_ON) */
+    return (eReturnValue);
+}
+#endif /* (CAN_STATS_API == STD_ON) */
+
 /*================================================================================================*/
 /*================================================================================================*/
 
@@ -1456,11 +1911,14 @@ FUNC(void, CAN_CODE) Can_MainFunction_Write_10( void)
 
 /*================================================================================================*/
 
-#if (CAN_RXPOLL_SUPPORTED  == STD_ON)
+#if ((CAN_RXPOLL_SUPPORTED  == STD_ON) || ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)))
    
 /**
 * @brief          Function called at fixed cyclic time.  SID is 0x08.
 * @details        Service for performs the polling of RX indications when CAN_RX_PROCESSING is set to POLLING.
+*                 It also drains the Rx FIFO of the controllers in batch mode, see Can_SetRxFifoBatchMode(),
+*                 and with CAN_RX_ADAPTIVE_API chooses the mode of every started Rx FIFO controller from the
+*                 frames received since the previous call.
 *                 This routine is called by:
 *                 - CanIf or an upper layer according to Autosar requirements.
 *
@@ -1474,6 +1932,10 @@ FUNC(void, CAN_CODE) Can_MainFunction_Write_10( void)
  /* @violates @ref Can_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static */
 FUNC(void, CAN_CODE) Can_MainFunction_Read( void)
 {
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+    VAR(uint8, AUTOMATIC) can_controller = 0U;
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
+
 #if (CAN_DEV_ERROR_DETECT == STD_ON)
     /* Test whether the driver is already initialised. */
     if ( CAN_UNINIT == Can_eDriverStatus )
@@ -1488,12 +1950,41 @@ FUNC(void, CAN_CODE) Can_MainFunction_Read( void)
     else
     {
 #endif /* (CAN_DEV_ERROR_DETECT == STD_ON) */    
+#if (CAN_RXPOLL_SUPPORTED  == STD_ON)
         /* Poll all controllers for Rx MB statuses. */
         Can_IPW_MainFunctionRead();
+#endif /* (CAN_RXPOLL_SUPPORTED == STD_ON) */
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+        /* Drain the Rx FIFO of the controllers in batch mode, with the FIFO warning interrupt held off. */
+        for ( can_controller = 0U; can_controller < (uint8)CanStatic_pCurrentConfig->u8ControllersConfigured; can_controller++)
+        {
+            if ( (boolean)TRUE == Can_abRxFifoBatchMode[can_controller] )
+            {
+                Can_IPW_DisableControllerInterrupts( can_controller);
+                Can_RxFifoBatchDrain( can_controller);
+                /* @violates @ref Can_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used  */
+                Can_IPW_EnableControllerInterrupts( can_controller, &(Can_pCurrentConfig->ControlerDescriptors[can_controller]));
+            }
+#if (CAN_RX_ADAPTIVE_API == STD_ON)
+            /* Controllers polling their Rx FIFO by configuration or set by Can_SetRxFifoBatchMode are left alone. */
+            /* @violates @ref Can_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+            if ( (CAN_STARTED == Can_ControllerStatuses[can_controller].ControllerState) && \
+                 ((boolean)FALSE == Can_abRxAdaptiveManual[can_controller]) && \
+                 (CAN_CONTROLLERCONFIG_RXFIFO_U32 == (CanStatic_pControlerDescriptors[can_controller].u32Options & \
+                    (CAN_CONTROLLERCONFIG_RXFIFO_U32 | CAN_CONTROLLERCONFIG_RXPOL_EN_U32))) )
+            {
+                Can_RxAdaptiveUpdate( can_controller);
+            }
+#endif /* (CAN_RX_ADAPTIVE_API == STD_ON) */
+        }
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
 #if (CAN_DEV_ERROR_DETECT == STD_ON)
     }
 #endif /* (CAN_DEV_ERROR_DETECT == STD_ON) */    
 }
+#endif /* ((CAN_RXPOLL_SUPPORTED == STD_ON) || ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))) */
+
+#if (CAN_RXPOLL_SUPPORTED  == STD_ON)
 
 #ifdef CAN_MAINFUNCTION_MULTIPLE_READ
 #if (CAN_MAINFUNCTION_MULTIPLE_READ == STD_ON)
@@ -2380,6 +2871,10 @@ FUNC(Std_ReturnType, CAN_CODE) Can_SetBaudrate( VAR(uint8, AUTOMATIC) Controller
                       (CAN255) The function Can_ChangeBaudrate shall only affect register areas that contain specific configuration for a single CAN controller.
                     */
                     eReturnValue = (Std_ReturnType)Can_IPW_ChangeBaudrate(Controller);
+#if ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON))
+                    /* Keep the batch mode across the reinitialization of the controller. */
+                    Can_RxFifoBatchApplyMask(Controller);
+#endif /* ((CAN_RXFIFO_ENABLE == STD_ON) && (CAN_RXFIFO_BATCH_API == STD_ON)) */
                 }
 #if (CAN_DEV_ERROR_DETECT == STD_ON)
             }
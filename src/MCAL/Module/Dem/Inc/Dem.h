@@ -100,6 +100,8 @@ extern "C"{
 /*==================================================================================================
 *                                       DEFINES AND MACROS
 ==================================================================================================*/
+#define DEM_SID_SETEVENTSTATUS        0x04U   /**< @brief Service ID of Dem_SetEventStatus */
+#define DEM_SID_REPORTERRORSTATUS     0x0FU   /**< @brief Service ID of Dem_ReportErrorStatus */
 
 /*==================================================================================================
 *                                             ENUMS
@@ -40,6 +40,7 @@ extern "C"{
 ==================================================================================================*/
 #include "Std_Types.h"
 #include "Dem.h"
+#include "Det.h"
 
 /*==================================================================================================
 *                                        LOCAL MACROS
@@ -142,6 +143,9 @@ FUNC(void, DEM_CODE) Dem_ReportErrorStatus(VAR(Dem_EventIdType, AUTOMATIC) Event
         Dem_EventId = EventId;
         Dem_EventStatus = EventStatus;
         Dem_numEventErrors++;
+#if (DET_TRACE_API == STD_ON)
+        Det_TraceRecord((uint16)DEM_MODULE_ID, EventId, 0U, DEM_SID_REPORTERRORSTATUS, EventStatus);
+#endif /* (DET_TRACE_API == STD_ON) */
 }
 
 /*================================================================================================*/
@@ -159,6 +163,9 @@ FUNC(Std_ReturnType, DEM_CODE) Dem_SetEventStatus(VAR(Dem_EventIdType, AUTOMATIC
 {
     Dem_EventId2 = EventId;
     Dem_EventStatus2 = EventStatus;
+#if (DET_TRACE_API == STD_ON)
+    Det_TraceRecord((uint16)DEM_MODULE_ID, EventId, 0U, DEM_SID_SETEVENTSTATUS, EventStatus);
+#endif /* (DET_TRACE_API == STD_ON) */
     return(E_OK);
 }
 
@@ -70,6 +70,18 @@ extern "C"{
 /*==================================================================================================
 *                                       DEFINES AND MACROS
 ==================================================================================================*/
+/** @brief Det_ReportError and Dem events are also recorded into a per core trace ring,
+*          requires GPT_STM_TIMEBASE_API */
+#define DET_TRACE_API               (STD_OFF)
+
+#if (DET_TRACE_API == STD_ON)
+/** @brief Entries of each trace ring, power of two */
+#define DET_TRACE_SIZE              (32U)
+/** @brief Number of cores owning a trace ring, indexed by the PIR register */
+#define DET_TRACE_CORE_NUM          (3U)
+/** @brief Module IDs below this value get an event counter */
+#define DET_TRACE_MODULE_NUM        (256U)
+#endif /* (DET_TRACE_API == STD_ON) */
 
 /*==================================================================================================
 *                                             ENUMS
@@ -78,6 +90,22 @@ extern "C"{
 /*==================================================================================================
 *                                 STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
+#if (DET_TRACE_API == STD_ON)
+/**
+* @brief   Entry of the trace ring
+* @details Entries from Dem carry DEM_MODULE_ID, the event ID, the Dem service ID as ApiId
+*          and the event status as ErrorId.
+*/
+typedef struct
+{
+    VAR(uint32, DET_VAR) Timestamp;   /**< @brief Lower word of the STM time base */
+    VAR(uint16, DET_VAR) ModuleId;    /**< @brief Reporting module */
+    VAR(uint16, DET_VAR) EventId;     /**< @brief Dem event ID, 0 for Det errors */
+    VAR(uint8, DET_VAR) InstanceId;   /**< @brief Instance of the reporting module */
+    VAR(uint8, DET_VAR) ApiId;        /**< @brief Service reporting the error */
+    VAR(uint8, DET_VAR) ErrorId;      /**< @brief Error or event status */
+} Det_TraceEntryType;
+#endif /* (DET_TRACE_API == STD_ON) */
 
 
 /*==================================================================================================
@@ -98,6 +126,12 @@ FUNC(void, DET_CODE) Det_Init(void);
 FUNC(Std_ReturnType, DET_CODE) Det_ReportError(VAR(uint16, AUTOMATIC) ModuleId, VAR(uint8, AUTOMATIC) InstanceId, VAR(uint8, AUTOMATIC) ApiId, VAR(uint8, AUTOMATIC) ErrorId);
 FUNC(void, DET_CODE) Det_Start(void);
 
+#if (DET_TRACE_API == STD_ON)
+FUNC(void, DET_CODE) Det_TraceRecord(VAR(uint16, AUTOMATIC) ModuleId, VAR(uint16, AUTOMATIC) EventId, VAR(uint8, AUTOMATIC) InstanceId, VAR(uint8, AUTOMATIC) ApiId, VAR(uint8, AUTOMATIC) ErrorId);
+FUNC(uint8, DET_CODE) Det_TraceDrain(P2VAR(Det_TraceEntryType, AUTOMATIC, DET_APPL_DATA) EntriesPtr, VAR(uint8, AUTOMATIC) MaxEntries, P2VAR(uint32, AUTOMATIC, DET_APPL_DATA) LostPtr);
+FUNC(uint32, DET_CODE) Det_TraceGetModuleCount(VAR(uint16, AUTOMATIC) ModuleId);
+#endif /* (DET_TRACE_API == STD_ON) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,7 +43,11 @@ extern "C"{
 * @requirements   DET004
 */
 #include "Std_Types.h"
+#include "Mcal.h"
 #include "Det.h"
+#if (DET_TRACE_API == STD_ON)
+#include "Gpt.h"
+#endif /* (DET_TRACE_API == STD_ON) */
 
 /*==================================================================================================
 *                                        LOCAL MACROS
@@ -84,6 +88,16 @@ extern "C"{
         #error "AutoSar Version Numbers of Det.c and Std_Types.h are different"
     #endif
 #endif
+#if (DET_TRACE_API == STD_ON)
+/* The trace timestamps are read from the STM time base shared by all cores */
+#if (GPT_STM_TIMEBASE_API == STD_OFF)
+    #error "DET_TRACE_API requires GPT_STM_TIMEBASE_API to be STD_ON"
+#endif
+/* EE bit of the MSR register */
+#define DET_MSR_EE_U32              ((uint32)0x00008000UL)
+/* Index mask of a trace ring */
+#define DET_TRACE_MASK_U32          ((uint32)DET_TRACE_SIZE - 1UL)
+#endif /* (DET_TRACE_API == STD_ON) */
 /*==================================================================================================
 *                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
@@ -96,6 +110,18 @@ extern "C"{
 /*==================================================================================================
 *                                       LOCAL VARIABLES
 ==================================================================================================*/
+#if (DET_TRACE_API == STD_ON)
+/* Trace rings, each core only writes and drains its own one */
+static VAR(Det_TraceEntryType, DET_VAR) Det_aTraceRing[DET_TRACE_CORE_NUM][DET_TRACE_SIZE];
+/* Number of entries written into each ring */
+static VAR(uint32, DET_VAR) Det_au32TraceHead[DET_TRACE_CORE_NUM];
+/* Number of entries drained from or overwritten in each ring */
+static VAR(uint32, DET_VAR) Det_au32TraceTail[DET_TRACE_CORE_NUM];
+/* Entries overwritten before being drained since the last drain */
+static VAR(uint32, DET_VAR) Det_au32TraceLost[DET_TRACE_CORE_NUM];
+/* Events per reporting module, saturating */
+static VAR(uint16, DET_VAR) Det_au16TraceModuleCount[DET_TRACE_CORE_NUM][DET_TRACE_MODULE_NUM];
+#endif /* (DET_TRACE_API == STD_ON) */
 
 
 /*==================================================================================================
@@ -119,12 +145,51 @@ VAR(uint16, DET_VAR) Det_ModuleId;       /**< @brief DET module ID*/
 /*==================================================================================================
 *                                   LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
+#if (DET_TRACE_API == STD_ON)
+#if !(defined(_GREENHILLS_C_MPC5777C_) || defined(_DIABDATA_C_MPC5777C_) || defined(_CODEWARRIOR_C_MPC5777C_))
+static FUNC(uint32, DET_CODE) Det_ReadPir(void);
+static FUNC(uint32, DET_CODE) Det_ReadMsr(void);
+#endif
+#endif /* (DET_TRACE_API == STD_ON) */
 
 
 /*==================================================================================================
 *                                       LOCAL FUNCTIONS
 ==================================================================================================*/
 /* put all DET code into defined section */
+#if (DET_TRACE_API == STD_ON)
+#if (defined(_GREENHILLS_C_MPC5777C_) || defined(_DIABDATA_C_MPC5777C_) || defined(_CODEWARRIOR_C_MPC5777C_))
+/**
+* @brief   Returns the processor ID of the calling core (PIR, SPR 286).
+*/
+ASM_KEYWORD FUNC(uint32, DET_CODE) Det_ReadPir(void)
+{
+    mfspr r3, 286
+}
+
+/**
+* @brief   Returns the machine state register of the calling core.
+*/
+ASM_KEYWORD FUNC(uint32, DET_CODE) Det_ReadMsr(void)
+{
+    mfmsr r3
+}
+#else
+static FUNC(uint32, DET_CODE) Det_ReadPir(void)
+{
+    uint32 result;
+    __asm volatile("mfspr %0, 286" : "=r" (result) :);
+    return result;
+}
+
+static FUNC(uint32, DET_CODE) Det_ReadMsr(void)
+{
+    uint32 result;
+    __asm volatile("mfmsr %0" : "=r" (result) :);
+    return result;
+}
+#endif /* GHS || DIAB || CW */
+#endif /* (DET_TRACE_API == STD_ON) */
 
 /*==================================================================================================
 *                                       GLOBAL FUNCTIONS
@@ -160,6 +225,9 @@ FUNC(Std_ReturnType, DET_CODE) Det_ReportError(VAR(uint16, AUTOMATIC) ModuleId,
     Det_InstanceId = InstanceId;
     Det_ApiId = ApiId; 
     Det_ErrorId = ErrorId;
+#if (DET_TRACE_API == STD_ON)
+    Det_TraceRecord(ModuleId, 0U, InstanceId, ApiId, ErrorId);
+#endif /* (DET_TRACE_API == STD_ON) */
     
     return E_OK;
 }
@@ -177,6 +245,146 @@ FUNC(void, DET_CODE) Det_Start(void)
     
 }
 
+#if (DET_TRACE_API == STD_ON)
+/*================================================================================================*/
+/** 
+* @brief   This function records an event into the trace ring of the calling core.
+* @details The ring keeps the latest DET_TRACE_SIZE events, older ones are overwritten and
+*          counted as lost. Interrupts of the calling core are masked for the few stores of the
+*          entry only, cores never share a ring so no lock or retry loop is needed. The call
+*          is safe from any interrupt level. The timestamp is the lower word of the STM time
+*          base (Gpt_GetTimestamp), taken once interrupts are masked so that the entries of a
+*          ring are in timestamp order, and comparable between cores.
+*    
+* @param[in]     ModuleId    Module ID of the reporting module
+* @param[in]     EventId     Dem event ID, 0 for development errors
+* @param[in]     InstanceId  Index of Module starting at 0
+* @param[in]     ApiId       ID of API with Error
+* @param[in]     ErrorId     ID of Error or event status
+*/
+FUNC(void, DET_CODE) Det_TraceRecord(VAR(uint16, AUTOMATIC) ModuleId, VAR(uint16, AUTOMATIC) EventId, VAR(uint8, AUTOMATIC) InstanceId, VAR(uint8, AUTOMATIC) ApiId, VAR(uint8, AUTOMATIC) ErrorId)
+{
+    VAR(uint32, AUTOMATIC) u32Core = Det_ReadPir();
+    VAR(uint32, AUTOMATIC) u32Msr;
+    P2VAR(Det_TraceEntryType, AUTOMATIC, DET_VAR) pEntry;
+
+    if (u32Core < DET_TRACE_CORE_NUM)
+    {
+        u32Msr = Det_ReadMsr();
+        if (0UL != (u32Msr & DET_MSR_EE_U32))
+        {
+            SuspendAllInterrupts();
+        }
+        pEntry = &Det_aTraceRing[u32Core][Det_au32TraceHead[u32Core] & DET_TRACE_MASK_U32];
+        pEntry->Timestamp = (uint32)Gpt_GetTimestamp();
+        pEntry->ModuleId = ModuleId;
+        pEntry->EventId = EventId;
+        pEntry->InstanceId = InstanceId;
+        pEntry->ApiId = ApiId;
+        pEntry->ErrorId = ErrorId;
+        Det_au32TraceHead[u32Core]++;
+        if ((Det_au32TraceHead[u32Core] - Det_au32TraceTail[u32Core]) > DET_TRACE_SIZE)
+        {
+            /* The oldest entry has just been overwritten */
+            Det_au32TraceTail[u32Core]++;
+            Det_au32TraceLost[u32Core]++;
+        }
+        if ((ModuleId < DET_TRACE_MODULE_NUM) && (0xFFFFU != Det_au16TraceModuleCount[u32Core][ModuleId]))
+        {
+            Det_au16TraceModuleCount[u32Core][ModuleId]++;
+        }
+        if (0UL != (u32Msr & DET_MSR_EE_U32))
+        {
+            ResumeAllInterrupts();
+        }
+    }
+}
+
+/*================================================================================================*/
+/** 
+* @brief   This function moves the recorded events of the calling core to the application.
+* @details Entries are returned oldest first and removed from the ring. Each core drains its
+*          own ring, so the function shall be called from a task of every core of interest.
+*    
+* @param[out]    EntriesPtr  Filled with the drained entries
+* @param[in]     MaxEntries  Capacity of EntriesPtr
+* @param[out]    LostPtr     Filled with the number of entries overwritten since the previous
+*                            drain, may be NULL_PTR
+* @return        uint8       Number of entries written into EntriesPtr
+*/
+FUNC(uint8, DET_CODE) Det_TraceDrain(P2VAR(Det_TraceEntryType, AUTOMATIC, DET_APPL_DATA) EntriesPtr, VAR(uint8, AUTOMATIC) MaxEntries, P2VAR(uint32, AUTOMATIC, DET_APPL_DATA) LostPtr)
+{
+    VAR(uint32, AUTOMATIC) u32Core = Det_ReadPir();
+    VAR(uint32, AUTOMATIC) u32Msr;
+    VAR(uint8, AUTOMATIC) u8Count = 0U;
+    VAR(boolean, AUTOMATIC) bEmpty = (boolean)FALSE;
+
+    if ((u32Core < DET_TRACE_CORE_NUM) && (NULL_PTR != EntriesPtr))
+    {
+        u32Msr = Det_ReadMsr();
+        while ((u8Count < MaxEntries) && ((boolean)FALSE == bEmpty))
+        {
+            /* Mask per entry only, an interrupt may overwrite the tail meanwhile */
+            if (0UL != (u32Msr & DET_MSR_EE_U32))
+            {
+                SuspendAllInterrupts();
+            }
+            if (Det_au32TraceTail[u32Core] != Det_au32TraceHead[u32Core])
+            {
+                EntriesPtr[u8Count] = Det_aTraceRing[u32Core][Det_au32TraceTail[u32Core] & DET_TRACE_MASK_U32];
+                Det_au32TraceTail[u32Core]++;
+                u8Count++;
+            }
+            else
+            {
+                bEmpty = (boolean)TRUE;
+            }
+            if (0UL != (u32Msr & DET_MSR_EE_U32))
+            {
+                ResumeAllInterrupts();
+            }
+        }
+        if (NULL_PTR != LostPtr)
+        {
+            if (0UL != (u32Msr & DET_MSR_EE_U32))
+            {
+                SuspendAllInterrupts();
+            }
+            *LostPtr = Det_au32TraceLost[u32Core];
+            Det_au32TraceLost[u32Core] = 0UL;
+            if (0UL != (u32Msr & DET_MSR_EE_U32))
+            {
+                ResumeAllInterrupts();
+            }
+        }
+    }
+    return u8Count;
+}
+
+/*================================================================================================*/
+/** 
+* @brief   This function returns the number of events recorded for a module on all cores.
+* @details The per core counters saturate at 0xFFFF and are never cleared by a drain.
+*    
+* @param[in]     ModuleId    Module ID of the reporting module
+* @return        uint32      Number of recorded events, 0 for IDs from DET_TRACE_MODULE_NUM on
+*/
+FUNC(uint32, DET_CODE) Det_TraceGetModuleCount(VAR(uint16, AUTOMATIC) ModuleId)
+{
+    VAR(uint32, AUTOMATIC) u32Count = 0UL;
+    VAR(uint32, AUTOMATIC) u32Core;
+
+    if (ModuleId < DET_TRACE_MODULE_NUM)
+    {
+        for (u32Core = 0UL; u32Core < DET_TRACE_CORE_NUM; u32Core++)
+        {
+            u32Count += (uint32)Det_au16TraceModuleCount[u32Core][ModuleId];
+        }
+    }
+    return u32Count;
+}
+#endif /* (DET_TRACE_API == STD_ON) */
+
 
 #ifdef __cplusplus
 }
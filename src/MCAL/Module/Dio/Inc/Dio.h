@@ -284,6 +284,14 @@ extern "C"{
 /*=================================================================================================
 *                                      DEFINES AND MACROS
 =================================================================================================*/
+/**
+* @brief          Enables Dio_WriteChannel_Unchecked.
+* @details        Dio_WriteChannel_Unchecked writes a channel like Dio_WriteChannel without the
+*                 channel and level checks, for callers which already guarantee them.
+*
+* @api
+*/
+#define DIO_UNCHECKED_API                       (STD_OFF)
 
 /*=================================================================================================
 *                                             ENUMS
@@ -330,6 +338,14 @@ FUNC(void, DIO_CODE) Dio_WriteChannel
     CONST(Dio_LevelType,   AUTOMATIC) Level
 );
 
+#if (STD_ON == DIO_UNCHECKED_API)
+FUNC(void, DIO_CODE) Dio_WriteChannel_Unchecked
+(
+    CONST(Dio_ChannelType, AUTOMATIC) ChannelId,
+    CONST(Dio_LevelType,   AUTOMATIC) Level
+);
+#endif /* (STD_ON == DIO_UNCHECKED_API) */
+
 #if (STD_ON == DIO_FLIP_CHANNEL_API)
 FUNC(Dio_LevelType, DIO_CODE) Dio_FlipChannel
 (
@@ -0,0 +1,202 @@
+/**
+*   @file    Dio_Fast.h
+*   @version 1.0.1
+*
+*   @brief   AUTOSAR Dio - direct register access fast path.
+*   @details Header only channel and port accesses for bit-banged protocols and software PWM.
+*            The channel and port IDs are resolved to register addresses and masks by the
+*            preprocessor: with a constant ID every access compiles to a single load or store to
+*            an absolute address, without the Dio parameter checks and without function calls.
+*
+*   @addtogroup DIO_SIU
+*   @{
+*/
+/*=================================================================================================
+*   Project              : AUTOSAR 4.0 MCAL
+*   Platform             : PA
+*   Peripheral           : SIU
+*   Dependencies         : none
+*
+*   Autosar Version      : 4.0.3
+*   Autosar Revision     : ASR_REL_4_0_REV_0003
+*   Autosar Conf.Variant :
+*   SW Version           : 1.0.1
+*   Build Version        : MPC5777C_MCAL_1_0_1_RTM_ASR_REL_4_0_REV_0003_20170519
+*
+*   (c) Copyright 2006-2016 Freescale Semiconductor, Inc.
+*       Copyright 2017 NXP
+*   All Rights Reserved.
+=================================================================================================*/
+/*=================================================================================================
+=================================================================================================*/
+
+#ifndef DIO_FAST_H
+#define DIO_FAST_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+* @page misra_violations MISRA-C:2004 violations
+*
+* @section Dio_Fast_h_REF_1
+*     Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined.
+*     The accesses are macros so that constant channel IDs fold into absolute addresses.
+*
+* @section Dio_Fast_h_REF_2
+*     Violates MISRA 2004 Required Rule 11.1, Conversions shall not be performed between a pointer
+*     to a function and any type other than an integral type. The register addresses are computed
+*     as integers and converted to pointers by the register access macros.
+*
+* @section [global]
+*     Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
+*     on the significance of more than 31 characters. The used compilers use more than 31 chars for
+*     identifiers.
+*/
+
+/*=================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+=================================================================================================*/
+#include "Dio.h"
+#include "StdRegMacros.h"
+#include "Dio_Reg_eSys_Siu.h"
+
+/*=================================================================================================
+*                               SOURCE FILE VERSION INFORMATION
+=================================================================================================*/
+#define DIO_FAST_VENDOR_ID                    43
+#define DIO_FAST_AR_RELEASE_MAJOR_VERSION     4
+#define DIO_FAST_AR_RELEASE_MINOR_VERSION     0
+#define DIO_FAST_AR_RELEASE_REVISION_VERSION  3
+#define DIO_FAST_SW_MAJOR_VERSION             1
+#define DIO_FAST_SW_MINOR_VERSION             0
+#define DIO_FAST_SW_PATCH_VERSION             1
+
+/*=================================================================================================
+*                                      FILE VERSION CHECKS
+=================================================================================================*/
+#if (DIO_FAST_VENDOR_ID != DIO_REGESYS_SIU_VENDOR_ID_REG)
+    #error "Dio_Fast.h and Dio_Reg_eSys_Siu.h have different vendor ids"
+#endif
+
+#if ((DIO_FAST_AR_RELEASE_MAJOR_VERSION    != DIO_REGESYS_SIU_AR_RELEASE_MAJOR_VERSION_REG) || \
+     (DIO_FAST_AR_RELEASE_MINOR_VERSION    != DIO_REGESYS_SIU_AR_RELEASE_MINOR_VERSION_REG) || \
+     (DIO_FAST_AR_RELEASE_REVISION_VERSION != DIO_REGESYS_SIU_AR_RELEASE_REVISION_VERSION_REG) \
+    )
+    #error "AutoSar Version Numbers of Dio_Fast.h and Dio_Reg_eSys_Siu.h are different"
+#endif
+
+#if ((DIO_FAST_SW_MAJOR_VERSION != DIO_REGESYS_SIU_SW_MAJOR_VERSION_REG) || \
+     (DIO_FAST_SW_MINOR_VERSION != DIO_REGESYS_SIU_SW_MINOR_VERSION_REG) || \
+     (DIO_FAST_SW_PATCH_VERSION != DIO_REGESYS_SIU_SW_PATCH_VERSION_REG) \
+    )
+    #error "Software Version Numbers of Dio_Fast.h and Dio_Reg_eSys_Siu.h are different"
+#endif
+
+/*=================================================================================================
+*                                          CONSTANTS
+=================================================================================================*/
+
+/*=================================================================================================
+*                                      DEFINES AND MACROS
+=================================================================================================*/
+/*
+* The accesses below bypass Dio: no DET checks, no user mode register protection. The caller
+* runs in supervisor mode and owns the channels it drives. Port masks and levels use the
+* register layout, where the first channel of a port is the most significant bit, regardless
+* of DIO_REVERSEPORTBITS.
+*/
+
+/**
+* @brief   Port of a channel.
+* @violates @ref Dio_Fast_h_REF_1 Function-like macro defined.
+*/
+#define DIO_FAST_PORT_OF(ChannelId)             ((Dio_PortType)((uint32)(ChannelId) >> 4U))
+
+/**
+* @brief   Bit of a channel in the parallel registers of its port.
+* @violates @ref Dio_Fast_h_REF_1 Function-like macro defined.
+*/
+#define DIO_FAST_CHANNEL_MASK_U16(ChannelId)    ((uint16)((uint32)0x8000UL >> ((uint32)(ChannelId) & 0x0FUL)))
+
+/**
+* @brief   Bits of a channel driven to a level, to be combined into DIO_FAST_MASKED_WRITE_PORT.
+* @violates @ref Dio_Fast_h_REF_1 Function-like macro defined.
+*/
+#define DIO_FAST_CHANNEL_LEVEL_U16(ChannelId, Level) \
+    ((uint16)(((Dio_LevelType)STD_LOW != (Dio_LevelType)(Level)) ? DIO_FAST_CHANNEL_MASK_U16(ChannelId) : 0U))
+
+/**
+* @brief   Drives a channel to a level with a single byte store to its GPDO register.
+* @violates @ref Dio_Fast_h_REF_1 Function-like macro defined.
+* @violates @ref Dio_Fast_h_REF_2 Cast from unsigned long to pointer.
+*/
+#define DIO_FAST_WRITE(ChannelId, Level) \
+    REG_WRITE8(SIU_GPDO_ADDR8((uint32)(ChannelId)), (uint8)(Level))
+
+/**
+* @brief   Reads the level of a channel from its GPDI register.
+* @violates @ref Dio_Fast_h_REF_1 Function-like macro defined.
+* @violates @ref Dio_Fast_h_REF_2 Cast from unsigned long to pointer.
+*/
+#define DIO_FAST_READ(ChannelId) \
+    ((Dio_LevelType)REG_READ8(SIU_GPDI_ADDR8((uint32)(ChannelId))))
+
+/**
+* @brief   Inverts the output level of a channel.
+* @details Read-modify-write of the GPDO byte of the channel, only the channel itself is touched.
+* @violates @ref Dio_Fast_h_REF_1 Function-like macro defined.
+* @violates @ref Dio_Fast_h_REF_2 Cast from unsigned long to pointer.
+*/
+#define DIO_FAST_FLIP(ChannelId) \
+    REG_WRITE8(SIU_GPDO_ADDR8((uint32)(ChannelId)), \
+               (uint8)(REG_READ8(SIU_GPDO_ADDR8((uint32)(ChannelId))) ^ (uint8)STD_HIGH))
+
+/**
+* @brief   Reads the 16 channels of a port from its PGPDI register.
+* @violates @ref Dio_Fast_h_REF_1 Function-like macro defined.
+* @violates @ref Dio_Fast_h_REF_2 Cast from unsigned long to pointer.
+*/
+#define DIO_FAST_READ_PORT(PortId) \
+    ((uint16)REG_READ16(SIU_PGPDI_ADDR32((uint32)(PortId))))
+
+/**
+* @brief   Drives the channels of Mask in a port to Level in a single store.
+* @details The MPGPDO register only updates the channels selected by its mask half, so several
+*          channels of a port change at once and the others are left untouched, without a
+*          read-modify-write nor a critical section.
+* @violates @ref Dio_Fast_h_REF_1 Function-like macro defined.
+* @violates @ref Dio_Fast_h_REF_2 Cast from unsigned long to pointer.
+*/
+#define DIO_FAST_MASKED_WRITE_PORT(PortId, Mask, Level) \
+    REG_WRITE32(SIU_MPGPDO_ADDR32((uint32)(PortId) << 2U), \
+                (uint32)(((uint32)(uint16)(Mask) << 16U) | (uint32)(uint16)(Level)))
+
+/*=================================================================================================
+*                                             ENUMS
+=================================================================================================*/
+
+/*=================================================================================================
+*                                STRUCTURES AND OTHER TYPEDEFS
+=================================================================================================*/
+
+/*=================================================================================================
+*                                GLOBAL VARIABLE DECLARATIONS
+=================================================================================================*/
+
+/*=================================================================================================
+*                                     FUNCTION PROTOTYPES
+=================================================================================================*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIO_FAST_H */
+
+/** @} */
@@ -716,6 +716,33 @@ FUNC(void, DIO_CODE) Dio_WriteChannel
 
 }
 
+#if (STD_ON == DIO_UNCHECKED_API)
+/*================================================================================================*/
+/**
+* @brief          Sets the level of a channel without parameter checks.
+* @details        Same as Dio_WriteChannel for callers which already guarantee
+*                 a valid channel and a level of @p STD_HIGH or @p STD_LOW.
+*                 No development error is reported.
+*
+* @param[in]      ChannelId   Specifies the required channel id.
+* @param[in]      Level       Specifies the channel desired level.
+*
+* @pre            This function can be used only if @p DIO_UNCHECKED_API
+*                 has been enabled.
+*
+* @api
+*/
+/** @violates @ref Dio_C_REF_5 This warning appears when defining functions or objects that will be used by the upper layers. */
+FUNC(void, DIO_CODE) Dio_WriteChannel_Unchecked
+(
+    CONST(Dio_ChannelType,  AUTOMATIC) ChannelId,
+    CONST(Dio_LevelType,    AUTOMATIC) Level
+)
+{
+    Dio_Ipw_WriteChannel(ChannelId, Level);
+}
+#endif /* (STD_ON == DIO_UNCHECKED_API) */
+
 #if (STD_ON == DIO_FLIP_CHANNEL_API)
 /*================================================================================================*/
 /**
@@ -219,9 +219,13 @@ extern "C" {
 #define SIU_MPGPDO_MULTIPLIER_U32(port)   ((uint32)((port) << 0x2U))
 #define SIU_MPGPDO_MASK_SHIFT_U8          ((uint8)16)
 #define SIU_MPGPDO_MPPDO_MASK_U32         ((uint32)0x0000FFFFU)
-#define SIU_REVERSE_BITS_SHIFT            ((Dio_PortLevelType)1U)
-#define SIU_REVERSE_BITS_MASK             ((Dio_PortLevelType)0x1U)
-#define SIU_REVERSE_BITS_NUMBER           ((Dio_PortLevelType)((sizeof(Dio_PortLevelType) << 0x3U) - 1U))
+/* Masks of the swap steps of the bit reversal, on a 32 bit word */
+#define SIU_REVERSE_BITS_MASK1_U32        ((uint32)0x55555555UL)
+#define SIU_REVERSE_BITS_MASK2_U32        ((uint32)0x33333333UL)
+#define SIU_REVERSE_BITS_MASK4_U32        ((uint32)0x0F0F0F0FUL)
+#define SIU_REVERSE_BITS_MASK8_U32        ((uint32)0x00FF00FFUL)
+/* Unused low bits of the reversed 32 bit word when Dio_PortLevelType is narrower */
+#define SIU_REVERSE_BITS_UNUSED_U32       ((uint32)(32U - ((uint32)sizeof(Dio_PortLevelType) << 0x3U)))
 
 /*=================================================================================================
 *                                      LOCAL CONSTANTS
@@ -281,21 +285,16 @@ static FUNC(Dio_PortLevelType, DIO_CODE) Dio_Siu_ReverseBits
     VAR(Dio_PortLevelType, AUTOMATIC) Level
 )
 {
-    /* RevLevel will be reversed bits of Level */
-    VAR(Dio_PortLevelType, AUTOMATIC) RevLevel = Level;
-    VAR(Dio_PortLevelType, AUTOMATIC) NumShifts = SIU_REVERSE_BITS_NUMBER; /* number of shifts needed due to trailing 0s */
+    VAR(uint32, AUTOMATIC) u32Level = (uint32)Level;
 
-    Level = (Dio_PortLevelType)(Level >> SIU_REVERSE_BITS_SHIFT);
+    /* Swap adjacent bits, then pairs, nibbles, bytes and half words: same cost for every value */
+    u32Level = ((u32Level >> 1U) & SIU_REVERSE_BITS_MASK1_U32) | ((u32Level & SIU_REVERSE_BITS_MASK1_U32) << 1U);
+    u32Level = ((u32Level >> 2U) & SIU_REVERSE_BITS_MASK2_U32) | ((u32Level & SIU_REVERSE_BITS_MASK2_U32) << 2U);
+    u32Level = ((u32Level >> 4U) & SIU_REVERSE_BITS_MASK4_U32) | ((u32Level & SIU_REVERSE_BITS_MASK4_U32) << 4U);
+    u32Level = ((u32Level >> 8U) & SIU_REVERSE_BITS_MASK8_U32) | ((u32Level & SIU_REVERSE_BITS_MASK8_U32) << 8U);
+    u32Level = (u32Level >> 16U) | (u32Level << 16U);
 
-    for (; (Dio_PortLevelType)STD_LOW != Level; Level = (Dio_PortLevelType)(Level >> SIU_REVERSE_BITS_SHIFT))
-    {
-        RevLevel = (Dio_PortLevelType)(RevLevel << SIU_REVERSE_BITS_SHIFT);
-        RevLevel = (Dio_PortLevelType)(RevLevel | ((Dio_PortLevelType)(Level & SIU_REVERSE_BITS_MASK)));
-        NumShifts--;
-    }
-    RevLevel = (Dio_PortLevelType)((uint32)RevLevel << NumShifts); /* Remaining shifts when Level's highest bits are zero */
-
-    return RevLevel;
+    return (Dio_PortLevelType)(u32Level >> SIU_REVERSE_BITS_UNUSED_U32);
 }
 #endif /* (STD_ON == DIO_REVERSEPORTBITS) */
 
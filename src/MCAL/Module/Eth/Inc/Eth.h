@@ -136,6 +136,13 @@ extern "C"{
 #define ETH_SID_TXIRQHDLR               0x11
 #define ETH_SID_SETPHYSADDR             0x13
 #define ETH_SID_UPDATEADDRFILTER        0x12
+#define ETH_SID_MIIBATCH                0x14
+#define ETH_SID_MIIIRQHDLR              0x15
+#define ETH_SID_ISRXADDRACCEPTED        0x16
+#define ETH_SID_GETRXFILTERDROPCOUNT    0x17
+#define ETH_SID_GETMIBSNAPSHOT          0x18
+#define ETH_SID_GETMIBDELTA             0x19
+#define ETH_SID_ABORTMIIBATCH           0x1A
 
 /* DET error codes */
 /** @implements Eth_DetErrorIds_define */
@@ -150,6 +157,28 @@ extern "C"{
 /*==================================================================================================
 *                                      DEFINES AND MACROS
 ==================================================================================================*/
+/* Eth_MiiBatch queues MII management transactions and chains them off the FEC MII interrupt */
+#define ETH_MII_BATCH_API               (STD_OFF)
+
+/* Eth_UpdatePhysAddrFilter keeps an exact copy of the multicast addresses behind the FEC group
+   hash. Received group frames missing from it are dropped before EthIf_RxIndication and counted,
+   see Eth_GetRxFilterDropCount */
+#define ETH_RX_EXACT_MCAST_FILTER       (STD_OFF)
+#define ETH_RX_EXACT_MCAST_FILTER_SIZE  (16U)
+
+/* Eth_GetMibSnapshot copies all MIB counters in one call, Eth_GetMibDelta compares two copies */
+#define ETH_MIB_SNAPSHOT_API            (STD_OFF)
+
+#if STD_ON == ETH_MIB_SNAPSHOT_API
+/* Number of 32 bit words from FEC_RMON_T_DROP_ADDR16 up to FEC_IEEE_R_OCTETS_OK_ADDR16 */
+#define ETH_MIB_COUNTER_NUM             (57U)
+/** @brief Index in Eth_MibSnapshotType of the counter at offset CtrOffs of Eth_Fec_Counters.h */
+#define ETH_MIB_COUNTER_IDX(CtrOffs)    ((uint16)((uint16)((uint16)(CtrOffs) - 0x0200U) >> 2U))
+#endif /* ETH_MIB_SNAPSHOT_API */
+
+/* Eth_Transmit_Unchecked and Eth_Receive_Unchecked skip the development error checks, for callers
+   which already guarantee the controller index, buffer index, pointers and controller state */
+#define ETH_UNCHECKED_API               (STD_OFF)
 
 /*==================================================================================================
 *                                             ENUMS
@@ -158,6 +187,47 @@ extern "C"{
 /*==================================================================================================
 *                                STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
+#if (STD_ON == ETH_CTRLENABLE_MII) && (STD_ON == ETH_MII_BATCH_API)
+/**
+* @brief         Type of a single MII management transaction of a batch
+* @details       Write transactions send RegVal to the transceiver, read
+*                transactions store the register value into RegVal once the
+*                transaction has completed.
+*/
+typedef struct
+{
+    VAR(boolean, ETH_VAR) bWrite;   /**< TRUE for a write, FALSE for a read transaction */
+    VAR(uint8, ETH_VAR) TrcvIdx;    /**< Transceiver (PHY) address */
+    VAR(uint8, ETH_VAR) RegIdx;     /**< Transceiver register address */
+    VAR(uint16, ETH_VAR) RegVal;    /**< Value written or read back */
+} Eth_MiiTransactionType;
+
+/**
+* @brief         Notification called from the MII interrupt when a batch has finished
+* @details       Result is ETH_OK when all transactions have completed and
+*                ETH_E_NO_ACCESS when the batch was aborted by a controller reset
+*                or by Eth_AbortMiiBatch.
+*/
+typedef P2FUNC(void, ETH_APPL_CODE, Eth_MiiBatchNotificationType) ( \
+                                VAR(uint8, AUTOMATIC) CtrlIdx, \
+                                VAR(Eth_ReturnType, AUTOMATIC) Result \
+                                                                   );
+#endif /* ETH_CTRLENABLE_MII && ETH_MII_BATCH_API */
+
+#if STD_ON == ETH_MIB_SNAPSHOT_API
+/**
+* @brief         Copy of the MIB counters of a controller
+* @details       Counter[ETH_MIB_COUNTER_IDX(FEC_RMON_T_DROP_ADDR16)] holds
+*                the same value as Eth_GetCounterState for that offset. The
+*                reserved words between the transmit and receive counters and
+*                the one between FEC_RMON_R_JAB and FEC_RMON_R_P64 are zero.
+*                Eth_GetMibDelta stores deltas and rates in the same layout.
+*/
+typedef struct
+{
+    VAR(uint32, ETH_VAR) Counter[ETH_MIB_COUNTER_NUM];
+} Eth_MibSnapshotType;
+#endif /* ETH_MIB_SNAPSHOT_API */
 
 /*==================================================================================================
 *                                GLOBAL VARIABLE DECLARATIONS
@@ -235,6 +305,16 @@ extern FUNC(void, ETH_CODE) Eth_SetPhysAddr(VAR(uint8, AUTOMATIC) CtrlIdx, P2CON
                                             P2CONST(uint8, AUTOMATIC, ETH_APPL_CONST) PhysAddrPtr, \
                                             VAR(Eth_FilterActionType, AUTOMATIC) Action \
                                                                     );
+#if STD_ON == ETH_RX_EXACT_MCAST_FILTER
+    extern FUNC(boolean, ETH_CODE) Eth_IsRxAddrAccepted ( \
+                                            VAR(uint8, AUTOMATIC) CtrlIdx, \
+                                            P2CONST(uint8, AUTOMATIC, ETH_APPL_CONST) PhysAddrPtr \
+                                                        );
+    extern FUNC(void, ETH_CODE) Eth_GetRxFilterDropCount ( \
+                                            VAR(uint8, AUTOMATIC) CtrlIdx, \
+                                            P2VAR(uint32, AUTOMATIC, ETH_APPL_DATA) DropCountPtr \
+                                                         );
+#endif /* ETH_RX_EXACT_MCAST_FILTER */
 #endif /* ETH_UPDATE_PHYS_ADDR_FILTER */
 
 #if STD_ON == ETH_CTRLENABLE_MII
@@ -250,12 +330,34 @@ extern FUNC(Eth_ReturnType, ETH_CODE) Eth_ReadMii   ( \
                                 VAR(uint8, AUTOMATIC) RegIdx, \
                                 P2VAR(uint16, AUTOMATIC, ETH_APPL_DATA) RegValPtr \
                                                     );
+#if STD_ON == ETH_MII_BATCH_API
+extern FUNC(Eth_ReturnType, ETH_CODE) Eth_MiiBatch  ( \
+                                VAR(uint8, AUTOMATIC) CtrlIdx, \
+                                P2VAR(Eth_MiiTransactionType, AUTOMATIC, ETH_APPL_DATA) TransactionsPtr, \
+                                VAR(uint8, AUTOMATIC) Count, \
+                                VAR(Eth_MiiBatchNotificationType, AUTOMATIC) NotificationPtr \
+                                                    );
+extern FUNC(void, ETH_CODE) Eth_AbortMiiBatch(VAR(uint8, AUTOMATIC) CtrlIdx);
+#endif /* ETH_MII_BATCH_API */
 #endif /* ETH_CTRLENABLE_MII */
 extern FUNC(void, ETH_CODE) Eth_GetCounterState ( \
                             VAR(uint8, AUTOMATIC) CtrlIdx, \
                             VAR(uint16, AUTOMATIC) CtrOffs, \
                             P2VAR(uint32, AUTOMATIC, ETH_APPL_DATA) CtrValPtr \
                                                 );
+#if STD_ON == ETH_MIB_SNAPSHOT_API
+extern FUNC(void, ETH_CODE) Eth_GetMibSnapshot  ( \
+                            VAR(uint8, AUTOMATIC) CtrlIdx, \
+                            P2VAR(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_DATA) SnapshotPtr \
+                                                );
+extern FUNC(void, ETH_CODE) Eth_GetMibDelta ( \
+                            P2CONST(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_CONST) PrevPtr, \
+                            P2CONST(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_CONST) CurrPtr, \
+                            VAR(uint32, AUTOMATIC) ElapsedMs, \
+                            P2VAR(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_DATA) DeltaPtr, \
+                            P2VAR(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_DATA) RatePtr \
+                                            );
+#endif /* ETH_MIB_SNAPSHOT_API */
 extern FUNC(BufReq_ReturnType, ETH_CODE) Eth_ProvideTxBuffer    ( \
                             VAR(uint8, AUTOMATIC) CtrlIdx, \
                             P2VAR(uint8, AUTOMATIC, ETH_APPL_DATA) BufIdxPtr, \
@@ -276,6 +378,21 @@ extern FUNC(Std_ReturnType, ETH_CODE) Eth_Transmit  (
 extern FUNC(void, ETH_CODE) Eth_Receive(VAR(uint8, AUTOMATIC) CtrlIdx, P2VAR(Eth_RxStatusType, AUTOMATIC, ETH_APPL_DATA) RxStatusPtr);
 extern FUNC(void, ETH_CODE) Eth_TxConfirmation(VAR(uint8, AUTOMATIC) CtrlIdx);
 
+#if STD_ON == ETH_UNCHECKED_API
+extern FUNC(Std_ReturnType, ETH_CODE) Eth_Transmit_Unchecked  (
+                            VAR(uint8, AUTOMATIC) CtrlIdx,
+                            VAR(uint8, AUTOMATIC) BufIdx,
+                            Eth_FrameType FrameType,
+                            VAR(boolean, AUTOMATIC) TxConfirmation,
+                            VAR(uint16, AUTOMATIC) LenByte,
+                            P2VAR(uint8, AUTOMATIC, ETH_APPL_DATA) PhysAddrPtr
+#if STD_ON == ETH_BRIDGE_SUPPORT
+                          , P2CONST(uint8, AUTOMATIC, ETH_APPL_DATA) PhysSourceAddrPtr
+#endif /* ETH_BRIDGE_SUPPORT  */  
+                                                    );
+extern FUNC(void, ETH_CODE) Eth_Receive_Unchecked(VAR(uint8, AUTOMATIC) CtrlIdx, P2VAR(Eth_RxStatusType, AUTOMATIC, ETH_APPL_DATA) RxStatusPtr);
+#endif /* ETH_UNCHECKED_API */
+
 #if STD_ON == ETH_VERSION_INFO_API
     #if STD_OFF == ETH_VERSION_INFO_API_MACRO
         extern FUNC(void, ETH_CODE) Eth_GetVersionInfo(P2VAR(Std_VersionInfoType, AUTOMATIC, ETH_APPL_DATA) VersionInfoPtr);
@@ -62,6 +62,11 @@ extern "C"{
 * by the agreed file template and cannot be changed. Authors of the template
 * have not taken the MISRA rules into account.
 *
+* @section Eth_Fec_h_REF_5
+* Violates MISRA 2004 Advisory Rule 19.7, A function should be used in preference to a
+* function-like macro. The macro maps the receive indications of the FEC layer on the exact
+* multicast filter without changing the FEC layer.
+*
 * @section [global]
 * Violates MISRA 2004 Required Rule 20.2, The names of standard library macros,
 * objects and functions shall not be reused. All defines starting with upper
@@ -444,6 +449,16 @@ extern FUNC(void, ETH_CODE) Eth_Fec_Transmit    ( \
                         CONST(uint32, AUTOMATIC) u32Operation \
                                                     );
 #endif /* ETH_CTRLENABLE_MII */
+#if (STD_ON == ETH_UPDATE_PHYS_ADDR_FILTER) && (STD_ON == ETH_RX_EXACT_MCAST_FILTER)
+    extern FUNC(void, ETH_CODE) Eth_Ipw_RxIndication ( \
+                        VAR(uint8, AUTOMATIC) u8CtrlIdx, \
+                        VAR(Eth_FrameType, AUTOMATIC) u16FrameType, \
+                        VAR(boolean, AUTOMATIC) bIsBroadcast, \
+                        P2VAR(uint8, AUTOMATIC, AUTOMATIC) pPhysAddrPtr, \
+                        P2VAR(Eth_DataType, AUTOMATIC, AUTOMATIC) pDataPtr, \
+                        VAR(uint16, AUTOMATIC) u16LenByte \
+                                                     );
+#endif /* ETH_UPDATE_PHYS_ADDR_FILTER && ETH_RX_EXACT_MCAST_FILTER */
 #define ETH_STOP_SEC_CODE
 /** 
 * @violates @ref Eth_Fec_h_REF_2 MISRA rule 19.15 
@@ -451,6 +466,16 @@ extern FUNC(void, ETH_CODE) Eth_Fec_Transmit    ( \
 */
 #include "MemMap.h"
 
+#if (STD_ON == ETH_UPDATE_PHYS_ADDR_FILTER) && (STD_ON == ETH_RX_EXACT_MCAST_FILTER)
+/* The receive indications of the FEC layer pass the exact multicast filter first. EthIf_Cbk.h
+   is included before the mapping so that its prototype keeps the original name. */
+/** @violates @ref Eth_Fec_h_REF_3 MISRA rule 19.1 */
+#include "EthIf_Cbk.h"
+/** @violates @ref Eth_Fec_h_REF_5 MISRA rule 19.7 */
+#define EthIf_RxIndication(CtrlIdx, FrameType, IsBroadcast, PhysAddrPtr, DataPtr, LenByte) \
+    Eth_Ipw_RxIndication((CtrlIdx), (FrameType), (IsBroadcast), (PhysAddrPtr), (DataPtr), (LenByte))
+#endif /* ETH_UPDATE_PHYS_ADDR_FILTER && ETH_RX_EXACT_MCAST_FILTER */
+
 #ifdef __cplusplus
 }
 #endif
@@ -169,12 +169,25 @@ extern FUNC(void, ETH_CODE) Eth_Ipw_UpdatePhysAddrFilter ( \
                     P2CONST(uint8, AUTOMATIC, ETH_APPL_CONST) pPhysAddrPtr, \
                     VAR(Eth_FilterActionType, AUTOMATIC) eAction \
                                                          );
+#if STD_ON == ETH_RX_EXACT_MCAST_FILTER
+extern FUNC(boolean, ETH_CODE) Eth_Ipw_IsRxAddrAccepted ( \
+                    CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                    P2CONST(uint8, AUTOMATIC, ETH_APPL_CONST) pPhysAddrPtr \
+                                                        );
+extern FUNC(uint32, ETH_CODE) Eth_Ipw_GetRxFilterDropCount(CONST(uint8, AUTOMATIC) u8CtrlIdx);
+#endif /* ETH_RX_EXACT_MCAST_FILTER */
 #endif
 extern FUNC(void, ETH_CODE) Eth_Ipw_GetCounterState ( \
                         CONST(uint8, AUTOMATIC) u8CtrlIdx, \
                         CONST(uint16, AUTOMATIC) u16Counter, \
                         CONSTP2VAR(uint32, AUTOMATIC, ETH_APPL_DATA) pValue \
                                                     );
+#if STD_ON == ETH_MIB_SNAPSHOT_API
+extern FUNC(void, ETH_CODE) Eth_Ipw_GetMibSnapshot  ( \
+                        CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                        CONSTP2VAR(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_DATA) pSnapshot \
+                                                    );
+#endif /* ETH_MIB_SNAPSHOT_API */
 extern FUNC(boolean, ETH_CODE) Eth_Ipw_ProvideBufferDataArea( \
                                 CONST(uint8, AUTOMATIC) u8CtrlIdx, \
                                 CONSTP2VAR(uint8, AUTOMATIC, ETH_APPL_DATA) pBufIdx, \
@@ -206,6 +219,17 @@ extern FUNC(boolean, ETH_CODE) Eth_Ipw_ReadMii  ( \
                         CONST(uint8, AUTOMATIC) u8Reg, \
                         CONSTP2VAR(uint16, AUTOMATIC, ETH_APPL_DATA) pData \
                                                 );
+#if STD_ON == ETH_MII_BATCH_API
+extern FUNC(boolean, ETH_CODE) Eth_Ipw_StartMiiBatch    ( \
+                        CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                        P2VAR(Eth_MiiTransactionType, AUTOMATIC, ETH_APPL_DATA) pTransactions, \
+                        CONST(uint8, AUTOMATIC) u8Count, \
+                        CONST(Eth_MiiBatchNotificationType, AUTOMATIC) pfNotification \
+                                                        );
+extern FUNC(void, ETH_CODE) Eth_Ipw_ProcessMiiInterrupt(CONST(uint8, AUTOMATIC) u8CtrlIdx);
+extern FUNC(void, ETH_CODE) Eth_Ipw_AbortMiiBatch(CONST(uint8, AUTOMATIC) u8CtrlIdx);
+extern FUNC(void, ETH_CODE) Eth_Ipw_ClearMiiInterruptFlag(CONST(uint8, AUTOMATIC) u8CtrlIdx);
+#endif /* ETH_MII_BATCH_API */
 #endif /* ETH_CTRLENABLE_MII */
 extern FUNC(void, ETH_CODE) Eth_Ipw_MainFunction(VAR(void, AUTOMATIC));
 extern FUNC(void, ETH_CODE) Eth_Ipw_ClearRxInterruptFlag (CONST(uint8, AUTOMATIC) u8CtrlIdx);
@@ -135,6 +135,9 @@ extern "C"{
 #include "MemMap.h"
     extern ISR(Eth_TxIrqHdlr_0);
     extern ISR(Eth_RxIrqHdlr_0);
+#if (STD_ON == ETH_CTRLENABLE_MII) && (STD_ON == ETH_MII_BATCH_API)
+    extern ISR(Eth_MiiIrqHdlr_0);
+#endif
     /* This ISR is used only in ARM platform which doesnot have separated IRQ vectors */
 #if defined(ETH_COMBINED_IRQ_SCR) && (STD_ON == ETH_COMBINED_IRQ_SCR)
     extern ISR(Eth_TxRxIrqHdlr_0);
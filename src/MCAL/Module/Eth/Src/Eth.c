@@ -260,6 +260,32 @@ VAR(uint32, ETH_VAR) Eth_MiiFailed[ETH_MAXCTRLS_SUPPORTED] = {0U};
 /*==================================================================================================
 *                                   LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
+#define ETH_START_SEC_CODE
+/**
+ * @violates @ref Eth_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+
+LOCAL_INLINE FUNC(Std_ReturnType, ETH_CODE) Eth_TransmitLocked(
+                            VAR(uint8, AUTOMATIC) CtrlIdx,
+                            VAR(uint8, AUTOMATIC) BufIdx,
+                            Eth_FrameType FrameType,
+                            VAR(boolean, AUTOMATIC) TxConfirmation,
+                            VAR(uint16, AUTOMATIC) LenByte,
+                            P2VAR(uint8, AUTOMATIC, ETH_APPL_DATA) PhysAddrPtr
+#if STD_ON == ETH_BRIDGE_SUPPORT
+                          , P2CONST(uint8, AUTOMATIC, ETH_APPL_DATA) PhysSourceAddrPtr
+#endif /* ETH_BRIDGE_SUPPORT  */
+                                                              );
+LOCAL_INLINE FUNC(void, ETH_CODE) Eth_ReceivePoll(VAR(uint8, AUTOMATIC) CtrlIdx, P2VAR(Eth_RxStatusType, AUTOMATIC, ETH_APPL_DATA) RxStatusPtr);
+
+#define ETH_STOP_SEC_CODE
+/**
+ * @violates @ref Eth_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
 
 
 /*==================================================================================================
@@ -272,6 +298,63 @@ VAR(uint32, ETH_VAR) Eth_MiiFailed[ETH_MAXCTRLS_SUPPORTED] = {0U};
  */
 #include "MemMap.h"
 
+/*================================================================================================*/
+/**
+* @brief         Transmits a buffer if it was granted and not transmitted yet.
+* @details       Common part of Eth_Transmit and Eth_Transmit_Unchecked, the
+*                parameters are already valid.
+* @return        E_OK if the buffer was transmitted, E_NOT_OK if it was not locked.
+*/
+LOCAL_INLINE FUNC(Std_ReturnType, ETH_CODE) Eth_TransmitLocked(
+                            VAR(uint8, AUTOMATIC) CtrlIdx,
+                            VAR(uint8, AUTOMATIC) BufIdx,
+                            Eth_FrameType FrameType,
+                            VAR(boolean, AUTOMATIC) TxConfirmation,
+                            VAR(uint16, AUTOMATIC) LenByte,
+                            P2VAR(uint8, AUTOMATIC, ETH_APPL_DATA) PhysAddrPtr
+#if STD_ON == ETH_BRIDGE_SUPPORT
+                          , P2CONST(uint8, AUTOMATIC, ETH_APPL_DATA) PhysSourceAddrPtr
+#endif /* ETH_BRIDGE_SUPPORT  */
+                                                              )
+{
+    VAR(Std_ReturnType, AUTOMATIC) u8FunctionSuccess = (VAR(Std_ReturnType, AUTOMATIC))E_NOT_OK;
+
+    /* Check whether the buffer was previously locked
+       and has not been transmitted yet */
+    /** @violates @ref Eth_c_REF_8 MISRA rule 17.4 */
+    /** @violates @ref Eth_c_REF_11 MISRA rule 11.1 */
+    if((VAR(boolean, AUTOMATIC))TRUE == Eth_Ipw_IsTxBufLockedBT(CtrlIdx, (VAR(uint8, AUTOMATIC))BufIdx))
+    { /* Yes, transmit the buffer */
+        Eth_Ipw_Transmit(CtrlIdx, BufIdx, FrameType, LenByte, TxConfirmation, PhysAddrPtr
+#if STD_ON == ETH_BRIDGE_SUPPORT
+                            , PhysSourceAddrPtr
+#endif /* ETH_BRIDGE_SUPPORT  */
+                        );
+        u8FunctionSuccess = (VAR(Std_ReturnType, AUTOMATIC))E_OK;
+    }
+    return u8FunctionSuccess;
+}
+
+/*================================================================================================*/
+/**
+* @brief         Reports the received frames when the reception is polled.
+* @details       Common part of Eth_Receive and Eth_Receive_Unchecked, the
+*                parameters are already valid.
+*/
+LOCAL_INLINE FUNC(void, ETH_CODE) Eth_ReceivePoll(VAR(uint8, AUTOMATIC) CtrlIdx, P2VAR(Eth_RxStatusType, AUTOMATIC, ETH_APPL_DATA) RxStatusPtr)
+{
+    /** @violates @ref Eth_c_REF_5 MISRA rule 13.7 */
+    /** @violates @ref Eth_c_REF_4 MISRA rule 17.4 */
+    /** @violates @ref Eth_c_REF_14 MISRA rule 14.1 */
+    if((VAR(boolean, AUTOMATIC))FALSE == ETH_CFG_ENABLERXINTERRUPT(CtrlIdx))
+    {
+        /* Check all buffers and report them - returned error
+        status is ignored because there is no mean to report errors
+        in the AUTOSAR specification */
+        *RxStatusPtr = Eth_Ipw_ReportReception(CtrlIdx, (VAR(boolean, AUTOMATIC))FALSE);
+    }/*ETH_CFG_ENABLERXINTERRUPT*/
+}
+
 /*==================================================================================================
 *                                       GLOBAL FUNCTIONS
 ==================================================================================================*/
@@ -849,6 +932,114 @@ FUNC(Std_ReturnType, ETH_CODE) Eth_UpdatePhysAddrFilter ( \
     return eReturnStatus;
 }
 
+#if STD_ON == ETH_RX_EXACT_MCAST_FILTER
+/*================================================================================================*/
+/**
+* @brief         Looks a destination address up in the table of the multicast
+*                addresses added to the filter.
+* @details       The FEC accepts every group address hitting one of the 64 bits
+*                of its group hash. Eth_UpdatePhysAddrFilter also keeps the
+*                added multicast addresses in an exact table. The receive path
+*                checks every frame against it before EthIf_RxIndication and
+*                drops the hash false positives; this function gives the same
+*                answer for an address without counting anything.
+*                Unicast and broadcast addresses are always accepted, as are
+*                all group addresses while the filter is open, before any
+*                multicast address has been added and after the table has run
+*                full.
+* @api
+* @param[in]     CtrlIdx Index of the controller which received the frame.
+* @param[in]     PhysAddrPtr Destination address of the frame in network byte
+*                order.
+* @return        Whether the address is accepted
+* @retval        TRUE The address is accepted
+* @retval        FALSE The address can only have passed the group hash
+*/
+
+/** @violates @ref Eth_c_REF_7 MISRA rule 8.10 */
+FUNC(boolean, ETH_CODE) Eth_IsRxAddrAccepted ( \
+                                VAR(uint8, AUTOMATIC) CtrlIdx, \
+                                P2CONST(uint8, AUTOMATIC, ETH_APPL_CONST) PhysAddrPtr \
+                                             )
+{
+    VAR(boolean, AUTOMATIC) bAccepted = (boolean)TRUE;
+
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+    if(CtrlIdx >= (VAR(uint8, AUTOMATIC))ETH_MAXCTRLS_SUPPORTED)
+    {
+        (void)Det_ReportError ( \
+          (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, ETH_DRIVER_INSTANCE, \
+          (VAR(uint8, AUTOMATIC)) ETH_SID_ISRXADDRACCEPTED, \
+          ETH_E_INV_CTRL_IDX \
+                              );
+    }
+    else
+    {
+        if(NULL_PTR == PhysAddrPtr)
+        {
+            (void)Det_ReportError ( \
+                (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+                ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) \
+                ETH_SID_ISRXADDRACCEPTED, ETH_E_INV_POINTER \
+                                  );
+        }
+        else
+        {
+    #endif /* ETH_DEV_ERROR_DETECT  */
+            bAccepted = Eth_Ipw_IsRxAddrAccepted(CtrlIdx, PhysAddrPtr);
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+        }
+    }
+    #endif /* ETH_DEV_ERROR_DETECT  */
+    return bAccepted;
+}
+
+/*================================================================================================*/
+/**
+* @brief         Reads the number of received frames dropped by the exact
+*                multicast filter.
+* @note          The counter is 32 bit with wrap-around.
+* @api
+* @param[in]     CtrlIdx Index of the controller.
+* @param[out]    DropCountPtr Filled with the number of dropped frames.
+*/
+
+/** @violates @ref Eth_c_REF_7 MISRA rule 8.10 */
+FUNC(void, ETH_CODE) Eth_GetRxFilterDropCount ( \
+                                VAR(uint8, AUTOMATIC) CtrlIdx, \
+                                P2VAR(uint32, AUTOMATIC, ETH_APPL_DATA) DropCountPtr \
+                                              )
+{
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+    if(CtrlIdx >= (VAR(uint8, AUTOMATIC))ETH_MAXCTRLS_SUPPORTED)
+    {
+        (void)Det_ReportError ( \
+          (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, ETH_DRIVER_INSTANCE, \
+          (VAR(uint8, AUTOMATIC)) ETH_SID_GETRXFILTERDROPCOUNT, \
+          ETH_E_INV_CTRL_IDX \
+                              );
+    }
+    else
+    {
+        if(NULL_PTR == DropCountPtr)
+        {
+            (void)Det_ReportError ( \
+                (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+                ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) \
+                ETH_SID_GETRXFILTERDROPCOUNT, ETH_E_INV_POINTER \
+                                  );
+        }
+        else
+        {
+    #endif /* ETH_DEV_ERROR_DETECT  */
+            *DropCountPtr = Eth_Ipw_GetRxFilterDropCount(CtrlIdx);
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+        }
+    }
+    #endif /* ETH_DEV_ERROR_DETECT  */
+}
+#endif /* ETH_RX_EXACT_MCAST_FILTER */
+
 #endif /* STD_ON == ETH_UPDATE_PHYS_ADDR_FILTER */
 
 
@@ -1006,6 +1197,129 @@ FUNC(Eth_ReturnType, ETH_CODE) Eth_ReadMii  ( \
     #endif /* ETH_DEV_ERROR_DETECT  */
     return eReturnStatus;
 }
+
+#if STD_ON == ETH_MII_BATCH_API
+/*================================================================================================*/
+/**
+* @brief          Starts a batch of transceiver register reads and writes.
+* @api
+* @param[in]      CtrlIdx Index of the controller which transceivers shall be
+*                 accessed. The index is valid within the context of the
+*                 Ethernet Driver only.
+* @param[in,out]  TransactionsPtr Transactions carried out in the given order.
+*                 Read transactions get the register content in RegVal. The
+*                 array shall stay valid until the notification is called.
+* @param[in]      Count Number of transactions in the batch.
+* @param[in]      NotificationPtr Called from the MII interrupt once the batch
+*                 has finished, may be NULL_PTR.
+* @details        The first management frame is issued and the function returns
+*                 without waiting. Every following frame is started from the
+*                 MII interrupt handler Eth_MiiIrqHdlr_0. Eth_WriteMii and
+*                 Eth_ReadMii return ETH_E_NO_ACCESS while a batch is running.
+*                 The driver does not time the batch: a caller which stops
+*                 waiting for the notification shall call Eth_AbortMiiBatch.
+* @return         Whether the batch has been started
+* @retval         ETH_OK The batch is running
+* @retval         ETH_E_NOT_OK Another batch is still running or a development
+*                 error has been detected
+*/
+
+/** @violates @ref Eth_c_REF_7 MISRA rule 8.10 */
+FUNC(Eth_ReturnType, ETH_CODE) Eth_MiiBatch ( \
+                    VAR(uint8, AUTOMATIC) CtrlIdx, \
+                    P2VAR(Eth_MiiTransactionType, AUTOMATIC, ETH_APPL_DATA) TransactionsPtr, \
+                    VAR(uint8, AUTOMATIC) Count, \
+                    VAR(Eth_MiiBatchNotificationType, AUTOMATIC) NotificationPtr \
+                                            )
+{
+    VAR(Eth_ReturnType, AUTOMATIC) eReturnStatus = ETH_E_NOT_OK;
+
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+    /** @violates @ref Eth_c_REF_4 MISRA rule 17.4 */
+    /** @violates @ref Eth_c_REF_5 MISRA rule 13.7 */
+    /** @violates @ref Eth_c_REF_14 MISRA rule 14.1 */
+    if((CtrlIdx >= (VAR(uint8, AUTOMATIC))ETH_MAXCTRLS_SUPPORTED)||((VAR(boolean, AUTOMATIC))FALSE == ETH_CFG_MDIOSUPPORT(CtrlIdx)))
+    {
+        (void)Det_ReportError ( \
+            (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+            ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) ETH_SID_MIIBATCH, \
+            ETH_E_INV_CTRL_IDX \
+                              );
+    }
+    else if(NULL_PTR == TransactionsPtr)
+    {
+        (void)Det_ReportError ( \
+            (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+            ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) ETH_SID_MIIBATCH, \
+            ETH_E_INV_POINTER \
+                              );
+    }
+    else if(0U == Count)
+    {
+        (void)Det_ReportError ( \
+            (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+            ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) ETH_SID_MIIBATCH, \
+            ETH_E_INV_PARAM \
+                              );
+    }
+    else if(ETH_STATE_ACTIVE != Eth_CtrlState[CtrlIdx])
+    {
+        (void)Det_ReportError ( \
+            (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+            ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) ETH_SID_MIIBATCH, \
+            ETH_E_NOT_INITIALIZED \
+                              );
+    }
+    else
+    {
+    #endif /* ETH_DEV_ERROR_DETECT  */
+        if((VAR(boolean, AUTOMATIC))TRUE == Eth_Ipw_StartMiiBatch(CtrlIdx, TransactionsPtr, Count, NotificationPtr))
+        {
+            eReturnStatus = ETH_OK;
+        }
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+    }
+    #endif /* ETH_DEV_ERROR_DETECT  */
+    return eReturnStatus;
+}
+
+/*================================================================================================*/
+/**
+* @brief          Aborts the running batch of transceiver accesses.
+* @api
+* @param[in]      CtrlIdx Index of the controller. The index is valid within the
+*                 context of the Ethernet Driver only.
+* @details        Meant for a caller which gives up waiting for the batch, for
+*                 instance when its own supervision time has elapsed. The
+*                 notification of the batch is called from this function with
+*                 ETH_E_NO_ACCESS; transactions not completed yet keep their
+*                 previous RegVal. Nothing is done when no batch is running.
+*/
+
+/** @violates @ref Eth_c_REF_7 MISRA rule 8.10 */
+FUNC(void, ETH_CODE) Eth_AbortMiiBatch(VAR(uint8, AUTOMATIC) CtrlIdx)
+{
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+    /** @violates @ref Eth_c_REF_4 MISRA rule 17.4 */
+    /** @violates @ref Eth_c_REF_5 MISRA rule 13.7 */
+    /** @violates @ref Eth_c_REF_14 MISRA rule 14.1 */
+    if((CtrlIdx >= (VAR(uint8, AUTOMATIC))ETH_MAXCTRLS_SUPPORTED)||((VAR(boolean, AUTOMATIC))FALSE == ETH_CFG_MDIOSUPPORT(CtrlIdx)))
+    {
+        (void)Det_ReportError ( \
+            (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+            ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) ETH_SID_ABORTMIIBATCH, \
+            ETH_E_INV_CTRL_IDX \
+                              );
+    }
+    else
+    {
+    #endif /* ETH_DEV_ERROR_DETECT  */
+        Eth_Ipw_AbortMiiBatch(CtrlIdx);
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+    }
+    #endif /* ETH_DEV_ERROR_DETECT  */
+}
+#endif /* ETH_MII_BATCH_API */
 #endif /* ETH_CTRLENABLE_MII */
 /*================================================================================================*/
 /**
@@ -1071,6 +1385,128 @@ FUNC(void, ETH_CODE) Eth_GetCounterState    ( \
     #endif /* ETH_DEV_ERROR_DETECT  */
 }
 
+#if STD_ON == ETH_MIB_SNAPSHOT_API
+/*================================================================================================*/
+/**
+* @brief         Copies all MIB counters of the controller in one call.
+* @details       Replaces a series of Eth_GetCounterState calls: the parameters
+*                are checked once and all counters are read in a single pass.
+*                Use ETH_MIB_COUNTER_IDX with the offsets of Eth_Fec_Counters.h
+*                to pick a counter from the snapshot.
+* @api
+* @param[in]     CtrlIdx Index of the controller which counters shall be read.
+* @param[out]    SnapshotPtr Filled with the counter values.
+*/
+
+/** @violates @ref Eth_c_REF_7 MISRA rule 8.10 */
+FUNC(void, ETH_CODE) Eth_GetMibSnapshot ( \
+                        VAR(uint8, AUTOMATIC) CtrlIdx, \
+                        P2VAR(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_DATA) SnapshotPtr \
+                                        )
+{
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+    if(CtrlIdx >= (VAR(uint8, AUTOMATIC))ETH_MAXCTRLS_SUPPORTED)
+    {
+        (void)Det_ReportError ( \
+            (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+            ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) \
+            ETH_SID_GETMIBSNAPSHOT, ETH_E_INV_CTRL_IDX \
+                              );
+    }
+    else
+    {
+        if(NULL_PTR == SnapshotPtr)
+        {
+            (void)Det_ReportError ( \
+                (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+                ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) \
+                ETH_SID_GETMIBSNAPSHOT, ETH_E_INV_POINTER \
+                                  );
+        }
+        else
+        {
+            if(ETH_STATE_ACTIVE != Eth_CtrlState[CtrlIdx])
+            {
+                (void)Det_ReportError ( \
+                    (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+                    ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) \
+                    ETH_SID_GETMIBSNAPSHOT, ETH_E_NOT_INITIALIZED \
+                                      );
+            }
+            else
+            {
+    #endif /* ETH_DEV_ERROR_DETECT  */
+                Eth_Ipw_GetMibSnapshot(CtrlIdx, SnapshotPtr);
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+            }
+        }
+    }
+    #endif /* ETH_DEV_ERROR_DETECT  */
+}
+
+/*================================================================================================*/
+/**
+* @brief         Computes the counter changes between two MIB snapshots.
+* @details       Counters are 32 bit with wrap-around, the modulo difference is
+*                exact as long as a counter wraps at most once between the two
+*                snapshots. At 100 Mbit/s the octet counters wrap after about
+*                340 s, so snapshots shall be taken more often than that.
+* @api
+* @param[in]     PrevPtr Older snapshot.
+* @param[in]     CurrPtr Newer snapshot.
+* @param[in]     ElapsedMs Time between the two snapshots in milliseconds.
+* @param[out]    DeltaPtr Filled with the counter increments.
+* @param[out]    RatePtr Filled with the increments per second, may be
+*                NULL_PTR. All rates are zero when ElapsedMs is zero.
+*/
+
+/** @violates @ref Eth_c_REF_7 MISRA rule 8.10 */
+FUNC(void, ETH_CODE) Eth_GetMibDelta ( \
+                        P2CONST(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_CONST) PrevPtr, \
+                        P2CONST(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_CONST) CurrPtr, \
+                        VAR(uint32, AUTOMATIC) ElapsedMs, \
+                        P2VAR(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_DATA) DeltaPtr, \
+                        P2VAR(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_DATA) RatePtr \
+                                     )
+{
+    VAR(uint8, AUTOMATIC) u8Idx;
+    VAR(uint32, AUTOMATIC) u32Delta;
+
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+    if((NULL_PTR == PrevPtr) || (NULL_PTR == CurrPtr) || (NULL_PTR == DeltaPtr))
+    {
+        (void)Det_ReportError ( \
+            (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+            ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) \
+            ETH_SID_GETMIBDELTA, ETH_E_INV_POINTER \
+                              );
+    }
+    else
+    {
+    #endif /* ETH_DEV_ERROR_DETECT  */
+        for(u8Idx = 0U; u8Idx < ETH_MIB_COUNTER_NUM; u8Idx++)
+        {
+            /* Unsigned subtraction handles the wrap-around */
+            u32Delta = CurrPtr->Counter[u8Idx] - PrevPtr->Counter[u8Idx];
+            DeltaPtr->Counter[u8Idx] = u32Delta;
+            if(NULL_PTR != RatePtr)
+            {
+                if(0UL == ElapsedMs)
+                {
+                    RatePtr->Counter[u8Idx] = 0UL;
+                }
+                else
+                {
+                    RatePtr->Counter[u8Idx] = (uint32)(((uint64)u32Delta * 1000ULL) / (uint64)ElapsedMs);
+                }
+            }
+        }
+    #if STD_ON == ETH_DEV_ERROR_DETECT
+    }
+    #endif /* ETH_DEV_ERROR_DETECT  */
+}
+#endif /* ETH_MIB_SNAPSHOT_API */
+
 /*================================================================================================*/
 /**
 * @brief         Provides access to a transmit buffer of the specified
@@ -1301,30 +1737,20 @@ FUNC(Std_ReturnType, ETH_CODE) Eth_Transmit     (
                     else
                     {
     #endif /* ETH_DEV_ERROR_DETECT  */
-                        /* Check whether the buffer was previously locked
-                           and has not been transmitted yet */
-                        /** @violates @ref Eth_c_REF_8 MISRA rule 17.4 */
-                        /** @violates @ref Eth_c_REF_11 MISRA rule 11.1 */
-                        if((VAR(boolean, AUTOMATIC))TRUE == Eth_Ipw_IsTxBufLockedBT(CtrlIdx, (VAR(uint8, AUTOMATIC))BufIdx))
-                        { /* Yes, transmit the buffer */
-                            Eth_Ipw_Transmit(CtrlIdx, BufIdx, FrameType, LenByte, TxConfirmation, PhysAddrPtr
+                        u8FunctionSuccess = Eth_TransmitLocked(CtrlIdx, BufIdx, FrameType, TxConfirmation, LenByte, PhysAddrPtr
 #if STD_ON == ETH_BRIDGE_SUPPORT
                                                 , PhysSourceAddrPtr
 #endif /* ETH_BRIDGE_SUPPORT  */
-                                            );
-                            u8FunctionSuccess = (VAR(Std_ReturnType, AUTOMATIC))E_OK;
-                        }
-                        else
-                        { /* No, report an error, do not transmit buffer */
+                                                              );
     #if STD_ON == ETH_DEV_ERROR_DETECT
+                        if((VAR(Std_ReturnType, AUTOMATIC))E_OK != u8FunctionSuccess)
+                        { /* The buffer was not locked, it has not been transmitted */
                             (void)Det_ReportError ( \
                                 (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
                                 ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) \
                                 ETH_SID_TRANSMIT, ETH_E_INV_PARAM \
                                                   );
-    #endif /* ETH_DEV_ERROR_DETECT  */
                         }
-    #if STD_ON == ETH_DEV_ERROR_DETECT
                     }
                 }
             }
@@ -1387,16 +1813,7 @@ FUNC(void, ETH_CODE) Eth_Receive(VAR(uint8, AUTOMATIC) CtrlIdx, P2VAR(Eth_RxStat
             else
             {
     #endif /* ETH_DEV_ERROR_DETECT  */
-                /** @violates @ref Eth_c_REF_5 MISRA rule 13.7 */
-                /** @violates @ref Eth_c_REF_4 MISRA rule 17.4 */
-                /** @violates @ref Eth_c_REF_14 MISRA rule 14.1 */
-                if((VAR(boolean, AUTOMATIC))FALSE == ETH_CFG_ENABLERXINTERRUPT(CtrlIdx))
-                {
-                    /* Check all buffers and report them - returned error
-                    status is ignored because there is no mean to report errors
-                    in the AUTOSAR specification */
-                    *RxStatusPtr = Eth_Ipw_ReportReception(CtrlIdx, (VAR(boolean, AUTOMATIC))FALSE);
-                }/*ETH_CFG_ENABLERXINTERRUPT*/
+                Eth_ReceivePoll(CtrlIdx, RxStatusPtr);
     #if STD_ON == ETH_DEV_ERROR_DETECT
                 /* Check whether any too long frame has been discarded/lost 
                    Note: this check is done after the reporting the reception
@@ -1482,6 +1899,54 @@ FUNC(void, ETH_CODE) Eth_TxConfirmation(VAR(uint8, AUTOMATIC) CtrlIdx)
     #endif /* ETH_DEV_ERROR_DETECT  */
 }
 
+#if STD_ON == ETH_UNCHECKED_API
+/*================================================================================================*/
+/**
+* @brief         Eth_Transmit without the development error checks.
+* @details       For callers which guarantee a valid controller index and buffer
+*                index, a non NULL PhysAddrPtr and an active controller. Only the
+*                buffer lock is checked, as by Eth_Transmit.
+* @api
+* @return        Error status
+* @retval        E_OK The buffer was transmitted.
+* @retval        E_NOT_OK The buffer was not granted or was already transmitted.
+*/
+
+/** @violates @ref Eth_c_REF_7 MISRA rule 8.10 */
+FUNC(Std_ReturnType, ETH_CODE) Eth_Transmit_Unchecked     (
+                            VAR(uint8, AUTOMATIC) CtrlIdx,
+                            VAR(uint8, AUTOMATIC) BufIdx,
+                            Eth_FrameType FrameType,
+                            VAR(boolean, AUTOMATIC) TxConfirmation,
+                            VAR(uint16, AUTOMATIC) LenByte,
+                            P2VAR(uint8, AUTOMATIC, ETH_APPL_DATA) PhysAddrPtr
+#if STD_ON == ETH_BRIDGE_SUPPORT
+                          , P2CONST(uint8, AUTOMATIC, ETH_APPL_DATA) PhysSourceAddrPtr
+#endif /* ETH_BRIDGE_SUPPORT  */
+                                                )
+{
+    return Eth_TransmitLocked(CtrlIdx, BufIdx, FrameType, TxConfirmation, LenByte, PhysAddrPtr
+#if STD_ON == ETH_BRIDGE_SUPPORT
+                                , PhysSourceAddrPtr
+#endif /* ETH_BRIDGE_SUPPORT  */
+                             );
+}
+
+/*================================================================================================*/
+/**
+* @brief         Eth_Receive without the development error checks.
+* @details       For callers which guarantee a valid controller index and an active
+*                controller. Lost too long frames are not reported.
+* @api
+*/
+
+/** @violates @ref Eth_c_REF_7 MISRA rule 8.10 */
+FUNC(void, ETH_CODE) Eth_Receive_Unchecked(VAR(uint8, AUTOMATIC) CtrlIdx, P2VAR(Eth_RxStatusType, AUTOMATIC, ETH_APPL_DATA) RxStatusPtr)
+{
+    Eth_ReceivePoll(CtrlIdx, RxStatusPtr);
+}
+#endif /* ETH_UNCHECKED_API */
+
 #if STD_ON == ETH_VERSION_INFO_API
 #if STD_OFF == ETH_VERSION_INFO_API_MACRO
 /*================================================================================================*/
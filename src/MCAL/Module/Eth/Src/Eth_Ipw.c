@@ -59,6 +59,12 @@ extern "C"{
 * than 31 characters. Name length of the macros is unfortunately longer than 31 characters 
 * which is required by the agreed macros format and cannot be changed. 
 *
+* @section Eth_Ipw_c_REF_5
+* Violates MISRA 2004 Required Rule 17.4, Array indexing shall be the only
+* allowed form of pointer arithmetic. The MII batch is walked with a pointer
+* to the transaction in progress, the receive filter reads the frame header
+* in front of the payload pointer.
+*
 * @section [global]
 * Violates MISRA 2004 Required Rule 20.2, The names of standard library macros,
 * objects and functions shall not be reused. All defines starting with upper
@@ -81,6 +87,8 @@ extern "C"{
 #include "EthIf_Cbk.h" /* EthIf callbacks to be called from Eth driver */
 #include "Eth_Fec.h" /* Lower layer header */
 #include "Eth_Ipw.h" /* Own header */
+#include "Reg_eSys.h" /* FEC base address */
+#include "SilRegMacros.h" /* Register access macros */
 
 /*==================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
@@ -136,11 +144,39 @@ extern "C"{
 /*==================================================================================================
 *                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
-
+#if (STD_ON == ETH_UPDATE_PHYS_ADDR_FILTER) && (STD_ON == ETH_RX_EXACT_MCAST_FILTER)
+/**
+* @brief         Physical address held by the exact multicast filter
+* @details       Entries are ordered by u16High then u32Low.
+*/
+typedef struct
+{
+    VAR(uint16, ETH_VAR) u16High;   /**< Address bytes 0 and 1 */
+    VAR(uint32, ETH_VAR) u32Low;    /**< Address bytes 2 to 5 */
+} Eth_Ipw_MacAddrType;
+#endif /* ETH_UPDATE_PHYS_ADDR_FILTER && ETH_RX_EXACT_MCAST_FILTER */
 
 /*==================================================================================================
 *                                       LOCAL MACROS
 ==================================================================================================*/
+/* The device has a single FEC instance, registers accessed here do not depend on the controller index */
+/** @violates @ref Eth_Ipw_c_REF_3 MISRA rule 1.4
+* @violates @ref Eth_Ipw_c_REF_4 MISRA rule 5.1 */
+#define ETH_IPW_FEC_REG_ADDR32(u16Offset)   (FEC_0_BASEADDR + (uint32)(u16Offset))
+
+#if (STD_ON == ETH_CTRLENABLE_MII) && (STD_ON == ETH_MII_BATCH_API)
+/* Position of the PA and RA bitfields in the MMFR register */
+#define ETH_IPW_MMFR_PA_SHIFT_U8            (23U)
+#define ETH_IPW_MMFR_RA_SHIFT_U8            (18U)
+#endif /* ETH_CTRLENABLE_MII && ETH_MII_BATCH_API */
+
+#if (STD_ON == ETH_UPDATE_PHYS_ADDR_FILTER) && (STD_ON == ETH_RX_EXACT_MCAST_FILTER)
+/* States of the exact multicast filter */
+#define ETH_IPW_MCAST_HASH_ONLY_U8          (0U) /* Nothing added yet, the group hash decides */
+#define ETH_IPW_MCAST_EXACT_U8              (1U) /* Only addresses of the table are accepted */
+#define ETH_IPW_MCAST_OVERFLOW_U8           (2U) /* Table was full, the group hash decides until closed */
+#define ETH_IPW_RX_HEADER_LEN_U8            (14U) /* Destination, source and type in front of the payload */
+#endif /* ETH_UPDATE_PHYS_ADDR_FILTER && ETH_RX_EXACT_MCAST_FILTER */
 
 /*==================================================================================================
 *                                      LOCAL CONSTANTS
@@ -149,6 +185,100 @@ extern "C"{
 /*==================================================================================================
 *                                      LOCAL VARIABLES
 ==================================================================================================*/
+#if (STD_ON == ETH_CTRLENABLE_MII) && (STD_ON == ETH_MII_BATCH_API)
+#define ETH_START_SEC_VAR_INIT_8
+/**
+ * @violates @ref Eth_Ipw_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_Ipw_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+/* Transactions of the running batch still waiting for completion, 0 when idle */
+static VAR(volatile uint8, ETH_VAR) Eth_Ipw_au8MiiBatchLeft[ETH_MAXCTRLS_SUPPORTED] = {0U};
+/* A polled MII access owns the management interface */
+static VAR(volatile boolean, ETH_VAR) Eth_Ipw_abMiiPolled[ETH_MAXCTRLS_SUPPORTED] = {(boolean)FALSE};
+#define ETH_STOP_SEC_VAR_INIT_8
+/**
+ * @violates @ref Eth_Ipw_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_Ipw_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+
+/** @violates @ref Eth_Ipw_c_REF_3 MISRA rule 1.4
+* @violates @ref Eth_Ipw_c_REF_4 MISRA rule 5.1 */
+#define ETH_START_SEC_VAR_INIT_UNSPECIFIED
+/**
+ * @violates @ref Eth_Ipw_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_Ipw_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+/* Transaction currently carried out by the MII management interface */
+static P2VAR(Eth_MiiTransactionType, ETH_VAR, ETH_APPL_DATA) Eth_Ipw_apMiiBatchCurrent[ETH_MAXCTRLS_SUPPORTED] = {NULL_PTR};
+/* Notification of the running batch */
+static VAR(Eth_MiiBatchNotificationType, ETH_VAR) Eth_Ipw_apfMiiBatchNotification[ETH_MAXCTRLS_SUPPORTED] = {NULL_PTR};
+/** @violates @ref Eth_Ipw_c_REF_3 MISRA rule 1.4
+* @violates @ref Eth_Ipw_c_REF_4 MISRA rule 5.1 */
+#define ETH_STOP_SEC_VAR_INIT_UNSPECIFIED
+/**
+ * @violates @ref Eth_Ipw_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_Ipw_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+#endif /* ETH_CTRLENABLE_MII && ETH_MII_BATCH_API */
+
+#if (STD_ON == ETH_UPDATE_PHYS_ADDR_FILTER) && (STD_ON == ETH_RX_EXACT_MCAST_FILTER)
+#define ETH_START_SEC_VAR_INIT_8
+/**
+ * @violates @ref Eth_Ipw_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_Ipw_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+/* Number of addresses in the exact multicast filter */
+static VAR(uint8, ETH_VAR) Eth_Ipw_au8McastCount[ETH_MAXCTRLS_SUPPORTED] = {0U};
+/* State of the exact multicast filter */
+static VAR(uint8, ETH_VAR) Eth_Ipw_au8McastState[ETH_MAXCTRLS_SUPPORTED] = {ETH_IPW_MCAST_HASH_ONLY_U8};
+/* Filter opened by the broadcast address */
+static VAR(boolean, ETH_VAR) Eth_Ipw_abMcastOpen[ETH_MAXCTRLS_SUPPORTED] = {(boolean)FALSE};
+#define ETH_STOP_SEC_VAR_INIT_8
+/**
+ * @violates @ref Eth_Ipw_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_Ipw_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+
+#define ETH_START_SEC_VAR_INIT_32
+/**
+ * @violates @ref Eth_Ipw_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_Ipw_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+/* Multicast frames passing the group hash but dropped by the exact filter */
+static VAR(uint32, ETH_VAR) Eth_Ipw_au32McastDropped[ETH_MAXCTRLS_SUPPORTED] = {0UL};
+#define ETH_STOP_SEC_VAR_INIT_32
+/**
+ * @violates @ref Eth_Ipw_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_Ipw_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+
+/** @violates @ref Eth_Ipw_c_REF_3 MISRA rule 1.4
+* @violates @ref Eth_Ipw_c_REF_4 MISRA rule 5.1 */
+#define ETH_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Eth_Ipw_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_Ipw_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+/* Multicast addresses added to the filter, in increasing order */
+static VAR(Eth_Ipw_MacAddrType, ETH_VAR) Eth_Ipw_aMcastTable[ETH_MAXCTRLS_SUPPORTED][ETH_RX_EXACT_MCAST_FILTER_SIZE];
+/** @violates @ref Eth_Ipw_c_REF_3 MISRA rule 1.4
+* @violates @ref Eth_Ipw_c_REF_4 MISRA rule 5.1 */
+#define ETH_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+ * @violates @ref Eth_Ipw_c_REF_1 MISRA rule 19.1
+ * @violates @ref Eth_Ipw_c_REF_2 MISRA rule 19.15
+ */
+#include "MemMap.h"
+#endif /* ETH_UPDATE_PHYS_ADDR_FILTER && ETH_RX_EXACT_MCAST_FILTER */
 
 
 /*==================================================================================================
@@ -164,7 +294,29 @@ extern "C"{
 /*==================================================================================================
 *                                   LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
-
+#if (STD_ON == ETH_CTRLENABLE_MII) && (STD_ON == ETH_MII_BATCH_API)
+LOCAL_INLINE void Eth_Ipw_StartMiiFrame(CONSTP2CONST(Eth_MiiTransactionType, AUTOMATIC, ETH_APPL_DATA) pTransaction);
+static FUNC(boolean, ETH_CODE) Eth_Ipw_DoPolledMii ( \
+                    CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                    CONST(uint8, AUTOMATIC) u8Trcv, \
+                    CONST(uint8, AUTOMATIC) u8Reg, \
+                    CONSTP2VAR(uint16, AUTOMATIC, ETH_APPL_DATA) pData, \
+                    CONST(uint32, AUTOMATIC) u32Operation \
+                                                   );
+#endif /* ETH_CTRLENABLE_MII && ETH_MII_BATCH_API */
+#if (STD_ON == ETH_UPDATE_PHYS_ADDR_FILTER) && (STD_ON == ETH_RX_EXACT_MCAST_FILTER)
+static FUNC(uint8, ETH_CODE) Eth_Ipw_FindMcastAddr  ( \
+                    CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                    CONST(uint16, AUTOMATIC) u16High, \
+                    CONST(uint32, AUTOMATIC) u32Low, \
+                    CONSTP2VAR(boolean, AUTOMATIC, AUTOMATIC) pbFound \
+                                                    );
+static FUNC(void, ETH_CODE) Eth_Ipw_UpdateMcastTable ( \
+                    CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                    P2CONST(uint8, AUTOMATIC, ETH_APPL_CONST) pPhysAddrPtr, \
+                    VAR(Eth_FilterActionType, AUTOMATIC) eAction \
+                                                     );
+#endif /* ETH_UPDATE_PHYS_ADDR_FILTER && ETH_RX_EXACT_MCAST_FILTER */
 
 /*==================================================================================================
 *                                       LOCAL FUNCTIONS
@@ -175,6 +327,207 @@ extern "C"{
  */
 #include "MemMap.h"
 
+#if (STD_ON == ETH_CTRLENABLE_MII) && (STD_ON == ETH_MII_BATCH_API)
+/*================================================================================================*/
+/**
+* @brief         Starts the MII management frame of one batch transaction
+* @param[in]     pTransaction Transaction to be carried out
+* @details       Completion is signalled by the MII interrupt flag.
+*/
+LOCAL_INLINE void Eth_Ipw_StartMiiFrame(CONSTP2CONST(Eth_MiiTransactionType, AUTOMATIC, ETH_APPL_DATA) pTransaction)
+{
+    VAR(uint32, AUTOMATIC) u32Frame;
+
+    u32Frame = FEC_MMFR_ST_VAL_U32 | FEC_MMFR_TA_VAL_U32 | \
+               (((uint32)pTransaction->TrcvIdx << ETH_IPW_MMFR_PA_SHIFT_U8) & FEC_MMFR_PA_U32) | \
+               (((uint32)pTransaction->RegIdx << ETH_IPW_MMFR_RA_SHIFT_U8) & FEC_MMFR_RA_U32);
+    if((VAR(boolean, AUTOMATIC))TRUE == pTransaction->bWrite)
+    {
+        u32Frame |= FEC_MMFR_OP_WRITE_U32 | ((uint32)pTransaction->RegVal & FEC_MMFR_DATA_U32);
+    }
+    else
+    {
+        u32Frame |= FEC_MMFR_OP_READ_U32;
+    }
+    REG_WRITE32(ETH_IPW_FEC_REG_ADDR32(FEC_MMFR_ADDR16), u32Frame);
+}
+
+/*================================================================================================*/
+/**
+* @brief         Carries out a polled MII access unless a batch is running
+* @param[in]     u8CtrlIdx Index of the controller
+* @param[in]     u8Trcv Transceiver address
+* @param[in]     u8Reg Register address
+* @param[in,out] pData Value written, or value read
+* @param[in]     u32Operation FEC_MMFR_OP_WRITE_U32 or FEC_MMFR_OP_READ_U32
+* @details       The polled access would consume the MII flag the batch waits
+*                for. The batch state is checked and the interface claimed in
+*                the same exclusive area as Eth_Ipw_StartMiiBatch, the access
+*                itself runs with interrupts enabled.
+* @return        Whether the access has been carried out
+*/
+static FUNC(boolean, ETH_CODE) Eth_Ipw_DoPolledMii ( \
+                    CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                    CONST(uint8, AUTOMATIC) u8Trcv, \
+                    CONST(uint8, AUTOMATIC) u8Reg, \
+                    CONSTP2VAR(uint16, AUTOMATIC, ETH_APPL_DATA) pData, \
+                    CONST(uint32, AUTOMATIC) u32Operation \
+                                                   )
+{
+    VAR(boolean, AUTOMATIC) bResult = (boolean)FALSE;
+    VAR(boolean, AUTOMATIC) bClaimed = (boolean)FALSE;
+
+    SchM_Enter_Eth_ETH_EXCLUSIVE_AREA_29();
+    if((0U == Eth_Ipw_au8MiiBatchLeft[u8CtrlIdx]) && ((boolean)FALSE == Eth_Ipw_abMiiPolled[u8CtrlIdx]))
+    {
+        Eth_Ipw_abMiiPolled[u8CtrlIdx] = (boolean)TRUE;
+        bClaimed = (boolean)TRUE;
+    }
+    SchM_Exit_Eth_ETH_EXCLUSIVE_AREA_29();
+
+    if((boolean)TRUE == bClaimed)
+    {
+        bResult = Eth_Fec_DoMiiMMF(u8CtrlIdx, u8Trcv, u8Reg, pData, u32Operation);
+        Eth_Ipw_abMiiPolled[u8CtrlIdx] = (boolean)FALSE;
+    }
+    return bResult;
+}
+
+#endif /* ETH_CTRLENABLE_MII && ETH_MII_BATCH_API */
+
+#if (STD_ON == ETH_UPDATE_PHYS_ADDR_FILTER) && (STD_ON == ETH_RX_EXACT_MCAST_FILTER)
+/*================================================================================================*/
+/**
+* @brief         Binary search of the exact multicast filter
+* @param[in]     u8CtrlIdx Index of the controller
+* @param[in]     u16High Address bytes 0 and 1
+* @param[in]     u32Low Address bytes 2 to 5
+* @param[out]    pbFound Whether the address is in the table
+* @return        Index of the address, or index where it is to be inserted
+*/
+static FUNC(uint8, ETH_CODE) Eth_Ipw_FindMcastAddr  ( \
+                    CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                    CONST(uint16, AUTOMATIC) u16High, \
+                    CONST(uint32, AUTOMATIC) u32Low, \
+                    CONSTP2VAR(boolean, AUTOMATIC, AUTOMATIC) pbFound \
+                                                    )
+{
+    VAR(uint8, AUTOMATIC) u8Low = 0U;
+    VAR(uint8, AUTOMATIC) u8High = Eth_Ipw_au8McastCount[u8CtrlIdx];
+    VAR(uint8, AUTOMATIC) u8Mid;
+
+    *pbFound = (boolean)FALSE;
+    while((u8Low < u8High) && ((boolean)FALSE == *pbFound))
+    {
+        u8Mid = (uint8)((uint8)(u8Low + u8High) >> 1U);
+        if((Eth_Ipw_aMcastTable[u8CtrlIdx][u8Mid].u16High < u16High) || \
+           ((Eth_Ipw_aMcastTable[u8CtrlIdx][u8Mid].u16High == u16High) && \
+            (Eth_Ipw_aMcastTable[u8CtrlIdx][u8Mid].u32Low < u32Low)))
+        {
+            u8Low = (uint8)(u8Mid + 1U);
+        }
+        else if((Eth_Ipw_aMcastTable[u8CtrlIdx][u8Mid].u16High == u16High) && \
+                (Eth_Ipw_aMcastTable[u8CtrlIdx][u8Mid].u32Low == u32Low))
+        {
+            u8Low = u8Mid;
+            *pbFound = (boolean)TRUE;
+        }
+        else
+        {
+            u8High = u8Mid;
+        }
+    }
+    return u8Low;
+}
+
+/*================================================================================================*/
+/**
+* @brief         Applies a filter update to the exact multicast filter
+* @param[in]     u8CtrlIdx Index of the controller
+* @param[in]     pPhysAddrPtr Address added or removed
+* @param[in]     eAction Add or remove
+* @details       Follows the rules of Eth_UpdatePhysAddrFilter: the broadcast
+*                address opens and recovers the filter, the null address closes
+*                it and empties the table. Unicast addresses are not kept. When
+*                the table is full the group hash alone decides until the
+*                filter is closed.
+*/
+static FUNC(void, ETH_CODE) Eth_Ipw_UpdateMcastTable ( \
+                    CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                    P2CONST(uint8, AUTOMATIC, ETH_APPL_CONST) pPhysAddrPtr, \
+                    VAR(Eth_FilterActionType, AUTOMATIC) eAction \
+                                                     )
+{
+    VAR(uint16, AUTOMATIC) u16High;
+    VAR(uint32, AUTOMATIC) u32Low;
+    VAR(uint8, AUTOMATIC) u8Idx;
+    VAR(uint8, AUTOMATIC) u8Move;
+    VAR(boolean, AUTOMATIC) bFound;
+
+    u16High = (uint16)(((uint16)pPhysAddrPtr[0] << 8U) | (uint16)pPhysAddrPtr[1]);
+    u32Low = ((uint32)pPhysAddrPtr[2] << 24U) | ((uint32)pPhysAddrPtr[3] << 16U) | \
+             ((uint32)pPhysAddrPtr[4] << 8U) | (uint32)pPhysAddrPtr[5];
+
+    /* The receive path reads the table from the interrupt */
+    SchM_Enter_Eth_ETH_EXCLUSIVE_AREA_28();
+    if((0U == u16High) && (0UL == u32Low))
+    {   /* Null address closes the filter */
+        Eth_Ipw_au8McastCount[u8CtrlIdx] = 0U;
+        Eth_Ipw_au8McastState[u8CtrlIdx] = ETH_IPW_MCAST_EXACT_U8;
+        Eth_Ipw_abMcastOpen[u8CtrlIdx] = (boolean)FALSE;
+    }
+    else if((0xFFFFU == u16High) && (0xFFFFFFFFUL == u32Low))
+    {   /* Broadcast address opens or recovers the filter */
+        Eth_Ipw_abMcastOpen[u8CtrlIdx] = (boolean)(ETH_ADD_TO_FILTER == eAction);
+    }
+    else if(0U != (pPhysAddrPtr[0] & 1U))
+    {   /* Group address */
+        u8Idx = Eth_Ipw_FindMcastAddr(u8CtrlIdx, u16High, u32Low, &bFound);
+        if(ETH_ADD_TO_FILTER == eAction)
+        {
+            if((boolean)FALSE == bFound)
+            {
+                if(Eth_Ipw_au8McastCount[u8CtrlIdx] < ETH_RX_EXACT_MCAST_FILTER_SIZE)
+                {
+                    for(u8Move = Eth_Ipw_au8McastCount[u8CtrlIdx]; u8Move > u8Idx; u8Move--)
+                    {
+                        Eth_Ipw_aMcastTable[u8CtrlIdx][u8Move] = Eth_Ipw_aMcastTable[u8CtrlIdx][u8Move - 1U];
+                    }
+                    Eth_Ipw_aMcastTable[u8CtrlIdx][u8Idx].u16High = u16High;
+                    Eth_Ipw_aMcastTable[u8CtrlIdx][u8Idx].u32Low = u32Low;
+                    Eth_Ipw_au8McastCount[u8CtrlIdx]++;
+                    if(ETH_IPW_MCAST_HASH_ONLY_U8 == Eth_Ipw_au8McastState[u8CtrlIdx])
+                    {
+                        Eth_Ipw_au8McastState[u8CtrlIdx] = ETH_IPW_MCAST_EXACT_U8;
+                    }
+                }
+                else
+                {   /* The address is only in the group hash now */
+                    Eth_Ipw_au8McastState[u8CtrlIdx] = ETH_IPW_MCAST_OVERFLOW_U8;
+                }
+            }
+        }
+        else if((boolean)TRUE == bFound)
+        {
+            Eth_Ipw_au8McastCount[u8CtrlIdx]--;
+            for(u8Move = u8Idx; u8Move < Eth_Ipw_au8McastCount[u8CtrlIdx]; u8Move++)
+            {
+                Eth_Ipw_aMcastTable[u8CtrlIdx][u8Move] = Eth_Ipw_aMcastTable[u8CtrlIdx][u8Move + 1U];
+            }
+        }
+        else
+        {
+            /* Address not in the table, nothing to remove */
+        }
+    }
+    else
+    {
+        /* Unicast addresses are left to the individual hash */
+    }
+    SchM_Exit_Eth_ETH_EXCLUSIVE_AREA_28();
+}
+#endif /* ETH_UPDATE_PHYS_ADDR_FILTER && ETH_RX_EXACT_MCAST_FILTER */
+
 /*==================================================================================================
 *                                       GLOBAL FUNCTIONS
 ==================================================================================================*/
@@ -284,6 +637,10 @@ FUNC(void, ETH_CODE) Eth_Ipw_DisableController(CONST(uint8, AUTOMATIC) u8CtrlIdx
 
 FUNC(void, ETH_CODE) Eth_Ipw_ResetController(CONST(uint8, AUTOMATIC) u8CtrlIdx)
 {
+#if (STD_ON == ETH_CTRLENABLE_MII) && (STD_ON == ETH_MII_BATCH_API)
+    /* The reset clears the MII interrupt mask, a running batch would never complete */
+    Eth_Ipw_AbortMiiBatch(u8CtrlIdx);
+#endif /* ETH_CTRLENABLE_MII && ETH_MII_BATCH_API */
     Eth_Fec_ResetController(u8CtrlIdx);
 }
 
@@ -295,6 +652,12 @@ FUNC(boolean, ETH_CODE) Eth_Ipw_CheckAccessToController(CONST(uint8, AUTOMATIC)
 FUNC(void, ETH_CODE) Eth_Ipw_ConfigureController(CONST(uint8, AUTOMATIC) u8CtrlIdx)
 {
     Eth_Fec_ConfigureCtrl(u8CtrlIdx);
+#if (STD_ON == ETH_UPDATE_PHYS_ADDR_FILTER) && (STD_ON == ETH_RX_EXACT_MCAST_FILTER)
+    /* The hash tables are back to their configured content */
+    Eth_Ipw_au8McastCount[u8CtrlIdx] = 0U;
+    Eth_Ipw_au8McastState[u8CtrlIdx] = ETH_IPW_MCAST_HASH_ONLY_U8;
+    Eth_Ipw_abMcastOpen[u8CtrlIdx] = (boolean)FALSE;
+#endif /* ETH_UPDATE_PHYS_ADDR_FILTER && ETH_RX_EXACT_MCAST_FILTER */
 }
 
 FUNC(void, ETH_CODE) Eth_Ipw_ClearCounters(CONST(uint8, AUTOMATIC) u8CtrlIdx)
@@ -348,7 +711,85 @@ FUNC(void, ETH_CODE) Eth_Ipw_UpdatePhysAddrFilter   ( \
                                                   )
 {
     Eth_Fec_UpdtePhysAddrFiltr(u8CtrlIdx, pPhysAddrPtr, eAction);
+#if STD_ON == ETH_RX_EXACT_MCAST_FILTER
+    Eth_Ipw_UpdateMcastTable(u8CtrlIdx, pPhysAddrPtr, eAction);
+#endif /* ETH_RX_EXACT_MCAST_FILTER */
 }
+
+#if STD_ON == ETH_RX_EXACT_MCAST_FILTER
+/*================================================================================================*/
+/**
+* @brief         Checks a received destination address against the exact multicast filter
+* @param[in]     u8CtrlIdx Index of the controller
+* @param[in]     pPhysAddrPtr Destination address of the received frame
+* @details       Unicast and broadcast addresses are always accepted.
+* @return        Whether the address is in the multicast table
+*/
+FUNC(boolean, ETH_CODE) Eth_Ipw_IsRxAddrAccepted ( \
+                    CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                    P2CONST(uint8, AUTOMATIC, ETH_APPL_CONST) pPhysAddrPtr \
+                                                 )
+{
+    VAR(boolean, AUTOMATIC) bAccepted = (boolean)TRUE;
+    VAR(uint16, AUTOMATIC) u16High;
+    VAR(uint32, AUTOMATIC) u32Low;
+
+    if((0U != (pPhysAddrPtr[0] & 1U)) && \
+       ((boolean)FALSE == Eth_Ipw_abMcastOpen[u8CtrlIdx]) && \
+       (ETH_IPW_MCAST_EXACT_U8 == Eth_Ipw_au8McastState[u8CtrlIdx]))
+    {
+        u16High = (uint16)(((uint16)pPhysAddrPtr[0] << 8U) | (uint16)pPhysAddrPtr[1]);
+        u32Low = ((uint32)pPhysAddrPtr[2] << 24U) | ((uint32)pPhysAddrPtr[3] << 16U) | \
+                 ((uint32)pPhysAddrPtr[4] << 8U) | (uint32)pPhysAddrPtr[5];
+        if((0xFFFFU != u16High) || (0xFFFFFFFFUL != u32Low))
+        {
+            (void)Eth_Ipw_FindMcastAddr(u8CtrlIdx, u16High, u32Low, &bAccepted);
+        }
+    }
+    return bAccepted;
+}
+
+/*================================================================================================*/
+/**
+* @brief         Receive indication of the FEC layer with the exact multicast filter applied
+* @param[in]     u8CtrlIdx Index of the controller
+* @param[in]     u16FrameType Frame type of the received frame
+* @param[in]     bIsBroadcast TRUE for a broadcast frame
+* @param[in]     pPhysAddrPtr Source address of the received frame
+* @param[in]     pDataPtr Payload of the received frame, right behind its header
+* @param[in]     u16LenByte Payload length
+* @details       Eth_Fec.h maps the EthIf_RxIndication calls of the FEC layer on
+*                this function. The destination address is read from the frame
+*                header in front of the payload. Group frames which passed the
+*                FEC hash only are counted and not indicated to EthIf.
+*/
+FUNC(void, ETH_CODE) Eth_Ipw_RxIndication ( \
+                    VAR(uint8, AUTOMATIC) u8CtrlIdx, \
+                    VAR(Eth_FrameType, AUTOMATIC) u16FrameType, \
+                    VAR(boolean, AUTOMATIC) bIsBroadcast, \
+                    P2VAR(uint8, AUTOMATIC, AUTOMATIC) pPhysAddrPtr, \
+                    P2VAR(Eth_DataType, AUTOMATIC, AUTOMATIC) pDataPtr, \
+                    VAR(uint16, AUTOMATIC) u16LenByte \
+                                          )
+{
+    /** @violates @ref Eth_Ipw_c_REF_5 MISRA rule 17.4 */
+    if(((boolean)TRUE == bIsBroadcast) || \
+       ((boolean)TRUE == Eth_Ipw_IsRxAddrAccepted(u8CtrlIdx, pDataPtr - ETH_IPW_RX_HEADER_LEN_U8)))
+    {
+        /* The parentheses keep the name from being replaced by the mapping macro of Eth_Fec.h */
+        (EthIf_RxIndication)(u8CtrlIdx, u16FrameType, bIsBroadcast, pPhysAddrPtr, pDataPtr, u16LenByte);
+    }
+    else
+    {
+        Eth_Ipw_au32McastDropped[u8CtrlIdx]++;
+    }
+}
+
+FUNC(uint32, ETH_CODE) Eth_Ipw_GetRxFilterDropCount(CONST(uint8, AUTOMATIC) u8CtrlIdx)
+{
+    return Eth_Ipw_au32McastDropped[u8CtrlIdx];
+}
+#endif /* ETH_RX_EXACT_MCAST_FILTER */
 #endif
 FUNC(void, ETH_CODE) Eth_Ipw_GetCounterState ( \
                     CONST(uint8, AUTOMATIC) u8CtrlIdx, \
@@ -358,6 +799,45 @@ FUNC(void, ETH_CODE) Eth_Ipw_GetCounterState ( \
 {
     Eth_Fec_GetCounterState(u8CtrlIdx, u16Counter, pValue);
 }
+#if STD_ON == ETH_MIB_SNAPSHOT_API
+/*================================================================================================*/
+/**
+* @brief         Copies all MIB counters of the controller
+* @param[in]     u8CtrlIdx Index of the controller
+* @param[out]    pSnapshot Filled with the counters
+* @details       The transmit and the receive counter blocks are read word by
+*                word in a single pass. The reserved words between them and
+*                inside the receive block are not accessed.
+*/
+FUNC(void, ETH_CODE) Eth_Ipw_GetMibSnapshot ( \
+                        CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                        CONSTP2VAR(Eth_MibSnapshotType, AUTOMATIC, ETH_APPL_DATA) pSnapshot \
+                                            )
+{
+    VAR(uint16, AUTOMATIC) u16Offset;
+
+    (void)u8CtrlIdx;
+    for(u16Offset = FEC_RMON_T_DROP_ADDR16; u16Offset <= FEC_IEEE_T_OCTETS_OK_ADDR16; u16Offset += 4U)
+    {
+        pSnapshot->Counter[ETH_MIB_COUNTER_IDX(u16Offset)] = REG_READ32(ETH_IPW_FEC_REG_ADDR32(u16Offset));
+    }
+    for(u16Offset = FEC_IEEE_T_OCTETS_OK_ADDR16 + 4U; u16Offset < FEC_RMON_R_DROP_ADDR16; u16Offset += 4U)
+    {
+        pSnapshot->Counter[ETH_MIB_COUNTER_IDX(u16Offset)] = 0UL;
+    }
+    for(u16Offset = FEC_RMON_R_DROP_ADDR16; u16Offset <= FEC_RMON_R_JAB_ADDR16; u16Offset += 4U)
+    {
+        pSnapshot->Counter[ETH_MIB_COUNTER_IDX(u16Offset)] = REG_READ32(ETH_IPW_FEC_REG_ADDR32(u16Offset));
+    }
+    /* Reserved word between FEC_RMON_R_JAB and FEC_RMON_R_P64 */
+    pSnapshot->Counter[ETH_MIB_COUNTER_IDX(FEC_RMON_R_JAB_ADDR16 + 4U)] = 0UL;
+    for(u16Offset = FEC_RMON_R_P64_ADDR16; u16Offset <= FEC_IEEE_R_OCTETS_OK_ADDR16; u16Offset += 4U)
+    {
+        pSnapshot->Counter[ETH_MIB_COUNTER_IDX(u16Offset)] = REG_READ32(ETH_IPW_FEC_REG_ADDR32(u16Offset));
+    }
+}
+#endif /* ETH_MIB_SNAPSHOT_API */
+
 FUNC(boolean, ETH_CODE) Eth_Ipw_ProvideBufferDataArea   ( \
                         CONST(uint8, AUTOMATIC) u8CtrlIdx, \
                         CONSTP2VAR(uint8, AUTOMATIC, ETH_APPL_DATA) pBufIdx, \
@@ -400,7 +880,11 @@ FUNC(boolean, ETH_CODE) Eth_Ipw_WriteMii    ( \
                         CONSTP2VAR(uint16, AUTOMATIC, ETH_APPL_DATA) pData \
                                             )
 {
+#if STD_ON == ETH_MII_BATCH_API
+    return Eth_Ipw_DoPolledMii(u8CtrlIdx, u8Trcv, u8Reg, pData, FEC_MMFR_OP_WRITE_U32);
+#else
     return Eth_Fec_DoMiiMMF(u8CtrlIdx, u8Trcv, u8Reg, pData, FEC_MMFR_OP_WRITE_U32);    
+#endif /* ETH_MII_BATCH_API */
 }
 
 FUNC(boolean, ETH_CODE) Eth_Ipw_ReadMii ( \
@@ -410,8 +894,134 @@ FUNC(boolean, ETH_CODE) Eth_Ipw_ReadMii ( \
                         CONSTP2VAR(uint16, AUTOMATIC, ETH_APPL_DATA) pData \
                                         )
 { 
+#if STD_ON == ETH_MII_BATCH_API
+    return Eth_Ipw_DoPolledMii(u8CtrlIdx, u8Trcv, u8Reg, pData, FEC_MMFR_OP_READ_U32);
+#else
     return Eth_Fec_DoMiiMMF(u8CtrlIdx, u8Trcv, u8Reg, pData, FEC_MMFR_OP_READ_U32);
+#endif /* ETH_MII_BATCH_API */
+}
+
+#if STD_ON == ETH_MII_BATCH_API
+/*================================================================================================*/
+/**
+* @brief         Starts a batch of MII management transactions
+* @param[in]     u8CtrlIdx Index of the controller
+* @param[in,out] pTransactions Transactions carried out in order, read values
+*                are stored back into them
+* @param[in]     u8Count Number of transactions, greater than zero
+* @param[in]     pfNotification Called from the MII interrupt once the batch
+*                has finished, may be NULL_PTR
+* @details       The first management frame is started here, every following
+*                one is chained from the MII interrupt so the caller does not
+*                wait for the transactions. The transactions must stay valid
+*                until the notification.
+* @return        Whether the batch has been started
+* @retval        TRUE The batch is running
+* @retval        FALSE Another batch or a polled access is still running on
+*                the controller
+*/
+FUNC(boolean, ETH_CODE) Eth_Ipw_StartMiiBatch   ( \
+                        CONST(uint8, AUTOMATIC) u8CtrlIdx, \
+                        P2VAR(Eth_MiiTransactionType, AUTOMATIC, ETH_APPL_DATA) pTransactions, \
+                        CONST(uint8, AUTOMATIC) u8Count, \
+                        CONST(Eth_MiiBatchNotificationType, AUTOMATIC) pfNotification \
+                                                )
+{
+    VAR(boolean, AUTOMATIC) bResult = (boolean)FALSE;
+
+    SchM_Enter_Eth_ETH_EXCLUSIVE_AREA_29();
+    if((0U == Eth_Ipw_au8MiiBatchLeft[u8CtrlIdx]) && ((boolean)FALSE == Eth_Ipw_abMiiPolled[u8CtrlIdx]))
+    {
+        Eth_Ipw_apMiiBatchCurrent[u8CtrlIdx] = pTransactions;
+        Eth_Ipw_apfMiiBatchNotification[u8CtrlIdx] = pfNotification;
+        Eth_Ipw_au8MiiBatchLeft[u8CtrlIdx] = u8Count;
+        /* Drop a completion left over by a polled access before unmasking */
+        REG_WRITE32(ETH_IPW_FEC_REG_ADDR32(FEC_EIR_ADDR16), FEC_EIR_MII_W1C);
+        REG_BIT_SET32(ETH_IPW_FEC_REG_ADDR32(FEC_EIMR_ADDR16), FEC_EIMR_MII_U32);
+        Eth_Ipw_StartMiiFrame(pTransactions);
+        bResult = (boolean)TRUE;
+    }
+    SchM_Exit_Eth_ETH_EXCLUSIVE_AREA_29();
+    return bResult;
+}
+
+/*================================================================================================*/
+/**
+* @brief         Completes the current batch transaction and starts the next one
+* @param[in]     u8CtrlIdx Index of the controller
+* @details       Called from the MII interrupt. The read value of the finished
+*                transaction is stored, the next management frame is started
+*                and the notification is called after the last one.
+*/
+FUNC(void, ETH_CODE) Eth_Ipw_ProcessMiiInterrupt(CONST(uint8, AUTOMATIC) u8CtrlIdx)
+{
+    P2VAR(Eth_MiiTransactionType, AUTOMATIC, ETH_APPL_DATA) pTransaction;
+    VAR(Eth_MiiBatchNotificationType, AUTOMATIC) pfNotification = NULL_PTR;
+
+    Eth_Ipw_ClearMiiInterruptFlag(u8CtrlIdx);
+    SchM_Enter_Eth_ETH_EXCLUSIVE_AREA_29();
+    /* Nothing to do for a spurious interrupt or a batch aborted meanwhile */
+    if(0U != Eth_Ipw_au8MiiBatchLeft[u8CtrlIdx])
+    {
+        pTransaction = Eth_Ipw_apMiiBatchCurrent[u8CtrlIdx];
+        if((VAR(boolean, AUTOMATIC))FALSE == pTransaction->bWrite)
+        {
+            pTransaction->RegVal = (uint16)(REG_READ32(ETH_IPW_FEC_REG_ADDR32(FEC_MMFR_ADDR16)) & FEC_MMFR_DATA_U32);
+        }
+        Eth_Ipw_au8MiiBatchLeft[u8CtrlIdx]--;
+        if(0U != Eth_Ipw_au8MiiBatchLeft[u8CtrlIdx])
+        {
+            /** @violates @ref Eth_Ipw_c_REF_5 MISRA rule 17.4 */
+            pTransaction++;
+            Eth_Ipw_apMiiBatchCurrent[u8CtrlIdx] = pTransaction;
+            Eth_Ipw_StartMiiFrame(pTransaction);
+        }
+        else
+        {
+            REG_BIT_CLEAR32(ETH_IPW_FEC_REG_ADDR32(FEC_EIMR_ADDR16), FEC_EIMR_MII_U32);
+            pfNotification = Eth_Ipw_apfMiiBatchNotification[u8CtrlIdx];
+        }
+    }
+    SchM_Exit_Eth_ETH_EXCLUSIVE_AREA_29();
+    if(NULL_PTR != pfNotification)
+    {
+        pfNotification(u8CtrlIdx, ETH_OK);
+    }
+}
+
+/*================================================================================================*/
+/**
+* @brief         Drops the running batch of the controller
+* @param[in]     u8CtrlIdx Index of the controller
+* @details       The MII interrupt is masked again and the batch owner is
+*                notified with ETH_E_NO_ACCESS. A management frame already
+*                started still completes on the MII bus.
+*/
+FUNC(void, ETH_CODE) Eth_Ipw_AbortMiiBatch(CONST(uint8, AUTOMATIC) u8CtrlIdx)
+{
+    VAR(Eth_MiiBatchNotificationType, AUTOMATIC) pfNotification = NULL_PTR;
+
+    SchM_Enter_Eth_ETH_EXCLUSIVE_AREA_29();
+    if(0U != Eth_Ipw_au8MiiBatchLeft[u8CtrlIdx])
+    {
+        REG_BIT_CLEAR32(ETH_IPW_FEC_REG_ADDR32(FEC_EIMR_ADDR16), FEC_EIMR_MII_U32);
+        REG_WRITE32(ETH_IPW_FEC_REG_ADDR32(FEC_EIR_ADDR16), FEC_EIR_MII_W1C);
+        Eth_Ipw_au8MiiBatchLeft[u8CtrlIdx] = 0U;
+        pfNotification = Eth_Ipw_apfMiiBatchNotification[u8CtrlIdx];
+    }
+    SchM_Exit_Eth_ETH_EXCLUSIVE_AREA_29();
+    if(NULL_PTR != pfNotification)
+    {
+        pfNotification(u8CtrlIdx, ETH_E_NO_ACCESS);
+    }
+}
+
+FUNC(void, ETH_CODE) Eth_Ipw_ClearMiiInterruptFlag(CONST(uint8, AUTOMATIC) u8CtrlIdx)
+{
+    (void)u8CtrlIdx;
+    REG_WRITE32(ETH_IPW_FEC_REG_ADDR32(FEC_EIR_ADDR16), FEC_EIR_MII_W1C);
 }
+#endif /* ETH_MII_BATCH_API */
 #endif /* ETH_CTRLENABLE_MII */
 
 FUNC(void, ETH_CODE) Eth_Ipw_ClearRxInterruptFlag(CONST(uint8, AUTOMATIC) u8CtrlIdx)
@@ -207,6 +207,9 @@ LOCAL_INLINE void Eth_TxIrqHdlr (CONST(uint8, AUTOMATIC) u8CtrlIdx);
 #if defined(ETH_COMBINED_IRQ_SCR) && (STD_ON == ETH_COMBINED_IRQ_SCR)
 LOCAL_INLINE void Eth_TxRxIrqHdlr (CONST(uint8, AUTOMATIC) u8CtrlIdx);
 #endif
+#if (STD_ON == ETH_CTRLENABLE_MII) && (STD_ON == ETH_MII_BATCH_API)
+LOCAL_INLINE void Eth_MiiIrqHdlr (CONST(uint8, AUTOMATIC) u8CtrlIdx);
+#endif
 
 /*==================================================================================================
 *                                       LOCAL FUNCTIONS
@@ -410,6 +413,36 @@ LOCAL_INLINE void Eth_TxRxIrqHdlr (CONST(uint8, AUTOMATIC) u8CtrlIdx)
 }
 #endif
 
+#if (STD_ON == ETH_CTRLENABLE_MII) && (STD_ON == ETH_MII_BATCH_API)
+/**
+* @brief         MII management interrupt handler for specific controller
+* @details       The finished transaction of the running MII batch is
+*                completed and the next one is started.
+* @param[in]     u8CtrlIdx Index of controller to be processed
+* @violates @ref Eth_Irq_c_REF_5 MISRA 2004 Rule 8.10
+*/
+LOCAL_INLINE void Eth_MiiIrqHdlr (CONST(uint8, AUTOMATIC) u8CtrlIdx)
+{
+    if(ETH_STATE_ACTIVE != Eth_CtrlState[u8CtrlIdx])
+    {
+        #if STD_ON == ETH_DEV_ERROR_DETECT
+        (void)Det_ReportError ( \
+            (VAR(uint8, AUTOMATIC)) ETH_MODULE_ID, \
+            ETH_DRIVER_INSTANCE, (VAR(uint8, AUTOMATIC)) ETH_SID_MIIIRQHDLR, \
+            ETH_E_NOT_INITIALIZED \
+                              );
+        #endif /* ETH_DEV_ERROR_DETECT  */
+        /* Clear the interrupt flag to avoid isr flood on failure */
+        Eth_Ipw_ClearMiiInterruptFlag(u8CtrlIdx);
+    }
+    else
+    {
+        /* This call also handles the interrupt flag */
+        Eth_Ipw_ProcessMiiInterrupt(u8CtrlIdx);
+    }
+}
+#endif
+
 
 /*==================================================================================================
 *                                       GLOBAL FUNCTIONS
@@ -454,6 +487,25 @@ ISR(Eth_TxIrqHdlr_0)
     EXIT_INTERRUPT();     
 }
 
+#if (STD_ON == ETH_CTRLENABLE_MII) && (STD_ON == ETH_MII_BATCH_API)
+/*================================================================================================*/
+/**
+* @brief         MII management interrupt handler for the controller 0
+* @details       Chains the transactions started by Eth_MiiBatch. Installed on
+*                the FEC interrupt 196, which carries the MII event.
+* @isr
+* @violates @ref Eth_Irq_c_REF_5 MISRA 2004 Rule 8.10
+*/
+ISR(Eth_MiiIrqHdlr_0)
+{
+    Eth_MiiIrqHdlr((uint8)0U);
+    /**
+     * @violates @ref Eth_Irq_c_REF_4 MISRA rule 11.1
+     */
+    EXIT_INTERRUPT();
+}
+#endif
+
 /* This ISR is used only in ARM platform which doesnot have separated IRQ vectors */
 #if defined(ETH_COMBINED_IRQ_SCR) && (STD_ON == ETH_COMBINED_IRQ_SCR)
 /*================================================================================================*/
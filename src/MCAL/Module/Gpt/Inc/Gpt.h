@@ -142,6 +142,14 @@ extern "C"{
 */
 #define GPT_E_INVALID_CALL    ((uint8)0xA0U)
 
+#if (GPT_VTIMER_API == STD_ON)
+/**
+* @brief virtual timer service called with a handle not initialized by Gpt_VTimerInit()
+* @details Errors and exceptions that will be detected by the GPT driver
+*/
+#define GPT_E_VTIMER_UNINIT   ((uint8)0xA1U)
+#endif /* GPT_VTIMER_API == STD_ON */
+
 
 /**
 * @brief function called without module initialization
@@ -305,6 +313,48 @@ extern "C"{
 */
 #define GPT_SET_CLOCK_MODE_ID                      ((uint8)0x10U)
 
+#if (GPT_VTIMER_API == STD_ON)
+/**
+* @brief   API service ID for Gpt_VTimerStart function
+* @details Parameters used when raising an error/exception
+*/
+#define GPT_VTIMER_START_ID                        ((uint8)0x11U)
+
+/**
+* @brief   API service ID for Gpt_VTimerCancel function
+* @details Parameters used when raising an error/exception
+*/
+#define GPT_VTIMER_CANCEL_ID                       ((uint8)0x12U)
+
+/**
+* @brief   API service ID for Gpt_VTimerIsActive function
+* @details Parameters used when raising an error/exception
+*/
+#define GPT_VTIMER_ISACTIVE_ID                     ((uint8)0x13U)
+
+/**
+* @brief   API service ID for Gpt_VTimerInit function
+* @details Parameters used when raising an error/exception
+*/
+#define GPT_VTIMER_INIT_ID                         ((uint8)0x14U)
+
+/**
+* @brief   Longest delay or period (in ticks) accepted by the virtual timer wheel.
+*/
+#define GPT_VTIMER_MAX_TICKS                       ((Gpt_ValueType)0x7FFFFFFFU)
+
+/**
+* @brief   Value of the u32InitMark field of an initialized virtual timer handle.
+*/
+#define GPT_VTIMER_INIT_MARK                       ((uint32)0x56544D52UL)
+
+/**
+* @brief   Static initializer of a Gpt_VTimerType handle, equivalent to Gpt_VTimerInit().
+*/
+#define GPT_VTIMER_INITIALIZER \
+    { NULL_PTR, NULL_PTR, 0U, (Gpt_ValueType)0U, NULL_PTR, NULL_PTR, 0U, 0U, (boolean)FALSE, 0U, GPT_VTIMER_INIT_MARK }
+#endif /* GPT_VTIMER_API == STD_ON */
+
 /**
 * @brief Instance ID of this GPT driver.
 *
@@ -416,6 +466,45 @@ typedef struct
     CONST(Gpt_ChannelType, GPT_CONST) Gpt_aHw2LogicChannelMap[GPT_CHANNEL_IDX_NUM];
 } Gpt_ConfigType;
 
+#if (GPT_VTIMER_API == STD_ON)
+/**
+* @brief Virtual timer expiry callback. Called from the GPT interrupt with the context pointer
+*        given to Gpt_VTimerStart().
+*/
+typedef P2FUNC(void, GPT_APPL_CODE, Gpt_VTimerCallbackType)(P2VAR(void, AUTOMATIC, GPT_APPL_DATA) pContext);
+
+/**
+* @brief Virtual timer handle. Allocated by the application, initialized with Gpt_VTimerInit()
+*        or GPT_VTIMER_INITIALIZER and linked into the timer wheel by Gpt_VTimerStart(); the
+*        fields are private to the driver.
+*/
+typedef struct Gpt_VTimerTag
+{
+    /**< @brief Next timer in the same wheel slot */
+    P2VAR(struct Gpt_VTimerTag, GPT_VAR, GPT_APPL_DATA) pNext;
+    /**< @brief Previous timer in the same wheel slot */
+    P2VAR(struct Gpt_VTimerTag, GPT_VAR, GPT_APPL_DATA) pPrev;
+    /**< @brief Absolute expiry time in wheel ticks */
+    VAR(uint32, GPT_VAR) u32Expiry;
+    /**< @brief Reload period in ticks, 0 for a one-shot timer */
+    VAR(Gpt_ValueType, GPT_VAR) uPeriod;
+    /**< @brief Expiry callback */
+    VAR(Gpt_VTimerCallbackType, GPT_VAR) pfCallback;
+    /**< @brief Context passed to the expiry callback */
+    P2VAR(void, GPT_VAR, GPT_APPL_DATA) pContext;
+    /**< @brief Wheel level the timer is linked in */
+    VAR(uint8, GPT_VAR) u8Level;
+    /**< @brief Wheel slot the timer is linked in */
+    VAR(uint8, GPT_VAR) u8Slot;
+    /**< @brief TRUE while the timer is linked in the wheel of epoch u32Epoch */
+    VAR(boolean, GPT_VAR) bActive;
+    /**< @brief Wheel epoch the timer was linked in */
+    VAR(uint32, GPT_VAR) u32Epoch;
+    /**< @brief GPT_VTIMER_INIT_MARK once the handle is initialized */
+    VAR(uint32, GPT_VAR) u32InitMark;
+} Gpt_VTimerType;
+#endif /* GPT_VTIMER_API == STD_ON */
+
 
 /*==================================================================================================
 *                                GLOBAL VARIABLE DECLARATIONS
@@ -477,6 +566,14 @@ FUNC(void, GPT_CODE) Gpt_StartTimer
     VAR(Gpt_ValueType, AUTOMATIC) value
 );
 
+#if (GPT_UNCHECKED_API == STD_ON)
+FUNC(void, GPT_CODE) Gpt_StartTimer_Unchecked
+(
+    VAR(Gpt_ChannelType, AUTOMATIC) channel,
+    VAR(Gpt_ValueType, AUTOMATIC) value
+);
+#endif
+
 FUNC(void, GPT_CODE) Gpt_StopTimer
 (
     VAR(Gpt_ChannelType, AUTOMATIC) channel
@@ -511,6 +608,29 @@ FUNC (void, GPT_CODE) Gpt_ChangeNextTimeoutValue
 FUNC (void, GPT_CODE) Gpt_SetClockMode(VAR(Gpt_ClockModeType, AUTOMATIC) eClkMode);
 #endif
 
+#if (GPT_VTIMER_API == STD_ON)
+FUNC(void, GPT_CODE) Gpt_VTimerInit(P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer);
+
+FUNC(Std_ReturnType, GPT_CODE) Gpt_VTimerStart
+(
+    P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer,
+    VAR(Gpt_ValueType, AUTOMATIC) delay,
+    VAR(Gpt_ValueType, AUTOMATIC) period,
+    VAR(Gpt_VTimerCallbackType, AUTOMATIC) pfCallback,
+    P2VAR(void, AUTOMATIC, GPT_APPL_DATA) pContext
+);
+
+FUNC(void, GPT_CODE) Gpt_VTimerCancel(P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer);
+
+FUNC(boolean, GPT_CODE) Gpt_VTimerIsActive(P2CONST(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer);
+#endif
+
+#if (GPT_STM_TIMEBASE_API == STD_ON)
+FUNC(uint64, GPT_CODE) Gpt_GetTimestamp(void);
+
+FUNC(uint64, GPT_CODE) Gpt_TimestampToNs(VAR(uint64, AUTOMATIC) ticks);
+#endif
+
 
 #define GPT_STOP_SEC_CODE
 /** @violates @ref GPT_H_REF_2 Repeated include file MemMap.h */
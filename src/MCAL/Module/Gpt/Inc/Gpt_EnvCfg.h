@@ -86,6 +86,44 @@ extern "C"{
 #define GPT_VALIDATE_STATE          (GPT_DEV_ERROR_DETECT)
 #define GPT_VALIDATE_PARAM          (GPT_DEV_ERROR_DETECT)
 
+/**
+* @brief   Switches the virtual timer wheel service (Gpt_VTimerStart/Gpt_VTimerCancel) on or off.
+* @details When enabled, the logical channel GPT_VTIMER_CHANNEL is owned by the timer wheel and
+*          must be configured in one-shot mode; the application shall not start or stop it directly.
+*/
+#define GPT_VTIMER_API              (STD_OFF)
+
+/**
+* @brief   Logical GPT channel driving the virtual timer wheel.
+*/
+#define GPT_VTIMER_CHANNEL          ((Gpt_ChannelType)0U)
+
+/**
+* @brief   Switches the 64-bit STM timestamp service (Gpt_GetTimestamp/Gpt_TimestampToNs) on or off.
+* @details The counter of STM module GPT_STM_TIMEBASE_MODULE is extended in software to 63 bits.
+*          At least one STM channel of that module shall be configured so that Gpt_Init enables
+*          the counter.
+*/
+#define GPT_STM_TIMEBASE_API        (STD_OFF)
+
+/**
+* @brief   STM module whose free running counter is used as timestamp source.
+*/
+#define GPT_STM_TIMEBASE_MODULE     (0U)
+
+/**
+* @brief   Counting frequency of the timestamp STM module in Hz (module clock divided by the
+*          configured prescaler). Used only for the conversion to nanoseconds.
+*/
+#define GPT_STM_TIMEBASE_FREQ_HZ    (80000000UL)
+
+/**
+* @brief   Switches Gpt_StartTimer_Unchecked on or off.
+* @details Gpt_StartTimer_Unchecked starts a channel like Gpt_StartTimer without the channel, state
+*          and timeout value checks, for callers which already guarantee them.
+*/
+#define GPT_UNCHECKED_API           (STD_OFF)
+
 /*==================================================================================================
                                              ENUMS
 ==================================================================================================*/
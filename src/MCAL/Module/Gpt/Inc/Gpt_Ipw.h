@@ -147,6 +147,12 @@ FUNC (void, GPT_CODE) Gpt_Ipw_DisableInterrupt(P2CONST(Gpt_HwChannelConfigType,
 FUNC (void, GPT_CODE) Gpt_Ipw_SetClockMode(P2CONST(Gpt_HwChannelConfigType, AUTOMATIC,GPT_APPL_CONST) pHwChannelConfig,
                                                 VAR(Gpt_ClockModeType, AUTOMATIC) clkMode);
 #endif
+
+#if (GPT_STM_TIMEBASE_API == STD_ON)
+FUNC (uint64, GPT_CODE) Gpt_Ipw_GetTimestamp(void);
+
+FUNC (uint64, GPT_CODE) Gpt_Ipw_TimestampToNs(VAR(uint64, AUTOMATIC) u64Ticks);
+#endif
 #define GPT_STOP_SEC_CODE
 /** @violates @ref GPT_IPW_H_REF_1 Repeated include file MemMap.h */
 #include "MemMap.h"
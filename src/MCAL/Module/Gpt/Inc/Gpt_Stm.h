@@ -184,6 +184,12 @@ FUNC (void, GPT_CODE) Gpt_Stm_SetClockMode
 );
 #endif
 
+#if (GPT_STM_TIMEBASE_API == STD_ON)
+FUNC (uint64, GPT_CODE) Gpt_Stm_GetTimestamp(void);
+
+FUNC (uint64, GPT_CODE) Gpt_Stm_TimestampToNs(VAR(uint64, AUTOMATIC) u64Ticks);
+#endif
+
 #define GPT_STOP_SEC_CODE
 /** @violates @ref GPT_STM_H_REF_1 Repeated include file MemMap.h */
 #include "MemMap.h"
@@ -189,6 +189,10 @@ extern "C"{
     #endif
 #endif /* GPT_DEV_ERROR_DETECT */
 
+#if ((GPT_STM_TIMEBASE_API == STD_ON) && (GPT_STM_USED == STD_OFF))
+    #error "GPT_STM_TIMEBASE_API requires at least one STM channel to be configured"
+#endif
+
 /*==================================================================================================
 *                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
@@ -230,10 +234,55 @@ typedef struct
 #endif
 } Gpt_ChannelInfoType;
 
+/**
+* @brief Gpt interrupt dispatch entry. One entry per hardware channel index, resolved from the
+*        configuration by Gpt_Init() so that the interrupt path does not walk the configuration.
+*
+*/
+typedef struct
+{
+    /**< @brief Notification to call, NULL_PTR while the notification is disabled or in sleep mode */
+    VAR(Gpt_NotificationType, GPT_VAR) pfNotification;
+    /**< @brief Hardware channel to stop on expiry, NULL_PTR for continuous channels */
+    P2CONST(Gpt_HwChannelConfigType, GPT_VAR, GPT_APPL_CONST) pOneShotHwChannel;
+    /**< @brief Status of the logical channel, set to expired for one-shot channels */
+    P2VAR(Gpt_ChannelStatusType, GPT_VAR, GPT_VAR) peChannelStatus;
+    /**< @brief Logical channel, GPT_DISPATCH_NO_CHANNEL for unused hardware channel indexes */
+    VAR(Gpt_ChannelType, GPT_VAR) channel;
+} Gpt_DispatchType;
+
 
 /*==================================================================================================
 *                                       LOCAL MACROS
 ==================================================================================================*/
+/**
+* @brief Logical channel value marking an unused entry of the interrupt dispatch table.
+*/
+#define GPT_DISPATCH_NO_CHANNEL     ((Gpt_ChannelType)0xFFU)
+
+#if (GPT_VTIMER_API == STD_ON)
+/**
+* @brief Number of levels of the virtual timer wheel. Six levels of 32 slots cover bits 0..29 of
+*        the wheel time, the top level holds the remaining two bits.
+*/
+#define GPT_VTIMER_LEVELS           (7U)
+/**
+* @brief Index of the top (coarsest) level of the virtual timer wheel.
+*/
+#define GPT_VTIMER_TOP_LEVEL        (6U)
+/**
+* @brief Number of slots per wheel level.
+*/
+#define GPT_VTIMER_SLOTS            (32U)
+/**
+* @brief Number of wheel time bits resolved by one level.
+*/
+#define GPT_VTIMER_SLOT_BITS        (5U)
+/**
+* @brief Mask selecting the slot index out of the wheel time of a level.
+*/
+#define GPT_VTIMER_SLOT_MASK        ((uint32)0x1FU)
+#endif /* GPT_VTIMER_API == STD_ON */
 
 /*==================================================================================================
 *                                      LOCAL CONSTANTS
@@ -280,6 +329,52 @@ static VAR(Gpt_ChannelInfoType, GPT_VAR) Gpt_aChannelInfo[GPT_HW_CHANNEL_NUM];
 */
 static volatile VAR(Gpt_ValueType,GPT_VAR) Gpt_aStopTime[GPT_HW_CHANNEL_NUM];
 
+/**
+* @brief         Interrupt dispatch table indexed by the hardware channel index passed to
+*                Gpt_ProcessCommonInterrupt().
+*/
+static VAR(Gpt_DispatchType, GPT_VAR) Gpt_aDispatch[GPT_CHANNEL_IDX_NUM];
+
+#if (GPT_VTIMER_API == STD_ON)
+/**
+* @brief         Heads of the doubly linked timer lists of every wheel slot.
+*/
+static P2VAR(Gpt_VTimerType, GPT_VAR, GPT_APPL_DATA) Gpt_apVTimerSlot[GPT_VTIMER_LEVELS][GPT_VTIMER_SLOTS];
+
+/**
+* @brief         One bit per non-empty slot for each wheel level.
+*/
+static VAR(uint32, GPT_VAR) Gpt_au32VTimerBitmap[GPT_VTIMER_LEVELS];
+
+/**
+* @brief         Current wheel time in ticks. Only advanced when the wheel channel expires or when
+*                a timer is started while the wheel channel is running.
+*/
+static VAR(uint32, GPT_VAR) Gpt_u32VTimerNow;
+
+/**
+* @brief         Timeout the wheel channel has been started with. 0 when the wheel channel is not
+*                running.
+*/
+static VAR(Gpt_ValueType, GPT_VAR) Gpt_uVTimerArmed;
+
+/**
+* @brief         Part of the running channel timeout already added to Gpt_u32VTimerNow.
+*/
+static VAR(Gpt_ValueType, GPT_VAR) Gpt_uVTimerConsumed;
+
+/**
+* @brief         TRUE while the wheel is being processed from the channel interrupt.
+*/
+static VAR(boolean, GPT_VAR) Gpt_bVTimerInIsr;
+
+/**
+* @brief         Wheel epoch, advanced by every Gpt_Init(). A handle linked in an older epoch is
+*                no longer in the wheel.
+*/
+static VAR(uint32, GPT_VAR) Gpt_u32VTimerEpoch;
+#endif /* GPT_VTIMER_API == STD_ON */
+
 #define GPT_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 /** @violates @ref GPT_C_REF_1 Only preprocessor statements and comments before "#include" */
 /** @violates @ref GPT_C_REF_2 Repeated include file MemMap.h */
@@ -377,6 +472,46 @@ LOCAL_INLINE FUNC(Std_ReturnType,GPT_CODE) Gpt_ValidateParamSetClockMode
 );
 #endif
 
+static FUNC(void, GPT_CODE) Gpt_InitDispatch(void);
+
+LOCAL_INLINE FUNC(void, GPT_CODE) Gpt_StartTimerChannel
+(
+    VAR(Gpt_ChannelType, AUTOMATIC) channel,
+    VAR(Gpt_ValueType, AUTOMATIC) value
+);
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+static FUNC(void, GPT_CODE) Gpt_UpdateDispatchNotification(VAR(Gpt_ChannelType, AUTOMATIC) channel);
+#endif
+
+#if (GPT_VTIMER_API == STD_ON)
+#if (GPT_VALIDATE_PARAM == STD_ON)
+LOCAL_INLINE FUNC(Std_ReturnType,GPT_CODE) Gpt_ValidateVTimerPtr
+(
+    VAR(uint8, AUTOMATIC) u8ServiceId,
+    P2CONST(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer
+);
+
+LOCAL_INLINE FUNC(Std_ReturnType,GPT_CODE) Gpt_ValidateVTimerStart
+(
+    P2CONST(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer,
+    VAR(Gpt_ValueType, AUTOMATIC) delay,
+    VAR(Gpt_ValueType, AUTOMATIC) period,
+    VAR(Gpt_VTimerCallbackType, AUTOMATIC) pfCallback
+);
+#endif
+
+static FUNC(void, GPT_CODE) Gpt_VTimerReset(void);
+static FUNC(uint32, GPT_CODE) Gpt_VTimerLowestBit(VAR(uint32, AUTOMATIC) u32Bitmap);
+static FUNC(void, GPT_CODE) Gpt_VTimerLink(P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer);
+static FUNC(void, GPT_CODE) Gpt_VTimerUnlink(P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer);
+static FUNC(boolean, GPT_CODE) Gpt_VTimerLinked(P2CONST(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer);
+static FUNC(boolean, GPT_CODE) Gpt_VTimerNextEvent(P2VAR(uint32, AUTOMATIC, AUTOMATIC) pu32Distance);
+static FUNC(void, GPT_CODE) Gpt_VTimerCascade(void);
+static FUNC(void, GPT_CODE) Gpt_VTimerArm(void);
+static FUNC(void, GPT_CODE) Gpt_VTimerProcess(void);
+#endif /* GPT_VTIMER_API == STD_ON */
+
 /*==================================================================================================
 *                                       LOCAL FUNCTIONS
 ==================================================================================================*/
@@ -823,41 +958,600 @@ LOCAL_INLINE FUNC(Std_ReturnType,GPT_CODE) Gpt_ValidateParamPtrInit
     }
     else
     {
-        returnValue=(Std_ReturnType)E_OK;
+        returnValue=(Std_ReturnType)E_OK;
+    }
+#endif
+#endif
+
+    return returnValue;
+}
+#endif
+
+#if (GPT_SET_CLOCK_MODE == STD_ON) && (GPT_VALIDATE_PARAM == STD_ON)
+LOCAL_INLINE FUNC(Std_ReturnType,GPT_CODE) Gpt_ValidateParamSetClockMode
+(
+    VAR(Gpt_ClockModeType, AUTOMATIC) eClkMode
+)
+{
+    VAR(Std_ReturnType,AUTOMATIC) returnValue = (Std_ReturnType)E_NOT_OK;
+
+    if((GPT_CLOCKMODE_NORMAL != eClkMode) && (GPT_CLOCKMODE_ALTERNATE != eClkMode))
+    {
+        (void)Det_ReportError\
+        (\
+            (uint16)GPT_MODULE_ID,\
+            (uint8)GPT_INSTANCE_ID,\
+            (uint8)GPT_SET_CLOCK_MODE_ID,\
+            (uint8)GPT_E_PARAM_CLOCK_MODE\
+        );
+    }
+    else
+    {
+        returnValue=(Std_ReturnType)E_OK;
+    }
+
+    return returnValue;
+}
+#endif
+
+/**
+ * @brief       Builds the interrupt dispatch table from the current configuration.
+ * @details     Each configured channel gets the entry of the hardware channel index its interrupt
+ *              handler reports, holding the resolved data needed on expiry. Notifications start
+ *              disabled, as after Gpt_Init().
+ *
+ * */
+static FUNC(void, GPT_CODE) Gpt_InitDispatch(void)
+{
+    VAR(uint32, AUTOMATIC) u32Index;
+    VAR(Gpt_ChannelType, AUTOMATIC) channel;
+    P2CONST(Gpt_ChannelConfigType, AUTOMATIC, GPT_APPL_CONST) pChannelConfig;
+
+    for (u32Index = 0U; u32Index < (uint32)GPT_CHANNEL_IDX_NUM; u32Index++)
+    {
+        Gpt_aDispatch[u32Index].pfNotification = NULL_PTR;
+        Gpt_aDispatch[u32Index].pOneShotHwChannel = NULL_PTR;
+        Gpt_aDispatch[u32Index].peChannelStatus = NULL_PTR;
+        Gpt_aDispatch[u32Index].channel = GPT_DISPATCH_NO_CHANNEL;
+    }
+
+    for (channel = 0U; channel < (Gpt_ChannelType)Gpt_pConfig->Gpt_uChannelCount; channel++)
+    {
+        pChannelConfig = &((*(Gpt_pConfig->Gpt_pChannelConfig))[channel]);
+        /* Same index as computed by Gpt_Ipw_ProcessCommonInterrupt() */
+        u32Index = (uint32)pChannelConfig->Gpt_HwChannelConfig.Gpt_u8HwChannel + \
+                   (uint32)pChannelConfig->Gpt_HwChannelConfig.Gpt_u8HwModule;
+
+        if (u32Index < (uint32)GPT_CHANNEL_IDX_NUM)
+        {
+            if (GPT_CH_MODE_ONESHOT == pChannelConfig->Gpt_eChannelMode)
+            {
+                Gpt_aDispatch[u32Index].pOneShotHwChannel = &(pChannelConfig->Gpt_HwChannelConfig);
+            }
+            Gpt_aDispatch[u32Index].peChannelStatus = &(Gpt_aChannelInfo[channel].eChannelStatus);
+            Gpt_aDispatch[u32Index].channel = channel;
+        }
+    }
+}
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+/**
+ * @brief       Refreshes the notification pointer of a channel in the interrupt dispatch table.
+ * @details     The entry holds the notification only while it is enabled and the driver is in
+ *              normal mode, so that the interrupt path does not test these conditions.
+ *
+ * @param[in]   channel          Numeric identifier of the GPT channel
+ *
+ * */
+static FUNC(void, GPT_CODE) Gpt_UpdateDispatchNotification(VAR(Gpt_ChannelType, AUTOMATIC) channel)
+{
+    VAR(uint32, AUTOMATIC) u32Index;
+    VAR(Gpt_NotificationType, AUTOMATIC) pfNotification = NULL_PTR;
+    P2CONST(Gpt_ChannelConfigType, AUTOMATIC, GPT_APPL_CONST) pChannelConfig;
+
+    pChannelConfig = &((*(Gpt_pConfig->Gpt_pChannelConfig))[channel]);
+    u32Index = (uint32)pChannelConfig->Gpt_HwChannelConfig.Gpt_u8HwChannel + \
+               (uint32)pChannelConfig->Gpt_HwChannelConfig.Gpt_u8HwModule;
+
+    if ((GPT_MODE_NORMAL == Gpt_eMode) && ((boolean)TRUE == Gpt_aChannelInfo[channel].bNotificationEnabled))
+    {
+        pfNotification = pChannelConfig->Gpt_pfNotification;
+    }
+
+    if (u32Index < (uint32)GPT_CHANNEL_IDX_NUM)
+    {
+        Gpt_aDispatch[u32Index].pfNotification = pfNotification;
+    }
+}
+#endif /* GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON */
+
+#if (GPT_VTIMER_API == STD_ON)
+#if (GPT_VALIDATE_PARAM == STD_ON)
+/**
+ * @brief       This function validates the virtual timer handle passed to the wheel services
+ * @details     The handle shall have been initialized by Gpt_VTimerInit() or GPT_VTIMER_INITIALIZER,
+ *              otherwise its link fields cannot be trusted.
+ *
+ * @param[in]   u8ServiceId      The service id of the caller function
+ * @param[in]   pTimer           Virtual timer handle
+ * @return      The validity of the function call
+ * @retval      E_OK             The function call is valid
+ * @retval      E_NOT_OK         The function call is invalid
+ *
+ * */
+LOCAL_INLINE FUNC(Std_ReturnType,GPT_CODE) Gpt_ValidateVTimerPtr
+(
+    VAR(uint8, AUTOMATIC) u8ServiceId,
+    P2CONST(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer
+)
+{
+    VAR(Std_ReturnType,AUTOMATIC) returnValue = (Std_ReturnType)E_NOT_OK;
+
+    if (NULL_PTR == pTimer)
+    {
+        (void)Det_ReportError\
+        (\
+            (uint16)GPT_MODULE_ID,\
+            (uint8)GPT_INSTANCE_ID,\
+            (uint8)u8ServiceId,\
+            (uint8)GPT_E_PARAM_POINTER\
+        );
+    }
+    else if (GPT_VTIMER_INIT_MARK != pTimer->u32InitMark)
+    {
+        (void)Det_ReportError\
+        (\
+            (uint16)GPT_MODULE_ID,\
+            (uint8)GPT_INSTANCE_ID,\
+            (uint8)u8ServiceId,\
+            (uint8)GPT_E_VTIMER_UNINIT\
+        );
+    }
+    else
+    {
+        returnValue = (Std_ReturnType)E_OK;
+    }
+
+    return returnValue;
+}
+
+/**
+ * @brief       This function validates the parameters of Gpt_VTimerStart
+ * @details     The timeout and the period shall fit in half of the wheel time range so that the
+ *              distance from the current wheel time can be computed with modulo arithmetic.
+ *
+ * @param[in]   pTimer           Virtual timer handle
+ * @param[in]   delay            Ticks until the first expiry
+ * @param[in]   period           Reload period in ticks, 0 for one-shot
+ * @param[in]   pfCallback       Expiry callback
+ * @return      The validity of the function call
+ * @retval      E_OK             The function call is valid
+ * @retval      E_NOT_OK         The function call is invalid
+ *
+ * */
+LOCAL_INLINE FUNC(Std_ReturnType,GPT_CODE) Gpt_ValidateVTimerStart
+(
+    P2CONST(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer,
+    VAR(Gpt_ValueType, AUTOMATIC) delay,
+    VAR(Gpt_ValueType, AUTOMATIC) period,
+    VAR(Gpt_VTimerCallbackType, AUTOMATIC) pfCallback
+)
+{
+    VAR(Std_ReturnType,AUTOMATIC) returnValue = (Std_ReturnType)E_NOT_OK;
+
+    if ((NULL_PTR == pTimer) || (NULL_PTR == pfCallback))
+    {
+        (void)Det_ReportError\
+        (\
+            (uint16)GPT_MODULE_ID,\
+            (uint8)GPT_INSTANCE_ID,\
+            (uint8)GPT_VTIMER_START_ID,\
+            (uint8)GPT_E_PARAM_POINTER\
+        );
+    }
+    else if (GPT_VTIMER_INIT_MARK != pTimer->u32InitMark)
+    {
+        (void)Det_ReportError\
+        (\
+            (uint16)GPT_MODULE_ID,\
+            (uint8)GPT_INSTANCE_ID,\
+            (uint8)GPT_VTIMER_START_ID,\
+            (uint8)GPT_E_VTIMER_UNINIT\
+        );
+    }
+    else if (GPT_CH_MODE_ONESHOT != (*(Gpt_pConfig->Gpt_pChannelConfig))[GPT_VTIMER_CHANNEL].Gpt_eChannelMode)
+    {
+        (void)Det_ReportError\
+        (\
+            (uint16)GPT_MODULE_ID,\
+            (uint8)GPT_INSTANCE_ID,\
+            (uint8)GPT_VTIMER_START_ID,\
+            (uint8)GPT_E_PARAM_CHANNEL\
+        );
+    }
+    else if (((Gpt_ValueType)0U == delay) || (delay > GPT_VTIMER_MAX_TICKS) || (period > GPT_VTIMER_MAX_TICKS))
+    {
+        (void)Det_ReportError\
+        (\
+            (uint16)GPT_MODULE_ID,\
+            (uint8)GPT_INSTANCE_ID,\
+            (uint8)GPT_VTIMER_START_ID,\
+            (uint8)GPT_E_PARAM_VALUE\
+        );
+    }
+    else
+    {
+        returnValue = (Std_ReturnType)E_OK;
+    }
+
+    return returnValue;
+}
+#endif /* GPT_VALIDATE_PARAM == STD_ON */
+
+/**
+ * @brief       Empties the virtual timer wheel.
+ * @details     Called from Gpt_Init(). Timers still linked from a previous initialization are
+ *              dropped without notification. The epoch is advanced, so their handles are seen as
+ *              stopped and their stale link fields are never followed.
+ *
+ * */
+static FUNC(void, GPT_CODE) Gpt_VTimerReset(void)
+{
+    VAR(uint32, AUTOMATIC) u32Level;
+    VAR(uint32, AUTOMATIC) u32Slot;
+
+    for (u32Level = 0U; u32Level < GPT_VTIMER_LEVELS; u32Level++)
+    {
+        Gpt_au32VTimerBitmap[u32Level] = 0U;
+        for (u32Slot = 0U; u32Slot < GPT_VTIMER_SLOTS; u32Slot++)
+        {
+            Gpt_apVTimerSlot[u32Level][u32Slot] = NULL_PTR;
+        }
+    }
+    Gpt_u32VTimerNow = 0U;
+    Gpt_uVTimerArmed = (Gpt_ValueType)0U;
+    Gpt_uVTimerConsumed = (Gpt_ValueType)0U;
+    Gpt_bVTimerInIsr = (boolean)FALSE;
+    Gpt_u32VTimerEpoch++;
+}
+
+/**
+ * @brief       Returns the index of the least significant bit set in a non-zero slot bitmap.
+ * @details     Branch bounded binary search, the cost does not depend on the bitmap contents.
+ *
+ * @param[in]   u32Bitmap        Slot bitmap, shall not be 0
+ * @return      Index of the lowest set bit
+ *
+ * */
+static FUNC(uint32, GPT_CODE) Gpt_VTimerLowestBit(VAR(uint32, AUTOMATIC) u32Bitmap)
+{
+    VAR(uint32, AUTOMATIC) u32Bits = u32Bitmap;
+    VAR(uint32, AUTOMATIC) u32Index = 0U;
+
+    if (0U == (u32Bits & 0x0000FFFFU))
+    {
+        u32Index += 16U;
+        u32Bits >>= 16U;
+    }
+    if (0U == (u32Bits & 0x000000FFU))
+    {
+        u32Index += 8U;
+        u32Bits >>= 8U;
+    }
+    if (0U == (u32Bits & 0x0000000FU))
+    {
+        u32Index += 4U;
+        u32Bits >>= 4U;
+    }
+    if (0U == (u32Bits & 0x00000003U))
+    {
+        u32Index += 2U;
+        u32Bits >>= 2U;
+    }
+    if (0U == (u32Bits & 0x00000001U))
+    {
+        u32Index += 1U;
+    }
+
+    return u32Index;
+}
+
+/**
+ * @brief       Links a timer into the wheel slot matching its expiry time.
+ * @details     The level is given by the most significant 5-bit group in which the expiry time
+ *              differs from the current wheel time, the slot by the value of that group in the
+ *              expiry time. A timer thus waits in a coarse slot until the wheel time reaches the
+ *              start of that slot, and is then cascaded to a finer level.
+ *
+ * @param[in]   pTimer           Virtual timer handle with u32Expiry already set
+ *
+ * */
+static FUNC(void, GPT_CODE) Gpt_VTimerLink(P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer)
+{
+    VAR(uint32, AUTOMATIC) u32Diff = pTimer->u32Expiry ^ Gpt_u32VTimerNow;
+    VAR(uint32, AUTOMATIC) u32Level = 0U;
+    VAR(uint32, AUTOMATIC) u32Slot;
+
+    while (u32Diff > GPT_VTIMER_SLOT_MASK)
+    {
+        u32Diff >>= GPT_VTIMER_SLOT_BITS;
+        u32Level++;
+    }
+    u32Slot = (pTimer->u32Expiry >> (u32Level * GPT_VTIMER_SLOT_BITS)) & GPT_VTIMER_SLOT_MASK;
+
+    pTimer->u8Level = (uint8)u32Level;
+    pTimer->u8Slot = (uint8)u32Slot;
+    pTimer->pPrev = NULL_PTR;
+    pTimer->pNext = Gpt_apVTimerSlot[u32Level][u32Slot];
+    if (NULL_PTR != pTimer->pNext)
+    {
+        pTimer->pNext->pPrev = pTimer;
+    }
+    Gpt_apVTimerSlot[u32Level][u32Slot] = pTimer;
+    Gpt_au32VTimerBitmap[u32Level] |= ((uint32)1U << u32Slot);
+    pTimer->u32Epoch = Gpt_u32VTimerEpoch;
+    pTimer->bActive = (boolean)TRUE;
+}
+
+/**
+ * @brief       Removes a timer from its wheel slot.
+ *
+ * @param[in]   pTimer           Virtual timer handle, shall be linked
+ *
+ * */
+static FUNC(void, GPT_CODE) Gpt_VTimerUnlink(P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer)
+{
+    if (NULL_PTR == pTimer->pPrev)
+    {
+        Gpt_apVTimerSlot[pTimer->u8Level][pTimer->u8Slot] = pTimer->pNext;
+        if (NULL_PTR == pTimer->pNext)
+        {
+            Gpt_au32VTimerBitmap[pTimer->u8Level] &= ~((uint32)1U << pTimer->u8Slot);
+        }
+    }
+    else
+    {
+        pTimer->pPrev->pNext = pTimer->pNext;
+    }
+    if (NULL_PTR != pTimer->pNext)
+    {
+        pTimer->pNext->pPrev = pTimer->pPrev;
+    }
+    pTimer->pNext = NULL_PTR;
+    pTimer->pPrev = NULL_PTR;
+    pTimer->bActive = (boolean)FALSE;
+}
+
+/**
+ * @brief       Returns whether a timer is linked in the current wheel.
+ * @details     A timer linked before the last Gpt_Init() keeps bActive set, but its wheel has
+ *              been emptied: it is stopped and shall not be unlinked.
+ *
+ * @param[in]   pTimer           Virtual timer handle
+ * @return      TRUE when the timer is linked in the current wheel
+ *
+ * */
+static FUNC(boolean, GPT_CODE) Gpt_VTimerLinked(P2CONST(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer)
+{
+    VAR(boolean, AUTOMATIC) bLinked = (boolean)FALSE;
+
+    if (((boolean)TRUE == pTimer->bActive) && (Gpt_u32VTimerEpoch == pTimer->u32Epoch))
+    {
+        bLinked = (boolean)TRUE;
+    }
+
+    return bLinked;
+}
+
+/**
+ * @brief       Computes the distance from the current wheel time to the next wheel event.
+ * @details     A wheel event is either the expiry of a level 0 slot or the start of a higher level
+ *              slot, when its timers have to be cascaded. Every event of a level lies before the
+ *              events of the levels above it, so the first non-empty level gives the result.
+ *              Only the top level can hold slots wrapped around the end of the wheel time range.
+ *
+ * @param[out]  pu32Distance     Ticks from the current wheel time to the next event
+ * @return      FALSE when the wheel is empty
+ *
+ * */
+static FUNC(boolean, GPT_CODE) Gpt_VTimerNextEvent(P2VAR(uint32, AUTOMATIC, AUTOMATIC) pu32Distance)
+{
+    VAR(boolean, AUTOMATIC) bFound = (boolean)FALSE;
+    VAR(uint32, AUTOMATIC) u32Level = 0U;
+    VAR(uint32, AUTOMATIC) u32Shift;
+    VAR(uint32, AUTOMATIC) u32Group;
+    VAR(uint32, AUTOMATIC) u32HighMask;
+    VAR(uint32, AUTOMATIC) u32Pending;
+    VAR(uint32, AUTOMATIC) u32Event;
+
+    while (((boolean)FALSE == bFound) && (u32Level < GPT_VTIMER_LEVELS))
+    {
+        if (0U != Gpt_au32VTimerBitmap[u32Level])
+        {
+            u32Shift = u32Level * GPT_VTIMER_SLOT_BITS;
+            u32Group = (Gpt_u32VTimerNow >> u32Shift) & GPT_VTIMER_SLOT_MASK;
+            u32HighMask = (GPT_VTIMER_TOP_LEVEL == u32Level) ? 0U : \
+                          ~(((uint32)1U << (u32Shift + GPT_VTIMER_SLOT_BITS)) - 1U);
+            /* Slots after the current one, in the current rotation of this level */
+            u32Pending = Gpt_au32VTimerBitmap[u32Level] & ~(((uint32)2U << u32Group) - 1U);
+
+            if (0U != u32Pending)
+            {
+                u32Event = (Gpt_u32VTimerNow & u32HighMask) + (Gpt_VTimerLowestBit(u32Pending) << u32Shift);
+            }
+            else
+            {
+                /* Next rotation, only reachable on the top level */
+                u32Event = (Gpt_u32VTimerNow & u32HighMask) + \
+                           (Gpt_VTimerLowestBit(Gpt_au32VTimerBitmap[u32Level]) << u32Shift) + \
+                           (~u32HighMask + 1U);
+            }
+            *pu32Distance = u32Event - Gpt_u32VTimerNow;
+            bFound = (boolean)TRUE;
+        }
+        u32Level++;
+    }
+
+    return bFound;
+}
+
+/**
+ * @brief       Moves the timers of the slots starting at the current wheel time one or more levels
+ *              down.
+ * @details     Levels are handled from the top so that timers cascaded from a coarse level into
+ *              the slot being processed on a finer level are cascaded again in the same call.
+ *              Timers expiring exactly now end up in the current level 0 slot.
+ *
+ * */
+static FUNC(void, GPT_CODE) Gpt_VTimerCascade(void)
+{
+    VAR(uint32, AUTOMATIC) u32Level;
+    VAR(uint32, AUTOMATIC) u32Shift;
+    VAR(uint32, AUTOMATIC) u32Slot;
+    P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer;
+
+    for (u32Level = GPT_VTIMER_TOP_LEVEL; u32Level > 0U; u32Level--)
+    {
+        u32Shift = u32Level * GPT_VTIMER_SLOT_BITS;
+        if (0U == (Gpt_u32VTimerNow & (((uint32)1U << u32Shift) - 1U)))
+        {
+            u32Slot = (Gpt_u32VTimerNow >> u32Shift) & GPT_VTIMER_SLOT_MASK;
+            pTimer = Gpt_apVTimerSlot[u32Level][u32Slot];
+            while (NULL_PTR != pTimer)
+            {
+                Gpt_VTimerUnlink(pTimer);
+                Gpt_VTimerLink(pTimer);
+                pTimer = Gpt_apVTimerSlot[u32Level][u32Slot];
+            }
+        }
+    }
+}
+
+/**
+ * @brief       Starts the wheel channel for the next wheel event.
+ * @details     The channel runs in one-shot mode and is only started when the wheel holds timers,
+ *              so no interrupt is taken while the wheel is idle. Events further away than the
+ *              channel tick range are reached in several steps.
+ *
+ * @pre         The wheel channel shall be stopped or expired.
+ *
+ * */
+static FUNC(void, GPT_CODE) Gpt_VTimerArm(void)
+{
+    VAR(uint32, AUTOMATIC) u32Distance = 0U;
+    VAR(Gpt_ValueType, AUTOMATIC) uTickMax;
+
+    if ((boolean)TRUE == Gpt_VTimerNextEvent(&u32Distance))
+    {
+        uTickMax = (*(Gpt_pConfig->Gpt_pChannelConfig))[GPT_VTIMER_CHANNEL].Gpt_uChannelTickValueMax;
+        if ((Gpt_ValueType)u32Distance > uTickMax)
+        {
+            u32Distance = (uint32)uTickMax;
+        }
+        Gpt_StartTimer(GPT_VTIMER_CHANNEL, (Gpt_ValueType)u32Distance);
+        Gpt_uVTimerArmed = (Gpt_ValueType)u32Distance;
+    }
+    else
+    {
+        Gpt_uVTimerArmed = (Gpt_ValueType)0U;
     }
-#endif
-#endif
+    Gpt_uVTimerConsumed = (Gpt_ValueType)0U;
+}
 
-    return returnValue;
+/**
+ * @brief       Processes the timer wheel on expiry of the wheel channel.
+ * @details     Advances the wheel time event by event up to the programmed timeout, expiring the
+ *              timers of each reached level 0 slot and restarting the channel for the next event.
+ *              Periodic timers are reloaded from their previous expiry time so they do not drift
+ *              with the callback execution time. Callbacks are called one by one outside of the
+ *              exclusive area and may start or cancel any timer.
+ *
+ * */
+static FUNC(void, GPT_CODE) Gpt_VTimerProcess(void)
+{
+    VAR(uint32, AUTOMATIC) u32Target;
+    VAR(uint32, AUTOMATIC) u32Distance = 0U;
+    VAR(uint32, AUTOMATIC) u32Slot;
+    P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer;
+    VAR(Gpt_VTimerCallbackType, AUTOMATIC) pfCallback;
+    P2VAR(void, AUTOMATIC, GPT_APPL_DATA) pContext;
+
+    SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_18();
+    u32Target = Gpt_u32VTimerNow + (uint32)(Gpt_uVTimerArmed - Gpt_uVTimerConsumed);
+    Gpt_uVTimerArmed = (Gpt_ValueType)0U;
+    Gpt_bVTimerInIsr = (boolean)TRUE;
+
+    while (((boolean)TRUE == Gpt_VTimerNextEvent(&u32Distance)) && \
+           (u32Distance <= (u32Target - Gpt_u32VTimerNow)))
+    {
+        Gpt_u32VTimerNow += u32Distance;
+        Gpt_VTimerCascade();
+
+        u32Slot = Gpt_u32VTimerNow & GPT_VTIMER_SLOT_MASK;
+        pTimer = Gpt_apVTimerSlot[0U][u32Slot];
+        while (NULL_PTR != pTimer)
+        {
+            Gpt_VTimerUnlink(pTimer);
+            pfCallback = pTimer->pfCallback;
+            pContext = pTimer->pContext;
+            if ((Gpt_ValueType)0U != pTimer->uPeriod)
+            {
+                pTimer->u32Expiry += (uint32)pTimer->uPeriod;
+                Gpt_VTimerLink(pTimer);
+            }
+            SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_18();
+
+            pfCallback(pContext);
+
+            SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_18();
+            pTimer = Gpt_apVTimerSlot[0U][u32Slot];
+        }
+    }
+
+    Gpt_u32VTimerNow = u32Target;
+    Gpt_bVTimerInIsr = (boolean)FALSE;
+    Gpt_VTimerArm();
+    SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_18();
 }
-#endif
+#endif /* GPT_VTIMER_API == STD_ON */
 
-#if (GPT_SET_CLOCK_MODE == STD_ON) && (GPT_VALIDATE_PARAM == STD_ON)
-LOCAL_INLINE FUNC(Std_ReturnType,GPT_CODE) Gpt_ValidateParamSetClockMode
+/*================================================================================================*/
+/**
+* @brief   Starts a timer channel whose parameters are already valid.
+* @details Common part of Gpt_StartTimer and Gpt_StartTimer_Unchecked.
+*
+* @param[in]     channel channel id
+* @param[in]     value   time-out period (in number of ticks)
+*/
+LOCAL_INLINE FUNC(void, GPT_CODE) Gpt_StartTimerChannel
 (
-    VAR(Gpt_ClockModeType, AUTOMATIC) eClkMode
+    VAR(Gpt_ChannelType, AUTOMATIC) channel,
+    VAR(Gpt_ValueType, AUTOMATIC) value
 )
 {
-    VAR(Std_ReturnType,AUTOMATIC) returnValue = (Std_ReturnType)E_NOT_OK;
-
-    if((GPT_CLOCKMODE_NORMAL != eClkMode) && (GPT_CLOCKMODE_ALTERNATE != eClkMode))
+    /*Enable hardware interrupts for the one-shot mode to set the status of  channel*/
+    if (GPT_CH_MODE_ONESHOT == (*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_eChannelMode)
     {
-        (void)Det_ReportError\
-        (\
-            (uint16)GPT_MODULE_ID,\
-            (uint8)GPT_INSTANCE_ID,\
-            (uint8)GPT_SET_CLOCK_MODE_ID,\
-            (uint8)GPT_E_PARAM_CLOCK_MODE\
+        Gpt_Ipw_EnableInterrupt
+        (
+            &((*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_HwChannelConfig)
         );
     }
-    else
+
+    /* Call low level start timer */
+    Gpt_Ipw_StartTimer
+    (
+        &((*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_HwChannelConfig),value
+    );
+
+    /* Change GPT channel status.Channel status change shall be made before to start
+    the hardware in order to not change the channel status from EXPIRED to RUNNING*/
+    SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_01();
     {
-        returnValue=(Std_ReturnType)E_OK;
+        Gpt_aChannelInfo[channel].eChannelStatus = GPT_STATUS_RUNNING;
     }
-
-    return returnValue;
+    SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_01();
 }
-#endif
 /*==================================================================================================
 *                                       GLOBAL FUNCTIONS
 ==================================================================================================*/
@@ -980,8 +1674,16 @@ FUNC(void, GPT_CODE) Gpt_Init(P2CONST(Gpt_ConfigType, AUTOMATIC, GPT_APPL_CONST)
                 Gpt_Ipw_Init(&((*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_HwChannelConfig));
             }
 
+#if (GPT_VTIMER_API == STD_ON)
+            /*Start with an empty virtual timer wheel*/
+            Gpt_VTimerReset();
+#endif
+
             /*Set the driver to normal mode*/
             Gpt_eMode = GPT_MODE_NORMAL;
+
+            /*Resolve the interrupt dispatch data of all channels*/
+            Gpt_InitDispatch();
 #if (GPT_VALIDATE_PARAM  == STD_ON)
         }
 #endif
@@ -1314,29 +2016,7 @@ FUNC(void, GPT_CODE) Gpt_StartTimer
             if ((Std_ReturnType)E_OK == Gpt_ValidateParamValue(GPT_STARTTIMER_ID,channel,value))
             {
 #endif
-                /*Enable hardware interrupts for the one-shot mode to set the status of  channel*/
-                if (GPT_CH_MODE_ONESHOT == (*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_eChannelMode)
-                {
-                    Gpt_Ipw_EnableInterrupt
-                    (
-                        &((*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_HwChannelConfig)
-                    );
-                }
-
-                /* Call low level start timer */
-                Gpt_Ipw_StartTimer
-                (
-                    &((*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_HwChannelConfig),value
-                );
-
-                /* Change GPT channel status.Channel status change shall be made before to start
-                the hardware in order to not change the channel status from EXPIRED to RUNNING*/
-                SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_01();
-                {
-                    Gpt_aChannelInfo[channel].eChannelStatus = GPT_STATUS_RUNNING;
-                }
-                SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_01();
-
+                Gpt_StartTimerChannel(channel, value);
 #if (GPT_VALIDATE_PARAM  == STD_ON)
             }
 #endif
@@ -1348,6 +2028,32 @@ FUNC(void, GPT_CODE) Gpt_StartTimer
 #endif
     return;
 }
+
+#if (GPT_UNCHECKED_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief   GPT driver function for starting a timer channel without parameter checks.
+* @details Same as Gpt_StartTimer, for callers which already guarantee an initialized driver, a
+*          valid channel which is not running and a timeout value in the range of the channel.
+*          No development error is reported.
+*
+* @param[in]     channel channel id
+* @param[in]     value   time-out period (in number of ticks) after a notification or a
+*                        wakeup event shall occur
+*
+* @api
+*
+* @violates @ref GPT_C_REF_5 Violates MISRA 2004 Required Rule 8.10 could be made static
+*/
+FUNC(void, GPT_CODE) Gpt_StartTimer_Unchecked
+(
+    VAR(Gpt_ChannelType,    AUTOMATIC) channel,
+    VAR(Gpt_ValueType,      AUTOMATIC) value
+)
+{
+    Gpt_StartTimerChannel(channel, value);
+}
+#endif /* GPT_UNCHECKED_API == STD_ON */
 /*================================================================================================*/
 /**
 * @brief   GPT driver function for stopping a timer channel.
@@ -1452,6 +2158,7 @@ FUNC(void, GPT_CODE) Gpt_EnableNotification(VAR(Gpt_ChannelType, AUTOMATIC) chan
 #endif
             /* Set the enable notification attribute */
             Gpt_aChannelInfo[channel].bNotificationEnabled = (boolean)TRUE;
+            Gpt_UpdateDispatchNotification(channel);
 
             if (GPT_MODE_NORMAL == Gpt_eMode)
             {
@@ -1501,6 +2208,7 @@ FUNC(void, GPT_CODE) Gpt_DisableNotification(VAR(Gpt_ChannelType, AUTOMATIC) cha
 #endif
             /* Set the enable notification attribute */
             Gpt_aChannelInfo[channel].bNotificationEnabled = (boolean)FALSE;
+            Gpt_UpdateDispatchNotification(channel);
 
             /* Disable hardware interrupts if the channel is not running in the ONE-SHUT mode.
             This is needed because the channel state is updated by ISR for ONE-SHOT mode */
@@ -1635,6 +2343,14 @@ FUNC(void, GPT_CODE) Gpt_SetMode(VAR(Gpt_ModeType, AUTOMATIC) eMode)
 
                 /*Set the driver mode to sleep */
                 Gpt_eMode = GPT_MODE_SLEEP;
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+                /*No notification is called in sleep mode*/
+                for (channel = 0U; channel < (Gpt_ChannelType)Gpt_pConfig->Gpt_uChannelCount; channel++)
+                {
+                    Gpt_UpdateDispatchNotification(channel);
+                }
+#endif
             }
             else if (GPT_MODE_NORMAL == eMode)
             {
@@ -1672,6 +2388,14 @@ FUNC(void, GPT_CODE) Gpt_SetMode(VAR(Gpt_ModeType, AUTOMATIC) eMode)
 
                 /*Set the driver mode to normal mode*/
                 Gpt_eMode = GPT_MODE_NORMAL;
+
+#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
+                /*Restore the notifications enabled before the sleep mode*/
+                for (channel = 0U; channel < (Gpt_ChannelType)Gpt_pConfig->Gpt_uChannelCount; channel++)
+                {
+                    Gpt_UpdateDispatchNotification(channel);
+                }
+#endif
             }
             else
             {
@@ -1879,38 +2603,38 @@ FUNC(void, GPT_CODE) Gpt_CheckWakeup(VAR(EcuM_WakeupSourceType, AUTOMATIC) wakeu
 */
 FUNC(void, GPT_CODE) Gpt_ProcessCommonInterrupt(VAR(uint8, AUTOMATIC) u8MapTableIndex)
 {
-    VAR(Gpt_ChannelType, AUTOMATIC) channel;
+    P2CONST(Gpt_DispatchType, AUTOMATIC, GPT_VAR) pDispatch = &Gpt_aDispatch[u8MapTableIndex];
 
-    if (Gpt_pConfig != NULL_PTR)
+    if ((Gpt_pConfig != NULL_PTR) && (GPT_DISPATCH_NO_CHANNEL != pDispatch->channel))
     {
-        /* Extract the logical channel from the hardware to logic map table */
-        channel = Gpt_pConfig->Gpt_aHw2LogicChannelMap[u8MapTableIndex];
-
         /*Stop the timer for one-shot mode*/
-        if (GPT_CH_MODE_ONESHOT == (*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_eChannelMode)
+        if (NULL_PTR != pDispatch->pOneShotHwChannel)
         {
             /*Stop channel*/
-            Gpt_Ipw_StopTimer(&((*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_HwChannelConfig));
-            SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_04();
-            {
-                /* Change the channel status to expired */
-                Gpt_aChannelInfo[channel].eChannelStatus = GPT_STATUS_EXPIRED;
-            }
-            SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_04();
+            Gpt_Ipw_StopTimer(pDispatch->pOneShotHwChannel);
+            /* Change the channel status to expired. A single store, the interrupt cannot be
+            preempted by the driver functions changing the status */
+            *(pDispatch->peChannelStatus) = GPT_STATUS_EXPIRED;
         }
-#if (GPT_ENABLE_DISABLE_NOTIFICATION_API == STD_ON)
-        if ((GPT_MODE_NORMAL == Gpt_eMode) && ((boolean)TRUE == Gpt_aChannelInfo[channel].bNotificationEnabled))
+#if (GPT_VTIMER_API == STD_ON)
+        /*Expire the virtual timers and restart the wheel channel*/
+        if (GPT_VTIMER_CHANNEL == pDispatch->channel)
         {
-            (*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_pfNotification();
+            Gpt_VTimerProcess();
         }
 #endif
+        /*The entry holds a notification only if enabled and in normal mode*/
+        if (NULL_PTR != pDispatch->pfNotification)
+        {
+            pDispatch->pfNotification();
+        }
 
 #if (GPT_WAKEUP_FUNCTIONALITY_API == STD_ON)
 #if (GPT_REPORT_WAKEUP_SOURCE == STD_ON)
-        if ((GPT_MODE_SLEEP == Gpt_eMode) && ((boolean)TRUE == Gpt_aChannelInfo[channel].bWakeupEnabled))
+        if ((GPT_MODE_SLEEP == Gpt_eMode) && ((boolean)TRUE == Gpt_aChannelInfo[pDispatch->channel].bWakeupEnabled))
         {
-            Gpt_aChannelInfo[channel].bWakeupGenerated =(boolean)TRUE;
-            EcuM_CheckWakeup((*(Gpt_pConfig->Gpt_pChannelConfig))[channel].Gpt_uWakeupSource);
+            Gpt_aChannelInfo[pDispatch->channel].bWakeupGenerated =(boolean)TRUE;
+            EcuM_CheckWakeup((*(Gpt_pConfig->Gpt_pChannelConfig))[pDispatch->channel].Gpt_uWakeupSource);
         }
 #endif
 #endif
@@ -2020,6 +2744,289 @@ FUNC(void, GPT_CODE) Gpt_SetClockMode(VAR(Gpt_ClockModeType, AUTOMATIC) eClkMode
 }
 #endif /* GPT_SET_CLOCK_MODE */
 
+/*================================================================================================*/
+#if (GPT_VTIMER_API == STD_ON)
+/**
+* @brief     Initializes a virtual timer handle.
+* @details   Clears the link fields of the handle and marks it as initialized. Every handle shall
+*            be initialized once before it is passed to another virtual timer service, either by
+*            this function or statically with GPT_VTIMER_INITIALIZER. Gpt_Init() empties the timer
+*            wheel without touching the handles; handles running at that time are seen as stopped
+*            afterwards and can be started again without being initialized again. A running timer
+*            shall not be initialized.
+*            This is a non-autosar function.
+*
+* @param[out]    pTimer      timer handle allocated by the caller
+*
+* @violates @ref GPT_C_REF_5 Violates MISRA 2004 Required Rule 8.10 could be made static
+*/
+FUNC(void, GPT_CODE) Gpt_VTimerInit(P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer)
+{
+#if (GPT_VALIDATE_PARAM == STD_ON)
+    if (NULL_PTR == pTimer)
+    {
+        (void)Det_ReportError\
+        (\
+            (uint16)GPT_MODULE_ID,\
+            (uint8)GPT_INSTANCE_ID,\
+            (uint8)GPT_VTIMER_INIT_ID,\
+            (uint8)GPT_E_PARAM_POINTER\
+        );
+    }
+    else
+    {
+#endif
+        pTimer->pNext = NULL_PTR;
+        pTimer->pPrev = NULL_PTR;
+        pTimer->u32Expiry = 0U;
+        pTimer->uPeriod = (Gpt_ValueType)0U;
+        pTimer->pfCallback = NULL_PTR;
+        pTimer->pContext = NULL_PTR;
+        pTimer->u8Level = 0U;
+        pTimer->u8Slot = 0U;
+        pTimer->bActive = (boolean)FALSE;
+        pTimer->u32Epoch = 0U;
+        pTimer->u32InitMark = GPT_VTIMER_INIT_MARK;
+#if (GPT_VALIDATE_PARAM == STD_ON)
+    }
+#endif
+
+    return;
+}
+
+/*================================================================================================*/
+/**
+* @brief     Starts a virtual timer on the timer wheel.
+* @details   Links the timer into the wheel driven by channel GPT_VTIMER_CHANNEL, in constant time
+*            regardless of the number of running timers. A timer which is already running is
+*            restarted. The wheel channel is only restarted when the new timer expires before the
+*            event the channel is currently programmed for.
+*            This is a non-autosar function.
+*
+* @param[in]     pTimer      timer handle initialized by Gpt_VTimerInit(), shall stay valid while
+*                            running
+* @param[in]     delay       ticks until the first expiry, 1 .. GPT_VTIMER_MAX_TICKS
+* @param[in]     period      reload period in ticks for periodic timers, 0 for one-shot timers
+* @param[in]     pfCallback  function called from the GPT interrupt on every expiry
+* @param[in]     pContext    parameter passed to pfCallback
+*
+* @return        Std_ReturnType
+* @retval        E_OK        the timer is running
+* @retval        E_NOT_OK    development error detected, the timer is unchanged
+*
+* @pre     Gpt_Init must be called before and pTimer shall be initialized.
+*
+* @violates @ref GPT_C_REF_5 Violates MISRA 2004 Required Rule 8.10 could be made static
+*/
+FUNC(Std_ReturnType, GPT_CODE) Gpt_VTimerStart
+(
+    P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer,
+    VAR(Gpt_ValueType, AUTOMATIC) delay,
+    VAR(Gpt_ValueType, AUTOMATIC) period,
+    VAR(Gpt_VTimerCallbackType, AUTOMATIC) pfCallback,
+    P2VAR(void, AUTOMATIC, GPT_APPL_DATA) pContext
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) returnValue = (Std_ReturnType)E_NOT_OK;
+    VAR(Gpt_HwChannelInfoType, AUTOMATIC) returnHwChannelInfo;
+    VAR(Gpt_ValueType, AUTOMATIC) uElapsedTime;
+    VAR(boolean, AUTOMATIC) bRebased = (boolean)FALSE;
+    VAR(uint32, AUTOMATIC) u32Distance = 0U;
+    VAR(uint32, AUTOMATIC) u32PendingTicks = 0U;
+
+    returnHwChannelInfo.bChannelRollover = (boolean)FALSE;
+    returnHwChannelInfo.uTargetTime = (Gpt_ValueType)0;
+
+#if (GPT_VALIDATE_GLOBAL_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Gpt_ValidateGlobalCall(GPT_VTIMER_START_ID))
+    {
+#endif
+#if (GPT_VALIDATE_PARAM == STD_ON)
+        if ((Std_ReturnType)E_OK == Gpt_ValidateVTimerStart(pTimer, delay, period, pfCallback))
+        {
+#endif
+            SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_18();
+            {
+                if ((boolean)TRUE == Gpt_VTimerLinked(pTimer))
+                {
+                    Gpt_VTimerUnlink(pTimer);
+                }
+
+                /* Bring the wheel time up to date while the channel is running. If the channel has
+                already expired and its interrupt is pending, the wheel time is only advanced by the
+                interrupt, so the new timer is placed relative to the programmed timeout */
+                if (((boolean)FALSE == Gpt_bVTimerInIsr) && ((Gpt_ValueType)0U != Gpt_uVTimerArmed))
+                {
+                    /** @violates @ref GPT_C_REF_6  pointer to local variable used as function parameter*/
+                    uElapsedTime = Gpt_Ipw_GetTimeElapsed((&((*(Gpt_pConfig->Gpt_pChannelConfig))[GPT_VTIMER_CHANNEL].Gpt_HwChannelConfig)), &returnHwChannelInfo);
+                    if (((boolean)FALSE == returnHwChannelInfo.bChannelRollover) && (uElapsedTime < Gpt_uVTimerArmed))
+                    {
+                        Gpt_u32VTimerNow += (uint32)(uElapsedTime - Gpt_uVTimerConsumed);
+                        Gpt_uVTimerConsumed = uElapsedTime;
+                        bRebased = (boolean)TRUE;
+                    }
+                    else
+                    {
+                        u32PendingTicks = (uint32)(Gpt_uVTimerArmed - Gpt_uVTimerConsumed);
+                    }
+                }
+
+                pTimer->u32Expiry = Gpt_u32VTimerNow + u32PendingTicks + (uint32)delay;
+                pTimer->uPeriod = period;
+                pTimer->pfCallback = pfCallback;
+                pTimer->pContext = pContext;
+                Gpt_VTimerLink(pTimer);
+
+                /* Within the interrupt the channel is restarted once all expired timers are handled */
+                if ((boolean)FALSE == Gpt_bVTimerInIsr)
+                {
+                    if ((Gpt_ValueType)0U == Gpt_uVTimerArmed)
+                    {
+                        Gpt_VTimerArm();
+                    }
+                    else if ((boolean)TRUE == bRebased)
+                    {
+                        if (((boolean)TRUE == Gpt_VTimerNextEvent(&u32Distance)) && \
+                            ((Gpt_ValueType)u32Distance < (Gpt_uVTimerArmed - Gpt_uVTimerConsumed)))
+                        {
+                            Gpt_StopTimer(GPT_VTIMER_CHANNEL);
+                            Gpt_VTimerArm();
+                        }
+                    }
+                    else
+                    {
+                        /* The pending channel interrupt restarts the wheel */
+                    }
+                }
+            }
+            SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_18();
+            returnValue = (Std_ReturnType)E_OK;
+#if (GPT_VALIDATE_PARAM == STD_ON)
+        }
+#endif
+#if (GPT_VALIDATE_GLOBAL_CALL == STD_ON)
+    }
+#endif
+
+    return returnValue;
+}
+
+/*================================================================================================*/
+/**
+* @brief     Stops a virtual timer.
+* @details   Unlinks the timer from the timer wheel in constant time. The wheel channel is left
+*            running; if the cancelled timer was the next to expire, the channel interrupt finds
+*            nothing to expire and restarts the channel for the following event.
+*            Cancelling a timer which is not running has no effect.
+*            This is a non-autosar function.
+*
+* @param[in]     pTimer      timer handle initialized by Gpt_VTimerInit()
+*
+* @pre     Gpt_Init must be called before.
+*
+* @violates @ref GPT_C_REF_5 Violates MISRA 2004 Required Rule 8.10 could be made static
+*/
+FUNC(void, GPT_CODE) Gpt_VTimerCancel(P2VAR(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer)
+{
+#if (GPT_VALIDATE_GLOBAL_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Gpt_ValidateGlobalCall(GPT_VTIMER_CANCEL_ID))
+    {
+#endif
+#if (GPT_VALIDATE_PARAM == STD_ON)
+        if ((Std_ReturnType)E_OK == Gpt_ValidateVTimerPtr(GPT_VTIMER_CANCEL_ID, pTimer))
+        {
+#endif
+            SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_18();
+            {
+                if ((boolean)TRUE == Gpt_VTimerLinked(pTimer))
+                {
+                    Gpt_VTimerUnlink(pTimer);
+                }
+            }
+            SchM_Exit_Gpt_GPT_EXCLUSIVE_AREA_18();
+#if (GPT_VALIDATE_PARAM == STD_ON)
+        }
+#endif
+#if (GPT_VALIDATE_GLOBAL_CALL == STD_ON)
+    }
+#endif
+
+    return;
+}
+
+/*================================================================================================*/
+/**
+* @brief     Returns whether a virtual timer is running.
+* @details   A one-shot timer stops running just before its callback is called, a periodic timer
+*            keeps running until it is cancelled.
+*            This is a non-autosar function.
+*
+* @param[in]     pTimer      timer handle initialized by Gpt_VTimerInit()
+*
+* @return        boolean
+* @retval        TRUE        the timer is linked in the timer wheel
+* @retval        FALSE       the timer is not running or a development error was detected
+*
+* @violates @ref GPT_C_REF_5 Violates MISRA 2004 Required Rule 8.10 could be made static
+*/
+FUNC(boolean, GPT_CODE) Gpt_VTimerIsActive(P2CONST(Gpt_VTimerType, AUTOMATIC, GPT_APPL_DATA) pTimer)
+{
+    VAR(boolean, AUTOMATIC) bActive = (boolean)FALSE;
+
+#if (GPT_VALIDATE_PARAM == STD_ON)
+    if ((Std_ReturnType)E_OK == Gpt_ValidateVTimerPtr(GPT_VTIMER_ISACTIVE_ID, pTimer))
+    {
+#endif
+        bActive = Gpt_VTimerLinked(pTimer);
+#if (GPT_VALIDATE_PARAM == STD_ON)
+    }
+#endif
+
+    return bActive;
+}
+#endif /* GPT_VTIMER_API == STD_ON */
+
+/*================================================================================================*/
+#if (GPT_STM_TIMEBASE_API == STD_ON)
+/**
+* @brief     Returns a free running 63-bit timestamp.
+* @details   The timestamp counts the ticks of the STM module GPT_STM_TIMEBASE_MODULE and never
+*            wraps in practice. It can be called from any context, including interrupts, and
+*            does not lock interrupts. The difference of two timestamps is converted to time with
+*            Gpt_TimestampToNs().
+*            The extension of the 32-bit hardware counter requires a call at least once every
+*            2^31 ticks; any STM channel interrupt also performs this update.
+*            This is a non-autosar function.
+*
+* @return        uint64      timestamp in STM ticks
+*
+* @pre     Gpt_Init must be called before with an STM channel on GPT_STM_TIMEBASE_MODULE.
+*
+* @violates @ref GPT_C_REF_5 Violates MISRA 2004 Required Rule 8.10 could be made static
+*/
+FUNC(uint64, GPT_CODE) Gpt_GetTimestamp(void)
+{
+    return Gpt_Ipw_GetTimestamp();
+}
+
+/*================================================================================================*/
+/**
+* @brief     Converts timestamp ticks to nanoseconds.
+* @details   The conversion uses GPT_STM_TIMEBASE_FREQ_HZ, which shall match the configured STM
+*            clock and prescaler.
+*            This is a non-autosar function.
+*
+* @param[in]     ticks       timestamp or timestamp difference in STM ticks
+*
+* @return        uint64      time in nanoseconds
+*
+* @violates @ref GPT_C_REF_5 Violates MISRA 2004 Required Rule 8.10 could be made static
+*/
+FUNC(uint64, GPT_CODE) Gpt_TimestampToNs(VAR(uint64, AUTOMATIC) ticks)
+{
+    return Gpt_Ipw_TimestampToNs(ticks);
+}
+#endif /* GPT_STM_TIMEBASE_API == STD_ON */
 
 
 #define GPT_STOP_SEC_CODE
@@ -642,6 +642,36 @@ FUNC (void, GPT_CODE) Gpt_Ipw_SetClockMode(
 }
 #endif /* GPT_SET_CLOCK_MODE == STD_ON */
 
+#if (GPT_STM_TIMEBASE_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief   Gpt driver Autosar independent and platform dependent function returning the timestamp.
+* @details Calls the STM function which extends the counter of the timestamp STM module.
+*
+* @return  63-bit timestamp in STM ticks
+*
+*/
+FUNC (uint64, GPT_CODE) Gpt_Ipw_GetTimestamp(void)
+{
+    return Gpt_Stm_GetTimestamp();
+}
+
+/*================================================================================================*/
+/**
+* @brief   Gpt driver Autosar independent and platform dependent function converting timestamp
+*          ticks to nanoseconds.
+*
+* @param[in]     u64Ticks       timestamp ticks
+*
+* @return  Time in nanoseconds
+*
+*/
+FUNC (uint64, GPT_CODE) Gpt_Ipw_TimestampToNs(VAR(uint64, AUTOMATIC) u64Ticks)
+{
+    return Gpt_Stm_TimestampToNs(u64Ticks);
+}
+#endif /* GPT_STM_TIMEBASE_API == STD_ON */
+
 
 #define GPT_STOP_SEC_CODE
 /** @violates @ref GPT_IPW_C_REF_1 Only preprocessor statements and comments before "#include" */
@@ -221,6 +221,29 @@ extern "C"{
 */
 #define STM_CNT_MAX_VALUE_U32        ((uint32)0xFFFFFFFFuL)
 
+#if (GPT_STM_TIMEBASE_API == STD_ON)
+/**
+* @brief Hardware channel ID used to address the counter of the timestamp STM module
+*/
+#define STM_TIMEBASE_CH_U32          ((uint32)((uint32)GPT_STM_TIMEBASE_MODULE << STM_MOD_SHIFT))
+
+/**
+* @brief Most significant bit of the STM counter, mirrored in bit 31 of the software high word
+*/
+#define STM_TIMEBASE_MSB_U32         ((uint32)0x80000000uL)
+
+/**
+* @brief Integer part of the number of nanoseconds per timestamp tick
+*/
+#define STM_TIMEBASE_NS_INT_U64      ((uint64)(1000000000ULL / (uint64)GPT_STM_TIMEBASE_FREQ_HZ))
+
+/**
+* @brief Fractional part of the number of nanoseconds per timestamp tick, in 0.32 fixed point
+*/
+#define STM_TIMEBASE_NS_FRAC_U64     ((uint64)(((((uint64)(1000000000ULL % (uint64)GPT_STM_TIMEBASE_FREQ_HZ)) << 32U) + \
+                                               ((uint64)GPT_STM_TIMEBASE_FREQ_HZ / 2ULL)) / (uint64)GPT_STM_TIMEBASE_FREQ_HZ))
+#endif
+
 
 
 /*==================================================================================================
@@ -263,6 +286,23 @@ CONST(uint32, GPT_CONST) STM_BASE_ADDR32[STM_MODULE_NUM_MAX_U8] =
 /*==================================================================================================
 *                                       LOCAL VARIABLES
 ==================================================================================================*/
+#if (GPT_STM_TIMEBASE_API == STD_ON)
+#define GPT_START_SEC_VAR_INIT_32
+/** @violates @ref GPT_STM_C_REF_1 Only preprocessor statements and comments before "#include" */
+/** @violates @ref GPT_STM_C_REF_2 Repeated include file MemMap.h */
+#include "MemMap.h"
+
+/**
+* @brief          Software extension of the timestamp STM counter. Bits 30..0 count the counter
+*                 wraps, bit 31 holds the counter MSB seen at the last update.
+*/
+static volatile VAR(uint32, GPT_VAR) Gpt_Stm_u32TimebaseHigh = 0U;
+
+#define GPT_STOP_SEC_VAR_INIT_32
+/** @violates @ref GPT_STM_C_REF_1 Only preprocessor statements and comments before "#include" */
+/** @violates @ref GPT_STM_C_REF_2 Repeated include file MemMap.h */
+#include "MemMap.h"
+#endif /* GPT_STM_TIMEBASE_API == STD_ON */
 
 
 /*==================================================================================================
@@ -384,6 +424,11 @@ static FUNC(void, GPT_CODE) Gpt_Stm_ProcessCommonInterrupt(VAR(uint8, AUTOMATIC)
     VAR(uint32,AUTOMATIC) u32Temp1;
     VAR(uint32,AUTOMATIC) u32Temp2;
 
+#if (GPT_STM_TIMEBASE_API == STD_ON)
+    /* Every STM interrupt keeps the timestamp extension up to date */
+    (void)Gpt_Stm_GetTimestamp();
+#endif
+
     SchM_Enter_Gpt_GPT_EXCLUSIVE_AREA_05();
     {
         /** @violates @ref GPT_STM_C_REF_3 MISRA 2004 Rule 11.1, Cast from unsigned long to pointer*/
@@ -727,6 +772,69 @@ FUNC(void, GPT_CODE) Gpt_Stm_SetClockMode(VAR(uint8, AUTOMATIC) u8HwChannel, VAR
 }
 #endif
 
+#if (GPT_STM_TIMEBASE_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief   Gpt driver function returning the 63-bit timestamp of the timestamp STM module.
+* @details The 32-bit STM counter is extended with a software high word without locking:
+*          the high word is read before the counter, and when the counter MSB differs from the MSB
+*          mirrored in the high word, the counter has crossed half of its range since the last
+*          update and the high word is advanced. Concurrent callers compute and store the same new
+*          high word, so the function may be called from any task or interrupt context.
+*          The result is only monotonic if the function is called at least once every 2^31
+*          counter ticks, which is ensured by any STM interrupt or by a cyclic caller.
+*
+* @return  Number of STM ticks counted since the counter was first enabled
+*
+* @pre     The counter of GPT_STM_TIMEBASE_MODULE shall be enabled by Gpt_Init.
+*
+*/
+FUNC(uint64, GPT_CODE) Gpt_Stm_GetTimestamp(void)
+{
+    VAR(uint32, AUTOMATIC) u32High;
+    VAR(uint32, AUTOMATIC) u32Low;
+
+    u32High = Gpt_Stm_u32TimebaseHigh;
+    /** @violates @ref GPT_STM_C_REF_3 Cast from unsigned long to pointer. */
+    /** @violates @ref GPT_STM_C_REF_8 Cast from unsigned long to pointer. */
+    u32Low = REG_READ32(STM_CNT_ADDR32(STM_TIMEBASE_CH_U32));
+
+    if ((uint32)0U != ((u32High ^ u32Low) & STM_TIMEBASE_MSB_U32))
+    {
+        /* Toggle the mirrored MSB and count a wrap when the counter MSB went from 1 to 0 */
+        u32High = (u32High ^ STM_TIMEBASE_MSB_U32) + (u32High >> 31U);
+        Gpt_Stm_u32TimebaseHigh = u32High;
+    }
+
+    return ((((uint64)(u32High & (~STM_TIMEBASE_MSB_U32))) << 32U) | (uint64)u32Low);
+}
+
+/*================================================================================================*/
+/**
+* @brief   Gpt driver function converting a timestamp tick count to nanoseconds.
+* @details Uses the fixed tick period derived from GPT_STM_TIMEBASE_FREQ_HZ, split in an integer
+*          and a 0.32 fixed point fractional part so that only 32x32 bit multiplications are needed
+*          for the fractional part and no 64-bit division is performed at runtime.
+*
+* @param[in]     u64Ticks       tick count or tick difference returned by Gpt_Stm_GetTimestamp
+*
+* @return  Equivalent time in nanoseconds
+*
+*/
+FUNC(uint64, GPT_CODE) Gpt_Stm_TimestampToNs(VAR(uint64, AUTOMATIC) u64Ticks)
+{
+    VAR(uint32, AUTOMATIC) u32TicksLow = (uint32)u64Ticks;
+    VAR(uint32, AUTOMATIC) u32TicksHigh = (uint32)(u64Ticks >> 32U);
+    VAR(uint64, AUTOMATIC) u64Ns;
+
+    u64Ns = u64Ticks * STM_TIMEBASE_NS_INT_U64;
+    u64Ns += ((uint64)u32TicksHigh * STM_TIMEBASE_NS_FRAC_U64);
+    u64Ns += (((uint64)u32TicksLow * STM_TIMEBASE_NS_FRAC_U64) >> 32U);
+
+    return u64Ns;
+}
+#endif /* GPT_STM_TIMEBASE_API == STD_ON */
+
 #if (GPT_STM_MODULE_SINGLE_INTERRUPT == STD_ON)
 #ifdef GPT_STM_0_ISR_USED
 /**
@@ -78,6 +78,7 @@ extern "C"{
 #include "Std_Types.h"
 #include "Gpt_Ipw_Irq.h"
 #include "Gpt_eMios.h"
+#include "Gpt_eMios_Irq.h"
 #include "eMios_Common.h"
 #include "SchM_Gpt.h"
 
@@ -294,6 +295,11 @@ FUNC(void, GPT_CODE) Gpt_eMios_Init (VAR(uint8, AUTOMATIC) u8HwChannel,
     /** @violates @ref Gpt_eMios_C_REF_1 Cast from unsigned long to pointer */
     /** @violates @ref Gpt_eMios_C_REF_7 Cast from unsigned long to pointer */
     REG_WRITE32(EMIOS_CADR_ADDR32(u8ModuleIdx, u8ChannelIdx), 1U);
+
+#if (GPT_EMIOS_USED == STD_ON)
+    /* Route the channel interrupt to the Gpt handler */
+    eMios_SetIrqHandler(u8HwChannel, &Gpt_eMios_ProcessCommonInterrupt);
+#endif
 }
 
 #if (GPT_DEINIT_API == STD_ON)
@@ -335,6 +341,11 @@ FUNC(void, GPT_CODE) Gpt_eMios_DeInit (VAR(uint8, AUTOMATIC) u8HwChannel)
     /** @violates @ref Gpt_eMios_C_REF_7 Cast from unsigned long to pointer */
     REG_WRITE32(EMIOS_CSR_ADDR32(u8ModuleIdx, u8ChannelIdx), CSR_FLAG_MASK_U32);
 
+#if (GPT_EMIOS_USED == STD_ON)
+    /* Detach the channel from the eMios interrupt vectors */
+    eMios_SetIrqHandler(u8HwChannel, NULL_PTR);
+#endif
+
     /* Only write UCDIS register if it_s available */
 #ifdef EMIOS_UCDIS_AVAILABLE
     #if (EMIOS_UCDIS_AVAILABLE == STD_ON)
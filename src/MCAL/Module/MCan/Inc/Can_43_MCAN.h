@@ -189,9 +189,70 @@ extern "C"{
 #define CAN_43_MCAN_SID_SET_BAUDRATE                  ((uint8)0x0FU)
 #define CAN_43_MCAN_SID_SETCLOCKMODE                  ((uint8)0x0FU)
 #define CAN_43_MCAN_SID_ABORT_MB                      ((uint8)0x10U)
+#define CAN_43_MCAN_SID_COMPILE_RX_FILTERS            ((uint8)0x11U)
+#define CAN_43_MCAN_SID_SET_RX_FILTERS                ((uint8)0x12U)
+#define CAN_43_MCAN_SID_GET_RX_FILTER_BUDGET          ((uint8)0x13U)
+#define CAN_43_MCAN_SID_GET_RX_ADAPTIVE_STATS         ((uint8)0x14U)
+#define CAN_43_MCAN_SID_GET_CONTROLLER_STATS          ((uint8)0x15U)
+#define CAN_43_MCAN_SID_GET_HOH_STATS                 ((uint8)0x16U)
+#define CAN_43_MCAN_SID_WRITE_GATHER                  ((uint8)0x17U)
 
 /**@}*/
 
+/**
+* @brief          Can_43_MCAN_Write_Unchecked skips the development error checks of Can_43_MCAN_Write, for callers
+*                 which already guarantee an initialized driver, a transmit Hth and valid PduInfo pointers.
+*/
+#define CAN_43_MCAN_UNCHECKED_API  (STD_OFF)
+
+/**
+* @brief          Can_43_MCAN_CompileRxFilters reduces a list of receive IDs to range, dual ID and classic mask
+*                 filter elements, Can_43_MCAN_SetRxFilters loads them in place of the configured filter table.
+*/
+#define CAN_43_MCAN_RX_FILTER_COMPILER_API      (STD_OFF)
+
+/**
+* @brief          Maximum number of receive IDs accepted by one Can_43_MCAN_CompileRxFilters call.
+*/
+#define CAN_43_MCAN_RX_FILTER_COMPILER_MAX_IDS  (128U)
+
+/**
+* @brief          Adaptive Rx processing of the controllers configured for Rx interrupts. Can_43_MCAN_MainFunction_Read
+*                 masks the new message interrupts and polls the Rx FIFOs and dedicated buffers of a controller when at
+*                 least CAN_43_MCAN_RX_ADAPTIVE_POLL_THRESHOLD frames arrived during one period, and enables them again
+*                 when at most CAN_43_MCAN_RX_ADAPTIVE_IRQ_THRESHOLD arrived.
+*/
+#define CAN_43_MCAN_RX_ADAPTIVE_API             (STD_OFF)
+#define CAN_43_MCAN_RX_ADAPTIVE_POLL_THRESHOLD  (16U)
+#define CAN_43_MCAN_RX_ADAPTIVE_IRQ_THRESHOLD   (4U)
+
+/**
+* @brief          Frame, Rx FIFO fill level, overrun, Tx busy, cancellation and bus off counters per controller and
+*                 frame and Tx busy counters per HOH, read by Can_43_MCAN_GetControllerStats and
+*                 Can_43_MCAN_GetHohStats.
+*/
+#define CAN_43_MCAN_STATS_API                   (STD_OFF)
+
+/**
+* @brief          Histogram of the time from Can_43_MCAN_Write to the Tx confirmation, in the controller counters.
+*                 Bucket 0 counts the latencies below 2^CAN_43_MCAN_TX_LATENCY_SHIFT ticks of the Gpt STM time base,
+*                 every next bucket doubles the limit and the last one takes the rest. Needs CAN_43_MCAN_STATS_API
+*                 and GPT_STM_TIMEBASE_API.
+*/
+#define CAN_43_MCAN_TX_LATENCY_API              (STD_OFF)
+#define CAN_43_MCAN_TX_LATENCY_BUCKETS          (16U)
+#define CAN_43_MCAN_TX_LATENCY_SHIFT            (4U)
+
+#if ((CAN_43_MCAN_TX_LATENCY_API == STD_ON) && (CAN_43_MCAN_STATS_API != STD_ON))
+    #error "CAN_43_MCAN_TX_LATENCY_API needs CAN_43_MCAN_STATS_API"
+#endif
+
+/**
+* @brief          Can_43_MCAN_WriteGather transmits a frame whose payload is given as a list of fragments, copied
+*                 into the Tx buffer without being assembled first.
+*/
+#define CAN_43_MCAN_WRITE_GATHER_API            (STD_OFF)
+
 /*==================================================================================================
 *                                             ENUMS
 ==================================================================================================*/
@@ -314,6 +375,70 @@ typedef enum
 /*==================================================================================================
 *                                STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+/**
+* @brief          Can_43_MCAN_RxAdaptiveStatsType
+* @details        Mode residency of the adaptive Rx processing of a controller, counted in
+*                 Can_43_MCAN_MainFunction_Read periods. Filled by Can_43_MCAN_GetRxAdaptiveStats.
+*
+*/
+typedef struct
+    {
+        VAR(uint32, CAN_43_MCAN_VAR) u32InterruptPeriods; /**< @brief Periods spent with the Rx interrupts enabled */
+        VAR(uint32, CAN_43_MCAN_VAR) u32PollPeriods;      /**< @brief Periods spent polling */
+        VAR(uint32, CAN_43_MCAN_VAR) u32ModeSwitches;     /**< @brief Switches between the two modes */
+        VAR(uint32, CAN_43_MCAN_VAR) u32LastFrames;       /**< @brief Frames received during the last period */
+        VAR(boolean, CAN_43_MCAN_VAR) bPollMode;          /**< @brief TRUE when the controller is polled */
+    } Can_43_MCAN_RxAdaptiveStatsType;
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+/**
+* @brief          Can_43_MCAN_ControllerStatsType
+* @details        Counters of a controller since Can_43_MCAN_Init, filled by Can_43_MCAN_GetControllerStats.
+*                 The counters wrap around.
+*
+*/
+typedef struct
+    {
+        VAR(uint32, CAN_43_MCAN_VAR) u32RxFrames;         /**< @brief Frames passed to CanIf_RxIndication */
+        VAR(uint32, CAN_43_MCAN_VAR) u32TxFrames;         /**< @brief Frames passed to CanIf_TxConfirmation */
+        VAR(uint32, CAN_43_MCAN_VAR) u32TxBusy;           /**< @brief Can_43_MCAN_Write calls returning CAN_BUSY */
+        VAR(uint32, CAN_43_MCAN_VAR) u32TxCancellations;  /**< @brief Frames passed to CanIf_CancelTxConfirmation */
+        VAR(uint32, CAN_43_MCAN_VAR) u32BusOffEvents;     /**< @brief Bus off events */
+        VAR(uint32, CAN_43_MCAN_VAR) u32RxFifo0Overruns;  /**< @brief Rx FIFO 0 message lost (RF0L) events */
+        VAR(uint32, CAN_43_MCAN_VAR) u32RxFifo1Overruns;  /**< @brief Rx FIFO 1 message lost (RF1L) events */
+        VAR(uint8, CAN_43_MCAN_VAR)  u8RxFifo0HighWater;  /**< @brief Highest Rx FIFO 0 fill level seen on reading */
+        VAR(uint8, CAN_43_MCAN_VAR)  u8RxFifo1HighWater;  /**< @brief Highest Rx FIFO 1 fill level seen on reading */
+#if (CAN_43_MCAN_TX_LATENCY_API == STD_ON)
+        /**< @brief Can_43_MCAN_Write to Tx confirmation latencies, see CAN_43_MCAN_TX_LATENCY_SHIFT */
+        VAR(uint32, CAN_43_MCAN_VAR) u32TxLatency[CAN_43_MCAN_TX_LATENCY_BUCKETS];
+#endif /* (CAN_43_MCAN_TX_LATENCY_API == STD_ON) */
+    } Can_43_MCAN_ControllerStatsType;
+
+/**
+* @brief          Can_43_MCAN_HohStatsType
+* @details        Counters of a hardware object since Can_43_MCAN_Init, filled by Can_43_MCAN_GetHohStats.
+*
+*/
+typedef struct
+    {
+        VAR(uint32, CAN_43_MCAN_VAR) u32Frames;           /**< @brief Frames received or confirmed as sent */
+        VAR(uint32, CAN_43_MCAN_VAR) u32TxBusy;           /**< @brief Can_43_MCAN_Write calls returning CAN_BUSY */
+    } Can_43_MCAN_HohStatsType;
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
+
+/**
+* @brief          Can_43_MCAN_TxFragmentType
+* @details        Part of the payload of a Tx frame, see Can_43_MCAN_WriteGather.
+*
+*/
+typedef struct
+    {
+        P2CONST(uint8, CAN_43_MCAN_VAR, CAN_43_MCAN_APPL_CONST) pData;   /**< @brief Bytes of the fragment */
+        VAR(uint8, CAN_43_MCAN_VAR) u8Length;                            /**< @brief Number of bytes */
+    } Can_43_MCAN_TxFragmentType;
+
 /**
 * @brief          Configuration of FlexCAN controller.
 * @details        This structure is initialized by Tresos considering user settings.
@@ -556,6 +681,37 @@ typedef struct
         CONST(uint16, CAN_43_MCAN_CONST) RxBufferOffset;
         CONST(uint16, CAN_43_MCAN_CONST) TxBufferOffset;
     } Can_43_MCAN_ControllerSectionOffsetType;
+
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+/**
+* @brief          Rx Filter Element
+* @details        One standard or extended filter element produced by Can_43_MCAN_CompileRxFilters.
+*                 u8FilterType holds the SFT/EFT encoding: 0 = range Id1..Id2, 1 = dual ID Id1 or Id2,
+*                 2 = classic filter Id1 with mask Id2.
+*/
+typedef struct
+    {
+        VAR(Can_43_MCANIdType, CAN_43_MCAN_VAR) eIdType;  /**< @brief CAN_43_MCAN_STANDARD or CAN_43_MCAN_EXTENDED */
+        VAR(uint8, CAN_43_MCAN_VAR)  u8FilterType;        /**< @brief SFT/EFT filter type */
+        VAR(uint32, CAN_43_MCAN_VAR) u32Id1;              /**< @brief SFID1/EFID1 */
+        VAR(uint32, CAN_43_MCAN_VAR) u32Id2;              /**< @brief SFID2/EFID2 */
+    } Can_43_MCAN_RxFilterElementType;
+
+/**
+* @brief          Rx Filter Compile Report
+* @details        Result of Can_43_MCAN_CompileRxFilters. The false accept rate counts IDs, every ID passed by
+*                 the elements but not in the list counts once regardless of its bus load. IDs passed by two
+*                 overlapping classic mask elements count twice, so the rate is an upper bound.
+*/
+typedef struct
+    {
+        VAR(uint16, CAN_43_MCAN_VAR) u16IdCount;             /**< @brief Distinct IDs in the list */
+        VAR(uint16, CAN_43_MCAN_VAR) u16ElementCount;        /**< @brief Filter elements produced */
+        VAR(uint32, CAN_43_MCAN_VAR) u32AcceptedIds;         /**< @brief IDs passed by the elements */
+        VAR(uint32, CAN_43_MCAN_VAR) u32FalseAcceptIds;      /**< @brief IDs passed by the elements but not in the list */
+        VAR(uint16, CAN_43_MCAN_VAR) u16FalseAcceptPerMille; /**< @brief u32FalseAcceptIds per thousand u32AcceptedIds */
+    } Can_43_MCAN_RxFilterReportType;
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
 #endif /* (CAN_43_MCAN_MCAN_SPECIFIC == STD_ON) */
 #endif
 
@@ -909,6 +1065,70 @@ extern FUNC(Can_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_Write( VAR(Can_HwHandl
                                                  P2CONST(Can_PduType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) PduInfo
                                                );
 
+#if (CAN_43_MCAN_UNCHECKED_API == STD_ON)
+extern FUNC(Can_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_Write_Unchecked( VAR(Can_HwHandleType, AUTOMATIC) Hth,
+                                                 P2CONST(Can_PduType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) PduInfo
+                                               );
+#endif /* (CAN_43_MCAN_UNCHECKED_API == STD_ON) */
+
+#if (CAN_43_MCAN_WRITE_GATHER_API == STD_ON)
+extern FUNC(Can_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_WriteGather( VAR(Can_HwHandleType, AUTOMATIC) Hth,
+                                                 P2CONST(Can_PduType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) PduInfo,
+                                                 P2CONST(Can_43_MCAN_TxFragmentType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) Fragments,
+                                                 VAR(uint8, AUTOMATIC) FragmentCount
+                                               );
+#endif /* (CAN_43_MCAN_WRITE_GATHER_API == STD_ON) */
+
+#ifdef CAN_43_MCAN_MCAN_SPECIFIC
+#if ((CAN_43_MCAN_MCAN_SPECIFIC == STD_ON) && (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON))
+extern FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_CompileRxFilters
+    (
+        P2CONST(uint32, AUTOMATIC, CAN_43_MCAN_APPL_CONST) IdList,
+        VAR(uint16, AUTOMATIC) IdCount,
+        VAR(Can_43_MCANIdType, AUTOMATIC) IdType,
+        VAR(uint8, AUTOMATIC) MaxElements,
+        P2VAR(Can_43_MCAN_RxFilterElementType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Elements,
+        P2VAR(Can_43_MCAN_RxFilterReportType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Report
+    );
+
+extern FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_SetRxFilters
+    (
+        VAR(uint8, AUTOMATIC) Controller,
+        P2CONST(Can_43_MCAN_RxFilterElementType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) Elements,
+        VAR(uint8, AUTOMATIC) ElementCount,
+        VAR(uint8, AUTOMATIC) ElementConfig
+    );
+
+extern FUNC(uint8, CAN_43_MCAN_CODE) Can_43_MCAN_GetRxFilterBudget
+    (
+        VAR(uint8, AUTOMATIC) Controller,
+        VAR(Can_43_MCANIdType, AUTOMATIC) IdType
+    );
+#endif /* ((CAN_43_MCAN_MCAN_SPECIFIC == STD_ON) && (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)) */
+#endif /* CAN_43_MCAN_MCAN_SPECIFIC */
+
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+extern FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_GetRxAdaptiveStats
+    (
+        VAR(uint8, AUTOMATIC) Controller,
+        P2VAR(Can_43_MCAN_RxAdaptiveStatsType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Stats
+    );
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+extern FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_GetControllerStats
+    (
+        VAR(uint8, AUTOMATIC) Controller,
+        P2VAR(Can_43_MCAN_ControllerStatsType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Stats
+    );
+
+extern FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_GetHohStats
+    (
+        VAR(Can_HwHandleType, AUTOMATIC) Hoh,
+        P2VAR(Can_43_MCAN_HohStatsType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Stats
+    );
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
+
 extern FUNC (Can_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_CheckWakeup( VAR(uint8, AUTOMATIC) controller);
 
 
@@ -1032,8 +1252,14 @@ extern FUNC(void, CAN_43_MCAN_CODE) Can_43_MCAN_MainFunction_Read_10( void);
 #endif /* ifdef CAN_43_MCAN_MAINFUNCTION_MULTIPLE_READ */
 
 #else /* (CAN_43_MCAN_RXPOLL_SUPPORTED == STD_OFF) */
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+
+extern FUNC(void, CAN_43_MCAN_CODE) Can_43_MCAN_MainFunction_Read( void);
+
+#else
 /* @violates @ref Can_43_MCAN_h_REF_1 Violates MISRA 2004 Advisory Rule 19.7, Function-like macro defined.*/
 #define Can_43_MCAN_MainFunction_Read()
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
 
 #endif /* (CAN_43_MCAN_RXPOLL_SUPPORTED == STD_OFF) */
 
@@ -194,12 +194,35 @@ extern "C"{
         #define         Can_43_MCAN_IPW_AbortMb(Hth)                                              (Can_MCan_AbortMb(Hth))
     #endif /* (CAN_43_MCAN_API_ENABLE_ABORT_MB == STD_ON) && (CAN_43_MCAN_HW_TRANSMIT_CANCELLATION == STD_ON) */
 
+    #if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_4 Violates MISRA 2004 Required Rule 19.10, Parantheses not used for parameters due to ##. */
+        #define         Can_43_MCAN_IPW_CompileRxFilters(IdList, IdCount, IdType, MaxElements, Elements, Report) \
+                        (Can_MCan_CompileRxFilters((IdList), (IdCount), (IdType), (MaxElements), (Elements), (Report)))
+
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_4 Violates MISRA 2004 Required Rule 19.10, Parantheses not used for parameters due to ##. */
+        #define         Can_43_MCAN_IPW_SetRxFilters(Controller, Elements, ElementCount, ElementConfig) \
+                        (Can_MCan_SetRxFilters((Controller), (Elements), (ElementCount), (ElementConfig)))
+
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_4 Violates MISRA 2004 Required Rule 19.10, Parantheses not used for parameters due to ##. */
+        #define         Can_43_MCAN_IPW_GetRxFilterBudget(Controller, IdType)                     (Can_MCan_GetRxFilterBudget((Controller), (IdType)))
+    #endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
+
 
 /* @violates @ref CAN_43_MCAN_IPW_h_REF_4 Violates MISRA 2004 Required Rule 19.10, Parantheses not used for parameters due to ##. */
         /* @violates @ref CAN_43_MCAN_IPW_h_REF_5 Violates MISRA 2004 Required Rule 19.4, expand c macro to use stub for support user mode. */
         /* @violates @ref CAN_43_MCAN_IPW_h_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
         #define         Can_43_MCAN_IPW_Write(Hth, PduInfo)                                       (Can_MCan_Write((Hth), (PduInfo)))
 
+#if (CAN_43_MCAN_WRITE_GATHER_API == STD_ON)
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_4 Violates MISRA 2004 Required Rule 19.10, Parantheses not used for parameters due to ##. */
+        #define         Can_43_MCAN_IPW_WriteGather(Hth, PduInfo, Fragments, FragmentCount) \
+                        (Can_MCan_WriteGather((Hth), (PduInfo), (Fragments), (FragmentCount)))
+#endif /* (CAN_43_MCAN_WRITE_GATHER_API == STD_ON) */
+
 #if ((CAN_43_MCAN_TXPOLL_SUPPORTED == STD_ON))
 /* @violates @ref CAN_43_MCAN_IPW_h_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
 /* @violates @ref CAN_43_MCAN_IPW_h_REF_4 Violates MISRA 2004 Required Rule 19.10, Parantheses not used for parameters due to ##. */
@@ -218,6 +241,21 @@ extern "C"{
         #define         Can_43_MCAN_IPW_MainFunctionMultipleReadPoll(readpoll)                    (Can_MCan_MainFunctionMultipleReadPoll(readpoll))
     #endif
 
+    #if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_4 Violates MISRA 2004 Required Rule 19.10, Parantheses not used for parameters due to ##. */
+        #define         Can_43_MCAN_IPW_MainFunctionRxAdaptive()                                  (Can_MCan_MainFunctionRxAdaptive())
+    #endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+
+    #if (CAN_43_MCAN_STATS_API == STD_ON)
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_4 Violates MISRA 2004 Required Rule 19.10, Parantheses not used for parameters due to ##. */
+        #define         Can_43_MCAN_IPW_GetControllerStats(Controller, Stats)                    (Can_MCan_GetControllerStats((Controller), (Stats)))
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
+/* @violates @ref CAN_43_MCAN_IPW_h_REF_4 Violates MISRA 2004 Required Rule 19.10, Parantheses not used for parameters due to ##. */
+        #define         Can_43_MCAN_IPW_GetHohStats(Hoh, Stats)                                  (Can_MCan_GetHohStats((Hoh), (Stats)))
+    #endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
+
     /* @violates @ref CAN_43_MCAN_IPW_h_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macro defined. */
     /* @violates @ref CAN_43_MCAN_IPW_h_REF_4 Violates MISRA 2004 Required Rule 19.10, Parantheses not used for parameters due to ##. */
     #define         Can_43_MCAN_IPW_MainFunctionMode()  (Can_MCan_MainFunctionMode())
@@ -186,6 +186,32 @@ typedef struct
         VAR(uint8, CAN_43_MCAN_VAR)          u8CurrentBaudRateIndex;
         
         VAR(uint32, CAN_43_MCAN_VAR)         Tx_complete_guard;
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+        /*< @brief Filter elements loaded in place of the configured Rx filter table, NULL_PTR for the configured table */
+        P2CONST(Can_43_MCAN_RxFilterElementType, CAN_43_MCAN_VAR, CAN_43_MCAN_APPL_CONST) pRxFilterSet;
+        /*< @brief Number of elements in pRxFilterSet */
+        VAR(uint8, CAN_43_MCAN_VAR)          u8RxFilterSetCount;
+        /*< @brief SFEC/EFEC element configuration used for every element of pRxFilterSet */
+        VAR(uint8, CAN_43_MCAN_VAR)          u8RxFilterSetConfig;
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+        /*< @brief TRUE while the new message interrupts are masked and the Rx is polled */
+        volatile VAR(boolean, CAN_43_MCAN_VAR) bRxPollMode;
+        /*< @brief Frames passed to CanIf, in both modes. Wraps around. */
+        volatile VAR(uint32, CAN_43_MCAN_VAR) u32RxFrames;
+        /*< @brief Value of u32RxFrames at the previous Can_43_MCAN_MainFunction_Read period */
+        VAR(uint32, CAN_43_MCAN_VAR)         u32RxFrameMark;
+        /*< @brief Mode residency read by Can_43_MCAN_GetRxAdaptiveStats */
+        VAR(Can_43_MCAN_RxAdaptiveStatsType, CAN_43_MCAN_VAR) RxAdaptiveStats;
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+        /*< @brief Counters read by Can_43_MCAN_GetControllerStats */
+        VAR(Can_43_MCAN_ControllerStatsType, CAN_43_MCAN_VAR) Stats;
+#if (CAN_43_MCAN_TX_LATENCY_API == STD_ON)
+        /*< @brief Time base at the Can_Write call of the frame in each Tx MB */
+        VAR(uint32, CAN_43_MCAN_VAR)         u32TxWriteTime[CAN_43_MCAN_MAX_TX_MB_CONFIG];
+#endif /* (CAN_43_MCAN_TX_LATENCY_API == STD_ON) */
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
     } Can_43_MCAN_ControllerStatusType;
 
 typedef P2CONST( Can_43_MCAN_MBConfigContainerType, CAN_43_MCAN_CONST, CAN_43_MCAN_APPL_DATA)   Can_43_MCAN_PtrMBConfigContainerType;
@@ -259,11 +285,47 @@ FUNC(void, CAN_43_MCAN_CODE) Can_MCan_AbortMb( VAR(Can_HwHandleType, AUTOMATIC)
 
 #endif
 
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+
+FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_MCan_CompileRxFilters
+    (
+        P2CONST(uint32, AUTOMATIC, CAN_43_MCAN_APPL_CONST) IdList,
+        VAR(uint16, AUTOMATIC) IdCount,
+        VAR(Can_43_MCANIdType, AUTOMATIC) IdType,
+        VAR(uint8, AUTOMATIC) MaxElements,
+        P2VAR(Can_43_MCAN_RxFilterElementType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Elements,
+        P2VAR(Can_43_MCAN_RxFilterReportType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Report
+    );
+
+FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_MCan_SetRxFilters
+    (
+        VAR(uint8, AUTOMATIC) controller,
+        P2CONST(Can_43_MCAN_RxFilterElementType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) Elements,
+        VAR(uint8, AUTOMATIC) ElementCount,
+        VAR(uint8, AUTOMATIC) ElementConfig
+    );
+
+FUNC(uint8, CAN_43_MCAN_CODE) Can_MCan_GetRxFilterBudget
+    (
+        VAR(uint8, AUTOMATIC) controller,
+        VAR(Can_43_MCANIdType, AUTOMATIC) IdType
+    );
+
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
+
 
 FUNC (Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_Write( Can_HwHandleType Hth,
                                                 P2CONST(Can_PduType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) PduInfo
                                               );
 
+#if (CAN_43_MCAN_WRITE_GATHER_API == STD_ON)
+FUNC (Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_WriteGather( Can_HwHandleType Hth,
+                                                      P2CONST(Can_PduType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) PduInfo,
+                                                      P2CONST(Can_43_MCAN_TxFragmentType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) Fragments,
+                                                      VAR(uint8, AUTOMATIC) FragmentCount
+                                                    );
+#endif /* (CAN_43_MCAN_WRITE_GATHER_API == STD_ON) */
+
 
 FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessTx( CONST(uint8, AUTOMATIC) controller,
                                           CONST(uint8, AUTOMATIC) mbindex_start,
@@ -286,6 +348,24 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_MainFunctionMultipleReadPoll( VAR(uint8,
 
 #endif /* (CAN_43_MCAN_RXPOLL_SUPPORTED == STD_ON) */
 
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+
+FUNC (void, CAN_43_MCAN_CODE) Can_MCan_MainFunctionRxAdaptive( void);
+
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+
+FUNC (void, CAN_43_MCAN_CODE) Can_MCan_GetControllerStats( VAR(uint8, AUTOMATIC) controller,
+                                                           P2VAR(Can_43_MCAN_ControllerStatsType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Stats
+                                                         );
+
+FUNC (void, CAN_43_MCAN_CODE) Can_MCan_GetHohStats( VAR(Can_HwHandleType, AUTOMATIC) Hoh,
+                                                    P2VAR(Can_43_MCAN_HohStatsType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Stats
+                                                  );
+
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
+
 
 FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessBusOff( CONST(uint8, CAN_43_MCAN_CONST) controller);
 
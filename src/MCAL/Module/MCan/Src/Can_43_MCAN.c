@@ -966,6 +966,439 @@ FUNC(Can_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_Write( VAR(Can_HwHandleType,
     return (eReturnValue);
 }
 
+/*================================================================================================*/
+#if (CAN_43_MCAN_UNCHECKED_API == STD_ON)
+/**
+* @brief          Transmits a message without the development error checks. SID is 0x06.
+* @details        Same as Can_43_MCAN_Write for callers which already guarantee an initialized driver, a
+*                 configured transmit Hth and non NULL PduInfo and PduInfo->sdu. No error is
+*                 reported to Det.
+*
+* @param[in]      Hth Information which HW-transmit handle shall be used for transmit.
+* @param[in]      PduInfo Pointer to SDU user memory, DLC and Identifier.
+* @return         Can_ReturnType   Result of the write operation.
+* @retval         CAN_OK   Write command has been accepted.
+* @retval         CAN_BUSY   No of TX hardware buffer available or preemtive call of Can_43_MCAN_Write() that can't be implemented reentrant.
+*
+* @pre            Driver must be initialized and MB must be configured for Tx.
+*
+* @violates @ref Can_43_MCAN_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Can_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_Write_Unchecked( VAR(Can_HwHandleType, AUTOMATIC) Hth,
+                                          P2CONST(Can_PduType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) PduInfo 
+                                        )
+{
+    /* @violates @ref Can_43_MCAN_c_REF_9 Violates MISRA 2004 Required Rule 10.1 , prohibited Implicit Conversion: Non-constant argument to function, Implicit conversion of integer to smaller type */ 
+    return ((Can_ReturnType)Can_43_MCAN_IPW_Write(Hth,PduInfo));
+}
+#endif /* (CAN_43_MCAN_UNCHECKED_API == STD_ON) */
+
+#if (CAN_43_MCAN_WRITE_GATHER_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Transmit a frame whose payload is given as fragments. SID is 0x17.
+* @details        Same as Can_43_MCAN_Write, but the payload is taken from the fragments in order instead of
+*                 PduInfo->sdu, so that a caller can send a header and a payload kept apart without first
+*                 copying them together. The fragments are packed directly into the Tx buffer.
+*                 This routine is called by:
+*                 - CanIf or an upper layer.
+*
+* @param[in]      Hth Information which HW-transmit handle shall be used for transmit.
+* @param[in]      PduInfo Identifier, length and PduId of the frame. The SDU pointer is not used.
+* @param[in]      Fragments Payload fragments, PduInfo->length bytes in total.
+* @param[in]      FragmentCount Number of fragments.
+* @return         Can_ReturnType   Result of the write operation.
+* @retval         CAN_OK   Write command has been accepted.
+* @retval         CAN_NOT_OK  Development error occured.
+* @retval         CAN_BUSY   No of TX hardware buffer available or preemtive call of Can_43_MCAN_Write() that can't be implemented reentrant.
+*
+* @pre            Driver must be initialized and MB must be configured for Tx.
+*
+* @violates @ref Can_43_MCAN_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Can_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_WriteGather( VAR(Can_HwHandleType, AUTOMATIC) Hth,
+                                          P2CONST(Can_PduType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) PduInfo,
+                                          P2CONST(Can_43_MCAN_TxFragmentType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) Fragments,
+                                          VAR(uint8, AUTOMATIC) FragmentCount
+                                        )
+{
+    /* Variable for return status */
+    VAR(Can_ReturnType, AUTOMATIC)  eReturnValue = CAN_NOT_OK;
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    VAR(uint32, AUTOMATIC) u32Length = 0U;
+    VAR(boolean, AUTOMATIC) bNullData = (boolean)FALSE;
+    VAR(uint8, AUTOMATIC) u8Fragment;
+
+    if ( CAN_43_MCAN_UNINIT == Can_43_MCAN_eDriverStatus )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_WRITE_GATHER, (uint8)CAN_43_MCAN_E_UNINIT);
+    }
+    else if ( (Hth >= Can_43_MCAN_pCurrentConfig->u32CanMaxObjectId) ||
+              (CAN_43_MCAN_TRANSMIT != (Can_43_MCAN_ObjType)Can_43_MCAN_pCurrentConfig->eObjectTypeMapping[Hth])
+            )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_WRITE_GATHER, (uint8)CAN_43_MCAN_E_PARAM_HANDLE);
+    }
+    else if ( (NULL_PTR == PduInfo) || ((NULL_PTR == Fragments) && (0U != FragmentCount)) )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_WRITE_GATHER, (uint8)CAN_43_MCAN_E_PARAM_POINTER);
+    }
+    else
+    {
+        for (u8Fragment = 0U; u8Fragment < FragmentCount; u8Fragment++)
+        {
+            /* @violates @ref Can_43_MCAN_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+            u32Length += (uint32)Fragments[u8Fragment].u8Length;
+            /* @violates @ref Can_43_MCAN_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+            if ( (NULL_PTR == Fragments[u8Fragment].pData) && (0U != Fragments[u8Fragment].u8Length) )
+            {
+                bNullData = (boolean)TRUE;
+            }
+        }
+        if ( (boolean)TRUE == bNullData )
+        {
+            (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_WRITE_GATHER, (uint8)CAN_43_MCAN_E_PARAM_POINTER);
+        }
+        else if ( u32Length != (uint32)PduInfo->length )
+        {
+            (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_WRITE_GATHER, (uint8)CAN_43_MCAN_E_PARAM_DLC);
+        }
+        else
+        {
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+            eReturnValue = (Can_ReturnType)Can_43_MCAN_IPW_WriteGather(Hth, PduInfo, Fragments, FragmentCount);
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+        }
+    }
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+    return (eReturnValue);
+}
+#endif /* (CAN_43_MCAN_WRITE_GATHER_API == STD_ON) */
+
+#ifdef CAN_43_MCAN_MCAN_SPECIFIC
+#if ((CAN_43_MCAN_MCAN_SPECIFIC == STD_ON) && (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON))
+/*================================================================================================*/
+/**
+* @brief          Compile receive IDs into filter elements. SID is 0x11.
+* @details        Reduces the receive IDs wanted by CanIf to at most MaxElements range, dual ID and classic mask
+*                 filter elements, merging neighbouring IDs at the lowest number of falsely passed IDs until
+*                 they fit. The function does not need an initialized driver and can be run offline.
+*                 This routine is called by:
+*                 - CanIf or an upper layer.
+*
+* @param[in]      IdList Receive IDs, in any order.
+* @param[in]      IdCount Number of IDs, at most CAN_43_MCAN_RX_FILTER_COMPILER_MAX_IDS.
+* @param[in]      IdType CAN_43_MCAN_STANDARD or CAN_43_MCAN_EXTENDED.
+* @param[in]      MaxElements Filter element budget, see Can_43_MCAN_GetRxFilterBudget().
+* @param[out]     Elements Filter elements, room for MaxElements.
+* @param[out]     Report Element count and false accept rate.
+*
+* @retval         E_OK  the elements pass every ID of the list.
+* @retval         E_NOT_OK  invalid ID, ID type or counts.
+*
+* @violates @ref Can_43_MCAN_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_CompileRxFilters
+    (
+        P2CONST(uint32, AUTOMATIC, CAN_43_MCAN_APPL_CONST) IdList,
+        VAR(uint16, AUTOMATIC) IdCount,
+        VAR(Can_43_MCANIdType, AUTOMATIC) IdType,
+        VAR(uint8, AUTOMATIC) MaxElements,
+        P2VAR(Can_43_MCAN_RxFilterElementType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Elements,
+        P2VAR(Can_43_MCAN_RxFilterReportType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Report
+    )
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturnValue = (uint8)E_NOT_OK;
+
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    if ( ((NULL_PTR == IdList) && (0U != IdCount)) || (NULL_PTR == Elements) || (NULL_PTR == Report) )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_COMPILE_RX_FILTERS, (uint8)CAN_43_MCAN_E_PARAM_POINTER);
+    }
+    else
+    {
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+        eReturnValue = Can_43_MCAN_IPW_CompileRxFilters(IdList, IdCount, IdType, MaxElements, Elements, Report);
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    }
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+    return (eReturnValue);
+}
+
+/*================================================================================================*/
+/**
+* @brief          Load filter elements in place of the configured Rx filter table. SID is 0x12.
+* @details        The controller is reinitialized with the elements, which stay in use across later
+*                 reinitializations until the function is called again. The element array is used by
+*                 reference and must stay valid. NULL_PTR loads the configured table again.
+*                 This routine is called by:
+*                 - CanIf or an upper layer.
+*
+* @param[in]      Controller Can controller - based on configuration order list (CanControllerId).
+* @param[in]      Elements Filter elements, typically produced by Can_43_MCAN_CompileRxFilters().
+* @param[in]      ElementCount Number of elements.
+* @param[in]      ElementConfig SFEC/EFEC for every element: 1 stores in Rx FIFO 0, 2 in Rx FIFO 1.
+*
+* @retval         E_OK  the filters are loaded.
+* @retval         E_NOT_OK  invalid element or more elements than the filter budget of the controller.
+*
+* @pre            The driver must be initialized and the controller must be in Stop state.
+*
+* @violates @ref Can_43_MCAN_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_SetRxFilters
+    (
+        VAR(uint8, AUTOMATIC) Controller,
+        P2CONST(Can_43_MCAN_RxFilterElementType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) Elements,
+        VAR(uint8, AUTOMATIC) ElementCount,
+        VAR(uint8, AUTOMATIC) ElementConfig
+    )
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturnValue = (uint8)E_NOT_OK;
+
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    if ( CAN_43_MCAN_UNINIT == Can_43_MCAN_eDriverStatus )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_SET_RX_FILTERS, (uint8)CAN_43_MCAN_E_UNINIT);
+    }
+    else if ( (Controller >= (uint8)Can_43_MCANStatic_pCurrentConfig->u8ControllersConfigured) ||
+              /* @violates @ref Can_43_MCAN_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+              (CAN_43_MCAN_NULL_OFFSET == (Can_43_MCANStatic_pControlerDescriptors[Controller].u8ControllerOffset))
+            )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_SET_RX_FILTERS, (uint8)CAN_43_MCAN_E_PARAM_CONTROLLER);
+    }
+    else if ( CAN_43_MCAN_STOPPED != Can_43_MCAN_ControllerStatuses[Controller].ControllerState )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_SET_RX_FILTERS, (uint8)CAN_43_MCAN_E_TRANSITION);
+    }
+    else
+    {
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+        eReturnValue = Can_43_MCAN_IPW_SetRxFilters(Controller, Elements, ElementCount, ElementConfig);
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    }
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+    return (eReturnValue);
+}
+
+/*================================================================================================*/
+/**
+* @brief          Filter element budget of a controller. SID is 0x13.
+* @details        Number of standard or extended filter elements reserved in the shared RAM for the controller
+*                 by the configured Rx filter table.
+*                 This routine is called by:
+*                 - CanIf or an upper layer.
+*
+* @param[in]      Controller Can controller - based on configuration order list (CanControllerId).
+* @param[in]      IdType CAN_43_MCAN_STANDARD or CAN_43_MCAN_EXTENDED.
+*
+* @return         uint8 Filter elements, 0 on a development error.
+*
+* @pre            The driver must be initialized.
+*
+* @violates @ref Can_43_MCAN_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(uint8, CAN_43_MCAN_CODE) Can_43_MCAN_GetRxFilterBudget
+    (
+        VAR(uint8, AUTOMATIC) Controller,
+        VAR(Can_43_MCANIdType, AUTOMATIC) IdType
+    )
+{
+    VAR(uint8, AUTOMATIC) u8Budget = 0U;
+
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    if ( CAN_43_MCAN_UNINIT == Can_43_MCAN_eDriverStatus )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_RX_FILTER_BUDGET, (uint8)CAN_43_MCAN_E_UNINIT);
+    }
+    else if ( (Controller >= (uint8)Can_43_MCANStatic_pCurrentConfig->u8ControllersConfigured) ||
+              /* @violates @ref Can_43_MCAN_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+              (CAN_43_MCAN_NULL_OFFSET == (Can_43_MCANStatic_pControlerDescriptors[Controller].u8ControllerOffset))
+            )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_RX_FILTER_BUDGET, (uint8)CAN_43_MCAN_E_PARAM_CONTROLLER);
+    }
+    else
+    {
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+        u8Budget = Can_43_MCAN_IPW_GetRxFilterBudget(Controller, IdType);
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    }
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+    return (u8Budget);
+}
+#endif /* ((CAN_43_MCAN_MCAN_SPECIFIC == STD_ON) && (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)) */
+#endif /* CAN_43_MCAN_MCAN_SPECIFIC */
+
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Mode residency of the adaptive Rx processing of a controller. SID is 0x14.
+* @details        Copies the counters kept by Can_43_MCAN_MainFunction_Read since Can_43_MCAN_Init. A controller is
+*                 only counted while it is started and configured for Rx interrupts.
+*                 This routine is called by:
+*                 - CanIf or an upper layer.
+*
+* @param[in]      Controller Can controller - based on configuration order list (CanControllerId).
+* @param[out]     Stats Counters of the controller.
+*
+* @retval         E_OK  the counters are copied.
+* @retval         E_NOT_OK  development error.
+*
+* @pre            The driver must be initialized.
+*
+* @violates @ref Can_43_MCAN_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_GetRxAdaptiveStats
+    (
+        VAR(uint8, AUTOMATIC) Controller,
+        P2VAR(Can_43_MCAN_RxAdaptiveStatsType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Stats
+    )
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturnValue = (uint8)E_NOT_OK;
+
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    if ( CAN_43_MCAN_UNINIT == Can_43_MCAN_eDriverStatus )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_RX_ADAPTIVE_STATS, (uint8)CAN_43_MCAN_E_UNINIT);
+    }
+    else if ( (Controller >= (uint8)Can_43_MCANStatic_pCurrentConfig->u8ControllersConfigured) ||
+              /* @violates @ref Can_43_MCAN_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+              (CAN_43_MCAN_NULL_OFFSET == (Can_43_MCANStatic_pControlerDescriptors[Controller].u8ControllerOffset))
+            )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_RX_ADAPTIVE_STATS, (uint8)CAN_43_MCAN_E_PARAM_CONTROLLER);
+    }
+    else if ( NULL_PTR == Stats )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_RX_ADAPTIVE_STATS, (uint8)CAN_43_MCAN_E_PARAM_POINTER);
+    }
+    else
+    {
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+        *Stats = Can_43_MCAN_ControllerStatuses[Controller].RxAdaptiveStats;
+        eReturnValue = (uint8)E_OK;
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    }
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+    return (eReturnValue);
+}
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Counters of a controller. SID is 0x15.
+* @details        Copies the frame, Tx busy, cancellation, bus off, Rx FIFO overrun and fill level counters
+*                 kept since Can_43_MCAN_Init and, with CAN_43_MCAN_TX_LATENCY_API, the Tx latency histogram.
+*                 This routine is called by:
+*                 - CanIf or an upper layer.
+*
+* @param[in]      Controller Can controller - based on configuration order list (CanControllerId).
+* @param[out]     Stats Counters of the controller.
+*
+* @retval         E_OK  the counters are copied.
+* @retval         E_NOT_OK  development error.
+*
+* @pre            The driver must be initialized.
+*
+* @violates @ref Can_43_MCAN_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_GetControllerStats
+    (
+        VAR(uint8, AUTOMATIC) Controller,
+        P2VAR(Can_43_MCAN_ControllerStatsType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Stats
+    )
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturnValue = (uint8)E_NOT_OK;
+
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    if ( CAN_43_MCAN_UNINIT == Can_43_MCAN_eDriverStatus )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_CONTROLLER_STATS, (uint8)CAN_43_MCAN_E_UNINIT);
+    }
+    else if ( (Controller >= (uint8)Can_43_MCANStatic_pCurrentConfig->u8ControllersConfigured) ||
+              /* @violates @ref Can_43_MCAN_c_REF_4 Violates MISRA 2004 Required Rule 17.4, pointer arithmetic other than array indexing used */
+              (CAN_43_MCAN_NULL_OFFSET == (Can_43_MCANStatic_pControlerDescriptors[Controller].u8ControllerOffset))
+            )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_CONTROLLER_STATS, (uint8)CAN_43_MCAN_E_PARAM_CONTROLLER);
+    }
+    else if ( NULL_PTR == Stats )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_CONTROLLER_STATS, (uint8)CAN_43_MCAN_E_PARAM_POINTER);
+    }
+    else
+    {
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+        Can_43_MCAN_IPW_GetControllerStats(Controller, Stats);
+        eReturnValue = (uint8)E_OK;
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    }
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+    return (eReturnValue);
+}
+
+/*================================================================================================*/
+/**
+* @brief          Counters of a hardware object. SID is 0x16.
+* @details        Copies the frames received by a Hrh or confirmed as sent by a Hth and the Can_43_MCAN_Write
+*                 calls of a Hth returning CAN_BUSY, counted since Can_43_MCAN_Init.
+*                 This routine is called by:
+*                 - CanIf or an upper layer.
+*
+* @param[in]      Hoh Hardware object, Hrh or Hth.
+* @param[out]     Stats Counters of the hardware object.
+*
+* @retval         E_OK  the counters are copied.
+* @retval         E_NOT_OK  development error.
+*
+* @pre            The driver must be initialized.
+*
+* @violates @ref Can_43_MCAN_c_REF_5 Violates MISRA 2004 Required Rule 8.10, external ... could be made static
+* @api
+*/
+FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_43_MCAN_GetHohStats
+    (
+        VAR(Can_HwHandleType, AUTOMATIC) Hoh,
+        P2VAR(Can_43_MCAN_HohStatsType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Stats
+    )
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturnValue = (uint8)E_NOT_OK;
+
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    if ( CAN_43_MCAN_UNINIT == Can_43_MCAN_eDriverStatus )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_HOH_STATS, (uint8)CAN_43_MCAN_E_UNINIT);
+    }
+    else if ( Hoh >= (Can_HwHandleType)CAN_43_MCAN_MAX_OBJECT_ID )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_HOH_STATS, (uint8)CAN_43_MCAN_E_PARAM_HANDLE);
+    }
+    else if ( NULL_PTR == Stats )
+    {
+        (void)Det_ReportError( (uint16)CAN_43_MCAN_MODULE_ID, (uint8)CAN_43_MCAN_INSTANCE, (uint8)CAN_43_MCAN_SID_GET_HOH_STATS, (uint8)CAN_43_MCAN_E_PARAM_POINTER);
+    }
+    else
+    {
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+        Can_43_MCAN_IPW_GetHohStats(Hoh, Stats);
+        eReturnValue = (uint8)E_OK;
+#if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
+    }
+#endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */
+    return (eReturnValue);
+}
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
+
 /*================================================================================================*/
 /*================================================================================================*/
 
@@ -1455,11 +1888,13 @@ FUNC(void, CAN_43_MCAN_CODE) Can_43_MCAN_MainFunction_Write_10( void)
 
 /*================================================================================================*/
 
-#if (CAN_43_MCAN_RXPOLL_SUPPORTED  == STD_ON)
+#if ((CAN_43_MCAN_RXPOLL_SUPPORTED  == STD_ON) || (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON))
    
 /**
 * @brief          Function called at fixed cyclic time.  SID is 0x08.
 * @details        Service for performs the polling of RX indications when CAN_RX_PROCESSING is set to POLLING.
+*                 With CAN_43_MCAN_RX_ADAPTIVE_API it also switches the controllers configured for Rx interrupts
+*                 between interrupts and polling according to the frames received since the previous call.
 *                 This routine is called by:
 *                 - CanIf or an upper layer according to Autosar requirements.
 *
@@ -1487,12 +1922,20 @@ FUNC(void, CAN_43_MCAN_CODE) Can_43_MCAN_MainFunction_Read( void)
     else
     {
 #endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */    
+#if (CAN_43_MCAN_RXPOLL_SUPPORTED  == STD_ON)
         /* Poll all controllers for Rx MB statuses. */
         Can_43_MCAN_IPW_MainFunctionRead();
+#endif /* (CAN_43_MCAN_RXPOLL_SUPPORTED == STD_ON) */
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+        Can_43_MCAN_IPW_MainFunctionRxAdaptive();
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
 #if (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON)
     }
 #endif /* (CAN_43_MCAN_DEV_ERROR_DETECT == STD_ON) */    
 }
+#endif /* ((CAN_43_MCAN_RXPOLL_SUPPORTED == STD_ON) || (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)) */
+
+#if (CAN_43_MCAN_RXPOLL_SUPPORTED  == STD_ON)
 
 #ifdef CAN_43_MCAN_MAINFUNCTION_MULTIPLE_READ
 #if (CAN_43_MCAN_MAINFUNCTION_MULTIPLE_READ == STD_ON)
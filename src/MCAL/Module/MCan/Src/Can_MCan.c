@@ -100,6 +100,12 @@ extern "C"{
 
 #include "SchM_MCan.h"
 #include "Mcal.h"
+#if (CAN_43_MCAN_TX_LATENCY_API == STD_ON)
+#include "Gpt.h"
+#if (GPT_STM_TIMEBASE_API != STD_ON)
+    #error "CAN_43_MCAN_TX_LATENCY_API needs GPT_STM_TIMEBASE_API"
+#endif
+#endif /* (CAN_43_MCAN_TX_LATENCY_API == STD_ON) */
 
 /*==================================================================================================
 *                              SOURCE FILE VERSION INFORMATION
@@ -154,11 +160,32 @@ extern "C"{
 /*==================================================================================================
 *                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+/**
+* @brief          Group of receive IDs covered by one filter element while compiling the Rx filters.
+*/
+typedef struct
+    {
+        VAR(uint32, AUTOMATIC) u32Low;   /* Lowest ID of the group */
+        VAR(uint32, AUTOMATIC) u32High;  /* Highest ID of the group */
+        VAR(uint32, AUTOMATIC) u32Diff;  /* OR of (ID ^ u32Low) over the group, the bits a classic mask ignores */
+        VAR(uint16, AUTOMATIC) u16Count; /* IDs of the list in the group */
+    } Can_MCan_RxFilterGroupType;
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
 
 
 /*==================================================================================================
 *                                       LOCAL MACROS
 ==================================================================================================*/
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+/* SFT/EFT filter types produced by Can_MCan_CompileRxFilters */
+#define MCAN_RX_FILTER_RANGE_U8     ((uint8)0U)
+#define MCAN_RX_FILTER_DUAL_ID_U8   ((uint8)1U)
+#define MCAN_RX_FILTER_CLASSIC_U8   ((uint8)2U)
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
+
+/* Multiplied by the padding byte it gives the word written to the Tx buffer after the payload */
+#define MCAN_TX_PADDING_PATTERN_U32 ((uint32)0x01010101U)
 
 
 /*==================================================================================================
@@ -256,6 +283,45 @@ static VAR(Can_SramStateType, CAN_43_MCAN_VAR) Can_SramStatus = MCAN_SRAM_UNINIT
 *  @violates @ref Can_MCan_c_REF_5 Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h 
 */
 #include "MemMap.h"
+
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+#define CAN_43_MCAN_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/* 
+* @violates @ref Can_MCan_c_REF_2 Violates MISRA 2004 Advisory Rule 19.1, #include preceded by non preproc directives.
+*  @violates @ref Can_MCan_c_REF_5 Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h 
+*/
+#include "MemMap.h"
+
+/**
+* @brief          Work area of Can_MCan_CompileRxFilters, the ID groups in increasing ID order.
+*/
+/* @violates @ref Can_MCan_c_REF_1 Violates MISRA 2004 Required Rule 8.7, Required */
+static VAR(Can_MCan_RxFilterGroupType, CAN_43_MCAN_VAR) Can_MCan_aRxFilterGroup[CAN_43_MCAN_RX_FILTER_COMPILER_MAX_IDS];
+
+#define CAN_43_MCAN_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/* 
+* @violates @ref Can_MCan_c_REF_2 Violates MISRA 2004 Advisory Rule 19.1, #include preceded by non preproc directives.
+*  @violates @ref Can_MCan_c_REF_5 Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h 
+*/
+#include "MemMap.h"
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
+
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+#define CAN_43_MCAN_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/* @violates @ref Can_MCan_c_REF_2 Violates MISRA 2004 Advisory Rule 19.1, #include preceded by non preproc directives. */
+/* @violates @ref Can_MCan_c_REF_5 Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h */
+#include "MemMap.h"
+
+/**
+* @brief          Counters of each hardware object, read by Can_MCan_GetHohStats.
+*/
+static VAR(Can_43_MCAN_HohStatsType, CAN_43_MCAN_VAR) Can_MCan_aHohStats[CAN_43_MCAN_MAX_OBJECT_ID];
+
+#define CAN_43_MCAN_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/* @violates @ref Can_MCan_c_REF_2 Violates MISRA 2004 Advisory Rule 19.1, #include preceded by non preproc directives. */
+/* @violates @ref Can_MCan_c_REF_5 Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h */
+#include "MemMap.h"
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
 /*==================================================================================================
 *                                      GLOBAL CONSTANTS
 ==================================================================================================*/
@@ -335,6 +401,39 @@ CONST(uint32, CAN_43_MCAN_CONST) MCAN_BASE_ADDRS[MCAN_CONTROLLERS_NO] = {
 
 static FUNC(uint8, CAN_43_MCAN_CODE) Can_Mcan_DecodeLenghtData(VAR(uint8, AUTOMATIC) u8MbDataLength);
 static FUNC(uint32, CAN_43_MCAN_CODE) Can_Mcan_CalcDataLenghtCode(VAR(uint8, AUTOMATIC) u8MbDataLength);
+static FUNC(void, CAN_43_MCAN_CODE) Can_MCan_WriteTxData
+    (
+        VAR(uint32, AUTOMATIC) u32DataAddress,
+        P2CONST(Can_43_MCAN_TxFragmentType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) pFragments,
+        VAR(uint8, AUTOMATIC) u8FragmentCount,
+        VAR(uint8, AUTOMATIC) u8NumberWord,
+        VAR(uint32, AUTOMATIC) u32PaddingWord
+    );
+static FUNC(Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_WriteFrame
+    (
+        Can_HwHandleType Hth,
+        P2CONST(Can_PduType, AUTOMATIC, CAN_APPL_CONST) PduInfo,
+        P2CONST(Can_43_MCAN_TxFragmentType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) pFragments,
+        VAR(uint8, AUTOMATIC) u8FragmentCount
+    );
+#if ((CAN_43_MCAN_STATS_API == STD_ON) && (CAN_43_MCAN_TX_LATENCY_API == STD_ON))
+static FUNC(void, CAN_43_MCAN_CODE) Can_MCan_StatsTxLatency(VAR(uint8, AUTOMATIC) controller, VAR(uint8, AUTOMATIC) u8MbIndex);
+#endif /* ((CAN_43_MCAN_STATS_API == STD_ON) && (CAN_43_MCAN_TX_LATENCY_API == STD_ON)) */
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+static FUNC(uint32, CAN_43_MCAN_CODE) Can_MCan_RxFilterGroupAccepts(P2CONST(Can_MCan_RxFilterGroupType, AUTOMATIC, CAN_43_MCAN_VAR) pGroup);
+static FUNC(void, CAN_43_MCAN_CODE) Can_MCan_RxFilterGroupMerge
+    (
+        P2CONST(Can_MCan_RxFilterGroupType, AUTOMATIC, CAN_43_MCAN_VAR) pLow,
+        P2CONST(Can_MCan_RxFilterGroupType, AUTOMATIC, CAN_43_MCAN_VAR) pHigh,
+        P2VAR(Can_MCan_RxFilterGroupType, AUTOMATIC, CAN_43_MCAN_VAR) pMerged
+    );
+static FUNC(void, CAN_43_MCAN_CODE) Can_MCan_RxFilterGroupRemove
+    (
+        VAR(uint16, AUTOMATIC) u16Index,
+        VAR(uint16, AUTOMATIC) u16Number,
+        VAR(uint16, AUTOMATIC) u16GroupCount
+    );
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
 
 /*==================================================================================================
 *                                       LOCAL FUNCTIONS
@@ -452,6 +551,239 @@ static FUNC(uint32, CAN_43_MCAN_CODE) Can_Mcan_CalcDataLenghtCode(VAR(uint8, AUT
     return (u32ReturnValue);
 }
 
+/*================================================================================================*/
+/**
+* @brief          Write the payload and the padding of a Tx frame in the data words of its Tx buffer.
+* @details        The fragments are packed in order, byte n of the payload going to bits 8*(n%4) of word n/4.
+*                 Whole words of a fragment are built from four bytes at once, only the bytes straddling two
+*                 fragments are packed one by one. The words after the payload are written with the padding
+*                 word and the partly filled last word takes its upper bytes.
+*                 This routine is called by:
+*                 - Can_MCan_WriteFrame() from Can_MCan.c file.
+*
+* @param[in]      u32DataAddress Address of the first data word of the Tx buffer
+* @param[in]      pFragments Payload fragments
+* @param[in]      u8FragmentCount Number of fragments
+* @param[in]      u8NumberWord Data words to write
+* @param[in]      u32PaddingWord Padding byte repeated in the four bytes of a word
+*
+*/
+static FUNC(void, CAN_43_MCAN_CODE) Can_MCan_WriteTxData
+    (
+        VAR(uint32, AUTOMATIC) u32DataAddress,
+        P2CONST(Can_43_MCAN_TxFragmentType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) pFragments,
+        VAR(uint8, AUTOMATIC) u8FragmentCount,
+        VAR(uint8, AUTOMATIC) u8NumberWord,
+        VAR(uint32, AUTOMATIC) u32PaddingWord
+    )
+{
+    VAR(uint32, AUTOMATIC) u32Address = u32DataAddress;
+    VAR(uint32, AUTOMATIC) u32EndAddress = u32DataAddress + ((uint32)u8NumberWord << 2U);
+    VAR(uint32, AUTOMATIC) u32DataWord = 0U;
+    VAR(uint32, AUTOMATIC) u32Shift = 0U;
+    VAR(uint32, AUTOMATIC) u32Room = (uint32)u8NumberWord << 2U;
+    VAR(uint32, AUTOMATIC) u32Index;
+    VAR(uint32, AUTOMATIC) u32Length;
+    VAR(uint8, AUTOMATIC)  u8Fragment;
+    P2CONST(uint8, AUTOMATIC, CAN_43_MCAN_APPL_CONST) pData;
+
+    for (u8Fragment = 0U; u8Fragment < u8FragmentCount; u8Fragment++)
+    {
+        /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
+        pData = pFragments[u8Fragment].pData;
+        /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
+        u32Length = (uint32)pFragments[u8Fragment].u8Length;
+        /* Bytes not fitting in the data words are dropped */
+        if (u32Length > u32Room)
+        {
+            u32Length = u32Room;
+        }
+        u32Room -= u32Length;
+        u32Index = 0U;
+
+        /* Complete the word started by the previous fragment */
+        while ((0U != u32Shift) && (u32Index < u32Length))
+        {
+            /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
+            u32DataWord |= (uint32)pData[u32Index] << u32Shift;
+            u32Index++;
+            u32Shift = (u32Shift + 8U) & 31U;
+            if (0U == u32Shift)
+            {
+                /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
+                /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+                REG_WRITE32( u32Address, u32DataWord);
+                u32Address += 4U;
+                u32DataWord = 0U;
+            }
+        }
+        /* Whole words */
+        while ((u32Index + 4U) <= u32Length)
+        {
+            /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
+            /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
+            /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+            REG_WRITE32( u32Address, ( (uint32)pData[u32Index] | \
+                                       ((uint32)pData[u32Index + 1U] << 8U) | \
+                                       ((uint32)pData[u32Index + 2U] << 16U) | \
+                                       ((uint32)pData[u32Index + 3U] << 24U) ));
+            u32Address += 4U;
+            u32Index += 4U;
+        }
+        /* Start of a word completed by the next fragment or by the padding */
+        while (u32Index < u32Length)
+        {
+            /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
+            u32DataWord |= (uint32)pData[u32Index] << u32Shift;
+            u32Index++;
+            u32Shift += 8U;
+        }
+    }
+
+    if (0U != u32Shift)
+    {
+        /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
+        /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+        REG_WRITE32( u32Address, (u32DataWord | (u32PaddingWord << u32Shift)));
+        u32Address += 4U;
+    }
+    while (u32Address < u32EndAddress)
+    {
+        /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
+        /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+        REG_WRITE32( u32Address, u32PaddingWord);
+        u32Address += 4U;
+    }
+}
+
+#if ((CAN_43_MCAN_STATS_API == STD_ON) && (CAN_43_MCAN_TX_LATENCY_API == STD_ON))
+/*================================================================================================*/
+/**
+* @brief          Count the Tx latency of a confirmed frame in the histogram of the controller.
+* @details        The latency runs from the time base stored by Can_MCan_Write for the MB. Bucket n counts
+*                 the latencies below 2^(CAN_43_MCAN_TX_LATENCY_SHIFT + n) ticks, the last bucket the rest.
+*                 This routine is called by:
+*                 - Can_MCan_ProcessTx() from Can_MCan.c file.
+*
+* @param[in]      controller CAN controller, based on configuration order list (CanControllerId)
+* @param[in]      u8MbIndex Tx MB of the confirmed frame
+*
+*/
+static FUNC(void, CAN_43_MCAN_CODE) Can_MCan_StatsTxLatency(VAR(uint8, AUTOMATIC) controller, VAR(uint8, AUTOMATIC) u8MbIndex)
+{
+    VAR(uint32, AUTOMATIC) u32Ticks;
+    VAR(uint8, AUTOMATIC)  u8Bucket = 0U;
+
+    u32Ticks = (uint32)Gpt_GetTimestamp() - Can_43_MCAN_ControllerStatuses[controller].u32TxWriteTime[u8MbIndex];
+    u32Ticks >>= CAN_43_MCAN_TX_LATENCY_SHIFT;
+    while ((0U != u32Ticks) && (u8Bucket < (uint8)(CAN_43_MCAN_TX_LATENCY_BUCKETS - 1U)))
+    {
+        u32Ticks >>= 1U;
+        u8Bucket++;
+    }
+    Can_43_MCAN_ControllerStatuses[controller].Stats.u32TxLatency[u8Bucket]++;
+}
+#endif /* ((CAN_43_MCAN_STATS_API == STD_ON) && (CAN_43_MCAN_TX_LATENCY_API == STD_ON)) */
+
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Number of IDs passed by the filter element encoding a group.
+* @details        One or two IDs are encoded exactly by a dual ID element. Larger groups take a classic
+*                 mask element ignoring the u32Diff bits or a range element, whichever passes fewer IDs.
+*                 This routine is called by:
+*                 - Can_MCan_CompileRxFilters() from Can_MCan.c file.
+*
+* @param[in]      pGroup Group of IDs
+*
+* @return         uint32 IDs passed by the element
+*
+*/
+static FUNC(uint32, CAN_43_MCAN_CODE) Can_MCan_RxFilterGroupAccepts(P2CONST(Can_MCan_RxFilterGroupType, AUTOMATIC, CAN_43_MCAN_VAR) pGroup)
+{
+    VAR(uint32, AUTOMATIC) u32Accepts = (uint32)pGroup->u16Count;
+    VAR(uint32, AUTOMATIC) u32Span = (pGroup->u32High - pGroup->u32Low) + 1U;
+    VAR(uint32, AUTOMATIC) u32MaskAccepts = 1U;
+    VAR(uint32, AUTOMATIC) u32Bits = pGroup->u32Diff;
+
+    if (pGroup->u16Count > 2U)
+    {
+        /* A classic mask passes 2^(number of ignored bits) IDs */
+        while (0U != u32Bits)
+        {
+            if (0U != (u32Bits & 1U))
+            {
+                u32MaskAccepts <<= 1U;
+            }
+            u32Bits >>= 1U;
+        }
+        u32Accepts = (u32MaskAccepts < u32Span) ? u32MaskAccepts : u32Span;
+    }
+
+    return (u32Accepts);
+}
+
+/*================================================================================================*/
+/**
+* @brief          Merge two neighbouring groups of IDs.
+* @details        u32Diff of the merged group is relative to the lowest ID, so it is a superset of the bits
+*                 in which the IDs really differ. The element built from it passes exactly the IDs counted
+*                 by Can_MCan_RxFilterGroupAccepts().
+*                 This routine is called by:
+*                 - Can_MCan_CompileRxFilters() from Can_MCan.c file.
+*
+* @param[in]      pLow Group with the lower IDs
+* @param[in]      pHigh Group with the higher IDs
+* @param[out]     pMerged Merged group, may be one of the inputs
+*
+*/
+static FUNC(void, CAN_43_MCAN_CODE) Can_MCan_RxFilterGroupMerge
+    (
+        P2CONST(Can_MCan_RxFilterGroupType, AUTOMATIC, CAN_43_MCAN_VAR) pLow,
+        P2CONST(Can_MCan_RxFilterGroupType, AUTOMATIC, CAN_43_MCAN_VAR) pHigh,
+        P2VAR(Can_MCan_RxFilterGroupType, AUTOMATIC, CAN_43_MCAN_VAR) pMerged
+    )
+{
+    VAR(uint32, AUTOMATIC) u32Low = pLow->u32Low;
+    VAR(uint32, AUTOMATIC) u32Diff = pLow->u32Diff | pHigh->u32Diff | (pHigh->u32Low ^ pLow->u32Low);
+    VAR(uint16, AUTOMATIC) u16Count = pLow->u16Count + pHigh->u16Count;
+
+    pMerged->u32High = pHigh->u32High;
+    pMerged->u32Low = u32Low;
+    pMerged->u32Diff = u32Diff;
+    pMerged->u16Count = u16Count;
+}
+
+/*================================================================================================*/
+/**
+* @brief          Remove groups from the compile work area.
+* @details        This routine is called by:
+*                 - Can_MCan_CompileRxFilters() from Can_MCan.c file.
+*
+* @param[in]      u16Index First group to remove
+* @param[in]      u16Number Number of groups to remove
+* @param[in]      u16GroupCount Groups in the work area before the removal
+*
+*/
+static FUNC(void, CAN_43_MCAN_CODE) Can_MCan_RxFilterGroupRemove
+    (
+        VAR(uint16, AUTOMATIC) u16Index,
+        VAR(uint16, AUTOMATIC) u16Number,
+        VAR(uint16, AUTOMATIC) u16GroupCount
+    )
+{
+    VAR(uint16, AUTOMATIC) u16Idx;
+
+    if (0U != u16Number)
+    {
+        for (u16Idx = u16Index; (u16Idx + u16Number) < u16GroupCount; u16Idx++)
+        {
+            Can_MCan_aRxFilterGroup[u16Idx] = Can_MCan_aRxFilterGroup[u16Idx + u16Number];
+        }
+    }
+}
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
+
 /*================================================================================================*/
 #ifdef ERR_IPV_MCAN_0001 
     #if (ERR_IPV_MCAN_0001 == STD_ON)
@@ -565,6 +897,9 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_InitVariables( void )
     VAR(uint8, AUTOMATIC) u8MbIndex = 0U;
     /* Temp word index for initialize Can_u32HOHStatus */
     VAR(uint8, AUTOMATIC) u8TempWordIndex = 0U;
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+    VAR(Can_HwHandleType, AUTOMATIC) u32Hoh = 0U;
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
 
     /* Init all global varibales/statuses for all controllers. */
     for ( u8CtrlIndex = 0U; u8CtrlIndex < (uint8)Can_43_MCANStatic_pCurrentConfig->u8ControllersConfigured; u8CtrlIndex++)
@@ -583,6 +918,41 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_InitVariables( void )
         /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
         Can_43_MCAN_ControllerStatuses[u8CtrlIndex].u8CurrentBaudRateIndex = (uint8)(Can_43_MCAN_pControlerDescriptors[u8CtrlIndex].u8DefaultBaudRateIndex);
 
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+        /* Load the configured Rx filter table */
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].pRxFilterSet = NULL_PTR;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].u8RxFilterSetCount = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].u8RxFilterSetConfig = 0U;
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+        /* Start with the Rx interrupts, the counters run from zero */
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].bRxPollMode = (boolean)FALSE;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].u32RxFrames = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].u32RxFrameMark = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.u32InterruptPeriods = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.u32PollPeriods = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.u32ModeSwitches = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.u32LastFrames = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.bPollMode = (boolean)FALSE;
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].Stats.u32RxFrames = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].Stats.u32TxFrames = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].Stats.u32TxBusy = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].Stats.u32TxCancellations = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].Stats.u32BusOffEvents = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].Stats.u32RxFifo0Overruns = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].Stats.u32RxFifo1Overruns = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].Stats.u8RxFifo0HighWater = 0U;
+        Can_43_MCAN_ControllerStatuses[u8CtrlIndex].Stats.u8RxFifo1HighWater = 0U;
+#if (CAN_43_MCAN_TX_LATENCY_API == STD_ON)
+        for (u8MbIndex = 0U; u8MbIndex < (uint8)CAN_43_MCAN_TX_LATENCY_BUCKETS; u8MbIndex++)
+        {
+            Can_43_MCAN_ControllerStatuses[u8CtrlIndex].Stats.u32TxLatency[u8MbIndex] = 0U;
+        }
+#endif /* (CAN_43_MCAN_TX_LATENCY_API == STD_ON) */
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
+
         for (u8MbIndex = 0U; u8MbIndex < (uint8)CAN_43_MCAN_MAX_TX_MB_CONFIG; u8MbIndex++)
         {
             Can_43_MCAN_ControllerStatuses[u8CtrlIndex].u32MbTxMapping[u8MbIndex] = (uint32)0U;
@@ -597,6 +967,13 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_InitVariables( void )
 #if 32U < CAN_43_MCAN_MAX_OBJECT_ID
     } while(u8TempWordIndex <= (uint8)(CAN_43_MCAN_MAX_OBJECT_ID / 32U));
 #endif
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+    for (u32Hoh = 0U; u32Hoh < (Can_HwHandleType)CAN_43_MCAN_MAX_OBJECT_ID; u32Hoh++)
+    {
+        Can_MCan_aHohStats[u32Hoh].u32Frames = 0U;
+        Can_MCan_aHohStats[u32Hoh].u32TxBusy = 0U;
+    }
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
 }
 
 /*================================================================================================*/
@@ -818,6 +1195,12 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ChangeBaudrate( VAR(uint8, AUTOMATIC) con
     VAR(uint8, AUTOMATIC) u8BaudrateIndex = 0U;
     /* Used to access configured table id and filtermask. */
     VAR(uint8, AUTOMATIC)             u8TempIndex = 0U;
+    /*Number of entries of the configured Rx filter table to load */
+    VAR(uint8, AUTOMATIC)             u8NumberRxFilterTable = Can_43_MCAN_pCurrentConfig->u8NumberRxFilterTable;
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+    /*Filter set loaded in place of the configured Rx filter table */
+    P2CONST(Can_43_MCAN_RxFilterElementType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) pRxFilterSet = NULL_PTR;
+#endif
     /*Variable for offset Filter*/
     VAR(uint8, AUTOMATIC)             u8RxFilterOffset = 0U;
     /*Variable configuration Filter */
@@ -875,6 +1258,15 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ChangeBaudrate( VAR(uint8, AUTOMATIC) con
     
     u8NumRxBuffer = pCanControlerDescriptor->u8MaxMbRxCount;
 
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+    pRxFilterSet = Can_43_MCAN_ControllerStatuses[controller].pRxFilterSet;
+    if (NULL_PTR != pRxFilterSet)
+    {
+        /* The filter set given by Can_MCan_SetRxFilters replaces the configured table */
+        u8NumberRxFilterTable = 0U;
+    }
+#endif
+
     eResetReturn = Can_MCan_ResetController( controller);
 
     /* Get the index of the current baudrate */
@@ -1089,7 +1481,7 @@ u8MbSize[controller] = 16U;
         }
 
         /* Init the Rx filter table. */                                   
-        for ( u8TempIndex = 0U; u8TempIndex < (Can_43_MCAN_pCurrentConfig->u8NumberRxFilterTable); u8TempIndex++)
+        for ( u8TempIndex = 0U; u8TempIndex < u8NumberRxFilterTable; u8TempIndex++)
         {
             /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
             if (u8HwOffset == (Can_43_MCAN_pCurrentConfig->pRxFilterTableConfig)[u8TempIndex].u8ControllerOffset)
@@ -1170,6 +1562,50 @@ u8MbSize[controller] = 16U;
                 #endif /* (CAN_43_MCAN_EXTENDEDID == STD_ON) */
             }
         }
+
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+        if (NULL_PTR != pRxFilterSet)
+        {
+            u8RxFilterConfig = Can_43_MCAN_ControllerStatuses[controller].u8RxFilterSetConfig;
+            /* Load the filter set packed from the start of each filter section */
+            for ( u8TempIndex = 0U; u8TempIndex < Can_43_MCAN_ControllerStatuses[controller].u8RxFilterSetCount; u8TempIndex++)
+            {
+                /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                u8RxFilterType = pRxFilterSet[u8TempIndex].u8FilterType;
+                /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                u32RxFilterId1Value = pRxFilterSet[u8TempIndex].u32Id1;
+                /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                u32RxFilterId2Value = pRxFilterSet[u8TempIndex].u32Id2;
+
+                /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                if (CAN_43_MCAN_STANDARD == pRxFilterSet[u8TempIndex].eIdType)
+                {
+                    u32TempReg = ((uint32)u8RxFilterType << MCAN_SRAM_SMIDFE_SFT_SHIFT_U32) & MCAN_SRAM_SMIDFE_SFT_MASK_U32;
+                    u32TempReg |= ((uint32)u8RxFilterConfig << MCAN_SRAM_SMIDFE_SFEC_SHIFT_U32) & MCAN_SRAM_SMIDFE_SFEC_MASK_U32;
+                    u32TempReg |= (u32RxFilterId1Value << MCAN_SRAM_SMIDFE_SFID1_SHIFT_U32) & MCAN_SRAM_SMIDFE_SFID1_MASK_U32;
+                    u32TempReg |= u32RxFilterId2Value & MCAN_SRAM_SMIDFE_SFID2_MASK_U32;
+                    /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
+                    /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+                    REG_WRITE32( (SCM_RAM_BASEADDR + ((uint32)u32StdRxFilterAddOffset << 2) + ((uint32)u8NumberStdRxFilterCount * MCAN_SRAM_STD_FTR_LENGTH_U32)), u32TempReg);
+                    u8NumberStdRxFilterCount++;
+                }
+                else
+                {
+                    u32TempReg = ((uint32)u8RxFilterConfig << MCAN_SRAM_EMIDFE_EFEC_SHIFT_U32) & MCAN_SRAM_EMIDFE_EFEC_MASK_U32;
+                    u32TempReg |= u32RxFilterId1Value & MCAN_SRAM_EMIDFE_EFID_MASK_U32;
+                    /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
+                    /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+                    REG_WRITE32( (SCM_RAM_BASEADDR + ((uint32)u32ExtdRxFilterAddOffset << 2) + ((uint32)u8NumberExtdRxFilterCount * MCAN_SRAM_EXD_FTR_LENGTH_U32)), u32TempReg);
+                    u32TempReg = ((uint32)u8RxFilterType << MCAN_SRAM_EMIDFE_EFT_SHIFT_U32) & MCAN_SRAM_EMIDFE_EFT_MASK_U32;
+                    u32TempReg |= u32RxFilterId2Value & MCAN_SRAM_EMIDFE_EFID_MASK_U32;
+                    /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
+                    /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+                    REG_WRITE32( (SCM_RAM_BASEADDR + ((uint32)u32ExtdRxFilterAddOffset << 2) + ((uint32)u8NumberExtdRxFilterCount * MCAN_SRAM_EXD_FTR_LENGTH_U32) + 4U), u32TempReg);
+                    u8NumberExtdRxFilterCount++;
+                }
+            }
+        }
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
         
         /* Initialization of Standard ID filter section by writing value to SIDFC register */
         u32TempReg = (uint32)u32StdRxFilterAddOffset << MCAN_SIDFC_FLSSA_SHIFT_U32;
@@ -1913,7 +2349,13 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_EnableControllerInterrupts( VAR(uint8, AU
             
         }
         /* Receive select by interrupt */
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+        /* Left masked while the adaptive Rx processing polls the controller */
+        if( (CAN_43_MCAN_CONTROLLERCONFIG_RXPOL_EN_U32 != (CAN_43_MCAN_CONTROLLERCONFIG_RXPOL_EN_U32 & pCanStaticControlerDescriptor->u32Options)) && \
+            ((boolean)FALSE == Can_43_MCAN_ControllerStatuses[controller].bRxPollMode) )
+#else
         if(CAN_43_MCAN_CONTROLLERCONFIG_RXPOL_EN_U32 != (CAN_43_MCAN_CONTROLLERCONFIG_RXPOL_EN_U32 & pCanStaticControlerDescriptor->u32Options))
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
         {
 #if (CAN_43_MCAN_RXFIFO_ENABLE == STD_ON)                 
             /* Rx FIFO 1 New Message Interrupt Enable */
@@ -2129,6 +2571,392 @@ FUNC(void, CAN_43_MCAN_CODE) Can_MCan_AbortMb( VAR(Can_HwHandleType, AUTOMATIC)
 }
 #endif /* (CAN_43_MCAN_API_ENABLE_ABORT_MB == STD_ON) && (CAN_43_MCAN_HW_TRANSMIT_CANCELLATION == STD_ON) */
 
+#if (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Compile a list of receive IDs into at most MaxElements filter elements.
+* @details        The IDs are sorted, duplicates dropped and runs of IDs one range or classic mask element
+*                 passes exactly are joined. While more elements are needed than MaxElements, the two
+*                 neighbouring groups whose merge saves an element at the lowest number of falsely passed IDs
+*                 are merged. Single IDs are paired into dual ID elements, larger groups become a classic
+*                 mask or a range element.
+*                 The routine touches no hardware and no driver state, it can be run on the host to build
+*                 the filter table offline. It uses a static work area and is not reentrant.
+*                 This routine is called by:
+*                 - Can_43_MCAN_CompileRxFilters() from Can_43_MCAN.c file.
+*
+* @param[in]      IdList Receive IDs, in any order
+* @param[in]      IdCount Number of IDs, at most CAN_43_MCAN_RX_FILTER_COMPILER_MAX_IDS
+* @param[in]      IdType CAN_43_MCAN_STANDARD or CAN_43_MCAN_EXTENDED
+* @param[in]      MaxElements Filter element budget, size of Elements
+* @param[out]     Elements Filter elements
+* @param[out]     Report Element count and false accept rate
+*
+* @return         Std_ReturnType
+* @retval         E_OK the elements pass every ID of the list
+* @retval         E_NOT_OK invalid ID, ID type or counts
+*
+*/
+FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_MCan_CompileRxFilters
+    (
+        P2CONST(uint32, AUTOMATIC, CAN_43_MCAN_APPL_CONST) IdList,
+        VAR(uint16, AUTOMATIC) IdCount,
+        VAR(Can_43_MCANIdType, AUTOMATIC) IdType,
+        VAR(uint8, AUTOMATIC) MaxElements,
+        P2VAR(Can_43_MCAN_RxFilterElementType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Elements,
+        P2VAR(Can_43_MCAN_RxFilterReportType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Report
+    )
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturn = (Std_ReturnType)E_OK;
+    VAR(uint32, AUTOMATIC) u32IdMask = MCAN_SRAM_EMIDFE_EFID_MASK_U32;
+    VAR(uint32, AUTOMATIC) u32Id;
+    VAR(uint32, AUTOMATIC) u32Accepted = 0U;
+    VAR(uint32, AUTOMATIC) u32Cost;
+    VAR(uint32, AUTOMATIC) u32Separate;
+    VAR(uint32, AUTOMATIC) u32GroupAccepts;
+    VAR(uint32, AUTOMATIC) u32BestCost;
+    VAR(uint32, AUTOMATIC) u32Halves = 0U;
+    VAR(uint32, AUTOMATIC) u32MergedHalves;
+    VAR(uint16, AUTOMATIC) u16GroupCount = 0U;
+    VAR(uint16, AUTOMATIC) u16ElementCount;
+    VAR(uint16, AUTOMATIC) u16Idx;
+    VAR(uint16, AUTOMATIC) u16Pos;
+    VAR(uint16, AUTOMATIC) u16Move;
+    VAR(uint16, AUTOMATIC) u16Best;
+    VAR(boolean, AUTOMATIC) bBestSaves;
+    VAR(boolean, AUTOMATIC) bSaves;
+    VAR(boolean, AUTOMATIC) bPending = (boolean)FALSE;
+    VAR(uint8, AUTOMATIC) u8Element = 0U;
+    VAR(Can_MCan_RxFilterGroupType, AUTOMATIC) Merged;
+
+    if (CAN_43_MCAN_STANDARD == IdType)
+    {
+        u32IdMask = MCAN_SRAM_SMIDFE_SFID2_MASK_U32;
+    }
+
+    if ( ((CAN_43_MCAN_STANDARD != IdType) && (CAN_43_MCAN_EXTENDED != IdType)) || \
+         (IdCount > (uint16)CAN_43_MCAN_RX_FILTER_COMPILER_MAX_IDS) || \
+         ((0U == MaxElements) && (0U != IdCount))
+       )
+    {
+        eReturn = (Std_ReturnType)E_NOT_OK;
+    }
+
+    /* Sort the IDs into single ID groups, dropping duplicates */
+    for (u16Idx = 0U; (u16Idx < IdCount) && ((Std_ReturnType)E_OK == eReturn); u16Idx++)
+    {
+        /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+        u32Id = IdList[u16Idx];
+        if (u32Id > u32IdMask)
+        {
+            eReturn = (Std_ReturnType)E_NOT_OK;
+        }
+        else
+        {
+            u16Pos = u16GroupCount;
+            while ((u16Pos > 0U) && (Can_MCan_aRxFilterGroup[u16Pos - 1U].u32Low > u32Id))
+            {
+                u16Pos--;
+            }
+            if ((u16Pos == 0U) || (Can_MCan_aRxFilterGroup[u16Pos - 1U].u32Low != u32Id))
+            {
+                for (u16Move = u16GroupCount; u16Move > u16Pos; u16Move--)
+                {
+                    Can_MCan_aRxFilterGroup[u16Move] = Can_MCan_aRxFilterGroup[u16Move - 1U];
+                }
+                Can_MCan_aRxFilterGroup[u16Pos].u32Low = u32Id;
+                Can_MCan_aRxFilterGroup[u16Pos].u32High = u32Id;
+                Can_MCan_aRxFilterGroup[u16Pos].u32Diff = 0U;
+                Can_MCan_aRxFilterGroup[u16Pos].u16Count = 1U;
+                u16GroupCount++;
+            }
+        }
+    }
+
+    if ((Std_ReturnType)E_OK == eReturn)
+    {
+        Report->u16IdCount = u16GroupCount;
+
+        /* Join the longest run of neighbours that one range or classic mask element passes exactly */
+        for (u16Idx = 0U; u16Idx < u16GroupCount; u16Idx++)
+        {
+            Merged = Can_MCan_aRxFilterGroup[u16Idx];
+            u16Best = u16Idx;
+            for (u16Pos = u16Idx + 1U; u16Pos < u16GroupCount; u16Pos++)
+            {
+                Can_MCan_RxFilterGroupMerge(&Merged, &Can_MCan_aRxFilterGroup[u16Pos], &Merged);
+                if ((Merged.u16Count > 2U) && (Can_MCan_RxFilterGroupAccepts(&Merged) == (uint32)Merged.u16Count))
+                {
+                    u16Best = u16Pos;
+                }
+            }
+            for (u16Pos = u16Idx + 1U; u16Pos <= u16Best; u16Pos++)
+            {
+                Can_MCan_RxFilterGroupMerge(&Can_MCan_aRxFilterGroup[u16Idx], &Can_MCan_aRxFilterGroup[u16Pos], &Can_MCan_aRxFilterGroup[u16Idx]);
+            }
+            Can_MCan_RxFilterGroupRemove((uint16)(u16Idx + 1U), (uint16)(u16Best - u16Idx), u16GroupCount);
+            u16GroupCount -= (uint16)(u16Best - u16Idx);
+        }
+
+        /* Count elements in halves: a single ID takes half a dual ID element, any other group a whole element */
+        for (u16Idx = 0U; u16Idx < u16GroupCount; u16Idx++)
+        {
+            u32Halves += (1U == Can_MCan_aRxFilterGroup[u16Idx].u16Count) ? 1U : 2U;
+        }
+        u16ElementCount = (uint16)((u32Halves + 1U) >> 1U);
+
+        /* Merge neighbours until the elements fit in the budget */
+        while ((u16ElementCount > (uint16)MaxElements) && (u16GroupCount > 1U))
+        {
+            u16Best = 0U;
+            u32BestCost = MCAN_MASK_32BITS_U32;
+            bBestSaves = (boolean)FALSE;
+            for (u16Idx = 0U; (u16Idx + 1U) < u16GroupCount; u16Idx++)
+            {
+                Can_MCan_RxFilterGroupMerge(&Can_MCan_aRxFilterGroup[u16Idx], &Can_MCan_aRxFilterGroup[u16Idx + 1U], &Merged);
+                /* Extra IDs passed by the merged element, the two elements may already overlap */
+                u32Cost = Can_MCan_RxFilterGroupAccepts(&Merged);
+                u32Separate = Can_MCan_RxFilterGroupAccepts(&Can_MCan_aRxFilterGroup[u16Idx]) + \
+                              Can_MCan_RxFilterGroupAccepts(&Can_MCan_aRxFilterGroup[u16Idx + 1U]);
+                u32Cost = (u32Cost > u32Separate) ? (u32Cost - u32Separate) : 0U;
+                u32MergedHalves = u32Halves + 2U;
+                u32MergedHalves -= (1U == Can_MCan_aRxFilterGroup[u16Idx].u16Count) ? 1U : 2U;
+                u32MergedHalves -= (1U == Can_MCan_aRxFilterGroup[u16Idx + 1U].u16Count) ? 1U : 2U;
+                bSaves = (((u32MergedHalves + 1U) >> 1U) < (uint32)u16ElementCount) ? (boolean)TRUE : (boolean)FALSE;
+                if ( (((boolean)TRUE == bSaves) && ((boolean)FALSE == bBestSaves)) || \
+                     ((bSaves == bBestSaves) && (u32Cost < u32BestCost))
+                   )
+                {
+                    u16Best = u16Idx;
+                    u32BestCost = u32Cost;
+                    bBestSaves = bSaves;
+                }
+            }
+            u32Halves -= (1U == Can_MCan_aRxFilterGroup[u16Best].u16Count) ? 1U : 2U;
+            u32Halves -= (1U == Can_MCan_aRxFilterGroup[u16Best + 1U].u16Count) ? 1U : 2U;
+            u32Halves += 2U;
+            u16ElementCount = (uint16)((u32Halves + 1U) >> 1U);
+            Can_MCan_RxFilterGroupMerge(&Can_MCan_aRxFilterGroup[u16Best], &Can_MCan_aRxFilterGroup[u16Best + 1U], &Can_MCan_aRxFilterGroup[u16Best]);
+            Can_MCan_RxFilterGroupRemove((uint16)(u16Best + 1U), 1U, u16GroupCount);
+            u16GroupCount--;
+        }
+
+        /* Encode the groups */
+        for (u16Idx = 0U; u16Idx < u16GroupCount; u16Idx++)
+        {
+            u32GroupAccepts = Can_MCan_RxFilterGroupAccepts(&Can_MCan_aRxFilterGroup[u16Idx]);
+            u32Accepted += u32GroupAccepts;
+            if (1U == Can_MCan_aRxFilterGroup[u16Idx].u16Count)
+            {
+                if ((boolean)TRUE == bPending)
+                {
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element].u32Id2 = Can_MCan_aRxFilterGroup[u16Idx].u32Low;
+                    u8Element++;
+                    bPending = (boolean)FALSE;
+                }
+                else
+                {
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element].eIdType = IdType;
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element].u8FilterType = MCAN_RX_FILTER_DUAL_ID_U8;
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element].u32Id1 = Can_MCan_aRxFilterGroup[u16Idx].u32Low;
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element].u32Id2 = Can_MCan_aRxFilterGroup[u16Idx].u32Low;
+                    bPending = (boolean)TRUE;
+                }
+            }
+            else
+            {
+                /* Keep a half filled dual ID element in the last slot */
+                if ((boolean)TRUE == bPending)
+                {
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element + 1U] = Elements[u8Element];
+                }
+                /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                Elements[u8Element].eIdType = IdType;
+                /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                Elements[u8Element].u32Id1 = Can_MCan_aRxFilterGroup[u16Idx].u32Low;
+                /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                Elements[u8Element].u32Id2 = Can_MCan_aRxFilterGroup[u16Idx].u32High;
+                if (2U == Can_MCan_aRxFilterGroup[u16Idx].u16Count)
+                {
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element].u8FilterType = MCAN_RX_FILTER_DUAL_ID_U8;
+                }
+                else if (u32GroupAccepts < ((Can_MCan_aRxFilterGroup[u16Idx].u32High - Can_MCan_aRxFilterGroup[u16Idx].u32Low) + 1U))
+                {
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element].u8FilterType = MCAN_RX_FILTER_CLASSIC_U8;
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element].u32Id2 = (~Can_MCan_aRxFilterGroup[u16Idx].u32Diff) & u32IdMask;
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element].u32Id1 = Can_MCan_aRxFilterGroup[u16Idx].u32Low & Elements[u8Element].u32Id2;
+                }
+                else
+                {
+                    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+                    Elements[u8Element].u8FilterType = MCAN_RX_FILTER_RANGE_U8;
+                }
+                u8Element++;
+            }
+        }
+        if ((boolean)TRUE == bPending)
+        {
+            u8Element++;
+        }
+
+        Report->u16ElementCount = (uint16)u8Element;
+        Report->u32AcceptedIds = u32Accepted;
+        Report->u32FalseAcceptIds = u32Accepted - (uint32)Report->u16IdCount;
+        Report->u16FalseAcceptPerMille = 0U;
+        if (0U != u32Accepted)
+        {
+            Report->u16FalseAcceptPerMille = (uint16)(((uint64)Report->u32FalseAcceptIds * 1000ULL) / (uint64)u32Accepted);
+        }
+    }
+
+    return (eReturn);
+}
+
+/*================================================================================================*/
+/**
+* @brief          Number of filter elements of one ID type the controller can hold.
+* @details        The filter sections in the shared RAM are sized by the configured Rx filter table, so the
+*                 budget is the number of configured table entries of the controller for that ID type.
+*                 This routine is called by:
+*                 - Can_43_MCAN_GetRxFilterBudget() from Can_43_MCAN.c file.
+*                 - Can_MCan_SetRxFilters() from Can_MCan.c file.
+*
+* @param[in]      controller CAN controller, based on configuration order list (CanControllerId)
+* @param[in]      IdType CAN_43_MCAN_STANDARD or CAN_43_MCAN_EXTENDED
+*
+* @return         uint8 Filter elements
+*
+*/
+FUNC(uint8, CAN_43_MCAN_CODE) Can_MCan_GetRxFilterBudget
+    (
+        VAR(uint8, AUTOMATIC) controller,
+        VAR(Can_43_MCANIdType, AUTOMATIC) IdType
+    )
+{
+    VAR(uint8, AUTOMATIC) u8Budget = 0U;
+    VAR(uint8, AUTOMATIC) u8TempIndex;
+    VAR(uint8, AUTOMATIC) u8HwOffset;
+
+    /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
+    u8HwOffset = Can_43_MCANStatic_pCurrentConfig->StaticControlerDescriptors[controller].u8ControllerOffset;
+
+    for ( u8TempIndex = 0U; u8TempIndex < (Can_43_MCAN_pCurrentConfig->u8NumberRxFilterTable); u8TempIndex++)
+    {
+        /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+        if (u8HwOffset == (Can_43_MCAN_pCurrentConfig->pRxFilterTableConfig)[u8TempIndex].u8ControllerOffset)
+        {
+#if (CAN_43_MCAN_EXTENDEDID == STD_ON)
+            /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+            if ( (CAN_43_MCAN_STANDARD == (Can_43_MCAN_pCurrentConfig->pRxFilterTableConfig)[u8TempIndex].eRxFilterMbType) == \
+                 (CAN_43_MCAN_STANDARD == IdType)
+               )
+#else
+            /* Every configured entry is a standard filter element */
+            if (CAN_43_MCAN_STANDARD == IdType)
+#endif /* (CAN_43_MCAN_EXTENDEDID == STD_ON) */
+            {
+                u8Budget++;
+            }
+        }
+    }
+
+    return (u8Budget);
+}
+
+/*================================================================================================*/
+/**
+* @brief          Replace the configured Rx filter table of a controller.
+* @details        The elements are kept by reference and loaded, packed from the start of the standard and
+*                 extended filter sections, every time the controller is (re)initialized. They take effect
+*                 at once through a reinitialization of the controller, which must be stopped.
+*                 This routine is called by:
+*                 - Can_43_MCAN_SetRxFilters() from Can_43_MCAN.c file.
+*
+* @param[in]      controller CAN controller, based on configuration order list (CanControllerId)
+* @param[in]      Elements Filter elements, NULL_PTR loads the configured table again
+* @param[in]      ElementCount Number of elements
+* @param[in]      ElementConfig SFEC/EFEC used for every element, 1 stores in Rx FIFO 0, 2 in Rx FIFO 1;
+*                 other values (reject, priority, Rx buffer) are refused
+*
+* @return         Std_ReturnType
+* @retval         E_OK the filters are loaded
+* @retval         E_NOT_OK invalid element or the elements do not fit in the filter sections
+*
+* @pre            The controller is in STOPPED state.
+*
+*/
+FUNC(Std_ReturnType, CAN_43_MCAN_CODE) Can_MCan_SetRxFilters
+    (
+        VAR(uint8, AUTOMATIC) controller,
+        P2CONST(Can_43_MCAN_RxFilterElementType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) Elements,
+        VAR(uint8, AUTOMATIC) ElementCount,
+        VAR(uint8, AUTOMATIC) ElementConfig
+    )
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturn = (Std_ReturnType)E_OK;
+    VAR(uint8, AUTOMATIC) u8StdCount = 0U;
+    VAR(uint8, AUTOMATIC) u8ExtdCount = 0U;
+    VAR(uint8, AUTOMATIC) u8Idx;
+
+    if (NULL_PTR != Elements)
+    {
+        if ((0U == ElementConfig) || (ElementConfig > 2U))
+        {
+            eReturn = (Std_ReturnType)E_NOT_OK;
+        }
+        for (u8Idx = 0U; (u8Idx < ElementCount) && ((Std_ReturnType)E_OK == eReturn); u8Idx++)
+        {
+            /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+            if (Elements[u8Idx].u8FilterType > MCAN_RX_FILTER_CLASSIC_U8)
+            {
+                eReturn = (Std_ReturnType)E_NOT_OK;
+            }
+            /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+            else if (CAN_43_MCAN_STANDARD == Elements[u8Idx].eIdType)
+            {
+                u8StdCount++;
+            }
+            /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
+            else if (CAN_43_MCAN_EXTENDED == Elements[u8Idx].eIdType)
+            {
+                u8ExtdCount++;
+            }
+            else
+            {
+                eReturn = (Std_ReturnType)E_NOT_OK;
+            }
+        }
+        if ( ((Std_ReturnType)E_OK == eReturn) && \
+             ( (u8StdCount > Can_MCan_GetRxFilterBudget(controller, CAN_43_MCAN_STANDARD)) || \
+               (u8ExtdCount > Can_MCan_GetRxFilterBudget(controller, CAN_43_MCAN_EXTENDED)) )
+           )
+        {
+            eReturn = (Std_ReturnType)E_NOT_OK;
+        }
+    }
+
+    if ((Std_ReturnType)E_OK == eReturn)
+    {
+        Can_43_MCAN_ControllerStatuses[controller].pRxFilterSet = Elements;
+        Can_43_MCAN_ControllerStatuses[controller].u8RxFilterSetCount = (NULL_PTR != Elements) ? ElementCount : 0U;
+        Can_43_MCAN_ControllerStatuses[controller].u8RxFilterSetConfig = ElementConfig;
+        Can_MCan_ChangeBaudrate(controller);
+    }
+
+    return (eReturn);
+}
+#endif /* (CAN_43_MCAN_RX_FILTER_COMPILER_API == STD_ON) */
+
 /*================================================================================================*/
 /**
 * @brief          Can_MCan_Write checks if hardware transmit object that is identified by the HTH is free.
@@ -2147,7 +2975,7 @@ FUNC(void, CAN_43_MCAN_CODE) Can_MCan_AbortMb( VAR(Can_HwHandleType, AUTOMATIC)
 *                         The transmission of the previous L-PDU is cancelled (asynchronously).
 *                         The function returns with CAN_BUSY.
 *                         This routine is called by:
-*                         - Can_Write() from Can.c file.
+*                         - Can_MCan_Write() and Can_MCan_WriteGather() from Can_MCan.c file.
 *                     Algorithm Description:
 *                     Case1: TxMUX supported = ON
 *                           Can_Write receive the Hth handle and the PduInfo for transmission. It starts to check from the first MBs of the
@@ -2163,7 +2991,9 @@ FUNC(void, CAN_43_MCAN_CODE) Can_MCan_AbortMb( VAR(Can_HwHandleType, AUTOMATIC)
 * @param[in]      Hth information which HW-transmit handle shall be used for transmit.
 *                 Implicitly this is also the information about the controller to use
 *                 because the Hth numbers are unique inside one hardware unit.
-* @param[in]      PduInfo Pointer to SDU user memory, DLC and Identifier
+* @param[in]      PduInfo DLC and Identifier, the SDU pointer is not used
+* @param[in]      pFragments Payload fragments, PduInfo->length bytes in total
+* @param[in]      u8FragmentCount Number of fragments
 *
 * @return          Can_ReturnType
 * @retval          CAN_OK write command has been accepted
@@ -2176,7 +3006,13 @@ FUNC(void, CAN_43_MCAN_CODE) Can_MCan_AbortMb( VAR(Can_HwHandleType, AUTOMATIC)
 *
 */
 
-FUNC (Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_Write( Can_HwHandleType Hth, P2CONST(Can_PduType, AUTOMATIC, CAN_APPL_CONST) PduInfo )
+static FUNC(Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_WriteFrame
+    (
+        Can_HwHandleType Hth,
+        P2CONST(Can_PduType, AUTOMATIC, CAN_APPL_CONST) PduInfo,
+        P2CONST(Can_43_MCAN_TxFragmentType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) pFragments,
+        VAR(uint8, AUTOMATIC) u8FragmentCount
+    )
 {
     /* Local copy of pointer to the controller descriptor. */
     VAR(Can_43_MCAN_PtrControlerDescriptorType, AUTOMATIC) pCanControlerDescriptor = NULL_PTR;
@@ -2194,14 +3030,10 @@ FUNC (Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_Write( Can_HwHandleType Hth, P2
     VAR(uint8, AUTOMATIC)          u8HwOffset = 0U;  /* Hardware Can controller offset. */
     VAR(uint32, AUTOMATIC)         u32TempFlag = 0U;
     VAR(uint32, AUTOMATIC)         u32MbMessageId = 0U;
-    VAR(uint8, AUTOMATIC)          u8MbDataByte = 0U;
-    VAR(uint8, AUTOMATIC)          u8ByteIndex = 0U;
-    VAR(uint32, AUTOMATIC)         u32ByteShiftArray[4U]={0U,8U,16U,24U};
     VAR(uint32, AUTOMATIC)         u32BaseAddress = 0U;
     VAR(uint8, AUTOMATIC)          u8CtrlId = (Can_43_MCAN_pCurrentConfig->u8ControllerIdMapping)[Hth];
     VAR(uint8, AUTOMATIC)          u8NumberWord = 0U;
-    VAR(uint8, AUTOMATIC)          u8IndexWord = 0U;    
-    VAR(uint32, AUTOMATIC)         u32DataWord = 0U;
+    VAR(uint32, AUTOMATIC)         u32PaddingWord = 0U;
     /*Variable stores value of data lenght code*/
     VAR(uint32, AUTOMATIC)         u32DataLengthCode = 0U;
 #if (CAN_43_MCAN_FD_MODE_ENABLE == STD_ON)
@@ -2370,6 +3202,9 @@ FUNC (Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_Write( Can_HwHandleType Hth, P2
 
                     /* Set-up the MB content for Tx. Remember the PduId for reporting when the frame is transmitted. */
                     Can_43_MCAN_ControllerStatuses[u8CtrlId].u32TxPduId[u8MbIndex] = PduInfo->swPduHandle;
+#if ((CAN_43_MCAN_STATS_API == STD_ON) && (CAN_43_MCAN_TX_LATENCY_API == STD_ON))
+                    Can_43_MCAN_ControllerStatuses[u8CtrlId].u32TxWriteTime[u8MbIndex] = (uint32)Gpt_GetTimestamp();
+#endif /* ((CAN_43_MCAN_STATS_API == STD_ON) && (CAN_43_MCAN_TX_LATENCY_API == STD_ON)) */
 
                 #if (CAN_43_MCAN_EXTENDEDID == STD_ON)
                     if ( (u32MbMessageId & MCAN_MBC_ID_IDE_U32) != (uint32)0U)
@@ -2424,38 +3259,16 @@ FUNC (Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_Write( Can_HwHandleType Hth, P2
                     /* Copy the padding data into the variable */
                     /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */    
                     u8PaddingValue = ((uint8)(Can_43_MCAN_pCurrentConfig->MBConfigContainer.pMessageBufferConfigsPtr[u8MbIndex].u8FdPaddingValue));
+                    u32PaddingWord = (uint32)u8PaddingValue * MCAN_TX_PADDING_PATTERN_U32;
                 #endif
-                    /* Calculate the number the word which uses to store the data of frame */
-                    u8NumberWord = (uint8)((uint32)u8MbSize[u8CtrlId] - (uint32)8U) >> 2U;
-                    /* Increase the u32BaseAddress to the beginning of data section */
-                    u32BaseAddress = u32BaseAddress + 8U;
-                    /* Access to each word anh each byte to arrange again the order layout of data */  
-                    for(u8IndexWord = 0U; u8IndexWord < u8NumberWord; u8IndexWord ++)
+                    /* Only the data words up to the size given by the DLC are transmitted and need to be written */
+                    u8NumberWord = (uint8)((Can_Mcan_DecodeLenghtData((uint8)((u32DataLengthCode & MCAN_TX_MB_DLC_MASK_U32) >> MCAN_TX_MB_DLC_SHIFT_U32)) + 3U) >> 2U);
+                    if (u8NumberWord > (uint8)(((uint32)u8MbSize[u8CtrlId] - (uint32)8U) >> 2U))
                     {
-                        u32DataWord = 0U;
-                        for(u8MbDataByte = (uint8)0U; u8MbDataByte < 4U; u8MbDataByte++)
-                        {
-                          #if (CAN_43_MCAN_FD_MODE_ENABLE == STD_ON)
-                            if(u8ByteIndex >= PduInfo->length)
-                            {
-                                u32DataWord |= (uint32)((uint32)((uint32)u8PaddingValue) << (u32ByteShiftArray[u8MbDataByte]));
-                            }
-                            else
-                            {
-                          #endif
-                                /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
-                                u32DataWord |= (uint32)((uint32)((PduInfo->sdu)[u8ByteIndex]) << (u32ByteShiftArray[u8MbDataByte]));
-                          #if (CAN_43_MCAN_FD_MODE_ENABLE == STD_ON)
-                            }
-                          #endif
-                            u8ByteIndex++;
-                        }
-                        /* Write the data to data field of buffer */
-                        /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
-                        /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
-                        REG_WRITE32(( u32BaseAddress ), u32DataWord);
-                        u32BaseAddress = u32BaseAddress + 4U;
+                        u8NumberWord = (uint8)(((uint32)u8MbSize[u8CtrlId] - (uint32)8U) >> 2U);
                     }
+                    /* Write the payload and the padding to the data section of the buffer */
+                    Can_MCan_WriteTxData( (u32BaseAddress + 8U), pFragments, u8FragmentCount, u8NumberWord, u32PaddingWord);
 
                     SchM_Enter_Can_43_MCAN_CAN_EXCLUSIVE_AREA_02();
                     /* Trigger transmission by set correspond bit in TXBAR */
@@ -2576,9 +3389,69 @@ FUNC (Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_Write( Can_HwHandleType Hth, P2
         SchM_Exit_Can_43_MCAN_CAN_EXCLUSIVE_AREA_04();
         eReturnValue = CAN_BUSY;
     }    
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+    if (CAN_BUSY == eReturnValue)
+    {
+        Can_43_MCAN_ControllerStatuses[u8CtrlId].Stats.u32TxBusy++;
+        Can_MCan_aHohStats[Hth].u32TxBusy++;
+    }
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
     return (eReturnValue);
 }
 
+/*================================================================================================*/
+/**
+* @brief          Transmit a frame whose payload is PduInfo->sdu.
+* @details        This routine is called by:
+*                 - Can_Write() from Can.c file.
+*
+* @param[in]      Hth information which HW-transmit handle shall be used for transmit.
+* @param[in]      PduInfo Pointer to SDU user memory, DLC and Identifier
+*
+* @return          Can_ReturnType, see Can_MCan_WriteFrame()
+*
+* @pre            The MB must be configured for Tx.
+*
+*/
+FUNC (Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_Write( Can_HwHandleType Hth, P2CONST(Can_PduType, AUTOMATIC, CAN_APPL_CONST) PduInfo )
+{
+    VAR(Can_43_MCAN_TxFragmentType, AUTOMATIC) Payload;
+
+    Payload.pData = PduInfo->sdu;
+    Payload.u8Length = PduInfo->length;
+
+    /* @violates @ref Can_MCan_c_REF_6 Violates MISRA 2004 Required Rule 1.2, Taking address of near auto variable */
+    return (Can_MCan_WriteFrame(Hth, PduInfo, &Payload, 1U));
+}
+
+#if (CAN_43_MCAN_WRITE_GATHER_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Transmit a frame whose payload is given as fragments.
+* @details        The fragments are packed into the Tx buffer in order, PduInfo->sdu is not used.
+*                 This routine is called by:
+*                 - Can_43_MCAN_WriteGather() from Can_43_MCAN.c file.
+*
+* @param[in]      Hth information which HW-transmit handle shall be used for transmit.
+* @param[in]      PduInfo DLC and Identifier
+* @param[in]      Fragments Payload fragments, PduInfo->length bytes in total
+* @param[in]      FragmentCount Number of fragments
+*
+* @return          Can_ReturnType, see Can_MCan_WriteFrame()
+*
+* @pre            The MB must be configured for Tx.
+*
+*/
+FUNC (Can_ReturnType, CAN_43_MCAN_CODE) Can_MCan_WriteGather( Can_HwHandleType Hth,
+                                                      P2CONST(Can_PduType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) PduInfo,
+                                                      P2CONST(Can_43_MCAN_TxFragmentType, AUTOMATIC, CAN_43_MCAN_APPL_CONST) Fragments,
+                                                      VAR(uint8, AUTOMATIC) FragmentCount
+                                                    )
+{
+    return (Can_MCan_WriteFrame(Hth, PduInfo, Fragments, FragmentCount));
+}
+#endif /* (CAN_43_MCAN_WRITE_GATHER_API == STD_ON) */
+
 /*================================================================================================*/
 /**
 * @brief          Local function for calling notification function to notify upper layer during Can_MainFunction_Write if polling is selected or from ISR when Interrupt mode selected.
@@ -2688,6 +3561,9 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessTx( CONST(uint8, AUTOMATIC) contro
             {
                 Can_43_MCAN_ControllerStatuses[controller].Tx_complete_guard &= (uint32)(~u32TempFlag);
                 SchM_Exit_Can_43_MCAN_CAN_EXCLUSIVE_AREA_05();
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+                Can_43_MCAN_ControllerStatuses[controller].Stats.u32TxCancellations++;
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
                 /* @violates @ref Can_MCan_c_REF_6 Violates MISRA 2004 Required Rule 1.2, Taking address of near auto variable */    
                 CanIf_CancelTxConfirmation(u32PduId , &CbkPduInfo);
             }
@@ -2709,6 +3585,13 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessTx( CONST(uint8, AUTOMATIC) contro
             {
                 Can_43_MCAN_ControllerStatuses[controller].Tx_complete_guard &= (uint32)(~u32TempFlag);
                 SchM_Exit_Can_43_MCAN_CAN_EXCLUSIVE_AREA_05();
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+                Can_43_MCAN_ControllerStatuses[controller].Stats.u32TxFrames++;
+                Can_MCan_aHohStats[Can_43_MCAN_ControllerStatuses[controller].u32MbTxMapping[u8MbIndex]].u32Frames++;
+#if (CAN_43_MCAN_TX_LATENCY_API == STD_ON)
+                Can_MCan_StatsTxLatency(controller, u8MbIndex);
+#endif /* (CAN_43_MCAN_TX_LATENCY_API == STD_ON) */
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
                 CanIf_TxConfirmation(u32PduId);
             }
             else
@@ -2882,6 +3765,10 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessRx( CONST(uint8, AUTOMATIC) contro
     VAR(uint8, AUTOMATIC)      u8FifoIndex = 0U;
     VAR(uint32, AUTOMATIC)     u32RxFifo0AddOffset = 0U;
     VAR(uint32, AUTOMATIC)     u32RxFifo1AddOffset = 0U;
+    VAR(uint32, AUTOMATIC)     u32RxFifoNewFlag = 0U;
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+    VAR(uint8, AUTOMATIC)      u8FifoLevel = 0U;
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
 #endif
     VAR(uint8, AUTOMATIC)      u8MbCtrlIndex = 0U;
     VAR(uint32, AUTOMATIC)     u32FlagRxBuffer = 0U; /* value 0 is don't has new message in Rx buffer */
@@ -2928,6 +3815,9 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessRx( CONST(uint8, AUTOMATIC) contro
             /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
             /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
             REG_WRITE32( MCAN_IR(u8HwOffset), MCAN_INTERRUPT_RF0L_U32);
+        #if (CAN_43_MCAN_STATS_API == STD_ON)
+            Can_43_MCAN_ControllerStatuses[controller].Stats.u32RxFifo0Overruns++;
+        #endif
         }
     
     #if (CAN_43_MCAN_FIFO_WARNING_NOTIFICATION == STD_ON)
@@ -2951,13 +3841,31 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessRx( CONST(uint8, AUTOMATIC) contro
 
         /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
         /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
-        if ( MCAN_INTERRUPT_RF0N_U32 == ((REG_READ32( MCAN_IR(u8HwOffset))) & MCAN_INTERRUPT_RF0N_U32) )
+        u32RxFifoNewFlag = (REG_READ32( MCAN_IR(u8HwOffset))) & MCAN_INTERRUPT_RF0N_U32;
+    #if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+        /* RF0N is masked on a polled controller and the common ISR clears it when another source fires,
+           the FIFO is then drained from its fill level alone */
+        if ( (boolean)TRUE == Can_43_MCAN_ControllerStatuses[controller].bRxPollMode )
+        {
+            u32RxFifoNewFlag = MCAN_INTERRUPT_RF0N_U32;
+        }
+    #endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+        if ( MCAN_INTERRUPT_RF0N_U32 == u32RxFifoNewFlag )
         {
             /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
             /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
             REG_WRITE32( MCAN_IR(u8HwOffset), MCAN_INTERRUPT_RF0N_U32);
             /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
             /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+    #if (CAN_43_MCAN_STATS_API == STD_ON)
+            u8FifoLevel = (uint8)(REG_READ32( MCAN_RXF0S(u8HwOffset)) & MCAN_RXF0S_F0FL_U32);
+            if (u8FifoLevel > Can_43_MCAN_ControllerStatuses[controller].Stats.u8RxFifo0HighWater)
+            {
+                Can_43_MCAN_ControllerStatuses[controller].Stats.u8RxFifo0HighWater = u8FifoLevel;
+            }
+            /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
+            /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+    #endif
             while ( ((REG_READ32( MCAN_RXF0S(u8HwOffset))) & MCAN_RXF0S_F0FL_U32)> 0U)
             {
                 
@@ -3033,6 +3941,13 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessRx( CONST(uint8, AUTOMATIC) contro
 
                         u32MbHrh = (Can_HwHandleType)((pCanMbConfigContainer->pMessageBufferConfigsPtr) + u8MbCtrlIndex)->u32HWObjID;
                                                 
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+                        Can_43_MCAN_ControllerStatuses[controller].u32RxFrames++;
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+                        Can_43_MCAN_ControllerStatuses[controller].Stats.u32RxFrames++;
+                        Can_MCan_aHohStats[u32MbHrh].u32Frames++;
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
                         #if (CAN_43_MCAN_LPDU_NOTIFICATION_ENABLE == STD_ON)
                         /*[CAN444] If the L-PDU callout returns false, the L-PDU shall not be processed any further. */
                         /* @violates @ref Can_MCan_c_REF_6 Violates MISRA 2004 Required Rule 1.2, Taking address of near auto variable */
@@ -3078,6 +3993,9 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessRx( CONST(uint8, AUTOMATIC) contro
             /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
             /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
             REG_WRITE32( MCAN_IR(u8HwOffset), MCAN_INTERRUPT_RF1L_U32);
+        #if (CAN_43_MCAN_STATS_API == STD_ON)
+            Can_43_MCAN_ControllerStatuses[controller].Stats.u32RxFifo1Overruns++;
+        #endif
         }
     
     #if (CAN_43_MCAN_FIFO_WARNING_NOTIFICATION == STD_ON)
@@ -3101,13 +4019,31 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessRx( CONST(uint8, AUTOMATIC) contro
 
         /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
         /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
-        if ( MCAN_INTERRUPT_RF1N_U32 == ((REG_READ32( MCAN_IR(u8HwOffset))) & MCAN_INTERRUPT_RF1N_U32) )
+        u32RxFifoNewFlag = (REG_READ32( MCAN_IR(u8HwOffset))) & MCAN_INTERRUPT_RF1N_U32;
+    #if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+        /* RF1N is masked on a polled controller and the common ISR clears it when another source fires,
+           the FIFO is then drained from its fill level alone */
+        if ( (boolean)TRUE == Can_43_MCAN_ControllerStatuses[controller].bRxPollMode )
+        {
+            u32RxFifoNewFlag = MCAN_INTERRUPT_RF1N_U32;
+        }
+    #endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+        if ( MCAN_INTERRUPT_RF1N_U32 == u32RxFifoNewFlag )
         {
             /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
             /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
             REG_WRITE32( MCAN_IR(u8HwOffset), MCAN_INTERRUPT_RF1N_U32);
             /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
             /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+    #if (CAN_43_MCAN_STATS_API == STD_ON)
+            u8FifoLevel = (uint8)(REG_READ32( MCAN_RXF1S(u8HwOffset)) & MCAN_RXF1S_F1FL_U32);
+            if (u8FifoLevel > Can_43_MCAN_ControllerStatuses[controller].Stats.u8RxFifo1HighWater)
+            {
+                Can_43_MCAN_ControllerStatuses[controller].Stats.u8RxFifo1HighWater = u8FifoLevel;
+            }
+            /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
+            /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
+    #endif
             while ( ((REG_READ32( MCAN_RXF1S(u8HwOffset))) & MCAN_RXF1S_F1FL_U32)> 0U)
             {
                 
@@ -3185,6 +4121,13 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessRx( CONST(uint8, AUTOMATIC) contro
                         /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4, pointer arithmetic other than array indexing used */
 
                         u32MbHrh = (Can_HwHandleType)((pCanMbConfigContainer->pMessageBufferConfigsPtr) + u8MbCtrlIndex)->u32HWObjID;
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+                        Can_43_MCAN_ControllerStatuses[controller].u32RxFrames++;
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+                        Can_43_MCAN_ControllerStatuses[controller].Stats.u32RxFrames++;
+                        Can_MCan_aHohStats[u32MbHrh].u32Frames++;
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
                         #if (CAN_43_MCAN_LPDU_NOTIFICATION_ENABLE == STD_ON)
                         /*[CAN444] If the L-PDU callout returns false, the L-PDU shall not be processed any further. */
                         /* @violates @ref Can_MCan_c_REF_6 Violates MISRA 2004 Required Rule 1.2, Taking address of near auto variable */
@@ -3317,6 +4260,13 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessRx( CONST(uint8, AUTOMATIC) contro
                     
                     u32MbHrh = (Can_HwHandleType)((pCanMbConfigContainer->pMessageBufferConfigsPtr) + u8MbCtrlIndex)->u32HWObjID;
                      
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+                    Can_43_MCAN_ControllerStatuses[controller].u32RxFrames++;
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+                    Can_43_MCAN_ControllerStatuses[controller].Stats.u32RxFrames++;
+                    Can_MCan_aHohStats[u32MbHrh].u32Frames++;
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
                     #if (CAN_43_MCAN_LPDU_NOTIFICATION_ENABLE == STD_ON)
                     /*[CAN444] If the L-PDU callout returns false, the L-PDU shall not be processed any further. */
                     /* @violates @ref Can_MCan_c_REF_6 Violates MISRA 2004 Required Rule 1.2, Taking address of near auto variable */                  
@@ -3442,6 +4392,145 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_MainFunctionMultipleReadPoll( VAR(uint8,
 }
 #endif
 
+#if (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Adaptive choice between Rx interrupts and polling for the controllers configured for Rx interrupts.
+* @details        A polled controller has its Rx FIFOs and dedicated Rx buffers read here first, the buffers from
+*                 their new data flags. The frames passed to CanIf since the previous period then select the
+*                 mode: a controller with Rx interrupts is polled from the next period on when at least
+*                 CAN_43_MCAN_RX_ADAPTIVE_POLL_THRESHOLD frames arrived, a polled controller gets its interrupts
+*                 back when at most CAN_43_MCAN_RX_ADAPTIVE_IRQ_THRESHOLD arrived. Each controller is handled
+*                 with its interrupts disabled, their enabling writes the new message interrupts of the chosen mode.
+*                 The FIFO full and message lost interrupts stay enabled in both modes.
+*                 This routine is called by:
+*                    - Can_43_MCAN_MainFunction_Read() from Can_43_MCAN.c file.
+*
+* @pre            The period of Can_43_MCAN_MainFunction_Read must let the Rx FIFOs take the frames of one period
+*                 at the CAN_43_MCAN_RX_ADAPTIVE_POLL_THRESHOLD load.
+*
+*/
+FUNC (void, CAN_43_MCAN_CODE) Can_MCan_MainFunctionRxAdaptive( void)
+{
+    /* Index CAN controllers from configuration. */
+    VAR(uint8, AUTOMATIC)       u8CtrlIndex = 0U;
+    VAR(uint8, AUTOMATIC)       u8MBIndex = 0U;
+    VAR(uint8, AUTOMATIC)       u8HwOffset = 0U;
+    VAR(uint32, AUTOMATIC)      u32Frames = 0U;
+    VAR(uint32, AUTOMATIC)      u32Mark = 0U;
+    /* Local copy of pointer to the controller descriptor. */
+    VAR(Can_43_MCAN_PtrControlerDescriptorType, AUTOMATIC) pCanControlerDescriptor = NULL_PTR;
+
+    for ( u8CtrlIndex = (uint8)0U; u8CtrlIndex < (uint8)Can_43_MCANStatic_pCurrentConfig->u8ControllersConfigured; u8CtrlIndex++)
+    {
+        /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
+        u8HwOffset = Can_43_MCANStatic_pControlerDescriptors[u8CtrlIndex].u8ControllerOffset;
+        /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
+        if ( (MCAN_NULL_OFFSET_U8 != u8HwOffset) && \
+             (CAN_43_MCAN_STARTED == Can_43_MCAN_ControllerStatuses[u8CtrlIndex].ControllerState) && \
+             ((uint32)0U == (CAN_43_MCAN_CONTROLLERCONFIG_RXPOL_EN_U32 & (Can_43_MCANStatic_pControlerDescriptors[u8CtrlIndex].u32Options))) \
+           )
+        {
+            /* @violates @ref Can_MCan_c_REF_8 Violates MISRA 2004 Advisory Rule 17.4,pointer arithmetic other than array indexing used */
+            pCanControlerDescriptor = &(Can_43_MCAN_pCurrentConfig->ControlerDescriptors[u8CtrlIndex]);
+            Can_MCan_DisableControllerInterrupts( u8CtrlIndex);
+
+            if ( (boolean)TRUE == Can_43_MCAN_ControllerStatuses[u8CtrlIndex].bRxPollMode )
+            {
+#if (CAN_43_MCAN_RXFIFO_ENABLE == STD_ON)
+                /* Each FIFO is read until empty, at most its configured depth */
+                Can_MCan_ProcessRx( (uint8)u8CtrlIndex, MCAN_STORE_RX_FIFO0_U8);
+                Can_MCan_ProcessRx( (uint8)u8CtrlIndex, MCAN_STORE_RX_FIFO1_U8);
+#endif
+                /* IR.DRX is not used here: the ISR of a shared line clears it while DRX is masked. Every
+                   dedicated Rx buffer is passed on, Can_MCan_ProcessRx reads only those flagged in NDAT1/NDAT2 */
+                for (u8MBIndex = 0U; u8MBIndex < pCanControlerDescriptor->u8MaxMbRxCount; u8MBIndex++)
+                {
+                    Can_MCan_ProcessRx( (uint8)u8CtrlIndex, u8MBIndex);
+                }
+            }
+
+            u32Mark = Can_43_MCAN_ControllerStatuses[u8CtrlIndex].u32RxFrames;
+            u32Frames = u32Mark - Can_43_MCAN_ControllerStatuses[u8CtrlIndex].u32RxFrameMark;
+            Can_43_MCAN_ControllerStatuses[u8CtrlIndex].u32RxFrameMark = u32Mark;
+
+            /* The gap between the two thresholds keeps a load near one of them from toggling the mode */
+            if ( ((boolean)FALSE == Can_43_MCAN_ControllerStatuses[u8CtrlIndex].bRxPollMode) && \
+                 (u32Frames >= (uint32)CAN_43_MCAN_RX_ADAPTIVE_POLL_THRESHOLD) )
+            {
+                Can_43_MCAN_ControllerStatuses[u8CtrlIndex].bRxPollMode = (boolean)TRUE;
+                Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.u32ModeSwitches++;
+            }
+            else if ( ((boolean)TRUE == Can_43_MCAN_ControllerStatuses[u8CtrlIndex].bRxPollMode) && \
+                      (u32Frames <= (uint32)CAN_43_MCAN_RX_ADAPTIVE_IRQ_THRESHOLD) )
+            {
+                Can_43_MCAN_ControllerStatuses[u8CtrlIndex].bRxPollMode = (boolean)FALSE;
+                Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.u32ModeSwitches++;
+            }
+            else
+            {
+                /* The mode is kept */
+            }
+
+            if ( (boolean)TRUE == Can_43_MCAN_ControllerStatuses[u8CtrlIndex].bRxPollMode )
+            {
+                Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.u32PollPeriods++;
+            }
+            else
+            {
+                Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.u32InterruptPeriods++;
+            }
+            Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.u32LastFrames = u32Frames;
+            Can_43_MCAN_ControllerStatuses[u8CtrlIndex].RxAdaptiveStats.bPollMode = Can_43_MCAN_ControllerStatuses[u8CtrlIndex].bRxPollMode;
+
+            Can_MCan_EnableControllerInterrupts( u8CtrlIndex, pCanControlerDescriptor);
+        }
+    }
+}
+#endif /* (CAN_43_MCAN_RX_ADAPTIVE_API == STD_ON) */
+
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief          Copy of the counters of a controller.
+* @details        The counters are incremented without locking from the contexts processing the events, the
+*                 copy is taken inside an exclusive area so that it is not torn by an interrupt.
+*                 This routine is called by:
+*                    - Can_43_MCAN_GetControllerStats() from Can_43_MCAN.c file.
+*
+* @param[in]      controller CAN controller, based on configuration order list (CanControllerId)
+* @param[out]     Stats Counters of the controller
+*
+*/
+FUNC (void, CAN_43_MCAN_CODE) Can_MCan_GetControllerStats( VAR(uint8, AUTOMATIC) controller,
+                                                           P2VAR(Can_43_MCAN_ControllerStatsType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Stats
+                                                         )
+{
+    SchM_Enter_Can_43_MCAN_CAN_EXCLUSIVE_AREA_06();
+    *Stats = Can_43_MCAN_ControllerStatuses[controller].Stats;
+    SchM_Exit_Can_43_MCAN_CAN_EXCLUSIVE_AREA_06();
+}
+
+/*================================================================================================*/
+/**
+* @brief          Copy of the counters of a hardware object.
+* @details        This routine is called by:
+*                    - Can_43_MCAN_GetHohStats() from Can_43_MCAN.c file.
+*
+* @param[in]      Hoh Hardware object, Hrh or Hth
+* @param[out]     Stats Counters of the hardware object
+*
+*/
+FUNC (void, CAN_43_MCAN_CODE) Can_MCan_GetHohStats( VAR(Can_HwHandleType, AUTOMATIC) Hoh,
+                                                    P2VAR(Can_43_MCAN_HohStatsType, AUTOMATIC, CAN_43_MCAN_APPL_DATA) Stats
+                                                  )
+{
+    SchM_Enter_Can_43_MCAN_CAN_EXCLUSIVE_AREA_06();
+    *Stats = Can_MCan_aHohStats[Hoh];
+    SchM_Exit_Can_43_MCAN_CAN_EXCLUSIVE_AREA_06();
+}
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
+
 /*================================================================================================*/
 /**
 * @brief          Service to perform the polling of CAN status register flags to detect transition of CAN Controller state
@@ -3524,6 +4613,9 @@ FUNC (void, CAN_43_MCAN_CODE) Can_MCan_ProcessBusOff( CONST(uint8, AUTOMATIC) co
     /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
     /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
     REG_WRITE32( MCAN_IR(u8HwOffset), MCAN_INTERRUPT_BO_U32);
+#if (CAN_43_MCAN_STATS_API == STD_ON)
+    Can_43_MCAN_ControllerStatuses[controller].Stats.u32BusOffEvents++;
+#endif /* (CAN_43_MCAN_STATS_API == STD_ON) */
 
 }
 
@@ -3941,6 +5033,12 @@ FUNC(void, CAN_43_MCAN_CODE) Can_MCan_Isr_common_process_interrupt( CONST(uint8,
                 /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
                 /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
                 REG_WRITE32( MCAN_IR(u8HwOffset), MCAN_INTERRUPT_RF0F_U32);
+            #if (CAN_43_MCAN_STATS_API == STD_ON)
+                if (0U != (u32TempInterruptStatus & MCAN_INTERRUPT_RF0L_U32))
+                {
+                    Can_43_MCAN_ControllerStatuses[controller].Stats.u32RxFifo0Overruns++;
+                }
+            #endif
             }
         }
 
@@ -3959,6 +5057,12 @@ FUNC(void, CAN_43_MCAN_CODE) Can_MCan_Isr_common_process_interrupt( CONST(uint8,
                 /* @violates @ref Can_MCan_c_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer. */
                 /* @violates @ref Can_MCan_c_REF_9 Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed */
                 REG_WRITE32( MCAN_IR(u8HwOffset), MCAN_INTERRUPT_RF1L_U32);
+            #if (CAN_43_MCAN_STATS_API == STD_ON)
+                if (0U != (u32TempInterruptStatus & MCAN_INTERRUPT_RF1L_U32))
+                {
+                    Can_43_MCAN_ControllerStatuses[controller].Stats.u32RxFifo1Overruns++;
+                }
+            #endif
             }
         }
 
@@ -198,6 +198,15 @@ extern "C"
 */
 #define MCL_E_UNEXPECTED_ISR_U8            ((uint8)0x11U)
 
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+/**
+* @brief            API Mcl_DmaCapture* service called with an invalid ring index, or
+*                   Mcl_DmaCaptureStart service called for a ring already started
+* 
+*/
+#define MCL_E_PARAM_RING_U8                ((uint8)0x14U)
+#endif /* (MCL_DMA_CAPTURE_API == STD_ON) */
+
 #endif /* (MCL_ENABLE_DMA == STD_ON) */
 
 /**
@@ -206,6 +215,17 @@ extern "C"
 * */
 #define MCL_E_PARAM_CONFIG_U8              ((uint8)0x12U)
 
+#if (((MCL_ENABLE_DMA == STD_ON) && ((MCL_DMA_MEMCPY_API == STD_ON) || (MCL_DMA_CAPTURE_API == STD_ON))) || \
+     ((MCL_ENABLE_CROSSBAR == STD_ON) && (MCL_CROSSBAR_PROFILE_API == STD_ON)))
+/**
+* @brief            API Mcl_DmaMemcpy/Mcl_DmaMemset service called with a zero length,
+*                   Mcl_DmaCaptureStart service called with a ring length out of range, or
+*                   Mcl_MeasureCrossbarLatency service called with a zero number of reads
+* 
+*/
+#define MCL_E_PARAM_LENGTH_U8              ((uint8)0x13U)
+#endif
+
 
 /**
 * @brief   API Mcl_DeInit service is not allowed because a DMA transfer is in progress
@@ -525,6 +545,47 @@ extern "C"
 * */
 #define MCL_GET_CH_ERR_STATUS_ID_U8          ((uint8)0x53U)
 
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+/**
+* @brief API service ID for Mcl_DmaMemcpy function
+* @details Parameters used when raising an error/exception
+* */
+#define MCL_DMA_MEMCPY_ID_U8                 ((uint8)0x57U)
+/**
+* @brief API service ID for Mcl_DmaMemset function
+* @details Parameters used when raising an error/exception
+* */
+#define MCL_DMA_MEMSET_ID_U8                 ((uint8)0x58U)
+/**
+* @brief API service ID for Mcl_DmaMemcpyMainFunction function
+* @details Parameters used when raising an error/exception
+* */
+#define MCL_DMA_MEMCPY_MAIN_ID_U8            ((uint8)0x59U)
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
+
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+/**
+* @brief API service ID for Mcl_DmaCaptureStart function
+* @details Parameters used when raising an error/exception
+* */
+#define MCL_DMA_CAPTURE_START_ID_U8          ((uint8)0x5AU)
+/**
+* @brief API service ID for Mcl_DmaCaptureStop function
+* @details Parameters used when raising an error/exception
+* */
+#define MCL_DMA_CAPTURE_STOP_ID_U8           ((uint8)0x5BU)
+/**
+* @brief API service ID for Mcl_DmaCaptureGetCount function
+* @details Parameters used when raising an error/exception
+* */
+#define MCL_DMA_CAPTURE_COUNT_ID_U8          ((uint8)0x5CU)
+/**
+* @brief API service ID for Mcl_DmaCaptureRead function
+* @details Parameters used when raising an error/exception
+* */
+#define MCL_DMA_CAPTURE_READ_ID_U8           ((uint8)0x5DU)
+#endif /* (MCL_DMA_CAPTURE_API == STD_ON) */
+
 
 #endif /* (MCL_ENABLE_DMA == STD_ON) */
 /**
@@ -532,6 +593,20 @@ extern "C"
 * @details Parameters used when raising an error/exception
 * */
 #define MCL_DEINIT_ID_U8                     ((uint8)0x56U)
+#if (MCL_ENABLE_CROSSBAR == STD_ON)
+#if (MCL_CROSSBAR_PROFILE_API == STD_ON)
+/**
+* @brief API service ID for Mcl_SetCrossbarProfile function
+* @details Parameters used when raising an error/exception
+* */
+#define MCL_SET_CROSSBAR_PROFILE_ID_U8       ((uint8)0x5EU)
+/**
+* @brief API service ID for Mcl_MeasureCrossbarLatency function
+* @details Parameters used when raising an error/exception
+* */
+#define MCL_MEASURE_CROSSBAR_LATENCY_ID_U8   ((uint8)0x5FU)
+#endif /* (MCL_CROSSBAR_PROFILE_API == STD_ON) */
+#endif /* (MCL_ENABLE_CROSSBAR == STD_ON) */
 /*==================================================================================================
 *                                              ENUMS
 ==================================================================================================*/
@@ -900,8 +975,67 @@ FUNC(Mcl_DmaChannelErrorStatusType, MCL_CODE) Mcl_DmaGetChannelErrorStatus
     VAR(Mcl_ChannelType, AUTOMATIC) logicalChannel
 );
 #endif
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+FUNC(Std_ReturnType, MCL_CODE) Mcl_DmaMemcpy
+(
+    P2VAR(void, AUTOMATIC, MCL_APPL_DATA) pDest,
+    P2CONST(void, AUTOMATIC, MCL_APPL_CONST) pSrc,
+    VAR(uint32, AUTOMATIC) u32Length,
+    VAR(Mcl_DmaMemcpyNotifyType, AUTOMATIC) pfNotification
+);
+
+FUNC(Std_ReturnType, MCL_CODE) Mcl_DmaMemset
+(
+    P2VAR(void, AUTOMATIC, MCL_APPL_DATA) pDest,
+    VAR(uint8, AUTOMATIC) u8Value,
+    VAR(uint32, AUTOMATIC) u32Length,
+    VAR(Mcl_DmaMemcpyNotifyType, AUTOMATIC) pfNotification
+);
+
+FUNC(void, MCL_CODE) Mcl_DmaMemcpyMainFunction(void);
+
+FUNC(boolean, MCL_CODE) Mcl_DmaMemcpyIsIdle(void);
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+FUNC(Std_ReturnType, MCL_CODE) Mcl_DmaCaptureStart
+(
+    VAR(uint8, AUTOMATIC) u8Ring,
+    VAR(Mcl_ChannelType, AUTOMATIC) nChannel,
+    VAR(uint8, AUTOMATIC) u8EmiosHwChannel,
+    P2VAR(uint32, AUTOMATIC, MCL_APPL_DATA) pBuffer,
+    VAR(uint16, AUTOMATIC) u16Length
+);
+
+FUNC(void, MCL_CODE) Mcl_DmaCaptureStop(VAR(uint8, AUTOMATIC) u8Ring);
+
+FUNC(uint16, MCL_CODE) Mcl_DmaCaptureGetCount(VAR(uint8, AUTOMATIC) u8Ring);
+
+FUNC(uint16, MCL_CODE) Mcl_DmaCaptureRead
+(
+    VAR(uint8, AUTOMATIC) u8Ring,
+    P2VAR(uint32, AUTOMATIC, MCL_APPL_DATA) pDest,
+    VAR(uint16, AUTOMATIC) u16MaxCount
+);
+#endif /* (MCL_DMA_CAPTURE_API == STD_ON) */
 #endif /* (MCL_ENABLE_DMA == STD_ON) */
 
+#if (MCL_ENABLE_CROSSBAR == STD_ON)
+#if (MCL_CROSSBAR_PROFILE_API == STD_ON)
+FUNC(Std_ReturnType, MCL_CODE) Mcl_SetCrossbarProfile
+(
+    P2CONST(Mcl_CrossbarProfileType, AUTOMATIC, MCL_APPL_CONST) pProfile
+);
+
+FUNC(Std_ReturnType, MCL_CODE) Mcl_MeasureCrossbarLatency
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint16, AUTOMATIC) u16Reads,
+    VAR(Mcl_CrossbarTimeSourceType, AUTOMATIC) pfTimeSource,
+    P2VAR(Mcl_CrossbarLatencyType, AUTOMATIC, MCL_APPL_DATA) pLatency
+);
+#endif /* (MCL_CROSSBAR_PROFILE_API == STD_ON) */
+#endif /* (MCL_ENABLE_CROSSBAR == STD_ON) */
+
 /*================================================================================================*/
 #ifdef MCL_LMEM_ENABLE_CACHE_API
 #if (STD_ON == MCL_LMEM_ENABLE_CACHE_API)
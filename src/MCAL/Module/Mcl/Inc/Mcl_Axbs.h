@@ -176,6 +176,18 @@ extern "C"{
 FUNC(void, MCL_CODE) Axbs_Init( P2CONST(Mcl_CrossbarConfigType, AUTOMATIC, MCL_APPL_CONST) pAxbsConfig);           
 #if (MCL_DEINIT_API == STD_ON)
 FUNC(void, MCL_CODE) Axbs_DeInit( P2CONST(Mcl_CrossbarConfigType, AUTOMATIC, MCL_APPL_CONST) pAxbsConfig); 
+#endif
+#ifdef MCL_CROSSBAR_PROFILE_API
+#if (STD_ON == MCL_CROSSBAR_PROFILE_API)
+FUNC(Std_ReturnType, MCL_CODE) Axbs_SetProfile( P2CONST(Mcl_CrossbarConfigType, AUTOMATIC, MCL_APPL_CONST) pProfile);
+FUNC(void, MCL_CODE) Axbs_MeasureLatency
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint16, AUTOMATIC) u16Reads,
+    VAR(Mcl_AxbsTimeSourceType, AUTOMATIC) pfTimeSource,
+    P2VAR(Mcl_AxbsLatencyType, AUTOMATIC, MCL_APPL_DATA) pLatency
+);
+#endif
 #endif                                               
 #define MCL_STOP_SEC_CODE
 /** @violates @ref Mcl_AXBS_h_REF_1 MISRA 2004 Advisory Rule 19.15, header file being included twice */
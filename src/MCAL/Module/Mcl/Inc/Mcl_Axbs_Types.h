@@ -198,6 +198,28 @@ typedef struct
 #endif
 #endif
 
+#ifdef MCL_CROSSBAR_PROFILE_API
+#if (STD_ON == MCL_CROSSBAR_PROFILE_API)
+/**
+*     Free running counter sampled around the measured accesses, e.g. a STM or timebase read
+*/
+typedef P2FUNC(uint32, MCL_CODE, Mcl_AxbsTimeSourceType)(void);
+
+/**
+*        result of a crossbar access latency measurement, in ticks of the time source
+*/
+typedef struct
+{
+    /**   fastest access, the latency without contention */
+    VAR(uint32, MCL_VAR)   u32MinTicks;
+    /**   slowest access, u32MaxTicks - u32MinTicks is the longest arbitration wait */
+    VAR(uint32, MCL_VAR)   u32MaxTicks;
+    /**   sum of all accesses, for the mean latency */
+    VAR(uint32, MCL_VAR)   u32TotalTicks;
+} Mcl_AxbsLatencyType;
+#endif
+#endif
+
 /*==================================================================================================
 *                                GLOBAL VARIABLE DECLARATIONS
 ==================================================================================================*/
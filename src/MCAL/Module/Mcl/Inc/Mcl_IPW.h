@@ -370,6 +370,16 @@ FUNC(void, MCL_CODE) Mcl_IPW_Crossbar_Init( P2CONST( Mcl_CrossbarConfigType, AUT
 #if (MCL_DEINIT_API == STD_ON)
 FUNC(void, MCL_CODE) Mcl_IPW_Crossbar_DeInit( P2CONST( Mcl_CrossbarConfigType, AUTOMATIC, MCL_APPL_CONST) Mcl_CrossbarConfigPtr);
 #endif
+#if (MCL_CROSSBAR_PROFILE_API == STD_ON)
+FUNC(Std_ReturnType, MCL_CODE) Mcl_IPW_Crossbar_SetProfile( P2CONST( Mcl_CrossbarProfileType, AUTOMATIC, MCL_APPL_CONST) Mcl_CrossbarProfilePtr);
+FUNC(void, MCL_CODE) Mcl_IPW_Crossbar_MeasureLatency
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint16, AUTOMATIC) u16Reads,
+    VAR(Mcl_CrossbarTimeSourceType, AUTOMATIC) pfTimeSource,
+    P2VAR(Mcl_CrossbarLatencyType, AUTOMATIC, MCL_APPL_DATA) pLatency
+);
+#endif
 #endif
 /*================================================================================================*/
 #ifdef CACHE_INVALIDATE_MACROS
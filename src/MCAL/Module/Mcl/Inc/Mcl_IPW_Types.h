@@ -180,6 +180,19 @@ typedef struct
     #endif
     #endif   
     } Mcl_CrossbarConfigType;
+
+#ifdef MCL_CROSSBAR_PROFILE_API
+#if (STD_ON == MCL_CROSSBAR_PROFILE_API)
+    /**  Mcl Crossbar runtime profile, same layout as the configuration applied by Mcl_Init */
+    typedef Mcl_CrossbarConfigType  Mcl_CrossbarProfileType;
+
+    /**  Mcl Crossbar latency measurement time source */
+    typedef Mcl_AxbsTimeSourceType  Mcl_CrossbarTimeSourceType;
+
+    /**  Mcl Crossbar latency measurement result */
+    typedef Mcl_AxbsLatencyType  Mcl_CrossbarLatencyType;
+#endif
+#endif
 #endif
 
 /*==================================================================================================
@@ -261,6 +261,15 @@ typedef void       (*Mcl_NotifyType)(void);
  * @brief          This gives the numeric ID of a Mcl logic channel
  * */
 typedef uint8      Mcl_ChannelType;
+
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+/**
+ * @brief          Completion callback of Mcl_DmaMemcpy()/Mcl_DmaMemset().
+ * @details        Called from Mcl_DmaMemcpyMainFunction() with the destination address of the
+ *                 request that has been completed.
+ * */
+typedef void       (*Mcl_DmaMemcpyNotifyType)(P2VAR(void, AUTOMATIC, MCL_APPL_DATA) pDest);
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
 #endif
 
 /*==================================================================================================
@@ -51,6 +51,7 @@ extern "C"{
 * 2) needed interfaces from external units
 * 3) internal and external interfaces from this unit
 ==================================================================================================*/
+#include "eMios_Common_Types.h"
 #include "Reg_eSys_eMios.h"
 
 /*==================================================================================================
@@ -116,6 +117,12 @@ FUNC (void, MCL_CODE) eMios_StopChannel(VAR(uint8, AUTOMATIC) u8HwChannel);
 #endif  /* EMIOS_UCDIS_AVAILABLE */
 #endif
 
+FUNC (void, MCL_CODE) eMios_SetIrqHandler(VAR(uint8, AUTOMATIC) u8HwChannel,
+                                          VAR(eMios_IrqHandlerType, AUTOMATIC) pfHandler);
+
+FUNC (void, MCL_CODE) eMios_SetDmaRequest(VAR(uint8, AUTOMATIC) u8HwChannel,
+                                          VAR(boolean, AUTOMATIC) bEnable);
+
 #define MCL_STOP_SEC_CODE
 /** @violates @ref EMIOS_COMMON_H_REF_1 Repeated include file */
 #include "MemMap.h"
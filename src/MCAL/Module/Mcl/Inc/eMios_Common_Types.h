@@ -68,6 +68,9 @@ extern "C"{
  2) needed interfaces from external units
  3) internal and external interfaces from this unit
 ==================================================================================================*/
+/** @violates @ref eMios_Common_Types_h_1 Precautions shall be taken in order to prevent the
+ contents of a header file being included twice */
+#include "Std_Types.h"
 
 /*==================================================================================================
                                SOURCE FILE VERSION INFORMATION
@@ -156,6 +159,14 @@ extern "C"{
 /**@violates @ref eMios_Common_Types_h_4 This is not a standard library macro */
 #define EMIOS_MODULE_2     ((uint8)0x02U)
 
+/**
+* @brief Number of eMios modules and unified channels served by the interrupt dispatcher
+*/
+/**@violates @ref eMios_Common_Types_h_4 This is not a standard library macro */
+#define EMIOS_IRQ_MODULE_COUNT_U8     ((uint8)3U)
+/**@violates @ref eMios_Common_Types_h_4 This is not a standard library macro */
+#define EMIOS_IRQ_CHANNEL_COUNT_U8    ((uint8)32U)
+
 /**
 * @brief EMIOS Channels defines
 */
@@ -425,6 +436,12 @@ extern "C"{
 /*==================================================================================================
                                  STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
+/**
+* @brief   Channel interrupt handler registered by the driver owning an eMios unified channel.
+* @details Called from the eMios interrupt vectors with the encoded hw channel (module and channel)
+*          whose flag is set in the module global flag register.
+*/
+typedef P2FUNC(void, MCL_CODE, eMios_IrqHandlerType)(VAR(uint8, AUTOMATIC) u8HwChannel);
 
 /*==================================================================================================
                                      FUNCTION PROTOTYPES
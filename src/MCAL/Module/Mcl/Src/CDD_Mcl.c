@@ -85,6 +85,10 @@ extern "C"
 * Violates MISRA 2004 Required Rule 8.7,Objects %s shall be defined at block scope if they are 
 * only accessed from within a single function %s.
 *
+* @section Mcl_c_12
+* Violates MISRA 2004 Required Rule 17.4, Array indexing shall be the only allowed form of pointer
+* arithmetic. The capture ring is a caller provided buffer, the index is kept below its length.
+*
 */
 
 /*==================================================================================================
@@ -109,6 +113,14 @@ extern "C"
     #include "Det.h"
 #endif
 
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+#include "SchM_Mcl.h"
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
+
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+#include "eMios_Common.h"
+#endif /* (MCL_DMA_CAPTURE_API == STD_ON) */
+
 /*==================================================================================================
  *                                      SOURCE FILE VERSION INFORMATION
 ==================================================================================================*/
@@ -202,6 +214,52 @@ extern "C"
 /*==================================================================================================
  *                           LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+/**
+* @brief      One request of the memory copy service.
+* @details    While the request waits in the queue u32Src holds the source address or, for a
+*             memset request, the fill pattern replicated on 32 bits. Once the request is owned by
+*             a channel u32Dest, u32Src and u32Remaining are advanced after every chunk.
+*/
+typedef struct
+{
+    P2VAR(void, MCL_VAR, MCL_APPL_DATA)   pDest;           /** @brief destination as given by the caller */
+    VAR(uint32, MCL_VAR)                  u32Dest;         /** @brief next destination address */
+    VAR(uint32, MCL_VAR)                  u32Src;          /** @brief next source address or fill pattern */
+    VAR(uint32, MCL_VAR)                  u32Remaining;    /** @brief bytes not yet programmed */
+    VAR(boolean, MCL_VAR)                 bMemset;         /** @brief TRUE for Mcl_DmaMemset requests */
+    VAR(Mcl_DmaMemcpyNotifyType, MCL_VAR) pfNotification;  /** @brief completion callback, may be NULL_PTR */
+} Mcl_DmaMemcpyRequestType;
+
+/**
+* @brief      State of one channel reserved for the memory copy service.
+*/
+typedef struct
+{
+    VAR(Mcl_DmaMemcpyRequestType, MCL_VAR) Request;        /** @brief request served by the channel */
+    VAR(uint32, MCL_VAR)                   u32ChunkBytes;  /** @brief bytes moved by the running major loop */
+    VAR(uint32, MCL_VAR)                   u32Pattern;     /** @brief source word for memset requests */
+    VAR(boolean, MCL_VAR)                  bBusy;          /** @brief TRUE while a request is owned */
+} Mcl_DmaMemcpyChannelStateType;
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
+
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+/**
+* @brief      State of one eMios capture ring.
+* @details    The eDma channel is the only producer, the position it writes next is derived from
+*             its current iteration count. u16Read is only written by Mcl_DmaCaptureRead().
+*/
+typedef struct
+{
+    P2VAR(uint32, MCL_VAR, MCL_APPL_DATA) pBuffer;          /** @brief ring storage */
+    VAR(Mcl_DmaTcdType, MCL_VAR)          TcdAddress;       /** @brief TCD of the channel filling the ring */
+    VAR(Mcl_ChannelType, MCL_VAR)         nChannel;         /** @brief logical eDma channel */
+    VAR(uint8, MCL_VAR)                   u8EmiosHwChannel; /** @brief eMios channel producing the captures */
+    VAR(uint16, MCL_VAR)                  u16Length;        /** @brief number of entries of the ring */
+    VAR(uint16, MCL_VAR)                  u16Read;          /** @brief next entry to be read */
+    VAR(boolean, MCL_VAR)                 bActive;          /** @brief TRUE between start and stop */
+} Mcl_DmaCaptureRingStateType;
+#endif /* (MCL_DMA_CAPTURE_API == STD_ON) */
 
 /*==================================================================================================
 *                                       LOCAL MACROS
@@ -218,9 +276,90 @@ extern "C"
 #define MCL_ENDVALIDATEGLOBALCALL()
 #endif 
 
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+#ifndef MCL_TRANSFER_SIZE_1_BYTE
+    #error "The memory copy service requires the 1 byte transfer size"
+#endif
+#if ((MCL_DMA_MEMCPY_MINOR_LOOP_BYTES % 32U) != 0U) || (MCL_DMA_MEMCPY_MINOR_LOOP_BYTES == 0U)
+    #error "MCL_DMA_MEMCPY_MINOR_LOOP_BYTES shall be a non zero multiple of 32"
+#endif
+
+/**
+* @brief      Mask of the transfer sizes enabled in the configuration, bit n set means a
+*             transfer size of 2^n bytes (the Mcl_DmaSizeType encoding) can be used.
+*/
+#ifdef MCL_TRANSFER_SIZE_2_BYTE
+#define MCL_DMA_MEMCPY_SIZE_2_MASK_U32      ((uint32)0x02U)
+#else
+#define MCL_DMA_MEMCPY_SIZE_2_MASK_U32      ((uint32)0x00U)
+#endif
+#ifdef MCL_TRANSFER_SIZE_4_BYTE
+#define MCL_DMA_MEMCPY_SIZE_4_MASK_U32      ((uint32)0x04U)
+#else
+#define MCL_DMA_MEMCPY_SIZE_4_MASK_U32      ((uint32)0x00U)
+#endif
+#ifdef MCL_TRANSFER_SIZE_8_BYTE
+#define MCL_DMA_MEMCPY_SIZE_8_MASK_U32      ((uint32)0x08U)
+#else
+#define MCL_DMA_MEMCPY_SIZE_8_MASK_U32      ((uint32)0x00U)
+#endif
+#ifdef MCL_TRANSFER_SIZE_16_BYTE
+#define MCL_DMA_MEMCPY_SIZE_16_MASK_U32     ((uint32)0x10U)
+#else
+#define MCL_DMA_MEMCPY_SIZE_16_MASK_U32     ((uint32)0x00U)
+#endif
+#ifdef MCL_TRANSFER_SIZE_32_BYTE
+#define MCL_DMA_MEMCPY_SIZE_32_MASK_U32     ((uint32)0x20U)
+#else
+#define MCL_DMA_MEMCPY_SIZE_32_MASK_U32     ((uint32)0x00U)
+#endif
+#define MCL_DMA_MEMCPY_SIZES_MASK_U32       ((uint32)0x01U | MCL_DMA_MEMCPY_SIZE_2_MASK_U32 | \
+                                             MCL_DMA_MEMCPY_SIZE_4_MASK_U32 | MCL_DMA_MEMCPY_SIZE_8_MASK_U32 | \
+                                             MCL_DMA_MEMCPY_SIZE_16_MASK_U32 | MCL_DMA_MEMCPY_SIZE_32_MASK_U32)
+
+/** @brief Largest transfer size code (log2 of the size in bytes) handled by the service */
+#define MCL_DMA_MEMCPY_MAX_SIZE_CODE_U32    ((uint32)5U)
+/** @brief Largest source size code used by memset, the pattern is a single 32 bit word */
+#define MCL_DMA_MEMSET_MAX_SSIZE_CODE_U32   ((uint32)2U)
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
+
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+#ifndef MCL_TRANSFER_SIZE_4_BYTE
+    #error "The eMios capture service requires the 4 bytes transfer size"
+#endif
+/** @brief Size in bytes of one capture ring entry, the eMios A register is read on 32 bits */
+#define MCL_DMA_CAPTURE_ENTRY_BYTES_U32     ((uint32)4U)
+#endif /* (MCL_DMA_CAPTURE_API == STD_ON) */
+
 /*==================================================================================================
  *                                        LOCAL CONSTANTS
 ==================================================================================================*/
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+#define MCL_START_SEC_CONST_UNSPECIFIED
+/*
+ * @violates @ref Mcl_c_1 Violates MISRA 2004 Advisory Rule 19.1, only preprocessor statements and comments
+ * before "#include"
+ *
+ * @violates @ref Mcl_c_2 precautions to prevent the contents
+ *        of a header file being included twice
+ */
+#include "MemMap.h"
+
+/**
+* @brief          Logical channels reserved for the memory copy service.
+*/
+static CONST(Mcl_ChannelType, MCL_CONST) Mcl_aDmaMemcpyChannels[MCL_DMA_MEMCPY_CHANNELS_NO] = MCL_DMA_MEMCPY_CHANNELS;
+
+#define MCL_STOP_SEC_CONST_UNSPECIFIED
+/*
+ * @violates @ref Mcl_c_1 Violates MISRA 2004 Advisory Rule 19.1, only preprocessor statements and comments
+ * before "#include"
+ *
+ * @violates @ref Mcl_c_2 precautions to prevent the contents
+ *        of a header file being included twice
+ */
+#include "MemMap.h"
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
 
 /*==================================================================================================
  *                                        LOCAL VARIABLES
@@ -257,6 +396,31 @@ P2CONST( Mcl_DemConfigType, MCL_VAR, MCL_APPL_CONST) Mcl_pDemCfgPtr = NULL_PTR;
 */
 static P2CONST(Mcl_ConfigType, MCL_VAR,  MCL_APPL_CONST)  Mcl_pConfig  = NULL_PTR;
 
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+/**
+* @brief          State of the channels reserved for the memory copy service.
+*/
+static VAR(Mcl_DmaMemcpyChannelStateType, MCL_VAR) Mcl_aDmaMemcpyChState[MCL_DMA_MEMCPY_CHANNELS_NO];
+
+/**
+* @brief          Requests waiting for a free channel, managed as a ring buffer.
+*/
+static VAR(Mcl_DmaMemcpyRequestType, MCL_VAR) Mcl_aDmaMemcpyQueue[MCL_DMA_MEMCPY_QUEUE_SIZE];
+
+/**
+* @brief          Index of the oldest request and number of requests in Mcl_aDmaMemcpyQueue.
+*/
+static VAR(uint8, MCL_VAR) Mcl_u8DmaMemcpyQueueHead = 0U;
+static VAR(uint8, MCL_VAR) Mcl_u8DmaMemcpyQueueCount = 0U;
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
+
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+/**
+* @brief          State of the eMios capture rings.
+*/
+static VAR(Mcl_DmaCaptureRingStateType, MCL_VAR) Mcl_aDmaCaptureRing[MCL_DMA_CAPTURE_RINGS_NO];
+#endif /* (MCL_DMA_CAPTURE_API == STD_ON) */
+
 
 #define MCL_STOP_SEC_VAR_INIT_UNSPECIFIED
 /*
@@ -316,6 +480,28 @@ P2CONST(Std_VersionInfoType, AUTOMATIC, MCL_APPL_CONST) versioninfo
 LOCAL_INLINE FUNC(uint32, MCL_CODE) Mcl_GetPhysicalAddress(VAR(uint32, AUTOMATIC) logicalAddr);
 #endif /*MCL_LOGICAL_ADDRESS_USED == STD_ON*/
 #endif /*defined MCL_LOGICAL_ADDRESS_USED*/
+
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+static FUNC(void, MCL_CODE) Mcl_DmaMemcpyReset(void);
+static FUNC(void, MCL_CODE) Mcl_DmaMemcpyStartChunk(VAR(uint8, AUTOMATIC) u8Index);
+static FUNC(void, MCL_CODE) Mcl_DmaMemcpyDispatch(void);
+static FUNC(Std_ReturnType, MCL_CODE) Mcl_DmaMemcpyEnqueue
+(
+    P2CONST(Mcl_DmaMemcpyRequestType, AUTOMATIC, MCL_APPL_CONST) pRequest
+);
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
+
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+static FUNC(Std_ReturnType, MCL_CODE) Mcl_DmaCaptureCheckRing
+(
+    VAR(uint8, AUTOMATIC) u8Ring,
+    VAR(uint8, AUTOMATIC) u8ServiceId
+);
+static FUNC(uint16, MCL_CODE) Mcl_DmaCaptureWriteIndex
+(
+    P2CONST(Mcl_DmaCaptureRingStateType, AUTOMATIC, MCL_VAR) pRing
+);
+#endif /* (MCL_DMA_CAPTURE_API == STD_ON) */
     
 #endif /* #if (MCL_ENABLE_DMA == STD_ON) */
 /*==================================================================================================
@@ -598,6 +784,254 @@ LOCAL_INLINE  FUNC(Std_ReturnType, MCL_CODE) Mcl_ValidateChannelConfigCall
 
 #endif /* (MCL_VALIDATE_CALL_AND_CHANNEL == STD_ON) */
 
+
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+/**
+ * @brief      Drops every pending request of the memory copy service.
+ * @details    Called from Mcl_Init(), the reserved channels are considered idle afterwards.
+ *
+ * @return     void
+ * */
+static FUNC(void, MCL_CODE) Mcl_DmaMemcpyReset(void)
+{
+    VAR(uint8, AUTOMATIC) u8Index;
+
+    for (u8Index = 0U; u8Index < (uint8)MCL_DMA_MEMCPY_CHANNELS_NO; u8Index++)
+    {
+        Mcl_aDmaMemcpyChState[u8Index].bBusy = (boolean)FALSE;
+        Mcl_aDmaMemcpyChState[u8Index].u32ChunkBytes = 0U;
+    }
+    Mcl_u8DmaMemcpyQueueHead = 0U;
+    Mcl_u8DmaMemcpyQueueCount = 0U;
+}
+
+/**
+ * @brief      Programs and starts the next chunk of the request owned by a reserved channel.
+ * @details    The transfer size is the largest enabled size (up to 32 bytes) matching the alignment
+ *             of the current addresses. Whole minor loops of MCL_DMA_MEMCPY_MINOR_LOOP_BYTES are
+ *             chained into one major loop by linking the channel to itself on minor loop
+ *             completion, so a single software start moves up to DMA_MAX_LINKED_ITER_CNT_U16
+ *             minor loops. The tail shorter than one minor loop is moved as a single minor loop,
+ *             stepping the transfer size down for the last bytes if needed.
+ *             Memset requests read the 32 bit pattern word with a zero source offset.
+ *             Shall be called from inside MCL_EXCLUSIVE_AREA_32.
+ *
+ * @param[in]  u8Index     Index of the reserved channel in Mcl_aDmaMemcpyChannels
+ *
+ * @return     void
+ * */
+static FUNC(void, MCL_CODE) Mcl_DmaMemcpyStartChunk(VAR(uint8, AUTOMATIC) u8Index)
+{
+    P2VAR(Mcl_DmaMemcpyChannelStateType, AUTOMATIC, MCL_VAR) pState = &Mcl_aDmaMemcpyChState[u8Index];
+    VAR(Mcl_ChannelType, AUTOMATIC) nChannel = Mcl_aDmaMemcpyChannels[u8Index];
+    VAR(Mcl_DmaTcdAttributesType, AUTOMATIC) TcdAttributes;
+    VAR(Mcl_DmaTcdType, AUTOMATIC) TcdAddress;
+    VAR(uint32, AUTOMATIC) u32Align;
+    VAR(uint32, AUTOMATIC) u32SizeCode = MCL_DMA_MEMCPY_MAX_SIZE_CODE_U32;
+    VAR(uint32, AUTOMATIC) u32NBytes;
+    VAR(uint32, AUTOMATIC) u32Iter = 1U;
+
+    u32Align = pState->Request.u32Dest;
+    if ((boolean)FALSE == pState->Request.bMemset)
+    {
+        u32Align |= pState->Request.u32Src;
+    }
+    /* Largest enabled transfer size matching the address alignment */
+    while ((0U != u32SizeCode) && \
+           ((0U == (MCL_DMA_MEMCPY_SIZES_MASK_U32 & ((uint32)1U << u32SizeCode))) || \
+            (0U != (u32Align & (((uint32)1U << u32SizeCode) - 1U)))))
+    {
+        u32SizeCode--;
+    }
+
+    if (pState->Request.u32Remaining >= MCL_DMA_MEMCPY_MINOR_LOOP_BYTES)
+    {
+        /* Whole minor loops chained in one major loop */
+        u32NBytes = MCL_DMA_MEMCPY_MINOR_LOOP_BYTES;
+        u32Iter = pState->Request.u32Remaining / MCL_DMA_MEMCPY_MINOR_LOOP_BYTES;
+        if (u32Iter > (uint32)DMA_MAX_LINKED_ITER_CNT_U16)
+        {
+            u32Iter = (uint32)DMA_MAX_LINKED_ITER_CNT_U16;
+        }
+    }
+    else
+    {
+        /* Tail shorter than one minor loop, step the size down until at least one beat fits */
+        u32NBytes = pState->Request.u32Remaining & ~(((uint32)1U << u32SizeCode) - 1U);
+        while (0U == u32NBytes)
+        {
+            do
+            {
+                u32SizeCode--;
+            } while (0U == (MCL_DMA_MEMCPY_SIZES_MASK_U32 & ((uint32)1U << u32SizeCode)));
+            u32NBytes = pState->Request.u32Remaining & ~(((uint32)1U << u32SizeCode) - 1U);
+        }
+    }
+
+    TcdAttributes.u32daddr = pState->Request.u32Dest;
+    TcdAttributes.u32dsize = u32SizeCode;
+    TcdAttributes.u32doff = (uint32)1U << u32SizeCode;
+    TcdAttributes.u32dmod = 0U;
+    TcdAttributes.u32smod = 0U;
+    TcdAttributes.u32num_bytes = u32NBytes;
+    TcdAttributes.u32iter = u32Iter;
+    if ((boolean)TRUE == pState->Request.bMemset)
+    {
+        /* Read the pattern word again and again */
+        pState->u32Pattern = pState->Request.u32Src;
+        /** @violates @ref Mcl_c_8 Violates MISRA 2004 Rule 11.3, cast from pointer to unsigned long */
+        TcdAttributes.u32saddr = (uint32)&pState->u32Pattern;
+        TcdAttributes.u32ssize = (u32SizeCode > MCL_DMA_MEMSET_MAX_SSIZE_CODE_U32) ? MCL_DMA_MEMSET_MAX_SSIZE_CODE_U32 : u32SizeCode;
+        TcdAttributes.u32soff = 0U;
+    }
+    else
+    {
+        TcdAttributes.u32saddr = pState->Request.u32Src;
+        TcdAttributes.u32ssize = u32SizeCode;
+        TcdAttributes.u32soff = (uint32)1U << u32SizeCode;
+    }
+#ifdef MCL_LOGICAL_ADDRESS_USED
+#if (MCL_LOGICAL_ADDRESS_USED == STD_ON)
+    TcdAttributes.u32saddr = Mcl_GetPhysicalAddress(TcdAttributes.u32saddr);
+    TcdAttributes.u32daddr = Mcl_GetPhysicalAddress(TcdAttributes.u32daddr);
+#endif /*MCL_LOGICAL_ADDRESS_USED == STD_ON*/
+#endif /*defined MCL_LOGICAL_ADDRESS_USED*/
+
+    Mcl_IPW_DmaConfigChannel(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig->pDma_Config, nChannel, &TcdAttributes);
+    if (u32Iter > 1U)
+    {
+        /* Link the channel to itself so every minor loop starts the next one */
+        TcdAddress = Mcl_IPW_DmaGetChannelTcdAddress(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig->pDma_Config, nChannel);
+        /** @violates @ref Mcl_c_7 Violates MISRA 2004 Rule 11.1 */
+        /** @violates @ref Mcl_c_8 Violates MISRA 2004 Rule 11.3*/
+        Mcl_IPW_DmaSetLinkAndIterCount(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig->pDma_Config, \
+                                       (Mcl_DmaTcdType*)TcdAddress, nChannel, (uint16)u32Iter);
+    }
+    pState->u32ChunkBytes = u32NBytes * u32Iter;
+    Mcl_IPW_DmaStartChannel(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig->pDma_Config, nChannel);
+}
+
+/**
+ * @brief      Hands the oldest queued requests to the idle reserved channels.
+ * @details    Shall be called from inside MCL_EXCLUSIVE_AREA_32.
+ *
+ * @return     void
+ * */
+static FUNC(void, MCL_CODE) Mcl_DmaMemcpyDispatch(void)
+{
+    VAR(uint8, AUTOMATIC) u8Index;
+
+    for (u8Index = 0U; (u8Index < (uint8)MCL_DMA_MEMCPY_CHANNELS_NO) && (0U != Mcl_u8DmaMemcpyQueueCount); u8Index++)
+    {
+        if ((boolean)FALSE == Mcl_aDmaMemcpyChState[u8Index].bBusy)
+        {
+            Mcl_aDmaMemcpyChState[u8Index].Request = Mcl_aDmaMemcpyQueue[Mcl_u8DmaMemcpyQueueHead];
+            Mcl_aDmaMemcpyChState[u8Index].bBusy = (boolean)TRUE;
+            Mcl_u8DmaMemcpyQueueHead++;
+            if (Mcl_u8DmaMemcpyQueueHead >= (uint8)MCL_DMA_MEMCPY_QUEUE_SIZE)
+            {
+                Mcl_u8DmaMemcpyQueueHead = 0U;
+            }
+            Mcl_u8DmaMemcpyQueueCount--;
+            Mcl_DmaMemcpyStartChunk(u8Index);
+        }
+    }
+}
+
+/**
+ * @brief      Appends a request to the memory copy queue and starts it if a channel is idle.
+ *
+ * @param[in]  pRequest    Request to be queued
+ *
+ * @return     Std_ReturnType
+ * @retval     E_OK        The request has been accepted
+ * @retval     E_NOT_OK    The queue is full
+ * */
+static FUNC(Std_ReturnType, MCL_CODE) Mcl_DmaMemcpyEnqueue
+(
+    P2CONST(Mcl_DmaMemcpyRequestType, AUTOMATIC, MCL_APPL_CONST) pRequest
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) retVal = (Std_ReturnType)E_NOT_OK;
+    VAR(uint32, AUTOMATIC) u32Tail;
+
+    SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_32();
+    if (Mcl_u8DmaMemcpyQueueCount < (uint8)MCL_DMA_MEMCPY_QUEUE_SIZE)
+    {
+        u32Tail = ((uint32)Mcl_u8DmaMemcpyQueueHead + (uint32)Mcl_u8DmaMemcpyQueueCount) % MCL_DMA_MEMCPY_QUEUE_SIZE;
+        Mcl_aDmaMemcpyQueue[u32Tail] = *pRequest;
+        Mcl_u8DmaMemcpyQueueCount++;
+        Mcl_DmaMemcpyDispatch();
+        retVal = (Std_ReturnType)E_OK;
+    }
+    SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_32();
+
+    return retVal;
+}
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
+
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+/**
+ * @brief      Checks the ring index given to a capture service.
+ *
+ * @param[in]  u8Ring      Capture ring index
+ * @param[in]  u8ServiceId Service reported to Det when the index is out of range
+ *
+ * @return     Std_ReturnType
+ * @retval     E_OK        The ring index is valid
+ * @retval     E_NOT_OK    The ring index is out of range
+ * */
+static FUNC(Std_ReturnType, MCL_CODE) Mcl_DmaCaptureCheckRing
+(
+    VAR(uint8, AUTOMATIC) u8Ring,
+    VAR(uint8, AUTOMATIC) u8ServiceId
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) retVal = (Std_ReturnType)E_OK;
+
+    if (u8Ring >= (uint8)MCL_DMA_CAPTURE_RINGS_NO)
+    {
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+        (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, u8ServiceId, (uint8)MCL_E_PARAM_RING_U8);
+#else
+        (void)u8ServiceId;
+#endif
+        retVal = (Std_ReturnType)E_NOT_OK;
+    }
+
+    return retVal;
+}
+
+/**
+ * @brief      Position of the ring entry the eDma channel writes next.
+ * @details    The major loop counts one iteration per capture and reloads at the end of the ring,
+ *             so the entries written since the last wrap are BITER - CITER. The iteration count is
+ *             only decremented once the entry has been written.
+ *
+ * @param[in]  pRing       Capture ring
+ *
+ * @return     uint16      Index of the next entry to be written
+ * */
+static FUNC(uint16, MCL_CODE) Mcl_DmaCaptureWriteIndex
+(
+    P2CONST(Mcl_DmaCaptureRingStateType, AUTOMATIC, MCL_VAR) pRing
+)
+{
+    VAR(uint16, AUTOMATIC) u16Citer;
+    VAR(uint16, AUTOMATIC) u16Write = 0U;
+
+    /** @violates @ref Mcl_c_7 Violates MISRA 2004 Rule 11.1 */
+    /** @violates @ref Mcl_c_8 Violates MISRA 2004 Rule 11.3*/
+    u16Citer = Mcl_IPW_DmaGetCiter((Mcl_DmaTcdType*)pRing->TcdAddress);
+    if (u16Citer < pRing->u16Length)
+    {
+        u16Write = (uint16)(pRing->u16Length - u16Citer);
+    }
+
+    return u16Write;
+}
+#endif /* (MCL_DMA_CAPTURE_API == STD_ON) */
+
 #endif /* (MCL_ENABLE_DMA == STD_ON) */
 
 /*==================================================================================================
@@ -630,6 +1064,9 @@ FUNC(void, MCL_CODE) Mcl_Init(P2CONST( Mcl_ConfigType, AUTOMATIC, MCL_APPL_CONST
 #if (MCL_VALIDATE_GLOBAL_CALL == STD_ON) || (MCL_VALIDATE_PARAMS == STD_ON)
     VAR(Std_ReturnType, AUTOMATIC)valid;
 #endif
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+    VAR(uint8, AUTOMATIC) u8Ring;
+#endif
 
 #if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
     valid = Mcl_ValidateGlobalCall(MCL_INIT_ID_U8);
@@ -655,6 +1092,17 @@ FUNC(void, MCL_CODE) Mcl_Init(P2CONST( Mcl_ConfigType, AUTOMATIC, MCL_APPL_CONST
 #endif 
             /* Init eDMA controllers and channels. */
             Mcl_IPW_Init(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig);
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+            /* No memory copy request survives a re-initialization */
+            Mcl_DmaMemcpyReset();
+#endif
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+            /* The eDma channels of the capture rings have been reset as well */
+            for (u8Ring = 0U; u8Ring < (uint8)MCL_DMA_CAPTURE_RINGS_NO; u8Ring++)
+            {
+                Mcl_aDmaCaptureRing[u8Ring].bActive = (boolean)FALSE;
+            }
+#endif
 #endif
 #if (MCL_ENABLE_CROSSBAR == STD_ON)
             /* Init Crossbar registers */
@@ -3019,6 +3467,511 @@ FUNC(Mcl_DmaChannelErrorStatusType, MCL_CODE) Mcl_DmaGetChannelErrorStatus(VAR(M
 }
 #endif
 
+#if (MCL_DMA_MEMCPY_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief    Mcl_DmaMemcpy.
+* @details  Queues an asynchronous copy of u32Length bytes from pSrc to pDest on the channels
+*           reserved by MCL_DMA_MEMCPY_CHANNELS. The copy starts immediately when a reserved
+*           channel is idle, otherwise when Mcl_DmaMemcpyMainFunction() frees one.
+*           pfNotification is called from Mcl_DmaMemcpyMainFunction() once the last byte has been
+*           written. The buffers shall not be accessed by the caller until then.
+*           The eDma engine does not snoop the core data cache: pDest and pSrc shall be placed in
+*           non-cacheable memory, otherwise the caller shall flush pSrc with
+*           Mcl_CacheFlushMultiLines() before the request and invalidate pDest with
+*           Mcl_CacheInvalidateMultiLines() once pfNotification has been called.
+*
+* @param[out]  pDest          - destination buffer
+* @param[in]   pSrc           - source buffer
+* @param[in]   u32Length      - number of bytes to copy
+* @param[in]   pfNotification - completion callback, may be NULL_PTR
+*
+* @return   Std_ReturnType
+* @retval   E_OK          The request has been accepted
+* @retval   E_NOT_OK      The request queue is full or a parameter is invalid
+*
+* @api
+*/
+/** @violates @ref Mcl_c_5 Violates MISRA 2004 Required Rule 8.10 could be made static */
+FUNC(Std_ReturnType, MCL_CODE) Mcl_DmaMemcpy
+(
+    P2VAR(void, AUTOMATIC, MCL_APPL_DATA) pDest,
+    P2CONST(void, AUTOMATIC, MCL_APPL_CONST) pSrc,
+    VAR(uint32, AUTOMATIC) u32Length,
+    VAR(Mcl_DmaMemcpyNotifyType, AUTOMATIC) pfNotification
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) retVal = (Std_ReturnType)E_NOT_OK;
+    VAR(Mcl_DmaMemcpyRequestType, AUTOMATIC) Request;
+
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Mcl_ValidateGlobalCall(MCL_DMA_MEMCPY_ID_U8))
+    {
+#endif
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+        if ((NULL_PTR == pDest) || (NULL_PTR == pSrc))
+        {
+            (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_DMA_MEMCPY_ID_U8, (uint8)MCL_E_PARAM_POINTER_U8);
+        }
+        else if (0U == u32Length)
+        {
+            (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_DMA_MEMCPY_ID_U8, (uint8)MCL_E_PARAM_LENGTH_U8);
+        }
+        else
+        {
+#endif
+            Request.pDest = pDest;
+            /** @violates @ref Mcl_c_8 Violates MISRA 2004 Rule 11.3, cast from pointer to unsigned long */
+            Request.u32Dest = (uint32)pDest;
+            /** @violates @ref Mcl_c_8 Violates MISRA 2004 Rule 11.3, cast from pointer to unsigned long */
+            Request.u32Src = (uint32)pSrc;
+            Request.u32Remaining = u32Length;
+            Request.bMemset = (boolean)FALSE;
+            Request.pfNotification = pfNotification;
+            retVal = Mcl_DmaMemcpyEnqueue(&Request);
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+        }
+#endif
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    }
+    MCL_ENDVALIDATEGLOBALCALL();
+#endif
+
+    return retVal;
+}
+
+/*================================================================================================*/
+/**
+* @brief    Mcl_DmaMemset.
+* @details  Queues an asynchronous fill of u32Length bytes at pDest with u8Value, served like
+*           Mcl_DmaMemcpy() by the reserved channels. The cache requirements of Mcl_DmaMemcpy()
+*           apply to pDest.
+*
+* @param[out]  pDest          - destination buffer
+* @param[in]   u8Value        - fill value
+* @param[in]   u32Length      - number of bytes to fill
+* @param[in]   pfNotification - completion callback, may be NULL_PTR
+*
+* @return   Std_ReturnType
+* @retval   E_OK          The request has been accepted
+* @retval   E_NOT_OK      The request queue is full or a parameter is invalid
+*
+* @api
+*/
+/** @violates @ref Mcl_c_5 Violates MISRA 2004 Required Rule 8.10 could be made static */
+FUNC(Std_ReturnType, MCL_CODE) Mcl_DmaMemset
+(
+    P2VAR(void, AUTOMATIC, MCL_APPL_DATA) pDest,
+    VAR(uint8, AUTOMATIC) u8Value,
+    VAR(uint32, AUTOMATIC) u32Length,
+    VAR(Mcl_DmaMemcpyNotifyType, AUTOMATIC) pfNotification
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) retVal = (Std_ReturnType)E_NOT_OK;
+    VAR(Mcl_DmaMemcpyRequestType, AUTOMATIC) Request;
+
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Mcl_ValidateGlobalCall(MCL_DMA_MEMSET_ID_U8))
+    {
+#endif
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+        if (NULL_PTR == pDest)
+        {
+            (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_DMA_MEMSET_ID_U8, (uint8)MCL_E_PARAM_POINTER_U8);
+        }
+        else if (0U == u32Length)
+        {
+            (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_DMA_MEMSET_ID_U8, (uint8)MCL_E_PARAM_LENGTH_U8);
+        }
+        else
+        {
+#endif
+            Request.pDest = pDest;
+            /** @violates @ref Mcl_c_8 Violates MISRA 2004 Rule 11.3, cast from pointer to unsigned long */
+            Request.u32Dest = (uint32)pDest;
+            /* The pattern word is identical in every byte lane */
+            Request.u32Src = (uint32)u8Value * 0x01010101U;
+            Request.u32Remaining = u32Length;
+            Request.bMemset = (boolean)TRUE;
+            Request.pfNotification = pfNotification;
+            retVal = Mcl_DmaMemcpyEnqueue(&Request);
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+        }
+#endif
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    }
+    MCL_ENDVALIDATEGLOBALCALL();
+#endif
+
+    return retVal;
+}
+
+/*================================================================================================*/
+/**
+* @brief    Mcl_DmaMemcpyMainFunction.
+* @details  Polls the DONE flag of the reserved channels, starts the next chunk of the running
+*           requests, calls the completion callbacks and hands queued requests to the channels
+*           that became idle. To be called cyclically, or from the transfer completion
+*           notification of the reserved channels.
+*
+* @return   void
+*
+* @api
+*/
+/** @violates @ref Mcl_c_5 Violates MISRA 2004 Required Rule 8.10 could be made static */
+FUNC(void, MCL_CODE) Mcl_DmaMemcpyMainFunction(void)
+{
+    VAR(uint8, AUTOMATIC) u8Index;
+    VAR(Mcl_DmaMemcpyNotifyType, AUTOMATIC) pfNotify;
+    P2VAR(void, AUTOMATIC, MCL_APPL_DATA) pDest = NULL_PTR;
+    P2VAR(Mcl_DmaMemcpyChannelStateType, AUTOMATIC, MCL_VAR) pState;
+
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Mcl_ValidateGlobalCall(MCL_DMA_MEMCPY_MAIN_ID_U8))
+    {
+#endif
+        for (u8Index = 0U; u8Index < (uint8)MCL_DMA_MEMCPY_CHANNELS_NO; u8Index++)
+        {
+            pfNotify = NULL_PTR;
+            pState = &Mcl_aDmaMemcpyChState[u8Index];
+
+            SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_32();
+            if (((boolean)TRUE == pState->bBusy) && \
+                ((boolean)TRUE == Mcl_IPW_DmaIsTransferCompleted(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig->pDma_Config, \
+                                                                 Mcl_aDmaMemcpyChannels[u8Index])))
+            {
+                Mcl_IPW_DmaClearDone(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig->pDma_Config, Mcl_aDmaMemcpyChannels[u8Index]);
+                pState->Request.u32Dest += pState->u32ChunkBytes;
+                if ((boolean)FALSE == pState->Request.bMemset)
+                {
+                    pState->Request.u32Src += pState->u32ChunkBytes;
+                }
+                pState->Request.u32Remaining -= pState->u32ChunkBytes;
+
+                if (0U != pState->Request.u32Remaining)
+                {
+                    Mcl_DmaMemcpyStartChunk(u8Index);
+                }
+                else
+                {
+                    pfNotify = pState->Request.pfNotification;
+                    pDest = pState->Request.pDest;
+                    pState->bBusy = (boolean)FALSE;
+                }
+            }
+            SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_32();
+
+            /* The callback may queue a new request, so it runs outside the exclusive area */
+            if (NULL_PTR != pfNotify)
+            {
+                pfNotify(pDest);
+            }
+        }
+
+        SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_32();
+        Mcl_DmaMemcpyDispatch();
+        SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_32();
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    }
+    MCL_ENDVALIDATEGLOBALCALL();
+#endif
+}
+
+/*================================================================================================*/
+/**
+* @brief    Mcl_DmaMemcpyIsIdle.
+* @details  Tells whether every request given to Mcl_DmaMemcpy()/Mcl_DmaMemset() has completed.
+*
+* @return   boolean
+* @retval   TRUE          No request is queued or running
+* @retval   FALSE         At least one request is queued or running
+*
+* @api
+*/
+/** @violates @ref Mcl_c_5 Violates MISRA 2004 Required Rule 8.10 could be made static */
+FUNC(boolean, MCL_CODE) Mcl_DmaMemcpyIsIdle(void)
+{
+    VAR(boolean, AUTOMATIC) bIdle = (boolean)TRUE;
+    VAR(uint8, AUTOMATIC) u8Index;
+
+    if (0U != Mcl_u8DmaMemcpyQueueCount)
+    {
+        bIdle = (boolean)FALSE;
+    }
+    for (u8Index = 0U; u8Index < (uint8)MCL_DMA_MEMCPY_CHANNELS_NO; u8Index++)
+    {
+        if ((boolean)TRUE == Mcl_aDmaMemcpyChState[u8Index].bBusy)
+        {
+            bIdle = (boolean)FALSE;
+        }
+    }
+
+    return bIdle;
+}
+#endif /* (MCL_DMA_MEMCPY_API == STD_ON) */
+
+#if (MCL_DMA_CAPTURE_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief    Mcl_DmaCaptureStart.
+* @details  Streams the captures of an eMios channel into a RAM ring without CPU interrupts.
+*           The eMios channel flag is routed to its DMA request and nChannel copies the channel A
+*           register into pBuffer on every event. The major loop spans the whole ring and
+*           reloads its destination at the end, so the channel runs until Mcl_DmaCaptureStop().
+*           nChannel shall be configured with the hardware request of the eMios channel, which
+*           shall already be configured in a capture mode by its owner. pBuffer shall not be
+*           cached and shall be large enough to hold the captures occurring between two
+*           Mcl_DmaCaptureRead() calls: older entries are overwritten without notice.
+*
+* @param[in]   u8Ring           - capture ring index, lower than MCL_DMA_CAPTURE_RINGS_NO
+* @param[in]   nChannel         - logical eDma channel serving the eMios channel
+* @param[in]   u8EmiosHwChannel - eMios hw channel ID (module and unified channel)
+* @param[out]  pBuffer          - ring storage of u16Length entries
+* @param[in]   u16Length        - number of entries, from 2 to DMA_MAX_UNLINKED_ITER_CNT_U16
+*
+* @return   Std_ReturnType
+* @retval   E_OK          The ring has been started
+* @retval   E_NOT_OK      A parameter is invalid or the ring is already started
+*
+* @api
+*/
+/** @violates @ref Mcl_c_5 Violates MISRA 2004 Required Rule 8.10 could be made static */
+FUNC(Std_ReturnType, MCL_CODE) Mcl_DmaCaptureStart
+(
+    VAR(uint8, AUTOMATIC) u8Ring,
+    VAR(Mcl_ChannelType, AUTOMATIC) nChannel,
+    VAR(uint8, AUTOMATIC) u8EmiosHwChannel,
+    P2VAR(uint32, AUTOMATIC, MCL_APPL_DATA) pBuffer,
+    VAR(uint16, AUTOMATIC) u16Length
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) retVal = (Std_ReturnType)E_NOT_OK;
+    VAR(Mcl_DmaTcdAttributesType, AUTOMATIC) TcdAttributes;
+    P2VAR(Mcl_DmaCaptureRingStateType, AUTOMATIC, MCL_VAR) pRing;
+
+#if (MCL_VALIDATE_CALL_AND_CHANNEL == STD_ON)
+    if ((Std_ReturnType)E_OK == Mcl_ValidateChannelConfigCall(nChannel, MCL_DMA_CAPTURE_START_ID_U8))
+    {
+#endif /* MCL_VALIDATE_CALL_AND_CHANNEL */
+        if ((Std_ReturnType)E_OK == Mcl_DmaCaptureCheckRing(u8Ring, MCL_DMA_CAPTURE_START_ID_U8))
+        {
+            pRing = &Mcl_aDmaCaptureRing[u8Ring];
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+            if ((boolean)TRUE == pRing->bActive)
+            {
+                (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_DMA_CAPTURE_START_ID_U8, (uint8)MCL_E_PARAM_RING_U8);
+            }
+            else if (NULL_PTR == pBuffer)
+            {
+                (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_DMA_CAPTURE_START_ID_U8, (uint8)MCL_E_PARAM_POINTER_U8);
+            }
+            else if ((u16Length < 2U) || (u16Length > (uint16)DMA_MAX_UNLINKED_ITER_CNT_U16))
+            {
+                (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_DMA_CAPTURE_START_ID_U8, (uint8)MCL_E_PARAM_LENGTH_U8);
+            }
+            else
+            {
+#endif
+                /* One 32 bit read of the capture register per minor loop, one minor loop per entry */
+                /** @violates @ref Mcl_c_8 Violates MISRA 2004 Rule 11.3, cast from pointer to unsigned long */
+                TcdAttributes.u32saddr = (uint32)EMIOS_CADR_ADDR32(EMIOS_MODULE_INDEX_U8(u8EmiosHwChannel), \
+                                                                   EMIOS_CHANNEL_INDEX_U8(u8EmiosHwChannel));
+                TcdAttributes.u32ssize = (uint32)DMA_SIZE_4BYTES;
+                TcdAttributes.u32soff = 0U;
+                TcdAttributes.u32smod = 0U;
+                /** @violates @ref Mcl_c_8 Violates MISRA 2004 Rule 11.3, cast from pointer to unsigned long */
+                TcdAttributes.u32daddr = (uint32)pBuffer;
+                TcdAttributes.u32dsize = (uint32)DMA_SIZE_4BYTES;
+                TcdAttributes.u32doff = MCL_DMA_CAPTURE_ENTRY_BYTES_U32;
+                TcdAttributes.u32dmod = 0U;
+                TcdAttributes.u32num_bytes = MCL_DMA_CAPTURE_ENTRY_BYTES_U32;
+                TcdAttributes.u32iter = (uint32)u16Length;
+#ifdef MCL_LOGICAL_ADDRESS_USED
+#if (MCL_LOGICAL_ADDRESS_USED == STD_ON)
+                TcdAttributes.u32daddr = Mcl_GetPhysicalAddress(TcdAttributes.u32daddr);
+#endif /*MCL_LOGICAL_ADDRESS_USED == STD_ON*/
+#endif /*defined MCL_LOGICAL_ADDRESS_USED*/
+
+                Mcl_IPW_DmaConfigChannel(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig->pDma_Config, nChannel, &TcdAttributes);
+                pRing->TcdAddress = Mcl_IPW_DmaGetChannelTcdAddress(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig->pDma_Config, nChannel);
+                /* Back to the first entry at the end of the ring, the channel keeps its hardware request */
+                /** @violates @ref Mcl_c_7 Violates MISRA 2004 Rule 11.1 */
+                /** @violates @ref Mcl_c_8 Violates MISRA 2004 Rule 11.3*/
+                Mcl_IPW_DmaSetDlast((Mcl_DmaTcdType*)pRing->TcdAddress, \
+                                    -(sint32)((uint32)u16Length * MCL_DMA_CAPTURE_ENTRY_BYTES_U32));
+
+                pRing->pBuffer = pBuffer;
+                pRing->nChannel = nChannel;
+                pRing->u8EmiosHwChannel = u8EmiosHwChannel;
+                pRing->u16Length = u16Length;
+                pRing->u16Read = 0U;
+                pRing->bActive = (boolean)TRUE;
+
+                Mcl_IPW_DmaEnableHwRequest(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig->pDma_Config, nChannel);
+                eMios_SetDmaRequest(u8EmiosHwChannel, (boolean)TRUE);
+                retVal = (Std_ReturnType)E_OK;
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+            }
+#endif
+        }
+#if (MCL_VALIDATE_CALL_AND_CHANNEL == STD_ON)
+    }
+    MCL_ENDVALIDATECHANNELCONFIGCALL(nChannel);
+#endif /* MCL_VALIDATE_CALL_AND_CHANNEL */
+
+    return retVal;
+}
+
+/*================================================================================================*/
+/**
+* @brief    Mcl_DmaCaptureStop.
+* @details  Stops routing the eMios channel events to the ring and disables the hardware request
+*           of its eDma channel. The entries already captured can still be read.
+*
+* @param[in]   u8Ring       - capture ring index
+*
+* @return   void
+*
+* @api
+*/
+/** @violates @ref Mcl_c_5 Violates MISRA 2004 Required Rule 8.10 could be made static */
+FUNC(void, MCL_CODE) Mcl_DmaCaptureStop(VAR(uint8, AUTOMATIC) u8Ring)
+{
+    P2VAR(Mcl_DmaCaptureRingStateType, AUTOMATIC, MCL_VAR) pRing;
+
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Mcl_ValidateGlobalCall(MCL_DMA_CAPTURE_STOP_ID_U8))
+    {
+#endif
+        if ((Std_ReturnType)E_OK == Mcl_DmaCaptureCheckRing(u8Ring, MCL_DMA_CAPTURE_STOP_ID_U8))
+        {
+            pRing = &Mcl_aDmaCaptureRing[u8Ring];
+            if ((boolean)TRUE == pRing->bActive)
+            {
+                eMios_SetDmaRequest(pRing->u8EmiosHwChannel, (boolean)FALSE);
+                Mcl_IPW_DmaDisableHwRequest(Mcl_pConfig->pMclDmaConfig->pMclDmaHwIpsConfig->pDma_Config, pRing->nChannel);
+                pRing->bActive = (boolean)FALSE;
+            }
+        }
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    }
+    MCL_ENDVALIDATEGLOBALCALL();
+#endif
+}
+
+/*================================================================================================*/
+/**
+* @brief    Mcl_DmaCaptureGetCount.
+* @details  Number of captures written to the ring and not read yet.
+*
+* @param[in]   u8Ring       - capture ring index
+*
+* @return   uint16        Number of entries Mcl_DmaCaptureRead() can return
+*
+* @api
+*/
+/** @violates @ref Mcl_c_5 Violates MISRA 2004 Required Rule 8.10 could be made static */
+FUNC(uint16, MCL_CODE) Mcl_DmaCaptureGetCount(VAR(uint8, AUTOMATIC) u8Ring)
+{
+    VAR(uint16, AUTOMATIC) u16Count = 0U;
+    VAR(uint16, AUTOMATIC) u16Write;
+    P2CONST(Mcl_DmaCaptureRingStateType, AUTOMATIC, MCL_VAR) pRing;
+
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Mcl_ValidateGlobalCall(MCL_DMA_CAPTURE_COUNT_ID_U8))
+    {
+#endif
+        if ((Std_ReturnType)E_OK == Mcl_DmaCaptureCheckRing(u8Ring, MCL_DMA_CAPTURE_COUNT_ID_U8))
+        {
+            pRing = &Mcl_aDmaCaptureRing[u8Ring];
+            if (0U != pRing->u16Length)
+            {
+                u16Write = Mcl_DmaCaptureWriteIndex(pRing);
+                u16Count = (uint16)(((uint32)u16Write + (uint32)pRing->u16Length - (uint32)pRing->u16Read) % \
+                                    (uint32)pRing->u16Length);
+            }
+        }
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    }
+    MCL_ENDVALIDATEGLOBALCALL();
+#endif
+
+    return u16Count;
+}
+
+/*================================================================================================*/
+/**
+* @brief    Mcl_DmaCaptureRead.
+* @details  Copies the oldest unread captures of the ring to pDest and releases them. The ring is
+*           filled by the eDma channel only and read by this service only, so no exclusive area
+*           is needed as long as a ring is read from a single task.
+*
+* @param[in]   u8Ring       - capture ring index
+* @param[out]  pDest        - destination of the captures
+* @param[in]   u16MaxCount  - number of entries pDest can hold
+*
+* @return   uint16        Number of captures copied to pDest
+*
+* @api
+*/
+/** @violates @ref Mcl_c_5 Violates MISRA 2004 Required Rule 8.10 could be made static */
+FUNC(uint16, MCL_CODE) Mcl_DmaCaptureRead
+(
+    VAR(uint8, AUTOMATIC) u8Ring,
+    P2VAR(uint32, AUTOMATIC, MCL_APPL_DATA) pDest,
+    VAR(uint16, AUTOMATIC) u16MaxCount
+)
+{
+    VAR(uint16, AUTOMATIC) u16Count = 0U;
+    VAR(uint16, AUTOMATIC) u16Write;
+    VAR(uint16, AUTOMATIC) u16Read;
+    P2VAR(Mcl_DmaCaptureRingStateType, AUTOMATIC, MCL_VAR) pRing;
+
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Mcl_ValidateGlobalCall(MCL_DMA_CAPTURE_READ_ID_U8))
+    {
+#endif
+        if ((Std_ReturnType)E_OK == Mcl_DmaCaptureCheckRing(u8Ring, MCL_DMA_CAPTURE_READ_ID_U8))
+        {
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+            if (NULL_PTR == pDest)
+            {
+                (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_DMA_CAPTURE_READ_ID_U8, (uint8)MCL_E_PARAM_POINTER_U8);
+            }
+            else
+            {
+#endif
+                pRing = &Mcl_aDmaCaptureRing[u8Ring];
+                if (0U != pRing->u16Length)
+                {
+                    u16Write = Mcl_DmaCaptureWriteIndex(pRing);
+                    u16Read = pRing->u16Read;
+                    while ((u16Read != u16Write) && (u16Count < u16MaxCount))
+                    {
+                        /** @violates @ref Mcl_c_12 Violates MISRA 2004 Rule 17.4, pointer arithmetic */
+                        pDest[u16Count] = pRing->pBuffer[u16Read];
+                        u16Count++;
+                        u16Read++;
+                        if (u16Read >= pRing->u16Length)
+                        {
+                            u16Read = 0U;
+                        }
+                    }
+                    pRing->u16Read = u16Read;
+                }
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+            }
+#endif
+        }
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    }
+    MCL_ENDVALIDATEGLOBALCALL();
+#endif
+
+    return u16Count;
+}
+#endif /* (MCL_DMA_CAPTURE_API == STD_ON) */
+
 #ifdef MCL_LOGICAL_ADDRESS_USED
 #if (MCL_LOGICAL_ADDRESS_USED == STD_ON)
 LOCAL_INLINE FUNC(uint32, MCL_CODE) Mcl_GetPhysicalAddress(VAR(uint32, AUTOMATIC) logicalAddr)
@@ -3042,6 +3995,119 @@ LOCAL_INLINE FUNC(uint32, MCL_CODE) Mcl_GetPhysicalAddress(VAR(uint32, AUTOMATIC
 #endif /*defined MCL_LOGICAL_ADDRESS_USED*/
 
 #endif /* (MCL_ENABLE_DMA == STD_ON) */
+
+#if (MCL_ENABLE_CROSSBAR == STD_ON)
+#if (MCL_CROSSBAR_PROFILE_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief    Mcl_SetCrossbarProfile.
+* @details  Switches the crossbar slave port priorities and parking to pProfile without
+*           re-initialising the driver, e.g. DMA first during communication bursts and core first
+*           during control loops. Profiles are user constants laid out as the crossbar
+*           configuration. The service is non reentrant: when two profiles are applied
+*           concurrently the ports can end up with a mix of both.
+*
+* @param[in]   pProfile     - crossbar profile to apply
+*
+* @return   Std_ReturnType
+*           E_OK        The profile is applied
+*           E_NOT_OK    A development error occurred or a slave port is locked
+*
+* @api
+*/
+/** @violates @ref Mcl_c_5 Violates MISRA 2004 Required Rule 8.10 could be made static */
+FUNC(Std_ReturnType, MCL_CODE) Mcl_SetCrossbarProfile
+(
+    P2CONST(Mcl_CrossbarProfileType, AUTOMATIC, MCL_APPL_CONST) pProfile
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturn = (Std_ReturnType)E_NOT_OK;
+
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Mcl_ValidateGlobalCall(MCL_SET_CROSSBAR_PROFILE_ID_U8))
+    {
+#endif
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+        if (NULL_PTR == pProfile)
+        {
+            (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_SET_CROSSBAR_PROFILE_ID_U8, (uint8)MCL_E_PARAM_POINTER_U8);
+        }
+        else
+        {
+#endif
+            eReturn = Mcl_IPW_Crossbar_SetProfile(pProfile);
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+        }
+#endif
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    }
+    MCL_ENDVALIDATEGLOBALCALL();
+#endif
+
+    return eReturn;
+}
+
+/*================================================================================================*/
+/**
+* @brief    Mcl_MeasureCrossbarLatency.
+* @details  Bus contention hook: reads u32Address u16Reads times and times every read with
+*           pfTimeSource, e.g. a STM or timebase counter. pLatency->u32MinTicks is the latency of
+*           an idle slave port and pLatency->u32MaxTicks - pLatency->u32MinTicks the longest time
+*           the core waited behind other masters. Run it with a profile applied and the traffic of
+*           interest running to compare profiles.
+*
+* @param[in]   u32Address   - address behind the slave port to measure, read as 32 bits
+* @param[in]   u16Reads     - number of timed reads
+* @param[in]   pfTimeSource - free running counter sampled around each read
+* @param[out]  pLatency     - minimum, maximum and total latency in time source ticks
+*
+* @return   Std_ReturnType
+*           E_OK        pLatency holds the measurement
+*           E_NOT_OK    A development error occurred
+*
+* @api
+*/
+/** @violates @ref Mcl_c_5 Violates MISRA 2004 Required Rule 8.10 could be made static */
+FUNC(Std_ReturnType, MCL_CODE) Mcl_MeasureCrossbarLatency
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint16, AUTOMATIC) u16Reads,
+    VAR(Mcl_CrossbarTimeSourceType, AUTOMATIC) pfTimeSource,
+    P2VAR(Mcl_CrossbarLatencyType, AUTOMATIC, MCL_APPL_DATA) pLatency
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturn = (Std_ReturnType)E_NOT_OK;
+
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    if ((Std_ReturnType)E_OK == Mcl_ValidateGlobalCall(MCL_MEASURE_CROSSBAR_LATENCY_ID_U8))
+    {
+#endif
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+        if ((NULL_PTR == pfTimeSource) || (NULL_PTR == pLatency))
+        {
+            (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_MEASURE_CROSSBAR_LATENCY_ID_U8, (uint8)MCL_E_PARAM_POINTER_U8);
+        }
+        else if (0U == u16Reads)
+        {
+            (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_MEASURE_CROSSBAR_LATENCY_ID_U8, (uint8)MCL_E_PARAM_LENGTH_U8);
+        }
+        else
+        {
+#endif
+            Mcl_IPW_Crossbar_MeasureLatency(u32Address, u16Reads, pfTimeSource, pLatency);
+            eReturn = (Std_ReturnType)E_OK;
+#if (MCL_DEV_ERROR_DETECT == STD_ON)
+        }
+#endif
+#if (MCL_VALIDATE_GLOBAL_CALL == STD_ON)
+    }
+    MCL_ENDVALIDATEGLOBALCALL();
+#endif
+
+    return eReturn;
+}
+#endif /* (MCL_CROSSBAR_PROFILE_API == STD_ON) */
+#endif /* (MCL_ENABLE_CROSSBAR == STD_ON) */
 /*================================================================================================*/
 /*=================================== CACHE API ===================================================*/
 
@@ -82,6 +82,7 @@ extern "C"{
 
 #include "Mcl_Axbs.h"
 #include "CDD_Mcl.h"
+#include "SchM_Mcl.h"
 #if (MCL_DEV_ERROR_DETECT == STD_ON)
 #include "Det.h"
 #endif
@@ -223,6 +224,11 @@ and comments before "#include"
 /*==================================================================================================
 *                                   LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
+static FUNC(Std_ReturnType, MCL_CODE) Axbs_ConfigurePorts
+(
+    P2CONST(Mcl_CrossbarConfigType, AUTOMATIC, MCL_APPL_CONST) pAxbsConfig,
+    VAR(uint8, AUTOMATIC) u8ServiceId
+);
 
 
 /*==================================================================================================
@@ -239,18 +245,23 @@ and comments before "#include"
 #include "MemMap.h"
 
 
-/*==================================================================================================
-*                                       GLOBAL FUNCTIONS
-==================================================================================================*/
-
 /**
-* @brief        This function initializes the AXBS module. 
-* @details     
+* @brief        Programs the slave and master ports of the crossbar.
+* @details      Slave ports whose CRS register is locked keep their current settings and are
+*               reported to Det against u8ServiceId.
 *
 * @param[in]    pAxbsConfig - pointer to Axbs configuration structure
+* @param[in]    u8ServiceId - service reporting the locked ports
+*
+* @return       E_OK all slave ports were programmed, E_NOT_OK at least one was locked
 */
-FUNC(void, MCL_CODE) Axbs_Init( P2CONST(Mcl_CrossbarConfigType, AUTOMATIC, MCL_APPL_CONST) pAxbsConfig)
+static FUNC(Std_ReturnType, MCL_CODE) Axbs_ConfigurePorts
+(
+    P2CONST(Mcl_CrossbarConfigType, AUTOMATIC, MCL_APPL_CONST) pAxbsConfig,
+    VAR(uint8, AUTOMATIC) u8ServiceId
+)
 {
+    VAR(Std_ReturnType, AUTOMATIC) eReturn = (Std_ReturnType)E_OK;
     /* @brief Counter value used in loops */
     VAR(uint8, AUTOMATIC) u8Counter;
     /* @brief Pointer to DMA channel specific configuration */
@@ -285,12 +296,13 @@ FUNC(void, MCL_CODE) Axbs_Init( P2CONST(Mcl_CrossbarConfigType, AUTOMATIC, MCL_A
             /** @violates @ref Mcl_AXBS_c_REF_11 MISRA 2004 Advisory Rule 11.3, A Cast should not be performed between a pointer type and an integral type */
             REG_WRITE32(AXBS_CRS_ADDR(pSlavePortConfig->Axbs_PortNumber, pSlavePortConfig->Axbs_InstanceNumber),pSlavePortConfig->Axbs_PortControlConfig);
         }
-#if (MCL_DEV_ERROR_DETECT == STD_ON)   
         else
         {   
-            (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, (uint8)MCL_INIT_ID_U8, (uint8)MCL_E_CRS_AXBS_LOCKED_U8);
-        }
+            eReturn = (Std_ReturnType)E_NOT_OK;
+#if (MCL_DEV_ERROR_DETECT == STD_ON)   
+            (void)Det_ReportError((uint16)MCL_MODULE_ID, 0U, u8ServiceId, (uint8)MCL_E_CRS_AXBS_LOCKED_U8);
 #endif        
+        }
     }
     
 #ifdef MCL_AXBS_ENABLE_INIT_MGPCR
@@ -309,8 +321,96 @@ FUNC(void, MCL_CODE) Axbs_Init( P2CONST(Mcl_CrossbarConfigType, AUTOMATIC, MCL_A
         }
     #endif
 #endif
+    return eReturn;
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+
+/**
+* @brief        This function initializes the AXBS module. 
+* @details     
+*
+* @param[in]    pAxbsConfig - pointer to Axbs configuration structure
+*/
+FUNC(void, MCL_CODE) Axbs_Init( P2CONST(Mcl_CrossbarConfigType, AUTOMATIC, MCL_APPL_CONST) pAxbsConfig)
+{
+    (void)Axbs_ConfigurePorts(pAxbsConfig, (uint8)MCL_INIT_ID_U8);
 }
 
+#ifdef MCL_CROSSBAR_PROFILE_API
+#if (STD_ON == MCL_CROSSBAR_PROFILE_API)
+/**
+* @brief        This function switches the AXBS to another priority and parking profile.
+* @details      The PRS and CRS registers are rewritten while the masters keep running, the new
+*               arbitration applies from the next transfer of each slave port.
+*
+* @param[in]    pProfile - pointer to the profile, laid out as the Axbs configuration structure
+*
+* @return       E_OK the profile was applied, E_NOT_OK at least one slave port was locked
+*/
+FUNC(Std_ReturnType, MCL_CODE) Axbs_SetProfile( P2CONST(Mcl_CrossbarConfigType, AUTOMATIC, MCL_APPL_CONST) pProfile)
+{
+    return Axbs_ConfigurePorts(pProfile, (uint8)MCL_SET_CROSSBAR_PROFILE_ID_U8);
+}
+
+/**
+* @brief        This function measures the latency of the core accesses to a crossbar slave.
+* @details      The AXBS has no wait counters, so the address is read u16Reads times and every
+*               read is timed with pfTimeSource. The fastest read is the latency of an idle slave
+*               port, the difference to the slowest one is the longest time the core waited for
+*               arbitration against the other masters. Interrupts are masked around each sample
+*               only, so an interrupt can neither inflate a sample nor be delayed for more than one
+*               read.
+*
+* @param[in]    u32Address   - address behind the slave port to measure, read as 32 bits
+* @param[in]    u16Reads     - number of timed reads, greater than zero
+* @param[in]    pfTimeSource - free running counter sampled around each read
+* @param[out]   pLatency     - minimum, maximum and total latency in time source ticks
+*/
+FUNC(void, MCL_CODE) Axbs_MeasureLatency
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint16, AUTOMATIC) u16Reads,
+    VAR(Mcl_AxbsTimeSourceType, AUTOMATIC) pfTimeSource,
+    P2VAR(Mcl_AxbsLatencyType, AUTOMATIC, MCL_APPL_DATA) pLatency
+)
+{
+    VAR(uint16, AUTOMATIC) u16Read;
+    VAR(uint32, AUTOMATIC) u32Start;
+    VAR(uint32, AUTOMATIC) u32Ticks;
+
+    pLatency->u32MinTicks = 0xFFFFFFFFUL;
+    pLatency->u32MaxTicks = 0UL;
+    pLatency->u32TotalTicks = 0UL;
+
+    for (u16Read = 0U; u16Read < u16Reads; u16Read++)
+    {
+        SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_34();
+        u32Start = pfTimeSource();
+        /** @violates @ref Mcl_AXBS_c_REF_10 Conversions shall not be performed between a pointer to a function and any type other than an integral type. */
+        /** @violates @ref Mcl_AXBS_c_REF_11 MISRA 2004 Advisory Rule 11.3, A Cast should not be performed between a pointer type and an integral type */
+        (void)REG_READ32(u32Address);
+        u32Ticks = pfTimeSource();
+        SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_34();
+        /* Unsigned difference, correct across one wrap of the counter */
+        u32Ticks -= u32Start;
+
+        if (u32Ticks < pLatency->u32MinTicks)
+        {
+            pLatency->u32MinTicks = u32Ticks;
+        }
+        if (u32Ticks > pLatency->u32MaxTicks)
+        {
+            pLatency->u32MaxTicks = u32Ticks;
+        }
+        pLatency->u32TotalTicks += u32Ticks;
+    }
+}
+#endif
+#endif
+
 #if (MCL_DEINIT_API == STD_ON)
 /**
 * @brief        This function de-initializes the AXBS module. 
@@ -1681,6 +1681,59 @@ FUNC(void, MCL_CODE) Mcl_IPW_Crossbar_DeInit( P2CONST( Mcl_CrossbarConfigType, A
 #endif /* MCL_ENABLE_USER_MODE_SUPPORT */   
 }
 #endif
+#if (MCL_CROSSBAR_PROFILE_API == STD_ON)
+/**
+ * @brief      Mcl_IPW_Crossbar_SetProfile
+ * @details    Apply a priority and parking profile to the crossbar module
+ *
+ * @param[in]      Mcl_CrossbarProfilePtr - pointer to Mcl crossbar profile
+ *
+ * @return Std_ReturnType
+ *
+ * @pre
+ *
+ */
+FUNC(Std_ReturnType, MCL_CODE) Mcl_IPW_Crossbar_SetProfile( P2CONST( Mcl_CrossbarProfileType, AUTOMATIC, MCL_APPL_CONST) Mcl_CrossbarProfilePtr)
+{
+    VAR(Std_ReturnType, AUTOMATIC) eReturn;
+#ifdef MCL_ENABLE_USER_MODE_SUPPORT
+#if (STD_ON == MCL_ENABLE_USER_MODE_SUPPORT)
+    eReturn = Mcal_Trusted_Call_Return(Axbs_SetProfile,(Mcl_CrossbarProfilePtr));
+#else
+    eReturn = Axbs_SetProfile(Mcl_CrossbarProfilePtr);
+#endif /* STD_ON == MCL_ENABLE_USER_MODE_SUPPORT */
+#else
+    eReturn = Axbs_SetProfile(Mcl_CrossbarProfilePtr);
+#endif /* MCL_ENABLE_USER_MODE_SUPPORT */
+    return eReturn;
+}
+
+/**
+ * @brief      Mcl_IPW_Crossbar_MeasureLatency
+ * @details    Time the core reads of an address behind a crossbar slave port
+ *
+ * @param[in]      u32Address   - address to read
+ * @param[in]      u16Reads     - number of timed reads
+ * @param[in]      pfTimeSource - free running counter
+ * @param[out]     pLatency     - measured latency
+ *
+ * @return void
+ *
+ * @pre
+ *
+ */
+FUNC(void, MCL_CODE) Mcl_IPW_Crossbar_MeasureLatency
+(
+    VAR(uint32, AUTOMATIC) u32Address,
+    VAR(uint16, AUTOMATIC) u16Reads,
+    VAR(Mcl_CrossbarTimeSourceType, AUTOMATIC) pfTimeSource,
+    P2VAR(Mcl_CrossbarLatencyType, AUTOMATIC, MCL_APPL_DATA) pLatency
+)
+{
+    /* The reads run in the caller mode, the measured address must be accessible from it */
+    Axbs_MeasureLatency(u32Address, u16Reads, pfTimeSource, pLatency);
+}
+#endif /* MCL_CROSSBAR_PROFILE_API == STD_ON */
 #endif
 
 #define MCL_STOP_SEC_CODE
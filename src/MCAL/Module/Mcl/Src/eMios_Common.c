@@ -70,6 +70,21 @@ extern "C"{
 * Violates MISRA 2004 Required Rule 12.4, side effects on right hand of logical operator: '||'
 * This violation  is not fixed since  the functions execution is not mandatory, both left hand and
 * right hand side of logical operator && are checking some status values
+*
+* @section eMios_Common_c_9
+* Violates MISRA 2004 Advisory Rule 19.7, A function should be used in preference to a
+* function-like macro. The interrupt vectors are instantiated from a single template macro so that
+* every vector has the same body.
+*
+* @section eMios_Common_c_10
+* Violates MISRA 2004 Advisory Rule 19.13, The # and ## preprocessor operators should not be used.
+* The ## operator builds the interrupt vector names expected by the interrupt controller table and
+* the names of the generated channel switches.
+*
+* @section eMios_Common_c_11
+* Violates MISRA 2004 Required Rule 1.1, All code shall conform to ISO 9899:1990.
+* A variadic macro (ISO 9899:1999) tells a generated switch defined empty from an undefined one,
+* so that the channel handlers are selected without a preprocessor conditional per channel.
 */
 
 
@@ -242,6 +257,54 @@ extern "C"{
 *                          LOCAL TYPEDEFS (STRUCTURES, UNIONS, ENUMS)
 ==================================================================================================*/
 
+/*==================================================================================================
+*                                       LOCAL MACROS
+==================================================================================================*/
+/*
+* @brief Handler each unified channel is bound to before any driver registers one.
+* @details The Pwm and Icu drivers do not call eMios_SetIrqHandler(), so their interrupt channels
+*          are bound at build time from their *_ISR_USED configuration. Gpt channels are
+*          registered by Gpt_eMios_Init(). EMIOS_IS_SET() turns a generated switch, defined empty,
+*          into 1 and an undefined one into 0. The four bits of a channel (Gpt used, Pwm used,
+*          Icu with interrupt, Pwm with interrupt) select its EMIOS_HANDLER_xxxx entry. A channel
+*          claimed by two drivers selects an undeclared identifier naming the conflict, which
+*          stops the build.
+* @violates @ref eMios_Common_c_9 Function-like macro defined
+* @violates @ref eMios_Common_c_10 Use of ## operator
+* @violates @ref eMios_Common_c_11 Variable number of macro arguments
+*/
+#define EMIOS_SECOND_I(a, b, ...)   b
+#define EMIOS_SECOND(...)           EMIOS_SECOND_I(__VA_ARGS__)
+#define EMIOS_PROBE_                ~, 1
+#define EMIOS_IS_SET_I(sw)          EMIOS_SECOND(EMIOS_PROBE_##sw, 0, ~)
+#define EMIOS_IS_SET(sw)            EMIOS_IS_SET_I(sw)
+
+#define EMIOS_HANDLER_0000          (NULL_PTR)
+#define EMIOS_HANDLER_0001          (&Pwm_eMios_ProcessCommonInterrupt)
+#define EMIOS_HANDLER_0010          (&Icu_eMios_ProcessCommonInterrupt)
+#define EMIOS_HANDLER_0011          (EMIOS_PWM_AND_ICU_RESOURCE_CONFLICT)
+#define EMIOS_HANDLER_0100          (NULL_PTR)
+#define EMIOS_HANDLER_0101          (&Pwm_eMios_ProcessCommonInterrupt)
+#define EMIOS_HANDLER_0110          (EMIOS_PWM_AND_ICU_RESOURCE_CONFLICT)
+#define EMIOS_HANDLER_0111          (EMIOS_PWM_AND_ICU_RESOURCE_CONFLICT)
+#define EMIOS_HANDLER_1000          (NULL_PTR)
+#define EMIOS_HANDLER_1001          (EMIOS_GPT_AND_PWM_RESOURCE_CONFLICT)
+#define EMIOS_HANDLER_1010          (EMIOS_GPT_AND_ICU_RESOURCE_CONFLICT)
+#define EMIOS_HANDLER_1011          (EMIOS_GPT_PWM_AND_ICU_RESOURCE_CONFLICT)
+#define EMIOS_HANDLER_1100          (EMIOS_GPT_AND_PWM_RESOURCE_CONFLICT)
+#define EMIOS_HANDLER_1101          (EMIOS_GPT_AND_PWM_RESOURCE_CONFLICT)
+#define EMIOS_HANDLER_1110          (EMIOS_GPT_PWM_AND_ICU_RESOURCE_CONFLICT)
+#define EMIOS_HANDLER_1111          (EMIOS_GPT_PWM_AND_ICU_RESOURCE_CONFLICT)
+
+#define EMIOS_HANDLER_SELECT_I(gpt, pwm, icu, pwmisr)   EMIOS_HANDLER_##gpt##pwm##icu##pwmisr
+#define EMIOS_HANDLER_SELECT(gpt, pwm, icu, pwmisr)     EMIOS_HANDLER_SELECT_I(gpt, pwm, icu, pwmisr)
+
+#define EMIOS_STATIC_HANDLER(mod, ch) \
+    EMIOS_HANDLER_SELECT(EMIOS_IS_SET(GPT_EMIOS_##mod##_CH_##ch##_USED), \
+                         EMIOS_IS_SET(PWM_EMIOS_##mod##_CH_##ch##_USED), \
+                         EMIOS_IS_SET(ICU_EMIOS_##mod##_CH_##ch##_ISR_USED), \
+                         EMIOS_IS_SET(PWM_EMIOS_##mod##_CH_##ch##_ISR_USED))
+
 /*==================================================================================================
 *                                       LOCAL CONSTANTS
 ==================================================================================================*/
@@ -249,6 +312,57 @@ extern "C"{
 /*==================================================================================================
 *                                       LOCAL VARIABLES
 ==================================================================================================*/
+#define MCL_START_SEC_VAR_INIT_UNSPECIFIED
+/**@violates @ref eMios_Common_c_1 only preprocessor statements and comments before "#include"
+ **@violates @ref eMios_Common_c_2 Precautions shall be taken in order to prevent...*/
+#include "MemMap.h"
+
+/**
+* @brief   Interrupt handler of each eMios unified channel.
+* @details Filled in by the driver owning the channel when it initializes the channel, through
+*          eMios_SetIrqHandler(), or bound at build time for the Pwm and Icu channels. The flags
+*          of a channel without a handler are cleared by the vectors, as long as the channel
+*          requests an interrupt (CCR FEN set, DMA clear).
+*/
+static VAR(eMios_IrqHandlerType, MCL_VAR) \
+    eMios_apfIrqHandler[EMIOS_IRQ_MODULE_COUNT_U8][EMIOS_IRQ_CHANNEL_COUNT_U8] =
+{
+    {
+        EMIOS_STATIC_HANDLER(0, 0), EMIOS_STATIC_HANDLER(0, 1), EMIOS_STATIC_HANDLER(0, 2), EMIOS_STATIC_HANDLER(0, 3),
+        EMIOS_STATIC_HANDLER(0, 4), EMIOS_STATIC_HANDLER(0, 5), EMIOS_STATIC_HANDLER(0, 6), EMIOS_STATIC_HANDLER(0, 7),
+        EMIOS_STATIC_HANDLER(0, 8), EMIOS_STATIC_HANDLER(0, 9), EMIOS_STATIC_HANDLER(0, 10), EMIOS_STATIC_HANDLER(0, 11),
+        EMIOS_STATIC_HANDLER(0, 12), EMIOS_STATIC_HANDLER(0, 13), EMIOS_STATIC_HANDLER(0, 14), EMIOS_STATIC_HANDLER(0, 15),
+        EMIOS_STATIC_HANDLER(0, 16), EMIOS_STATIC_HANDLER(0, 17), EMIOS_STATIC_HANDLER(0, 18), EMIOS_STATIC_HANDLER(0, 19),
+        EMIOS_STATIC_HANDLER(0, 20), EMIOS_STATIC_HANDLER(0, 21), EMIOS_STATIC_HANDLER(0, 22), EMIOS_STATIC_HANDLER(0, 23),
+        EMIOS_STATIC_HANDLER(0, 24), EMIOS_STATIC_HANDLER(0, 25), EMIOS_STATIC_HANDLER(0, 26), EMIOS_STATIC_HANDLER(0, 27),
+        EMIOS_STATIC_HANDLER(0, 28), EMIOS_STATIC_HANDLER(0, 29), EMIOS_STATIC_HANDLER(0, 30), EMIOS_STATIC_HANDLER(0, 31)
+    },
+    {
+        EMIOS_STATIC_HANDLER(1, 0), EMIOS_STATIC_HANDLER(1, 1), EMIOS_STATIC_HANDLER(1, 2), EMIOS_STATIC_HANDLER(1, 3),
+        EMIOS_STATIC_HANDLER(1, 4), EMIOS_STATIC_HANDLER(1, 5), EMIOS_STATIC_HANDLER(1, 6), EMIOS_STATIC_HANDLER(1, 7),
+        EMIOS_STATIC_HANDLER(1, 8), EMIOS_STATIC_HANDLER(1, 9), EMIOS_STATIC_HANDLER(1, 10), EMIOS_STATIC_HANDLER(1, 11),
+        EMIOS_STATIC_HANDLER(1, 12), EMIOS_STATIC_HANDLER(1, 13), EMIOS_STATIC_HANDLER(1, 14), EMIOS_STATIC_HANDLER(1, 15),
+        EMIOS_STATIC_HANDLER(1, 16), EMIOS_STATIC_HANDLER(1, 17), EMIOS_STATIC_HANDLER(1, 18), EMIOS_STATIC_HANDLER(1, 19),
+        EMIOS_STATIC_HANDLER(1, 20), EMIOS_STATIC_HANDLER(1, 21), EMIOS_STATIC_HANDLER(1, 22), EMIOS_STATIC_HANDLER(1, 23),
+        EMIOS_STATIC_HANDLER(1, 24), EMIOS_STATIC_HANDLER(1, 25), EMIOS_STATIC_HANDLER(1, 26), EMIOS_STATIC_HANDLER(1, 27),
+        EMIOS_STATIC_HANDLER(1, 28), EMIOS_STATIC_HANDLER(1, 29), EMIOS_STATIC_HANDLER(1, 30), EMIOS_STATIC_HANDLER(1, 31)
+    },
+    {
+        EMIOS_STATIC_HANDLER(2, 0), EMIOS_STATIC_HANDLER(2, 1), EMIOS_STATIC_HANDLER(2, 2), EMIOS_STATIC_HANDLER(2, 3),
+        EMIOS_STATIC_HANDLER(2, 4), EMIOS_STATIC_HANDLER(2, 5), EMIOS_STATIC_HANDLER(2, 6), EMIOS_STATIC_HANDLER(2, 7),
+        EMIOS_STATIC_HANDLER(2, 8), EMIOS_STATIC_HANDLER(2, 9), EMIOS_STATIC_HANDLER(2, 10), EMIOS_STATIC_HANDLER(2, 11),
+        EMIOS_STATIC_HANDLER(2, 12), EMIOS_STATIC_HANDLER(2, 13), EMIOS_STATIC_HANDLER(2, 14), EMIOS_STATIC_HANDLER(2, 15),
+        EMIOS_STATIC_HANDLER(2, 16), EMIOS_STATIC_HANDLER(2, 17), EMIOS_STATIC_HANDLER(2, 18), EMIOS_STATIC_HANDLER(2, 19),
+        EMIOS_STATIC_HANDLER(2, 20), EMIOS_STATIC_HANDLER(2, 21), EMIOS_STATIC_HANDLER(2, 22), EMIOS_STATIC_HANDLER(2, 23),
+        EMIOS_STATIC_HANDLER(2, 24), EMIOS_STATIC_HANDLER(2, 25), EMIOS_STATIC_HANDLER(2, 26), EMIOS_STATIC_HANDLER(2, 27),
+        EMIOS_STATIC_HANDLER(2, 28), EMIOS_STATIC_HANDLER(2, 29), EMIOS_STATIC_HANDLER(2, 30), EMIOS_STATIC_HANDLER(2, 31)
+    }
+};
+
+#define MCL_STOP_SEC_VAR_INIT_UNSPECIFIED
+/**@violates @ref eMios_Common_c_1 only preprocessor statements and comments before "#include"
+ **@violates @ref eMios_Common_c_2 Precautions shall be taken in order to prevent...*/
+#include "MemMap.h"
 
 /*==================================================================================================
 *                                       GLOBAL CONSTANTS
@@ -305,10 +419,118 @@ CONST(uint32, MCL_CONST) EMIOS_BASE_ADDR32[] =
 /*==================================================================================================
 *                                   LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
+#define MCL_START_SEC_CODE
+/**@violates @ref eMios_Common_c_1 only preprocessor statements and comments before "#include"
+ **@violates @ref eMios_Common_c_2 Precautions shall be taken in order to prevent...*/
+#include "MemMap.h"
+
+#ifdef EMIOS_COMMON_ISR_HANDLER
+static FUNC(void, MCL_CODE) eMios_DispatchChannel(VAR(uint8, AUTOMATIC) u8ModuleIdx,
+                                                  VAR(uint8, AUTOMATIC) u8ChannelIdx);
+#if (EMIOS_COMMON_ISR_HANDLER == STD_ON)
+static FUNC(void, MCL_CODE) eMios_ProcessCommonInterrupt(VAR(uint8, AUTOMATIC) u8ModuleIdx,
+                                                         VAR(uint8, AUTOMATIC) u8FirstChannel);
+#else
+static FUNC(void, MCL_CODE) eMios_ProcessChannelInterrupt(VAR(uint8, AUTOMATIC) u8ModuleIdx,
+                                                          VAR(uint8, AUTOMATIC) u8ChannelIdx);
+#endif
+#endif
+
+#define MCL_STOP_SEC_CODE
+/**@violates @ref eMios_Common_c_1 only preprocessor statements and comments before "#include"
+ **@violates @ref eMios_Common_c_2 Precautions shall be taken in order to prevent...*/
+#include "MemMap.h"
 
 /*==================================================================================================
 *                                       LOCAL FUNCTIONS
 ==================================================================================================*/
+#define MCL_START_SEC_CODE
+/**@violates @ref eMios_Common_c_1 only preprocessor statements and comments before "#include"
+ **@violates @ref eMios_Common_c_2 Precautions shall be taken in order to prevent...*/
+#include "MemMap.h"
+
+#ifdef EMIOS_COMMON_ISR_HANDLER
+/**
+* @brief   Services a flagged unified channel.
+* @details The handler is only called when the channel flag requests an interrupt (CCR[FEN] set,
+*          CCR[DMA] cleared), so that the flag of a channel routed to DMA is left to its eDma
+*          channel and the flag of a channel polled with FEN cleared is left to its driver. A
+*          channel requesting an interrupt without handler has its flags cleared, otherwise the
+*          vector is raised again as soon as it returns.
+*
+* @param[in]     u8ModuleIdx      eMios module index
+* @param[in]     u8ChannelIdx     flagged unified channel
+*/
+static FUNC(void, MCL_CODE) eMios_DispatchChannel(VAR(uint8, AUTOMATIC) u8ModuleIdx,
+                                                  VAR(uint8, AUTOMATIC) u8ChannelIdx)
+{
+    CONST(eMios_IrqHandlerType, AUTOMATIC) pfHandler = eMios_apfIrqHandler[u8ModuleIdx][u8ChannelIdx];
+
+    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
+    if ((REG_READ32(EMIOS_CCR_ADDR32(u8ModuleIdx, u8ChannelIdx)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
+        ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | (CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT)))
+    {
+        if (NULL_PTR != pfHandler)
+        {
+            pfHandler((uint8)((uint8)(u8ModuleIdx << EMIOS_MOD_SHIFT) + u8ChannelIdx));
+        }
+        else
+        {
+            /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
+            REG_WRITE32(EMIOS_CSR_ADDR32(u8ModuleIdx, u8ChannelIdx), \
+                        REG_READ32(EMIOS_CSR_ADDR32(u8ModuleIdx, u8ChannelIdx)) & \
+                        (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
+        }
+    }
+}
+
+#if (EMIOS_COMMON_ISR_HANDLER == STD_ON)
+/**
+* @brief   Services the two unified channels sharing one eMios interrupt vector.
+* @details The flags of both channels are taken from a single read of the module global flag
+*          register, and each flagged channel is passed to eMios_DispatchChannel().
+*
+* @param[in]     u8ModuleIdx      eMios module index
+* @param[in]     u8FirstChannel   first (even) unified channel served by the vector
+*/
+static FUNC(void, MCL_CODE) eMios_ProcessCommonInterrupt(VAR(uint8, AUTOMATIC) u8ModuleIdx,
+                                                         VAR(uint8, AUTOMATIC) u8FirstChannel)
+{
+    VAR(uint32, AUTOMATIC) u32Pending;
+    VAR(uint8, AUTOMATIC)  u8ChannelIdx = u8FirstChannel;
+
+    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
+    u32Pending = (REG_READ32(EMIOS_GFR_ADDR32(u8ModuleIdx)) >> u8FirstChannel) & (uint32)(BIT1 | BIT0);
+
+    while (0U != u32Pending)
+    {
+        if (0U != (u32Pending & (uint32)BIT0))
+        {
+            eMios_DispatchChannel(u8ModuleIdx, u8ChannelIdx);
+        }
+        u32Pending >>= 1U;
+        u8ChannelIdx++;
+    }
+}
+#else
+/**
+* @brief   Services the unified channel owning an independent eMios interrupt vector.
+*
+* @param[in]     u8ModuleIdx      eMios module index
+* @param[in]     u8ChannelIdx     unified channel served by the vector
+*/
+static FUNC(void, MCL_CODE) eMios_ProcessChannelInterrupt(VAR(uint8, AUTOMATIC) u8ModuleIdx,
+                                                          VAR(uint8, AUTOMATIC) u8ChannelIdx)
+{
+    eMios_DispatchChannel(u8ModuleIdx, u8ChannelIdx);
+}
+#endif
+#endif
+
+#define MCL_STOP_SEC_CODE
+/**@violates @ref eMios_Common_c_1 only preprocessor statements and comments before "#include"
+ **@violates @ref eMios_Common_c_2 Precautions shall be taken in order to prevent...*/
+#include "MemMap.h"
 
 /*==================================================================================================
 *                                   GLOBAL FUNCTIONS PROTOTYPES
@@ -681,10805 +903,737 @@ FUNC (void, MCL_CODE) eMios_StopChannel(VAR(uint8, AUTOMATIC) u8HwChannel)
 #endif  /* EMIOS_UCDIS_AVAILABLE */
 #endif
 
-#ifdef EMIOS_COMMON_ISR_HANDLER
-#if  (EMIOS_COMMON_ISR_HANDLER == STD_ON)
-/*==================================================================================================*/
-/*                    COMMON EMIOS CHANNELS INTERRUPT SERVICE ROUTINES DEFINITION                   */
-/*==================================================================================================*/
-/*********************************** EMIOS 0 common interrupts START ******************************/
 /**
-* @brief EMIOS module:0 channels:0,1 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_0
-*/
-#if  ((defined GPT_EMIOS_0_CH_0_USED) && (defined PWM_EMIOS_0_CH_0_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_0"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_0_USED) && (defined ICU_EMIOS_0_CH_0_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_0"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_0_ISR_USED) && (defined GPT_EMIOS_0_CH_0_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_0"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_1
+* @brief   eMios channel interrupt handler registration.
+* @details Called by the driver owning a unified channel when it initializes the channel, so the
+*          eMios interrupt vectors can dispatch to it without testing the configuration. Passing
+*          NULL_PTR detaches the channel, whose flags are then only cleared by the vectors while
+*          the channel requests an interrupt.
+*          Channels of modules without interrupt vectors are ignored.
+*
+* @param[in]     u8HwChannel      Emios hw channel ID
+* @param[in]     pfHandler        handler called when the channel flag requests an interrupt, or NULL_PTR
+*
 */
-#if  ((defined GPT_EMIOS_0_CH_1_USED) && (defined PWM_EMIOS_0_CH_1_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_1"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_1_USED) && (defined ICU_EMIOS_0_CH_1_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_1"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_1_ISR_USED) && (defined GPT_EMIOS_0_CH_1_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_1"
-#endif
+FUNC (void, MCL_CODE) eMios_SetIrqHandler(VAR(uint8, AUTOMATIC) u8HwChannel,
+                                          VAR(eMios_IrqHandlerType, AUTOMATIC) pfHandler)
+{
+    CONST(uint8, AUTOMATIC) u8ModuleIdx  = (uint8)(EMIOS_MODULE_INDEX_U8(u8HwChannel));
+    CONST(uint8, AUTOMATIC) u8ChannelIdx = (uint8)(EMIOS_CHANNEL_INDEX_U8(u8HwChannel));
 
-#if ( (defined GPT_EMIOS_0_CH_0_ISR_USED) || (defined GPT_EMIOS_0_CH_1_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_0_ISR_USED) || (defined PWM_EMIOS_0_CH_1_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_0_ISR_USED) || (defined ICU_EMIOS_0_CH_1_ISR_USED) )
+    if (u8ModuleIdx < EMIOS_IRQ_MODULE_COUNT_U8)
+    {
+        eMios_apfIrqHandler[u8ModuleIdx][u8ChannelIdx] = pfHandler;
+    }
+}
 
-/*================================================================================================*/
 /**
-* @brief     Interrupt handler for eMios channels : 0 and 1 for eMios_0 module
-* @details   Process the interrupt of eMios channels 0 and 1
-* @note   This will be defined only if eMios channels 0 or 1 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro
+* @brief   eMios channel DMA request routing.
+* @details Routes the flag of a unified channel to its DMA request instead of its interrupt, so
+*          every event of the channel is served by the eDma channel attached to it. Disabling the
+*          routing also disables the flag request, the owning driver enables it again if needed.
+*
+* @param[in]     u8HwChannel      Emios hw channel ID
+* @param[in]     bEnable          TRUE to route the flag to DMA, FALSE to stop flag requests
+*
 */
-ISR(EMIOS_0_CH_0_CH_1_ISR)
+FUNC (void, MCL_CODE) eMios_SetDmaRequest(VAR(uint8, AUTOMATIC) u8HwChannel,
+                                          VAR(boolean, AUTOMATIC) bEnable)
 {
-     #if ( (defined GPT_EMIOS_0_CH_0_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_0_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_0_ISR_USED) )
+    CONST(uint8, AUTOMATIC) u8ModuleIdx  = (uint8)(EMIOS_MODULE_INDEX_U8(u8HwChannel));
+    CONST(uint8, AUTOMATIC) u8ChannelIdx = (uint8)(EMIOS_CHANNEL_INDEX_U8(u8HwChannel));
 
-    /* Check if match event occured on EMIOS_0 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 0)) & CSR_FLAG_MASK_U32) != 0U )
+    SchM_Enter_Mcl_MCL_EXCLUSIVE_AREA_33();
+    if ((boolean)TRUE == bEnable)
     {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_0 */
+        /* Drop an event latched before the DMA channel was ready */
         /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 0)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-           ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_0_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_0);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_0_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_0);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_0_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_0);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 0),REG_READ32(EMIOS_CSR_ADDR32(0, 0)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
+        REG_WRITE32(EMIOS_CSR_ADDR32(u8ModuleIdx, u8ChannelIdx), CSR_FLAG_MASK_U32);
+        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
+        REG_BIT_SET32(EMIOS_CCR_ADDR32(u8ModuleIdx, u8ChannelIdx), (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32));
     }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_1_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_1_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_1_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_1 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer */
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 1)) & CSR_FLAG_MASK_U32) != 0U )
+    else
     {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_1 */
         /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 1)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_1_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_1);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_1_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_1);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_1_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_1);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 1),REG_READ32(EMIOS_CSR_ADDR32(0, 1)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
+        REG_BIT_CLEAR32(EMIOS_CCR_ADDR32(u8ModuleIdx, u8ChannelIdx), (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32));
     }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
+    SchM_Exit_Mcl_MCL_EXCLUSIVE_AREA_33();
 }
-#endif
-
 
+#ifdef EMIOS_COMMON_ISR_HANDLER
+#if  (EMIOS_COMMON_ISR_HANDLER == STD_ON)
+/*==================================================================================================*/
+/*                    COMMON EMIOS CHANNELS INTERRUPT SERVICE ROUTINES DEFINITION                   */
+/*==================================================================================================*/
 /**
-* @brief EMIOS module:0 channels:2,3 common interrupt handler
+* @brief   Interrupt handler template for eMios module mod, channels chA and chB.
+* @details Instantiated below only for the vectors having at least one channel configured in GPT,
+*          ICU or PWM mode with interrupt.
+* @violates @ref eMios_Common_c_5 This is not a standard library macro
+* @violates @ref eMios_Common_c_9 Function-like macro defined
+* @violates @ref eMios_Common_c_10 Use of ## operator
 */
+#define EMIOS_COMMON_ISR(mod, chA, chB) \
+ISR(EMIOS_##mod##_CH_##chA##_CH_##chB##_ISR) \
+{ \
+    eMios_ProcessCommonInterrupt((uint8)(mod##U), (uint8)(chA##U)); \
+    EXIT_INTERRUPT(); \
+}
 
-/*
-* @brief resource conflict check for EMIOS_0_CH_2
-*/
-#if  ((defined GPT_EMIOS_0_CH_2_USED) && (defined PWM_EMIOS_0_CH_2_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_2"
+#if ( (defined GPT_EMIOS_0_CH_0_ISR_USED) || (defined GPT_EMIOS_0_CH_1_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_0_ISR_USED) || (defined PWM_EMIOS_0_CH_1_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_0_ISR_USED) || (defined ICU_EMIOS_0_CH_1_ISR_USED) )
+EMIOS_COMMON_ISR(0, 0, 1)
 #endif
-
-#if  ((defined PWM_EMIOS_0_CH_2_USED) && (defined ICU_EMIOS_0_CH_2_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_2"
+#if ( (defined GPT_EMIOS_0_CH_2_ISR_USED) || (defined GPT_EMIOS_0_CH_3_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_2_ISR_USED) || (defined PWM_EMIOS_0_CH_3_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_2_ISR_USED) || (defined ICU_EMIOS_0_CH_3_ISR_USED) )
+EMIOS_COMMON_ISR(0, 2, 3)
 #endif
-
-#if  ((defined ICU_EMIOS_0_CH_2_ISR_USED) && (defined GPT_EMIOS_0_CH_2_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_2"
+#if ( (defined GPT_EMIOS_0_CH_4_ISR_USED) || (defined GPT_EMIOS_0_CH_5_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_4_ISR_USED) || (defined PWM_EMIOS_0_CH_5_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_4_ISR_USED) || (defined ICU_EMIOS_0_CH_5_ISR_USED) )
+EMIOS_COMMON_ISR(0, 4, 5)
 #endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_3
-*/
-#if  ((defined GPT_EMIOS_0_CH_3_USED) && (defined PWM_EMIOS_0_CH_3_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_3"
+#if ( (defined GPT_EMIOS_0_CH_6_ISR_USED) || (defined GPT_EMIOS_0_CH_7_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_6_ISR_USED) || (defined PWM_EMIOS_0_CH_7_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_6_ISR_USED) || (defined ICU_EMIOS_0_CH_7_ISR_USED) )
+EMIOS_COMMON_ISR(0, 6, 7)
 #endif
-
-#if  ((defined PWM_EMIOS_0_CH_3_USED) && (defined ICU_EMIOS_0_CH_3_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_3"
+#if ( (defined GPT_EMIOS_0_CH_8_ISR_USED) || (defined GPT_EMIOS_0_CH_9_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_8_ISR_USED) || (defined PWM_EMIOS_0_CH_9_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_8_ISR_USED) || (defined ICU_EMIOS_0_CH_9_ISR_USED) )
+EMIOS_COMMON_ISR(0, 8, 9)
 #endif
-
-#if  ((defined ICU_EMIOS_0_CH_3_ISR_USED) && (defined GPT_EMIOS_0_CH_3_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_3"
+#if ( (defined GPT_EMIOS_0_CH_10_ISR_USED) || (defined GPT_EMIOS_0_CH_11_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_10_ISR_USED) || (defined PWM_EMIOS_0_CH_11_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_10_ISR_USED) || (defined ICU_EMIOS_0_CH_11_ISR_USED) )
+EMIOS_COMMON_ISR(0, 10, 11)
 #endif
-
-#if ( (defined GPT_EMIOS_0_CH_2_ISR_USED) || (defined GPT_EMIOS_0_CH_3_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_2_ISR_USED) || (defined PWM_EMIOS_0_CH_3_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_2_ISR_USED) || (defined ICU_EMIOS_0_CH_3_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 2 and 3 for eMios_0 module
-* @details   Process the interrupt of eMios channels 2 and 3
-*
-* @note   This will be defined only if eMios channels 2 or 3 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro
-*/
-ISR(EMIOS_0_CH_2_CH_3_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_2_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_2_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_2_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_2 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer */
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 2)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_2 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 2)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_2_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_2);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_2_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_2);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_2_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_2);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 2),REG_READ32(EMIOS_CSR_ADDR32(0, 2)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_3_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_3_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_3_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_3 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer */
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 3)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_3 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 3)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_3_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_3);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_3_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_3);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_3_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_3);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 3),REG_READ32(EMIOS_CSR_ADDR32(0, 3)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer
-     ** @violates @ref eMios_Common_c_4, Implicit conversion changes signedness */
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_0_CH_12_ISR_USED) || (defined GPT_EMIOS_0_CH_13_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_12_ISR_USED) || (defined PWM_EMIOS_0_CH_13_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_12_ISR_USED) || (defined ICU_EMIOS_0_CH_13_ISR_USED) )
+EMIOS_COMMON_ISR(0, 12, 13)
 #endif
-
-
-/*
-* @brief EMIOS module:0 channels:4,5 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_4
-*/
-#if  ((defined GPT_EMIOS_0_CH_4_USED) && (defined PWM_EMIOS_0_CH_4_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_4"
+#if ( (defined GPT_EMIOS_0_CH_14_ISR_USED) || (defined GPT_EMIOS_0_CH_15_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_14_ISR_USED) || (defined PWM_EMIOS_0_CH_15_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_14_ISR_USED) || (defined ICU_EMIOS_0_CH_15_ISR_USED) )
+EMIOS_COMMON_ISR(0, 14, 15)
 #endif
-
-#if  ((defined PWM_EMIOS_0_CH_4_USED) && (defined ICU_EMIOS_0_CH_4_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_4"
+#if ( (defined GPT_EMIOS_0_CH_16_ISR_USED) || (defined GPT_EMIOS_0_CH_17_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_16_ISR_USED) || (defined PWM_EMIOS_0_CH_17_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_16_ISR_USED) || (defined ICU_EMIOS_0_CH_17_ISR_USED) )
+EMIOS_COMMON_ISR(0, 16, 17)
 #endif
-
-#if  ((defined ICU_EMIOS_0_CH_4_ISR_USED) && (defined GPT_EMIOS_0_CH_4_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_4"
+#if ( (defined GPT_EMIOS_0_CH_18_ISR_USED) || (defined GPT_EMIOS_0_CH_19_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_18_ISR_USED) || (defined PWM_EMIOS_0_CH_19_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_18_ISR_USED) || (defined ICU_EMIOS_0_CH_19_ISR_USED) )
+EMIOS_COMMON_ISR(0, 18, 19)
 #endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_5
-*/
-#if  ((defined GPT_EMIOS_0_CH_5_USED) && (defined PWM_EMIOS_0_CH_5_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_5"
+#if ( (defined GPT_EMIOS_0_CH_20_ISR_USED) || (defined GPT_EMIOS_0_CH_21_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_20_ISR_USED) || (defined PWM_EMIOS_0_CH_21_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_20_ISR_USED) || (defined ICU_EMIOS_0_CH_21_ISR_USED) )
+EMIOS_COMMON_ISR(0, 20, 21)
 #endif
-
-#if  ((defined PWM_EMIOS_0_CH_5_USED) && (defined ICU_EMIOS_0_CH_5_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_5"
+#if ( (defined GPT_EMIOS_0_CH_22_ISR_USED) || (defined GPT_EMIOS_0_CH_23_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_22_ISR_USED) || (defined PWM_EMIOS_0_CH_23_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_22_ISR_USED) || (defined ICU_EMIOS_0_CH_23_ISR_USED) )
+EMIOS_COMMON_ISR(0, 22, 23)
 #endif
-
-#if  ((defined ICU_EMIOS_0_CH_5_ISR_USED) && (defined GPT_EMIOS_0_CH_5_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_5"
+#if ( (defined GPT_EMIOS_0_CH_24_ISR_USED) || (defined GPT_EMIOS_0_CH_25_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_24_ISR_USED) || (defined PWM_EMIOS_0_CH_25_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_24_ISR_USED) || (defined ICU_EMIOS_0_CH_25_ISR_USED) )
+EMIOS_COMMON_ISR(0, 24, 25)
 #endif
-
-#if ( (defined GPT_EMIOS_0_CH_4_ISR_USED) || (defined GPT_EMIOS_0_CH_5_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_4_ISR_USED) || (defined PWM_EMIOS_0_CH_5_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_4_ISR_USED) || (defined ICU_EMIOS_0_CH_5_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 4 and 5 for eMios_0 module
-* @details   Process the interrupt of eMios channels 4 and 5
-*
-* @note   This will be defined only if eMios channels 4 or 5 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_4_CH_5_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_4_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_4_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_4_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_4 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 4)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_4 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 4)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_4_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_4);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_4_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_4);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_4_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_4);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 4),REG_READ32(EMIOS_CSR_ADDR32(0, 4)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_5_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_5_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_5_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_5 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 5)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_5 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 5)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_5_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_5);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_5_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_5);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_5_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_5);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 5),REG_READ32(EMIOS_CSR_ADDR32(0, 5)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:6,7 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_6
-*/
-#if  ((defined GPT_EMIOS_0_CH_6_USED) && (defined PWM_EMIOS_0_CH_6_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_6"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_6_USED) && (defined ICU_EMIOS_0_CH_6_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_6"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_6_ISR_USED) && (defined GPT_EMIOS_0_CH_6_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_6"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_7
-*/
-#if  ((defined GPT_EMIOS_0_CH_7_USED) && (defined PWM_EMIOS_0_CH_7_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_7"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_7_USED) && (defined ICU_EMIOS_0_CH_7_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_7"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_7_ISR_USED) && (defined GPT_EMIOS_0_CH_7_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_7"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_6_ISR_USED) || (defined GPT_EMIOS_0_CH_7_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_6_ISR_USED) || (defined PWM_EMIOS_0_CH_7_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_6_ISR_USED) || (defined ICU_EMIOS_0_CH_7_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 6 and 7 for eMios_0 module
-* @details   Process the interrupt of eMios channels 6 and 7
-*
-* @note   This will be defined only if eMios channels 6 or 7 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_6_CH_7_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_6_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_6_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_6_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_6 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 6)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_6 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 6)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-                #if(defined GPT_EMIOS_0_CH_6_ISR_USED)
-                        Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_6);
-                #endif
-
-                #if(defined PWM_EMIOS_0_CH_6_ISR_USED)
-                        Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_6);
-                #endif
-
-                #if(defined ICU_EMIOS_0_CH_6_ISR_USED)
-                        Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_6);
-                #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 6),REG_READ32(EMIOS_CSR_ADDR32(0, 6)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_7_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_7_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_7_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_7 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 7)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_7 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 7)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_7_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_7);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_7_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_7);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_7_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_7);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 7),REG_READ32(EMIOS_CSR_ADDR32(0, 7)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:8,9 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_8
-*/
-#if  ((defined GPT_EMIOS_0_CH_8_USED) && (defined PWM_EMIOS_0_CH_8_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_8"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_8_USED) && (defined ICU_EMIOS_0_CH_8_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_8"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_8_ISR_USED) && (defined GPT_EMIOS_0_CH_8_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_8"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_9
-*/
-#if  ((defined GPT_EMIOS_0_CH_9_USED) && (defined PWM_EMIOS_0_CH_9_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_9"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_9_USED) && (defined ICU_EMIOS_0_CH_9_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_9"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_9_ISR_USED) && (defined GPT_EMIOS_0_CH_9_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_9"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_8_ISR_USED) || (defined GPT_EMIOS_0_CH_9_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_8_ISR_USED) || (defined PWM_EMIOS_0_CH_9_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_8_ISR_USED) || (defined ICU_EMIOS_0_CH_9_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 8 and 9 for eMios_0 module
-* @details   Process the interrupt of eMios channels 8 and 9
-* @note   This will be defined only if eMios channels 8 or 9 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro
-*/
-ISR(EMIOS_0_CH_8_CH_9_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_8_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_8_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_8_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_8 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 8)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_8 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 8)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_8_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_8);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_8_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_8);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_8_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_8);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 8),REG_READ32(EMIOS_CSR_ADDR32(0, 8)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_9_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_9_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_9_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_9 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 9)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_9 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 9)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_9_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_9);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_9_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_9);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_9_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_9);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 9),REG_READ32(EMIOS_CSR_ADDR32(0, 9)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer
-     **@violates @ref eMios_Common_c_4 Implicit conversion changes signedness */
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:10,11 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_10
-*/
-#if  ((defined GPT_EMIOS_0_CH_10_USED) && (defined PWM_EMIOS_0_CH_10_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_10"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_10_USED) && (defined ICU_EMIOS_0_CH_10_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_10"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_10_ISR_USED) && (defined GPT_EMIOS_0_CH_10_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_10"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_11
-*/
-#if  ((defined GPT_EMIOS_0_CH_11_USED) && (defined PWM_EMIOS_0_CH_11_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_11"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_11_USED) && (defined ICU_EMIOS_0_CH_11_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_11"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_11_ISR_USED) && (defined GPT_EMIOS_0_CH_11_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_11"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_10_ISR_USED) || (defined GPT_EMIOS_0_CH_11_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_10_ISR_USED) || (defined PWM_EMIOS_0_CH_11_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_10_ISR_USED) || (defined ICU_EMIOS_0_CH_11_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief    Interrupt handler for eMios channels : 10 and 11 for eMios_0 module
-* @details  Process the interrupt of eMios channels 10 and 11
-*
-*@note      This will be defined only if eMios channels 10 or 11 are configured in GPT, ICU or
-*           PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro
-*/
-/*================================================================================================*/
-ISR(EMIOS_0_CH_10_CH_11_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_10_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_10_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_10_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_10 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 10)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_10 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 10)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_10_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_10);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_10_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_10);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_10_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_10);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 10),REG_READ32(EMIOS_CSR_ADDR32(0, 10)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_11_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_11_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_11_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_11 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 11)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_11 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 11)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_11_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_11);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_11_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_11);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_11_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_11);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 11),REG_READ32(EMIOS_CSR_ADDR32(0, 11)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:12,13 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_12
-*/
-#if  ((defined GPT_EMIOS_0_CH_12_USED) && (defined PWM_EMIOS_0_CH_12_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_12"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_12_USED) && (defined ICU_EMIOS_0_CH_12_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_12"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_12_ISR_USED) && (defined GPT_EMIOS_0_CH_12_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_12"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_13
-*/
-#if  ((defined GPT_EMIOS_0_CH_13_USED) && (defined PWM_EMIOS_0_CH_13_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_13"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_13_USED) && (defined ICU_EMIOS_0_CH_13_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_13"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_13_ISR_USED) && (defined GPT_EMIOS_0_CH_13_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_13"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_12_ISR_USED) || (defined GPT_EMIOS_0_CH_13_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_12_ISR_USED) || (defined PWM_EMIOS_0_CH_13_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_12_ISR_USED) || (defined ICU_EMIOS_0_CH_13_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 12 and 13 for eMios_0 module
-* @details   Process the interrupt of eMios channels 12 and 13
-*
-* @note     This will be defined only if eMios channels 12 or 13 are configured in GPT, ICU or PWM
-*           mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_12_CH_13_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_12_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_12_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_12_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_12 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 12)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_12 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 12)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_12_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_12);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_12_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_12);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_12_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_12);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 12),REG_READ32(EMIOS_CSR_ADDR32(0, 12)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_13_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_13_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_13_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_13 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 13)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_13 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 13)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_13_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_13);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_13_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_13);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_13_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_13);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 13),REG_READ32(EMIOS_CSR_ADDR32(0, 13)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:14,15 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_14
-*/
-#if  ((defined GPT_EMIOS_0_CH_14_USED) && (defined PWM_EMIOS_0_CH_14_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_14"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_14_USED) && (defined ICU_EMIOS_0_CH_14_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_14"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_14_ISR_USED) && (defined GPT_EMIOS_0_CH_14_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_14"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_15
-*/
-#if  ((defined GPT_EMIOS_0_CH_15_USED) && (defined PWM_EMIOS_0_CH_15_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_15"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_15_USED) && (defined ICU_EMIOS_0_CH_15_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_15"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_15_ISR_USED) && (defined GPT_EMIOS_0_CH_15_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_15"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_14_ISR_USED) || (defined GPT_EMIOS_0_CH_15_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_14_ISR_USED) || (defined PWM_EMIOS_0_CH_15_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_14_ISR_USED) || (defined ICU_EMIOS_0_CH_15_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 14 and 15 for eMios_0 module
-* @details   Process the interrupt of eMios channels 14 and 15
-*
-* @note     This will be defined only if eMios channels 14 or 15 are configured in GPT, ICU or PWM
-*           mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_14_CH_15_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_14_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_14_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_14_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_14 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 14)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_14 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 14)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_14_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_14);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_14_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_14);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_14_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_14);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 14),REG_READ32(EMIOS_CSR_ADDR32(0, 14)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_15_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_15_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_15_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_15 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 15)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_15 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 15)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_15_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_15);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_15_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_15);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_15_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_15);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 15),REG_READ32(EMIOS_CSR_ADDR32(0, 15)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:16,17 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_16
-*/
-#if  ((defined GPT_EMIOS_0_CH_16_USED) && (defined PWM_EMIOS_0_CH_16_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_16"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_16_USED) && (defined ICU_EMIOS_0_CH_16_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_16"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_16_ISR_USED) && (defined GPT_EMIOS_0_CH_16_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_16"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_17
-*/
-#if  ((defined GPT_EMIOS_0_CH_17_USED) && (defined PWM_EMIOS_0_CH_17_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_17"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_17_USED) && (defined ICU_EMIOS_0_CH_17_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_17"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_17_ISR_USED) && (defined GPT_EMIOS_0_CH_17_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_17"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_16_ISR_USED) || (defined GPT_EMIOS_0_CH_17_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_16_ISR_USED) || (defined PWM_EMIOS_0_CH_17_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_16_ISR_USED) || (defined ICU_EMIOS_0_CH_17_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 16 and 17 for eMios_0 module
-* @details   Process the interrupt of eMios channels 16 and 17
-
-* @note     This will be defined only if eMios channels 16 or 17 are configured in GPT, ICU or PWM
-*           mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_16_CH_17_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_16_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_16_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_16_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_16 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 16)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_16 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 16)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_16_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_16);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_16_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_16);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_16_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_16);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 16),REG_READ32(EMIOS_CSR_ADDR32(0, 16)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_17_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_17_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_17_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_17 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 17)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_17 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 17)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-        ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_17_ISR_USED)
-                    Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_17);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_17_ISR_USED)
-                    Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_17);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_17_ISR_USED)
-                    Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_17);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 17),REG_READ32(EMIOS_CSR_ADDR32(0, 17)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:18,19 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_18
-*/
-#if  ((defined GPT_EMIOS_0_CH_18_USED) && (defined PWM_EMIOS_0_CH_18_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_18"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_18_USED) && (defined ICU_EMIOS_0_CH_18_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_18"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_18_ISR_USED) && (defined GPT_EMIOS_0_CH_18_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_18"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_19
-*/
-#if  ((defined GPT_EMIOS_0_CH_19_USED) && (defined PWM_EMIOS_0_CH_19_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_19"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_19_USED) && (defined ICU_EMIOS_0_CH_19_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_19"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_19_ISR_USED) && (defined GPT_EMIOS_0_CH_19_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_19"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_18_ISR_USED) || (defined GPT_EMIOS_0_CH_19_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_18_ISR_USED) || (defined PWM_EMIOS_0_CH_19_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_18_ISR_USED) || (defined ICU_EMIOS_0_CH_19_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 18 and 19 for eMios_0 module
-* @details   Process the interrupt of eMios channels 18 and 19
-*
-* @note   This will be defined only if eMios channels 18 or 19 are configured in GPT, ICU or PWM
-*            mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_18_CH_19_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_18_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_18_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_18_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_18 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 18)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_18 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 18)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_18_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_18);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_18_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_18);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_18_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_18);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 18),REG_READ32(EMIOS_CSR_ADDR32(0, 18)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_19_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_19_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_19_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_19 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 19)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_19 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 19)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_19_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_19);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_19_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_19);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_19_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_19);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 19),REG_READ32(EMIOS_CSR_ADDR32(0, 19)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:20,21 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_20
-*/
-#if  ((defined GPT_EMIOS_0_CH_20_USED) && (defined PWM_EMIOS_0_CH_20_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_20"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_20_USED) && (defined ICU_EMIOS_0_CH_20_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_20"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_20_ISR_USED) && (defined GPT_EMIOS_0_CH_20_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_20"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_21
-*/
-#if  ((defined GPT_EMIOS_0_CH_21_USED) && (defined PWM_EMIOS_0_CH_21_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_21"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_21_USED) && (defined ICU_EMIOS_0_CH_21_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_21"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_21_ISR_USED) && (defined GPT_EMIOS_0_CH_21_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_21"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_20_ISR_USED) || (defined GPT_EMIOS_0_CH_21_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_20_ISR_USED) || (defined PWM_EMIOS_0_CH_21_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_20_ISR_USED) || (defined ICU_EMIOS_0_CH_21_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 20 and 21 for eMios_0 module
-* @details   Process the interrupt of eMios channels 20 and 21
-*
-* @note   This will be defined only if eMios channels 20 or 21 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_20_CH_21_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_20_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_20_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_20_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_20 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 20)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_20 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 20)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_20_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_20);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_20_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_20);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_20_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_20);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 20),REG_READ32(EMIOS_CSR_ADDR32(0, 20)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_21_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_21_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_21_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_21 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 21)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_21 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 21)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_21_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_21);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_21_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_21);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_21_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_21);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 21),REG_READ32(EMIOS_CSR_ADDR32(0, 21)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:22,23 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_22
-*/
-#if  ((defined GPT_EMIOS_0_CH_22_USED) && (defined PWM_EMIOS_0_CH_22_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_22"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_22_USED) && (defined ICU_EMIOS_0_CH_22_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_22"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_22_ISR_USED) && (defined GPT_EMIOS_0_CH_22_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_22"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_23
-*/
-#if  ((defined GPT_EMIOS_0_CH_23_USED) && (defined PWM_EMIOS_0_CH_23_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_23"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_23_USED) && (defined ICU_EMIOS_0_CH_23_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_23"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_23_ISR_USED) && (defined GPT_EMIOS_0_CH_23_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_23"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_22_ISR_USED) || (defined GPT_EMIOS_0_CH_23_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_22_ISR_USED) || (defined PWM_EMIOS_0_CH_23_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_22_ISR_USED) || (defined ICU_EMIOS_0_CH_23_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 22 and 23 for eMios_0 module
-* @details   Process the interrupt of eMios channels 22 and 23
-*
-* @note   This will be defined only if eMios channels 22 or 23 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro
-*/
-ISR(EMIOS_0_CH_22_CH_23_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_22_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_22_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_22_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_22 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 22)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_22 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 22)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_22_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_22);
-            #endif
-    
-            #if(defined PWM_EMIOS_0_CH_22_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_22);
-            #endif
-    
-            #if(defined ICU_EMIOS_0_CH_22_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_22);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 22),REG_READ32(EMIOS_CSR_ADDR32(0, 22)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_23_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_23_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_23_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_23 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 23)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_23 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 23)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_23_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_23);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_23_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_23);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_23_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_23);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 23),REG_READ32(EMIOS_CSR_ADDR32(0, 23)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:24,25 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_24
-*/
-#if  ((defined GPT_EMIOS_0_CH_24_USED) && (defined PWM_EMIOS_0_CH_24_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_24"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_24_USED) && (defined ICU_EMIOS_0_CH_24_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_24"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_24_ISR_USED) && (defined GPT_EMIOS_0_CH_24_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_24"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_25
-*/
-#if  ((defined GPT_EMIOS_0_CH_25_USED) && (defined PWM_EMIOS_0_CH_25_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_25"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_25_USED) && (defined ICU_EMIOS_0_CH_25_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_25"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_25_ISR_USED) && (defined GPT_EMIOS_0_CH_25_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_25"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_24_ISR_USED) || (defined GPT_EMIOS_0_CH_25_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_24_ISR_USED) || (defined PWM_EMIOS_0_CH_25_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_24_ISR_USED) || (defined ICU_EMIOS_0_CH_25_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 24 and 25 for eMios_0 module
-* @details   Process the interrupt of eMios channels 24 and 25
-*
-* @note   This will be defined only if eMios channels 24 or 25 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro
-*/
-ISR(EMIOS_0_CH_24_CH_25_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_24_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_24_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_24_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_24 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 24)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_24 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 24)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_24_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_24);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_24_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_24);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_24_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_24);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 24),REG_READ32(EMIOS_CSR_ADDR32(0, 24)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_25_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_25_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_25_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_25 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 25)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_25 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 25)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_25_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_25);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_25_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_25);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_25_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_25);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 25),REG_READ32(EMIOS_CSR_ADDR32(0, 25)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:26,27 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_26
-*/
-#if  ((defined GPT_EMIOS_0_CH_26_USED) && (defined PWM_EMIOS_0_CH_26_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_26"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_26_USED) && (defined ICU_EMIOS_0_CH_26_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_26"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_26_ISR_USED) && (defined GPT_EMIOS_0_CH_26_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_26"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_27
-*/
-#if  ((defined GPT_EMIOS_0_CH_27_USED) && (defined PWM_EMIOS_0_CH_27_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_27"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_27_USED) && (defined ICU_EMIOS_0_CH_27_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_27"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_27_ISR_USED) && (defined GPT_EMIOS_0_CH_27_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_27"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_26_ISR_USED) || (defined GPT_EMIOS_0_CH_27_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_26_ISR_USED) || (defined PWM_EMIOS_0_CH_27_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_26_ISR_USED) || (defined ICU_EMIOS_0_CH_27_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 26 and 27 for eMios_0 module
-* @details   Process the interrupt of eMios channels 26 and 27
-*
-* @note   This will be defined only if eMios channels 26 or 27 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro
-*/
-ISR(EMIOS_0_CH_26_CH_27_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_26_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_26_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_26_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_26 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 26)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_26 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 26)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_26_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_26);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_26_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_26);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_26_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_26);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 26),REG_READ32(EMIOS_CSR_ADDR32(0, 26)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_27_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_27_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_27_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_27 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 27)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_27 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 27)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_27_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_27);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_27_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_27);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_27_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_27);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 27),REG_READ32(EMIOS_CSR_ADDR32(0, 27)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:28,29 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_28
-*/
-#if  ((defined GPT_EMIOS_0_CH_28_USED) && (defined PWM_EMIOS_0_CH_28_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_28"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_28_USED) && (defined ICU_EMIOS_0_CH_28_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_28"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_28_ISR_USED) && (defined GPT_EMIOS_0_CH_28_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_28"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_29
-*/
-#if  ((defined GPT_EMIOS_0_CH_29_USED) && (defined PWM_EMIOS_0_CH_29_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_29"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_29_USED) && (defined ICU_EMIOS_0_CH_29_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_29"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_29_ISR_USED) && (defined GPT_EMIOS_0_CH_29_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_29"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_28_ISR_USED) || (defined GPT_EMIOS_0_CH_29_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_28_ISR_USED) || (defined PWM_EMIOS_0_CH_29_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_28_ISR_USED) || (defined ICU_EMIOS_0_CH_29_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 28 and 29 for eMios_0 module
-* @details   Process the interrupt of eMios channels 28 and 29
-*
-* @note   This will be defined only if eMios channels 28 or 29 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro
-*/
-ISR(EMIOS_0_CH_28_CH_29_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_28_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_28_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_28_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_28 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 28)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_28 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 28)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_28_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_28);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_28_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_28);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_28_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_28);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 28),REG_READ32(EMIOS_CSR_ADDR32(0, 28)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_29_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_29_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_29_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_29 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 29)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_29 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 29)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_29_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_29);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_29_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_29);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_29_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_29);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 29),REG_READ32(EMIOS_CSR_ADDR32(0, 29)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channels:30,31 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_30
-*/
-#if  ((defined GPT_EMIOS_0_CH_30_ISR_USED) && (defined PWM_EMIOS_0_CH_30_ISR_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_30"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_30_USED) && (defined ICU_EMIOS_0_CH_30_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_30"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_30_USED) && (defined GPT_EMIOS_0_CH_30_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_30"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_31
-*/
-#if  ((defined GPT_EMIOS_0_CH_31_ISR_USED) && (defined PWM_EMIOS_0_CH_31_ISR_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_31"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_31_USED) && (defined ICU_EMIOS_0_CH_31_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_31"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_31_USED) && (defined GPT_EMIOS_0_CH_31_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_31"
-#endif
-
-#if ( (defined GPT_EMIOS_0_CH_30_ISR_USED) || (defined GPT_EMIOS_0_CH_31_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_30_ISR_USED) || (defined PWM_EMIOS_0_CH_31_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_30_ISR_USED) || (defined ICU_EMIOS_0_CH_31_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 30 and 31 for eMios_0 module
-* @details   Process the interrupt of eMios channels 30 and 31
-*
-* @note   This will be defined only if eMios channels 30 or 31 are configured in GPT, ICU or PWM
-*         mode
-*/
-/*
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_30_CH_31_ISR)
-{
-     #if ( (defined GPT_EMIOS_0_CH_30_ISR_USED) || \
-           (defined PWM_EMIOS_0_CH_30_ISR_USED) || \
-           (defined ICU_EMIOS_0_CH_30_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_30 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 30)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_30 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 30)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_30_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_30);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_30_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_30);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_30_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_30);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 30),REG_READ32(EMIOS_CSR_ADDR32(0, 30)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_0_CH_31_ISR_USED) || \
-          (defined PWM_EMIOS_0_CH_31_ISR_USED) || \
-          (defined ICU_EMIOS_0_CH_31_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_31 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(0, 31)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_31 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(0, 31)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_0_CH_31_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_31);
-            #endif
-
-            #if(defined PWM_EMIOS_0_CH_31_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_31);
-            #endif
-
-            #if(defined ICU_EMIOS_0_CH_31_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_31);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(0, 31),REG_READ32(EMIOS_CSR_ADDR32(0, 31)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-
-/*********************************** EMIOS 0 common interrupts END ********************************/
-
-
-
-/*********************************** EMIOS 1 common interrupts START ******************************/
-
-
-/*
-* @brief EMIOS module:1 channels:0,1 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_0
-*/
-#if  ((defined GPT_EMIOS_1_CH_0_ISR_USED) && (defined PWM_EMIOS_1_CH_0_ISR_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_0"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_0_USED) && (defined ICU_EMIOS_1_CH_0_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_0"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_0_USED) && (defined GPT_EMIOS_1_CH_0_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_0"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_1
-*/
-#if  ((defined GPT_EMIOS_1_CH_1_ISR_USED) && (defined PWM_EMIOS_1_CH_1_ISR_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_1"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_1_USED) && (defined ICU_EMIOS_1_CH_1_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_1"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_1_USED) && (defined GPT_EMIOS_1_CH_1_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_1"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_0_ISR_USED) || (defined GPT_EMIOS_1_CH_1_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_0_ISR_USED) || (defined PWM_EMIOS_1_CH_1_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_0_ISR_USED) || (defined ICU_EMIOS_1_CH_1_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 0 and 1 for eMios_1 module
-* @details   Process the interrupt of eMios channels 0 and 1
-*
-* @note   This will be defined only if eMios channels 0 or 1 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_0_CH_1_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_0_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_0_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_0_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_0 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 0)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_0 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 0)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_0_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_0);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_0_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_0);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_0_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_0);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 0),REG_READ32(EMIOS_CSR_ADDR32(1, 0)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_1_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_1_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_1_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_1 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 1)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_1 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 1)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_1_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_1);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_1_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_1);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_1_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_1);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 1),REG_READ32(EMIOS_CSR_ADDR32(1, 1)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:2,3 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_2
-*/
-#if  ((defined GPT_EMIOS_1_CH_2_USED) && (defined PWM_EMIOS_1_CH_2_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_2"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_2_USED) && (defined ICU_EMIOS_1_CH_2_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_2"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_2_ISR_USED) && (defined GPT_EMIOS_1_CH_2_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_2"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_3
-*/
-#if  ((defined GPT_EMIOS_1_CH_3_USED) && (defined PWM_EMIOS_1_CH_3_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_3"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_3_USED) && (defined ICU_EMIOS_1_CH_3_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_3"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_3_ISR_USED) && (defined GPT_EMIOS_1_CH_3_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_3"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_2_ISR_USED) || (defined GPT_EMIOS_1_CH_3_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_2_ISR_USED) || (defined PWM_EMIOS_1_CH_3_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_2_ISR_USED) || (defined ICU_EMIOS_1_CH_3_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 2 and 3 for eMios_1 module
-* @details   Process the interrupt of eMios channels 2 and 3
-*
-* @note   This will be defined only if eMios channels 2 or 3 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro
-*/
-ISR(EMIOS_1_CH_2_CH_3_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_2_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_2_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_2_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_2 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 2)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_2 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 2)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_2_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_2);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_2_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_2);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_2_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_2);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 2),REG_READ32(EMIOS_CSR_ADDR32(1, 2)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_3_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_3_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_3_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_3 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 3)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_3 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 3)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_3_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_3);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_3_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_3);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_3_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_3);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 3),REG_READ32(EMIOS_CSR_ADDR32(1, 3)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:4,5 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_4
-*/
-#if  ((defined GPT_EMIOS_1_CH_4_USED) && (defined PWM_EMIOS_1_CH_4_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_4"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_4_USED) && (defined ICU_EMIOS_1_CH_4_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_4"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_4_ISR_USED) && (defined GPT_EMIOS_1_CH_4_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_4"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_5
-*/
-#if  ((defined GPT_EMIOS_1_CH_5_ISR_USED) && (defined PWM_EMIOS_1_CH_5_ISR_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_5"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_5_USED) && (defined ICU_EMIOS_1_CH_5_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_5"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_5_USED) && (defined GPT_EMIOS_1_CH_5_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_5"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_4_ISR_USED) || (defined GPT_EMIOS_1_CH_5_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_4_ISR_USED) || (defined PWM_EMIOS_1_CH_5_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_4_ISR_USED) || (defined ICU_EMIOS_1_CH_5_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 4 and 5 for eMios_1 module
-* @details   Process the interrupt of eMios channels 4 and 5
-* @note   This will be defined only if eMios channels 4 or 5 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro
-*/
-ISR(EMIOS_1_CH_4_CH_5_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_4_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_4_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_4_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_4 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 4)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_4 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 4)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_4_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_4);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_4_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_4);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_4_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_4);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 4),REG_READ32(EMIOS_CSR_ADDR32(1, 4)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_5_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_5_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_5_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_5 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 5)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_5 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 5)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_5_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_5);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_5_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_5);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_5_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_5);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 5),REG_READ32(EMIOS_CSR_ADDR32(1, 5)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:6,7 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_6
-*/
-#if  ((defined GPT_EMIOS_1_CH_6_USED) && (defined PWM_EMIOS_1_CH_6_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_6"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_6_USED) && (defined ICU_EMIOS_1_CH_6_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_6"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_6_ISR_USED) && (defined GPT_EMIOS_1_CH_6_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_6"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_7
-*/
-#if  ((defined GPT_EMIOS_1_CH_7_ISR_USED) && (defined PWM_EMIOS_1_CH_7_ISR_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_7"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_7_USED) && (defined ICU_EMIOS_1_CH_7_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_7"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_7_USED) && (defined GPT_EMIOS_1_CH_7_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_7"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_6_ISR_USED) || (defined GPT_EMIOS_1_CH_7_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_6_ISR_USED) || (defined PWM_EMIOS_1_CH_7_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_6_ISR_USED) || (defined ICU_EMIOS_1_CH_7_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 6 and 7 for eMios_1 module
-* @details   Process the interrupt of eMios channels 6 and 7
-*
-* @note   This will be defined only if eMios channels 6 or 7 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_6_CH_7_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_6_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_6_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_6_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_6 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 6)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_6 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 6)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_6_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_6);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_6_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_6);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_6_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_6);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 6),REG_READ32(EMIOS_CSR_ADDR32(1, 6)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_7_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_7_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_7_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_7 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 7)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_7 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 7)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_7_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_7);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_7_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_7);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_7_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_7);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 7),REG_READ32(EMIOS_CSR_ADDR32(1, 7)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:8,9 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_8
-*/
-#if  ((defined GPT_EMIOS_1_CH_8_USED) && (defined PWM_EMIOS_1_CH_8_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_8"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_8_USED) && (defined ICU_EMIOS_1_CH_8_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_8"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_8_ISR_USED) && (defined GPT_EMIOS_1_CH_8_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_8"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_9
-*/
-#if  ((defined GPT_EMIOS_1_CH_9_USED) && (defined PWM_EMIOS_1_CH_9_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_9"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_9_USED) && (defined ICU_EMIOS_1_CH_9_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_9"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_9_ISR_USED) && (defined GPT_EMIOS_1_CH_9_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_9"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_8_ISR_USED) || (defined GPT_EMIOS_1_CH_9_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_8_ISR_USED) || (defined PWM_EMIOS_1_CH_9_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_8_ISR_USED) || (defined ICU_EMIOS_1_CH_9_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 8 and 9 for eMios_1 module
-* @details   Process the interrupt of eMios channels 8 and 9
-*
-* @note   This will be defined only if eMios channels 8 or 9 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_8_CH_9_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_8_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_8_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_8_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_8 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 8)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_8 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 8)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_8_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_8);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_8_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_8);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_8_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_8);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 8),REG_READ32(EMIOS_CSR_ADDR32(1, 8)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_9_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_9_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_9_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_9 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 9)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_9 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 9)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_9_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_9);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_9_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_9);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_9_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_9);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 9),REG_READ32(EMIOS_CSR_ADDR32(1, 9)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:10,11 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_10
-*/
-#if  ((defined GPT_EMIOS_1_CH_10_USED) && (defined PWM_EMIOS_1_CH_10_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_10"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_10_USED) && (defined ICU_EMIOS_1_CH_10_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_10"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_10_ISR_USED) && (defined GPT_EMIOS_1_CH_10_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_10"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_11
-*/
-#if  ((defined GPT_EMIOS_1_CH_11_USED) && (defined PWM_EMIOS_1_CH_11_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_11"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_11_USED) && (defined ICU_EMIOS_1_CH_11_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_11"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_11_ISR_USED) && (defined GPT_EMIOS_1_CH_11_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_11"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_10_ISR_USED) || (defined GPT_EMIOS_1_CH_11_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_10_ISR_USED) || (defined PWM_EMIOS_1_CH_11_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_10_ISR_USED) || (defined ICU_EMIOS_1_CH_11_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 10 and 11 for eMios_1 module
-* @details   Process the interrupt of eMios channels 10 and 11
-*
-* @note     This will be defined only if eMios channels 10 or 11 are configured in GPT, ICU or PWM
-*           mode
-*/
-/*
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_10_CH_11_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_10_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_10_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_10_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_10 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 10)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_10 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 10)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_10_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_10);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_10_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_10);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_10_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_10);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 10),REG_READ32(EMIOS_CSR_ADDR32(1, 10)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_11_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_11_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_11_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_11 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 11)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_11 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 11)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_11_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_11);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_11_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_11);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_11_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_11);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 11),REG_READ32(EMIOS_CSR_ADDR32(1, 11)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:12,13 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_12
-*/
-#if  ((defined GPT_EMIOS_1_CH_12_USED) && (defined PWM_EMIOS_1_CH_12_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_12"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_12_USED) && (defined ICU_EMIOS_1_CH_12_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_12"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_12_ISR_USED) && (defined GPT_EMIOS_1_CH_12_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_12"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_13
-*/
-#if  ((defined GPT_EMIOS_1_CH_13_USED) && (defined PWM_EMIOS_1_CH_13_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_13"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_13_USED) && (defined ICU_EMIOS_1_CH_13_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_13"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_13_ISR_USED) && (defined GPT_EMIOS_1_CH_13_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_13"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_12_ISR_USED) || (defined GPT_EMIOS_1_CH_13_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_12_ISR_USED) || (defined PWM_EMIOS_1_CH_13_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_12_ISR_USED) || (defined ICU_EMIOS_1_CH_13_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 12 and 13 for eMios_1 module
-* @details   Process the interrupt of eMios channels 12 and 13
-*
-* @note   This will be defined only if eMios channels 12 or 13 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_12_CH_13_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_12_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_12_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_12_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_12 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 12)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_12 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 12)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_12_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_12);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_12_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_12);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_12_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_12);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 12),REG_READ32(EMIOS_CSR_ADDR32(1, 12)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_13_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_13_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_13_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_13 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 13)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_13 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 13)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_13_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_13);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_13_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_13);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_13_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_13);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 13),REG_READ32(EMIOS_CSR_ADDR32(1, 13)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:14,15 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_14
-*/
-#if  ((defined GPT_EMIOS_1_CH_14_USED) && (defined PWM_EMIOS_1_CH_14_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_14"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_14_USED) && (defined ICU_EMIOS_1_CH_14_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_14"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_14_ISR_USED) && (defined GPT_EMIOS_1_CH_14_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_14"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_15
-*/
-#if  ((defined GPT_EMIOS_1_CH_15_USED) && (defined PWM_EMIOS_1_CH_15_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_15"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_15_USED) && (defined ICU_EMIOS_1_CH_15_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_15"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_15_ISR_USED) && (defined GPT_EMIOS_1_CH_15_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_15"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_14_ISR_USED) || (defined GPT_EMIOS_1_CH_15_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_14_ISR_USED) || (defined PWM_EMIOS_1_CH_15_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_14_ISR_USED) || (defined ICU_EMIOS_1_CH_15_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 14 and 15 for eMios_1 module
-* @details   Process the interrupt of eMios channels 14 and 15
-*
-* @note   This will be defined only if eMios channels 14 or 15 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_14_CH_15_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_14_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_14_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_14_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_14 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 14)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_14 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 14)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_14_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_14);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_14_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_14);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_14_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_14);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 14),REG_READ32(EMIOS_CSR_ADDR32(1, 14)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_15_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_15_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_15_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_15 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 15)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_15 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 15)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_15_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_15);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_15_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_15);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_15_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_15);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 15),REG_READ32(EMIOS_CSR_ADDR32(1, 15)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:16,17 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_16
-*/
-#if  ((defined GPT_EMIOS_1_CH_16_USED) && (defined PWM_EMIOS_1_CH_16_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_16"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_16_USED) && (defined ICU_EMIOS_1_CH_16_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_16"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_16_ISR_USED) && (defined GPT_EMIOS_1_CH_16_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_16"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_17
-*/
-#if  ((defined GPT_EMIOS_1_CH_17_USED) && (defined PWM_EMIOS_1_CH_17_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_17"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_17_USED) && (defined ICU_EMIOS_1_CH_17_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_17"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_17_ISR_USED) && (defined GPT_EMIOS_1_CH_17_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_17"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_16_ISR_USED) || (defined GPT_EMIOS_1_CH_17_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_16_ISR_USED) || (defined PWM_EMIOS_1_CH_17_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_16_ISR_USED) || (defined ICU_EMIOS_1_CH_17_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 16 and 17 for eMios_1 module
-* @details   Process the interrupt of eMios channels 16 and 17
-*
-* @note   This will be defined only if eMios channels 16 or 17 are configured in GPT, ICU or PWM
-*         mode
-*/
-/*
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_16_CH_17_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_16_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_16_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_16_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_16 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 16)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_16 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 16)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_16_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_16);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_16_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_16);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_16_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_16);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 16),REG_READ32(EMIOS_CSR_ADDR32(1, 16)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_17_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_17_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_17_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_17 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 17)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_17 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 17)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_17_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_17);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_17_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_17);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_17_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_17);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 17),REG_READ32(EMIOS_CSR_ADDR32(1, 17)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer
-     **@violates @ref eMios_Common_c_4 Implicit conversion changes signedness */
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:18,19 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_18
-*/
-#if  ((defined GPT_EMIOS_1_CH_18_USED) && (defined PWM_EMIOS_1_CH_18_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_18"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_18_USED) && (defined ICU_EMIOS_1_CH_18_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_18"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_18_ISR_USED) && (defined GPT_EMIOS_1_CH_18_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_18"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_19
-*/
-#if  ((defined GPT_EMIOS_1_CH_19_USED) && (defined PWM_EMIOS_1_CH_19_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_19"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_19_USED) && (defined ICU_EMIOS_1_CH_19_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_19"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_19_ISR_USED) && (defined GPT_EMIOS_1_CH_19_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_19"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_18_ISR_USED) || (defined GPT_EMIOS_1_CH_19_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_18_ISR_USED) || (defined PWM_EMIOS_1_CH_19_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_18_ISR_USED) || (defined ICU_EMIOS_1_CH_19_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 18 and 19 for eMios_1 module
-* @details   Process the interrupt of eMios channels 18 and 19
-*
-* @note   This will be defined only if eMios channels 18 or 19 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_18_CH_19_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_18_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_18_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_18_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_18 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 18)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_18 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 18)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_18_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_18);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_18_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_18);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_18_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_18);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 18),REG_READ32(EMIOS_CSR_ADDR32(1, 18)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_19_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_19_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_19_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_19 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 19)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_19 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 19)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_19_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_19);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_19_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_19);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_19_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_19);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 19),REG_READ32(EMIOS_CSR_ADDR32(1, 19)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:20,21 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_20
-*/
-#if  ((defined GPT_EMIOS_1_CH_20_USED) && (defined PWM_EMIOS_1_CH_20_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_20"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_20_USED) && (defined ICU_EMIOS_1_CH_20_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_20"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_20_ISR_USED) && (defined GPT_EMIOS_1_CH_20_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_20"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_21
-*/
-#if  ((defined GPT_EMIOS_1_CH_21_USED) && (defined PWM_EMIOS_1_CH_21_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_21"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_21_USED) && (defined ICU_EMIOS_1_CH_21_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_21"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_21_ISR_USED) && (defined GPT_EMIOS_1_CH_21_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_21"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_20_ISR_USED) || (defined GPT_EMIOS_1_CH_21_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_20_ISR_USED) || (defined PWM_EMIOS_1_CH_21_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_20_ISR_USED) || (defined ICU_EMIOS_1_CH_21_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 20 and 21 for eMios_1 module
-* @details   Process the interrupt of eMios channels 20 and 21
-*
-* @note   This will be defined only if eMios channels 20 or 21 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_20_CH_21_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_20_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_20_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_20_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_20 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 20)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_20 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 20)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_20_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_20);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_20_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_20);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_20_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_20);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 20),REG_READ32(EMIOS_CSR_ADDR32(1, 20)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_21_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_21_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_21_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_21 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 21)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_21 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 21)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_21_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_21);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_21_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_21);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_21_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_21);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 21),REG_READ32(EMIOS_CSR_ADDR32(1, 21)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:22,23 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_22
-*/
-#if  ((defined GPT_EMIOS_1_CH_22_USED) && (defined PWM_EMIOS_1_CH_22_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_22"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_22_USED) && (defined ICU_EMIOS_1_CH_22_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_22"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_22_ISR_USED) && (defined GPT_EMIOS_1_CH_22_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_22"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_23
-*/
-#if  ((defined GPT_EMIOS_1_CH_23_USED) && (defined PWM_EMIOS_1_CH_23_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_23"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_23_USED) && (defined ICU_EMIOS_1_CH_23_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_23"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_23_ISR_USED) && (defined GPT_EMIOS_1_CH_23_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_23"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_22_ISR_USED) || (defined GPT_EMIOS_1_CH_23_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_22_ISR_USED) || (defined PWM_EMIOS_1_CH_23_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_22_ISR_USED) || (defined ICU_EMIOS_1_CH_23_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 22 and 23 for eMios_1 module
-* @details   Process the interrupt of eMios channels 22 and 23
-*
-* @note   This will be defined only if eMios channels 22 or 23 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_22_CH_23_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_22_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_22_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_22_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_22 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 22)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_22 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 22)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_22_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_22);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_22_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_22);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_22_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_22);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 22),REG_READ32(EMIOS_CSR_ADDR32(1, 22)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_23_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_23_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_23_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_23 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 23)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_23 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 23)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_23_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_23);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_23_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_23);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_23_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_23);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 23),REG_READ32(EMIOS_CSR_ADDR32(1, 23)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:24,25 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_24
-*/
-#if  ((defined GPT_EMIOS_1_CH_24_USED) && (defined PWM_EMIOS_1_CH_24_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_24"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_24_USED) && (defined ICU_EMIOS_1_CH_24_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_24"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_24_ISR_USED) && (defined GPT_EMIOS_1_CH_24_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_24"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_25
-*/
-#if  ((defined GPT_EMIOS_1_CH_25_USED) && (defined PWM_EMIOS_1_CH_25_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_25"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_25_USED) && (defined ICU_EMIOS_1_CH_25_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_25"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_25_ISR_USED) && (defined GPT_EMIOS_1_CH_25_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_25"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_24_ISR_USED) || (defined GPT_EMIOS_1_CH_25_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_24_ISR_USED) || (defined PWM_EMIOS_1_CH_25_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_24_ISR_USED) || (defined ICU_EMIOS_1_CH_25_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 24 and 25 for eMios_1 module
-* @details   Process the interrupt of eMios channels 24 and 25
-*
-* @note   This will be defined only if eMios channels 24 or 25 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_24_CH_25_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_24_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_24_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_24_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_24 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 24)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_24 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 24)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_24_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_24);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_24_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_24);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_24_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_24);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 24),REG_READ32(EMIOS_CSR_ADDR32(1, 24)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_25_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_25_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_25_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_25 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 25)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_25 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 25)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_25_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_25);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_25_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_25);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_25_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_25);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 25),REG_READ32(EMIOS_CSR_ADDR32(1, 25)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:26,27 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_26
-*/
-#if  ((defined GPT_EMIOS_1_CH_26_USED) && (defined PWM_EMIOS_1_CH_26_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_26"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_26_USED) && (defined ICU_EMIOS_1_CH_26_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_26"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_26_ISR_USED) && (defined GPT_EMIOS_1_CH_26_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_26"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_27
-*/
-#if  ((defined GPT_EMIOS_1_CH_27_USED) && (defined PWM_EMIOS_1_CH_27_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_27"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_27_USED) && (defined ICU_EMIOS_1_CH_27_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_27"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_27_ISR_USED) && (defined GPT_EMIOS_1_CH_27_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_27"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_26_ISR_USED) || (defined GPT_EMIOS_1_CH_27_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_26_ISR_USED) || (defined PWM_EMIOS_1_CH_27_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_26_ISR_USED) || (defined ICU_EMIOS_1_CH_27_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 26 and 27 for eMios_1 module
-* @details   Process the interrupt of eMios channels 26 and 27
-*
-* @note   This will be defined only if eMios channels 26 or 27 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_26_CH_27_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_26_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_26_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_26_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_26 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 26)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_26 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 26)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_26_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_26);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_26_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_26);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_26_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_26);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 26),REG_READ32(EMIOS_CSR_ADDR32(1, 26)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_27_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_27_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_27_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_27 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 27)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_27 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 27)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_27_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_27);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_27_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_27);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_27_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_27);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 27),REG_READ32(EMIOS_CSR_ADDR32(1, 27)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:28,29 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_28
-*/
-#if  ((defined GPT_EMIOS_1_CH_28_USED) && (defined PWM_EMIOS_1_CH_28_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_28"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_28_USED) && (defined ICU_EMIOS_1_CH_28_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_28"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_28_ISR_USED) && (defined GPT_EMIOS_1_CH_28_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_28"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_29
-*/
-#if  ((defined GPT_EMIOS_1_CH_29_USED) && (defined PWM_EMIOS_1_CH_29_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_29"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_29_USED) && (defined ICU_EMIOS_1_CH_29_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_29"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_29_ISR_USED) && (defined GPT_EMIOS_1_CH_29_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_29"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_28_ISR_USED) || (defined GPT_EMIOS_1_CH_29_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_28_ISR_USED) || (defined PWM_EMIOS_1_CH_29_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_28_ISR_USED) || (defined ICU_EMIOS_1_CH_29_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 28 and 29 for eMios_1 module
-* @details   Process the interrupt of eMios channels 28 and 29
-*
-* @note   This will be defined only if eMios channels 28 or 29 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_28_CH_29_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_28_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_28_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_28_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_28 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 28)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_28 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 28)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_28_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_28);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_28_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_28);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_28_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_28);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 28),REG_READ32(EMIOS_CSR_ADDR32(1, 28)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_29_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_29_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_29_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_29 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 29)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_29 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 29)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_29_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_29);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_29_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_29);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_29_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_29);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 29),REG_READ32(EMIOS_CSR_ADDR32(1, 29)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channels:30,31 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_30
-*/
-#if  ((defined GPT_EMIOS_1_CH_30_USED) && (defined PWM_EMIOS_1_CH_30_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_30"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_30_USED) && (defined ICU_EMIOS_1_CH_30_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_30"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_30_ISR_USED) && (defined GPT_EMIOS_1_CH_30_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_30"
-#endif
-
-/*
-* @brief resource conflict check for EMIOS_1_CH_31
-*/
-#if  ((defined GPT_EMIOS_1_CH_31_USED) && (defined PWM_EMIOS_1_CH_31_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_31"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_31_USED) && (defined ICU_EMIOS_1_CH_31_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_31"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_31_ISR_USED) && (defined GPT_EMIOS_1_CH_31_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_31"
-#endif
-
-#if ( (defined GPT_EMIOS_1_CH_30_ISR_USED) || (defined GPT_EMIOS_1_CH_31_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_30_ISR_USED) || (defined PWM_EMIOS_1_CH_31_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_30_ISR_USED) || (defined ICU_EMIOS_1_CH_31_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 30 and 31 for eMios_1 module
-* @details   Process the interrupt of eMios channels 30 and 31
-*
-* @note   This will be defined only if eMios channels 30 or 31 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_30_CH_31_ISR)
-{
-     #if ( (defined GPT_EMIOS_1_CH_30_ISR_USED) || \
-           (defined PWM_EMIOS_1_CH_30_ISR_USED) || \
-           (defined ICU_EMIOS_1_CH_30_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_30 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 30)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_30 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 30)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_30_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_30);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_30_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_30);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_30_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_30);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 30),REG_READ32(EMIOS_CSR_ADDR32(1, 30)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_1_CH_31_ISR_USED) || \
-          (defined PWM_EMIOS_1_CH_31_ISR_USED) || \
-          (defined ICU_EMIOS_1_CH_31_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_31 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(1, 31)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_31 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(1, 31)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_1_CH_31_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_31);
-            #endif
-
-            #if(defined PWM_EMIOS_1_CH_31_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_31);
-            #endif
-
-            #if(defined ICU_EMIOS_1_CH_31_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_31);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(1, 31),REG_READ32(EMIOS_CSR_ADDR32(1, 31)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-
-/*********************************** EMIOS 1 common interrupts END ********************************/
-
-
-/********************************** EMIOS 2 common interrupts START ********************************/
-/*
-* @brief EMIOS module:2 channels:0,1 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_0
-*/
-#if  ((defined GPT_EMIOS_2_CH_0_USED) && (defined PWM_EMIOS_2_CH_0_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_0"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_0_USED) && (defined ICU_EMIOS_2_CH_0_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_0"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_0_ISR_USED) && (defined GPT_EMIOS_2_CH_0_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_0"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_1
-*/
-#if  ((defined GPT_EMIOS_2_CH_1_USED) && (defined PWM_EMIOS_2_CH_1_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_1"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_1_USED) && (defined ICU_EMIOS_2_CH_1_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_1"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_1_ISR_USED) && (defined GPT_EMIOS_2_CH_1_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_1"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_0_ISR_USED) || (defined GPT_EMIOS_2_CH_1_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_0_ISR_USED) || (defined PWM_EMIOS_2_CH_1_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_0_ISR_USED) || (defined ICU_EMIOS_2_CH_1_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 0 and 1 for eMios_2 module
-* @details   Process the interrupt of eMios channels 0 and 1
-* @note   This will be defined only if eMios channels 0 or 1 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_0_CH_1_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_0_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_0_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_0_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_2 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 0)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_2 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 0)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_0_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_0);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_0_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_0);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_0_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_0);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 0),REG_READ32(EMIOS_CSR_ADDR32(2, 0)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_1_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_1_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_1_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_1 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 1)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_1 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 1)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_1_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_1);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_1_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_1);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_1_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_1);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 1),REG_READ32(EMIOS_CSR_ADDR32(2, 1)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:2,3 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_2
-*/
-#if  ((defined GPT_EMIOS_2_CH_2_USED) && (defined PWM_EMIOS_2_CH_2_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_2"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_2_USED) && (defined ICU_EMIOS_2_CH_2_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_2"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_2_ISR_USED) && (defined GPT_EMIOS_2_CH_2_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_2"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_3
-*/
-#if  ((defined GPT_EMIOS_2_CH_3_USED) && (defined PWM_EMIOS_2_CH_3_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_3"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_3_USED) && (defined ICU_EMIOS_2_CH_3_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_3"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_3_ISR_USED) && (defined GPT_EMIOS_2_CH_3_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_3"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_2_ISR_USED) || (defined GPT_EMIOS_2_CH_3_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_2_ISR_USED) || (defined PWM_EMIOS_2_CH_3_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_2_ISR_USED) || (defined ICU_EMIOS_2_CH_3_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 2 and 3 for eMios_2 module
-* @details   Process the interrupt of eMios channels 2 and 3
-*
-* @note   This will be defined only if eMios channels 2 or 3 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_2_CH_3_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_2_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_2_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_2_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_2 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 2)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_2 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 2)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_2_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_2);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_2_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_2);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_2_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_2);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 2),REG_READ32(EMIOS_CSR_ADDR32(2, 2)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_3_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_3_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_3_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_3 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 3)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_3 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 3)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_3_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_3);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_3_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_3);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_3_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_3);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 3),REG_READ32(EMIOS_CSR_ADDR32(2, 3)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-  /* @violates @ref eMios_Common_c_4 Violates MISRA 2004 Required Rule 10.1, Implicit conversion changes signedness */
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:4,5 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_4
-*/
-#if  ((defined GPT_EMIOS_2_CH_4_USED) && (defined PWM_EMIOS_2_CH_4_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_4"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_4_USED) && (defined ICU_EMIOS_2_CH_4_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_4"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_4_ISR_USED) && (defined GPT_EMIOS_2_CH_4_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_4"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_5
-*/
-#if  ((defined GPT_EMIOS_2_CH_5_USED) && (defined PWM_EMIOS_2_CH_5_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_5"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_5_USED) && (defined ICU_EMIOS_2_CH_5_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_5"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_5_ISR_USED) && (defined GPT_EMIOS_2_CH_5_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_5"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_4_ISR_USED) || (defined GPT_EMIOS_2_CH_5_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_4_ISR_USED) || (defined PWM_EMIOS_2_CH_5_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_4_ISR_USED) || (defined ICU_EMIOS_2_CH_5_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 4 and 5 for eMios_2 module
-* @details   Process the interrupt of eMios channels 4 and 5
-*
-* @note   This will be defined only if eMios channels 4 or 5 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_4_CH_5_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_4_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_4_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_4_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_4 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 4)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_4 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 4)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_4_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_4);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_4_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_4);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_4_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_4);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 4),REG_READ32(EMIOS_CSR_ADDR32(2, 4)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_5_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_5_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_5_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_5 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 5)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_5 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 5)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_5_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_5);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_5_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_5);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_5_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_5);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 5),REG_READ32(EMIOS_CSR_ADDR32(2, 5)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:6,7 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_6
-*/
-#if  ((defined GPT_EMIOS_2_CH_6_USED) && (defined PWM_EMIOS_2_CH_6_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_6"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_6_USED) && (defined ICU_EMIOS_2_CH_6_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_6"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_6_ISR_USED) && (defined GPT_EMIOS_2_CH_6_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_6"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_7
-*/
-#if  ((defined GPT_EMIOS_2_CH_7_USED) && (defined PWM_EMIOS_2_CH_7_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_7"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_7_USED) && (defined ICU_EMIOS_2_CH_7_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_7"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_7_ISR_USED) && (defined GPT_EMIOS_2_CH_7_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_7"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_6_ISR_USED) || (defined GPT_EMIOS_2_CH_7_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_6_ISR_USED) || (defined PWM_EMIOS_2_CH_7_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_6_ISR_USED) || (defined ICU_EMIOS_2_CH_7_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 6 and 7 for eMios_2 module
-* @details   Process the interrupt of eMios channels 6 and 7
-*
-* @note   This will be defined only if eMios channels 6 or 7 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_6_CH_7_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_6_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_6_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_6_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_6 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 6)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_6 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 6)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_6_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_6);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_6_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_6);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_6_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_6);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 6),REG_READ32(EMIOS_CSR_ADDR32(2, 6)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_7_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_7_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_7_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_7 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 7)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_7 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 7)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_7_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_7);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_7_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_7);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_7_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_7);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 7),REG_READ32(EMIOS_CSR_ADDR32(2, 7)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:8,9 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_8
-*/
-#if  ((defined GPT_EMIOS_2_CH_8_USED) && (defined PWM_EMIOS_2_CH_8_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_8"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_8_USED) && (defined ICU_EMIOS_2_CH_8_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_8"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_8_ISR_USED) && (defined GPT_EMIOS_2_CH_8_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_8"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_9
-*/
-#if  ((defined GPT_EMIOS_2_CH_9_USED) && (defined PWM_EMIOS_2_CH_9_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_9"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_9_USED) && (defined ICU_EMIOS_2_CH_9_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_9"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_9_ISR_USED) && (defined GPT_EMIOS_2_CH_9_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_9"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_8_ISR_USED) || (defined GPT_EMIOS_2_CH_9_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_8_ISR_USED) || (defined PWM_EMIOS_2_CH_9_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_8_ISR_USED) || (defined ICU_EMIOS_2_CH_9_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 8 and 9 for eMios_2 module
-* @details   Process the interrupt of eMios channels 8 and 9
-* @note   This will be defined only if eMios channels 8 or 9 are configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_8_CH_9_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_8_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_8_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_8_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_8 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 8)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_8 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 8)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_8_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_8);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_8_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_8);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_8_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_8);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 8),REG_READ32(EMIOS_CSR_ADDR32(2, 8)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_9_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_9_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_9_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_9 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 9)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_9 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 9)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_9_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_9);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_9_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_9);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_9_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_9);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 9),REG_READ32(EMIOS_CSR_ADDR32(2, 9)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer
-     **@violates @ref eMios_Common_c_4 Implicit conversion changes signedness */
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:10,11 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_10
-*/
-#if  ((defined GPT_EMIOS_2_CH_10_USED) && (defined PWM_EMIOS_2_CH_10_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_10"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_10_USED) && (defined ICU_EMIOS_2_CH_10_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_10"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_10_ISR_USED) && (defined GPT_EMIOS_2_CH_10_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_10"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_11
-*/
-#if  ((defined GPT_EMIOS_2_CH_11_USED) && (defined PWM_EMIOS_2_CH_11_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_11"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_11_USED) && (defined ICU_EMIOS_2_CH_11_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_11"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_11_ISR_USED) && (defined GPT_EMIOS_2_CH_11_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_11"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_10_ISR_USED) || (defined GPT_EMIOS_2_CH_11_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_10_ISR_USED) || (defined PWM_EMIOS_2_CH_11_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_10_ISR_USED) || (defined ICU_EMIOS_2_CH_11_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief    Interrupt handler for eMios channels : 10 and 11 for eMios_2 module
-* @details  Process the interrupt of eMios channels 10 and 11
-*
-*@note      This will be defined only if eMios channels 10 or 11 are configured in GPT, ICU or
-*           PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_10_CH_11_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_10_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_10_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_10_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_10 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 10)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_10 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 10)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_10_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_10);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_10_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_10);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_10_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_10);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 10),REG_READ32(EMIOS_CSR_ADDR32(2, 10)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_11_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_11_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_11_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_11 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 11)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_11 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 11)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_11_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_11);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_11_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_11);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_11_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_11);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 11),REG_READ32(EMIOS_CSR_ADDR32(2, 11)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:12,13 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_12
-*/
-#if  ((defined GPT_EMIOS_2_CH_12_USED) && (defined PWM_EMIOS_2_CH_12_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_12"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_12_USED) && (defined ICU_EMIOS_2_CH_12_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_12"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_12_ISR_USED) && (defined GPT_EMIOS_2_CH_12_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_12"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_13
-*/
-#if  ((defined GPT_EMIOS_2_CH_13_USED) && (defined PWM_EMIOS_2_CH_13_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_13"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_13_USED) && (defined ICU_EMIOS_2_CH_13_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_13"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_13_ISR_USED) && (defined GPT_EMIOS_2_CH_13_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_13"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_12_ISR_USED) || (defined GPT_EMIOS_2_CH_13_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_12_ISR_USED) || (defined PWM_EMIOS_2_CH_13_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_12_ISR_USED) || (defined ICU_EMIOS_2_CH_13_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 12 and 13 for eMios_2 module
-* @details   Process the interrupt of eMios channels 12 and 13
-*
-* @note     This will be defined only if eMios channels 12 or 13 are configured in GPT, ICU or PWM
-*           mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_12_CH_13_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_12_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_12_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_12_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_12 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 12)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_12 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 12)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_12_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_12);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_12_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_12);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_12_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_12);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 12),REG_READ32(EMIOS_CSR_ADDR32(2, 12)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_13_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_13_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_13_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_13 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 13)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_13 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 13)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_13_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_13);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_13_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_13);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_13_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_13);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 13),REG_READ32(EMIOS_CSR_ADDR32(2, 13)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:14,15 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_14
-*/
-#if  ((defined GPT_EMIOS_2_CH_14_USED) && (defined PWM_EMIOS_2_CH_14_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_14"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_14_USED) && (defined ICU_EMIOS_2_CH_14_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_14"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_14_ISR_USED) && (defined GPT_EMIOS_2_CH_14_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_14"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_15
-*/
-#if  ((defined GPT_EMIOS_2_CH_15_USED) && (defined PWM_EMIOS_2_CH_15_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_15"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_15_USED) && (defined ICU_EMIOS_2_CH_15_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_15"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_15_ISR_USED) && (defined GPT_EMIOS_2_CH_15_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_15"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_14_ISR_USED) || (defined GPT_EMIOS_2_CH_15_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_14_ISR_USED) || (defined PWM_EMIOS_2_CH_15_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_14_ISR_USED) || (defined ICU_EMIOS_2_CH_15_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 14 and 15 for eMios_2 module
-* @details   Process the interrupt of eMios channels 14 and 15
-*
-* @note     This will be defined only if eMios channels 14 or 15 are configured in GPT, ICU or PWM
-*           mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_14_CH_15_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_14_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_14_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_14_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_14 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 14)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_14 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 14)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_14_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_14);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_14_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_14);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_14_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_14);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 14),REG_READ32(EMIOS_CSR_ADDR32(2, 14)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_15_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_15_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_15_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_15 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 15)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_15 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 15)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_15_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_15);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_15_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_15);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_15_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_15);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 15),REG_READ32(EMIOS_CSR_ADDR32(2, 15)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:16,17 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_16
-*/
-#if  ((defined GPT_EMIOS_2_CH_16_USED) && (defined PWM_EMIOS_2_CH_16_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_16"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_16_USED) && (defined ICU_EMIOS_2_CH_16_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_16"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_16_ISR_USED) && (defined GPT_EMIOS_2_CH_16_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_16"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_17
-*/
-#if  ((defined GPT_EMIOS_2_CH_17_USED) && (defined PWM_EMIOS_2_CH_17_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_17"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_17_USED) && (defined ICU_EMIOS_2_CH_17_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_17"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_17_ISR_USED) && (defined GPT_EMIOS_2_CH_17_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_17"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_16_ISR_USED) || (defined GPT_EMIOS_2_CH_17_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_16_ISR_USED) || (defined PWM_EMIOS_2_CH_17_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_16_ISR_USED) || (defined ICU_EMIOS_2_CH_17_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 16 and 17 for eMios_2 module
-* @details   Process the interrupt of eMios channels 16 and 17
-
-* @note     This will be defined only if eMios channels 16 or 17 are configured in GPT, ICU or PWM
-*           mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_16_CH_17_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_16_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_16_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_16_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_16 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 16)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_16 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 16)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_16_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_16);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_16_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_16);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_16_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_16);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 16),REG_READ32(EMIOS_CSR_ADDR32(2, 16)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_17_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_17_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_17_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_17 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 17)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_17 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 17)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_17_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_17);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_17_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_17);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_17_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_17);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 17),REG_READ32(EMIOS_CSR_ADDR32(2, 17)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:18,19 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_18
-*/
-#if  ((defined GPT_EMIOS_2_CH_18_USED) && (defined PWM_EMIOS_2_CH_18_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_18"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_18_USED) && (defined ICU_EMIOS_2_CH_18_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_18"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_18_ISR_USED) && (defined GPT_EMIOS_2_CH_18_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_18"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_19
-*/
-#if  ((defined GPT_EMIOS_2_CH_19_USED) && (defined PWM_EMIOS_2_CH_19_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_19"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_19_USED) && (defined ICU_EMIOS_2_CH_19_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_19"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_19_ISR_USED) && (defined GPT_EMIOS_2_CH_19_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_19"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_18_ISR_USED) || (defined GPT_EMIOS_2_CH_19_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_18_ISR_USED) || (defined PWM_EMIOS_2_CH_19_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_18_ISR_USED) || (defined ICU_EMIOS_2_CH_19_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 18 and 19 for eMios_2 module
-* @details   Process the interrupt of eMios channels 18 and 19
-*
-* @note   This will be defined only if eMios channels 18 or 19 are configured in GPT, ICU or PWM
-*            mode
-*/
-/*
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_18_CH_19_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_18_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_18_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_18_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_18 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 18)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_18 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 18)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_18_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_18);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_18_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_18);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_18_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_18);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 18),REG_READ32(EMIOS_CSR_ADDR32(2, 18)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_19_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_19_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_19_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_19 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 19)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_19 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 19)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_19_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_19);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_19_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_19);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_19_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_19);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 19),REG_READ32(EMIOS_CSR_ADDR32(2, 19)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:20,21 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_20
-*/
-#if  ((defined GPT_EMIOS_2_CH_20_USED) && (defined PWM_EMIOS_2_CH_20_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_20"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_20_USED) && (defined ICU_EMIOS_2_CH_20_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_20"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_20_ISR_USED) && (defined GPT_EMIOS_2_CH_20_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_20"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_21
-*/
-#if  ((defined GPT_EMIOS_2_CH_21_USED) && (defined PWM_EMIOS_2_CH_21_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_21"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_21_USED) && (defined ICU_EMIOS_2_CH_21_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_21"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_21_ISR_USED) && (defined GPT_EMIOS_2_CH_21_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_21"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_20_ISR_USED) || (defined GPT_EMIOS_2_CH_21_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_20_ISR_USED) || (defined PWM_EMIOS_2_CH_21_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_20_ISR_USED) || (defined ICU_EMIOS_2_CH_21_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 20 and 21 for eMios_2 module
-* @details   Process the interrupt of eMios channels 20 and 21
-*
-* @note   This will be defined only if eMios channels 20 or 21 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_20_CH_21_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_20_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_20_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_20_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_20 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 20)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_20 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 20)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_20_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_20);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_20_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_20);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_20_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_20);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 20),REG_READ32(EMIOS_CSR_ADDR32(2, 20)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_21_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_21_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_21_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_21 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 21)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_21 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 21)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_21_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_21);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_21_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_21);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_21_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_21);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 21),REG_READ32(EMIOS_CSR_ADDR32(2, 21)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:22,23 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_22
-*/
-#if  ((defined GPT_EMIOS_2_CH_22_USED) && (defined PWM_EMIOS_2_CH_22_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_22"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_22_USED) && (defined ICU_EMIOS_2_CH_22_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_22"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_22_ISR_USED) && (defined GPT_EMIOS_2_CH_22_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_22"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_23
-*/
-#if  ((defined GPT_EMIOS_2_CH_23_USED) && (defined PWM_EMIOS_2_CH_23_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_23"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_23_USED) && (defined ICU_EMIOS_2_CH_23_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_23"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_23_ISR_USED) && (defined GPT_EMIOS_2_CH_23_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_23"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_22_ISR_USED) || (defined GPT_EMIOS_2_CH_23_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_22_ISR_USED) || (defined PWM_EMIOS_2_CH_23_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_22_ISR_USED) || (defined ICU_EMIOS_2_CH_23_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 22 and 23 for eMios_2 module
-* @details   Process the interrupt of eMios channels 22 and 23
-*
-* @note   This will be defined only if eMios channels 22 or 23 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_22_CH_23_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_22_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_22_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_22_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_22 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 22)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_22 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 22)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_22_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_22);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_22_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_22);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_22_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_22);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 22),REG_READ32(EMIOS_CSR_ADDR32(2, 22)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_23_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_23_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_23_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_23 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 23)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_23 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 23)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_23_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_23);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_23_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_23);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_23_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_23);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 23),REG_READ32(EMIOS_CSR_ADDR32(2, 23)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:24,25 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_24
-*/
-#if  ((defined GPT_EMIOS_2_CH_24_USED) && (defined PWM_EMIOS_2_CH_24_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_24"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_24_USED) && (defined ICU_EMIOS_2_CH_24_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_24"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_24_ISR_USED) && (defined GPT_EMIOS_2_CH_24_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_24"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_25
-*/
-#if  ((defined GPT_EMIOS_2_CH_25_USED) && (defined PWM_EMIOS_2_CH_25_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_25"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_25_USED) && (defined ICU_EMIOS_2_CH_25_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_25"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_25_ISR_USED) && (defined GPT_EMIOS_2_CH_25_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_25"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_24_ISR_USED) || (defined GPT_EMIOS_2_CH_25_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_24_ISR_USED) || (defined PWM_EMIOS_2_CH_25_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_24_ISR_USED) || (defined ICU_EMIOS_2_CH_25_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 24 and 25 for eMios_2 module
-* @details   Process the interrupt of eMios channels 24 and 25
-*
-* @note   This will be defined only if eMios channels 24 or 25 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_24_CH_25_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_24_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_24_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_24_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_24 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 24)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_24 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 24)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_24_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_24);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_24_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_24);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_24_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_24);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 24),REG_READ32(EMIOS_CSR_ADDR32(2, 24)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_25_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_25_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_25_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_25 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 25)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_25 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 25)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_25_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_25);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_25_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_25);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_25_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_25);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 25),REG_READ32(EMIOS_CSR_ADDR32(2, 25)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:26,27 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_26
-*/
-#if  ((defined GPT_EMIOS_2_CH_26_USED) && (defined PWM_EMIOS_2_CH_26_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_26"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_26_USED) && (defined ICU_EMIOS_2_CH_26_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_26"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_26_ISR_USED) && (defined GPT_EMIOS_2_CH_26_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_26"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_27
-*/
-#if  ((defined GPT_EMIOS_2_CH_27_USED) && (defined PWM_EMIOS_2_CH_27_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_27"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_27_USED) && (defined ICU_EMIOS_2_CH_27_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_27"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_27_ISR_USED) && (defined GPT_EMIOS_2_CH_27_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_27"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_26_ISR_USED) || (defined GPT_EMIOS_2_CH_27_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_26_ISR_USED) || (defined PWM_EMIOS_2_CH_27_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_26_ISR_USED) || (defined ICU_EMIOS_2_CH_27_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 26 and 27 for eMios_2 module
-* @details   Process the interrupt of eMios channels 26 and 27
-*
-* @note   This will be defined only if eMios channels 26 or 27 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_26_CH_27_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_26_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_26_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_26_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_26 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 26)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_26 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 26)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_26_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_26);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_26_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_26);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_26_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_26);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 26),REG_READ32(EMIOS_CSR_ADDR32(2, 26)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_27_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_27_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_27_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_27 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 27)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_27 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 27)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_27_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_27);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_27_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_27);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_27_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_27);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 27),REG_READ32(EMIOS_CSR_ADDR32(2, 27)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:28,29 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_28
-*/
-#if  ((defined GPT_EMIOS_2_CH_28_USED) && (defined PWM_EMIOS_2_CH_28_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_28"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_28_USED) && (defined ICU_EMIOS_2_CH_28_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_28"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_28_ISR_USED) && (defined GPT_EMIOS_2_CH_28_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_28"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_29
-*/
-#if  ((defined GPT_EMIOS_2_CH_29_USED) && (defined PWM_EMIOS_2_CH_29_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_29"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_29_USED) && (defined ICU_EMIOS_2_CH_29_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_29"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_29_ISR_USED) && (defined GPT_EMIOS_2_CH_29_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_29"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_28_ISR_USED) || (defined GPT_EMIOS_2_CH_29_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_28_ISR_USED) || (defined PWM_EMIOS_2_CH_29_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_28_ISR_USED) || (defined ICU_EMIOS_2_CH_29_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 28 and 29 for eMios_2 module
-* @details   Process the interrupt of eMios channels 28 and 29
-*
-* @note   This will be defined only if eMios channels 28 or 29 are configured in GPT, ICU or PWM
-*         mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_28_CH_29_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_28_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_28_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_28_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_28 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 28)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_28 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 28)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_28_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_28);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_28_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_28);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_28_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_28);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 28),REG_READ32(EMIOS_CSR_ADDR32(2, 28)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_29_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_29_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_29_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_29 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 29)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_29 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 29)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_29_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_29);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_29_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_29);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_29_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_29);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 29),REG_READ32(EMIOS_CSR_ADDR32(2, 29)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channels:30,31 common interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_30
-*/
-#if  ((defined GPT_EMIOS_2_CH_30_USED) && (defined PWM_EMIOS_2_CH_30_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_30"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_30_USED) && (defined ICU_EMIOS_2_CH_30_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_30"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_30_ISR_USED) && (defined GPT_EMIOS_2_CH_30_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_30"
-#endif
-
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_31
-*/
-#if  ((defined GPT_EMIOS_2_CH_31_USED) && (defined PWM_EMIOS_2_CH_31_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_31"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_31_USED) && (defined ICU_EMIOS_2_CH_31_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_31"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_31_ISR_USED) && (defined GPT_EMIOS_2_CH_31_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_31"
-#endif
-
-#if ( (defined GPT_EMIOS_2_CH_30_ISR_USED) || (defined GPT_EMIOS_2_CH_31_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_30_ISR_USED) || (defined PWM_EMIOS_2_CH_31_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_30_ISR_USED) || (defined ICU_EMIOS_2_CH_31_ISR_USED) )
-
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channels : 30 and 31 for eMios_2 module
-* @details   Process the interrupt of eMios channels 30 and 31
-*
-* @note   This will be defined only if eMios channels 30 or 31 are configured in GPT, ICU or PWM
-*         mode
-*/
-/*
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_30_CH_31_ISR)
-{
-     #if ( (defined GPT_EMIOS_2_CH_30_ISR_USED) || \
-           (defined PWM_EMIOS_2_CH_30_ISR_USED) || \
-           (defined ICU_EMIOS_2_CH_30_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_30 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 30)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_30 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 30)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_30_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_30);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_30_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_30);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_30_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_30);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 30),REG_READ32(EMIOS_CSR_ADDR32(2, 30)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    #if ( (defined GPT_EMIOS_2_CH_31_ISR_USED) || \
-          (defined PWM_EMIOS_2_CH_31_ISR_USED) || \
-          (defined ICU_EMIOS_2_CH_31_ISR_USED) )
-
-    /* Check if match event occured on EMIOS_31 */
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    if ( ( REG_READ32(EMIOS_CSR_ADDR32(2, 31)) & CSR_FLAG_MASK_U32) != 0U )
-    {
-        /* Check that a match event generates an interrupt and interrupts are enabled for EMIOS_31 */
-        /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-        if ( (REG_READ32(EMIOS_CCR_ADDR32(2, 31)) & (CCR_DMA_MASK_U32 | CCR_FEN_MASK_U32)) ==
-            ((CCR_DMA_ASSIGN_INT_U32 << CCR_DMA_SHIFT) | ( CCR_FEN_ENABLE_U32 << CCR_FEN_SHIFT )))
-        {
-            #if(defined GPT_EMIOS_2_CH_31_ISR_USED)
-                Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_31);
-            #endif
-
-            #if(defined PWM_EMIOS_2_CH_31_ISR_USED)
-                Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_31);
-            #endif
-
-            #if(defined ICU_EMIOS_2_CH_31_ISR_USED)
-                Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_31);
-            #endif
-        }
-        else
-        {
-            REG_WRITE32(EMIOS_CSR_ADDR32(2, 31),REG_READ32(EMIOS_CSR_ADDR32(2, 31)) & (uint32)(CSR_OVR_BIT_U32 | CSR_OVFL_BIT_U32 | CSR_FLAG_BIT_U32));
-        }
-    }
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-/*********************************** EMIOS 2 common interrupts END ********************************/
-
-#else  /* EMIOS_COMMON_ISR_HANDLER == STD_OFF */
-/*================================================================================================*/
-/*                     CHANNEL INDEPENDENT EMIOS INTERRUPT SERVICE ROUTINES DEFINITION            */
-/*================================================================================================*/
-/*********************************** EMIOS 0 independent interrupts START *************************/
-/*
-* @brief EMIOS module:0 channel:0 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_0
-*/
-#if  ((defined GPT_EMIOS_0_CH_0_USED) && (defined PWM_EMIOS_0_CH_0_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_0"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_0_USED) && (defined ICU_EMIOS_0_CH_0_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_0"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_0_ISR_USED) && (defined GPT_EMIOS_0_CH_0_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_0"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_0_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_0_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_0_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 0 for eMios_0 module
-* @details   Process the interrupt of eMios channel 0
-*
-* @note   This will be defined only if eMios channel 0 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_0_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_0_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_0);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_0_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_0);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_0_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_0);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:1 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_1
-*/
-#if  ((defined GPT_EMIOS_0_CH_1_USED) && (defined PWM_EMIOS_0_CH_1_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_1"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_1_USED) && (defined ICU_EMIOS_0_CH_1_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_1"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_1_ISR_USED) && (defined GPT_EMIOS_0_CH_1_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_1"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_1_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_1_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_1_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 1 for eMios_0 module
-* @details   Process the interrupt of eMios channel 1
-*
-* @note   This will be defined only if eMios channel 1 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_1_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_1_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_1);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_1_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_1);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_1_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_1);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:2 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_2
-*/
-#if  ((defined GPT_EMIOS_0_CH_2_USED) && (defined PWM_EMIOS_0_CH_2_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_2"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_2_USED) && (defined ICU_EMIOS_0_CH_2_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_2"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_2_ISR_USED) && (defined GPT_EMIOS_0_CH_2_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_2"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_2_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_2_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_2_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 2 for eMios_0 module
-* @details   Process the interrupt of eMios channel 2
-*
-* @note   This will be defined only if eMios channel 2 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_2_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_2_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_2);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_2_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_2);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_2_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_2);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:3 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_3
-*/
-#if  ((defined GPT_EMIOS_0_CH_3_USED) && (defined PWM_EMIOS_0_CH_3_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_3"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_3_USED) && (defined ICU_EMIOS_0_CH_3_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_3"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_3_ISR_USED) && (defined GPT_EMIOS_0_CH_3_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_3"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_3_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_3_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_3_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 3 for eMios_0 module
-* @details   Process the interrupt of eMios channel 3
-*
-* @note   This will be defined only if eMios channel 3 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_3_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_3_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_3);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_3_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_3);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_3_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_3);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:4 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_4
-*/
-#if  ((defined GPT_EMIOS_0_CH_4_USED) && (defined PWM_EMIOS_0_CH_4_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_4"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_4_USED) && (defined ICU_EMIOS_0_CH_4_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_4"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_4_ISR_USED) && (defined GPT_EMIOS_0_CH_4_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_4"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_4_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_4_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_4_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 4 for eMios_0 module
-* @details   Process the interrupt of eMios channel 4
-*
-* @note   This will be defined only if eMios channel 4 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_4_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_4_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_4);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_4_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_4);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_4_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_4);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:5 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_5
-*/
-#if  ((defined GPT_EMIOS_0_CH_5_USED) && (defined PWM_EMIOS_0_CH_5_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_5"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_5_USED) && (defined ICU_EMIOS_0_CH_5_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_5"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_5_ISR_USED) && (defined GPT_EMIOS_0_CH_5_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_5"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_5_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_5_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_5_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 5 for eMios_0 module
-* @details   Process the interrupt of eMios channel 5
-*
-* @note   This will be defined only if eMios channel 5 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_5_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_5_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_5);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_5_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_5);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_5_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_5);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:6 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_6
-*/
-#if  ((defined GPT_EMIOS_0_CH_6_USED) && (defined PWM_EMIOS_0_CH_6_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_6"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_6_USED) && (defined ICU_EMIOS_0_CH_6_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_6"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_6_ISR_USED) && (defined GPT_EMIOS_0_CH_6_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_6"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_6_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_6_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_6_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 6 for eMios_0 module
-* @details   Process the interrupt of eMios channel 6
-*
-* @note   This will be defined only if eMios channel 6 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_6_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_6_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_6);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_6_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_6);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_6_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_6);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:7 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_0_CH_7
-*/
-#if  ((defined GPT_EMIOS_0_CH_7_USED) && (defined PWM_EMIOS_0_CH_7_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_7"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_7_USED) && (defined ICU_EMIOS_0_CH_7_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_7"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_7_ISR_USED) && (defined GPT_EMIOS_0_CH_7_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_7"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_7_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_7_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_7_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 7 for eMios_0 module
-* @details   Process the interrupt of eMios channel 7
-*
-* @note   This will be defined only if eMios channel 7 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_7_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_7_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_7);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_7_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_7);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_7_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_7);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:8 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_8
-*/
-
-#if  ((defined GPT_EMIOS_0_CH_8_USED) && (defined PWM_EMIOS_0_CH_8_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_8"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_8_USED) && (defined ICU_EMIOS_0_CH_8_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_8"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_8_ISR_USED) && (defined GPT_EMIOS_0_CH_8_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_8"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_8_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_8_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_8_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 8 for eMios_0 module
-* @details   Process the interrupt of eMios channel 8
-*
-* @note   This will be defined only if eMios channel 8 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_8_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_8_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_8);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_8_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_8);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_8_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_8);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:9 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_9
-*/
-#if  ((defined GPT_EMIOS_0_CH_9_USED) && (defined PWM_EMIOS_0_CH_9_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_9"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_9_USED) && (defined ICU_EMIOS_0_CH_9_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_9"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_9_ISR_USED) && (defined GPT_EMIOS_0_CH_9_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_9"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_9_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_9_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_9_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 9 for eMios_0 module
-* @details   Process the interrupt of eMios channel 9
-*
-* @note   This will be defined only if eMios channel 9 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_9_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_9_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_9);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_9_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_9);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_9_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_9);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:10 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_10
-*/
-#if  ((defined GPT_EMIOS_0_CH_10_USED) && (defined PWM_EMIOS_0_CH_10_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_10"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_10_USED) && (defined ICU_EMIOS_0_CH_10_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_10"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_10_ISR_USED) && (defined GPT_EMIOS_0_CH_10_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_10"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_10_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_10_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_10_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 10 for eMios_0 module
-* @details   Process the interrupt of eMios channel 10
-*
-* @note   This will be defined only if eMios channel 10 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_10_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_10_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_10);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_10_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_10);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_10_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_10);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:11 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_11
-*/
-#if  ((defined GPT_EMIOS_0_CH_11_USED) && (defined PWM_EMIOS_0_CH_11_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_11"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_11_USED) && (defined ICU_EMIOS_0_CH_11_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_11"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_11_ISR_USED) && (defined GPT_EMIOS_0_CH_11_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_11"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_11_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_11_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_11_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 11 for eMios_0 module
-* @details   Process the interrupt of eMios channel 11
-*
-* @note   This will be defined only if eMios channel 11 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_11_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_11_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_11);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_11_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_11);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_11_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_11);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:12 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_12
-*/
-#if  ((defined GPT_EMIOS_0_CH_12_USED) && (defined PWM_EMIOS_0_CH_12_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_12"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_12_USED) && (defined ICU_EMIOS_0_CH_12_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_12"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_12_ISR_USED) && (defined GPT_EMIOS_0_CH_12_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_12"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_12_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_12_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_12_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 12 for eMios_0 module
-* @details   Process the interrupt of eMios channel 12
-*
-* @note   This will be defined only if eMios channel 12 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_12_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_12_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_12);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_12_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_12);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_12_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_12);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:13 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_13
-*/
-#if  ((defined GPT_EMIOS_0_CH_13_USED) && (defined PWM_EMIOS_0_CH_13_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_13"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_13_USED) && (defined ICU_EMIOS_0_CH_13_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_13"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_13_ISR_USED) && (defined GPT_EMIOS_0_CH_13_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_13"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_13_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_13_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_13_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 13 for eMios_0 module
-* @details   Process the interrupt of eMios channel 13
-*
-* @note   This will be defined only if eMios channel 13 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_13_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_13_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_13);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_13_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_13);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_13_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_13);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:14 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_14
-*/
-#if  ((defined GPT_EMIOS_0_CH_14_USED) && (defined PWM_EMIOS_0_CH_14_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_14"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_14_USED) && (defined ICU_EMIOS_0_CH_14_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_14"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_14_ISR_USED) && (defined GPT_EMIOS_0_CH_14_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_14"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_14_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_14_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_14_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 14 for eMios_0 module
-* @details   Process the interrupt of eMios channel 14
-*
-* @note   This will be defined only if eMios channel 14 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_14_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_14_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_14);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_14_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_14);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_14_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_14);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:15 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_15
-*/
-#if  ((defined GPT_EMIOS_0_CH_15_USED) && (defined PWM_EMIOS_0_CH_15_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_15"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_15_USED) && (defined ICU_EMIOS_0_CH_15_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_15"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_15_ISR_USED) && (defined GPT_EMIOS_0_CH_15_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_15"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_15_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_15_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_15_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 15 for eMios_0 module
-* @details   Process the interrupt of eMios channel 15
-*
-* @note   This will be defined only if eMios channel 15 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_15_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_15_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_15);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_15_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_15);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_15_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_15);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:16 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_16
-*/
-#if  ((defined GPT_EMIOS_0_CH_16_USED) && (defined PWM_EMIOS_0_CH_16_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_16"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_16_USED) && (defined ICU_EMIOS_0_CH_16_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_16"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_16_ISR_USED) && (defined GPT_EMIOS_0_CH_16_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_16"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_16_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_16_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_16_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 16 for eMios_0 module
-* @details   Process the interrupt of eMios channel 16
-*
-* @note   This will be defined only if eMios channel 16 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_16_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_16_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_16);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_16_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_16);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_16_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_16);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:17 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_17
-*/
-#if  ((defined GPT_EMIOS_0_CH_17_USED) && (defined PWM_EMIOS_0_CH_17_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_17"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_17_USED) && (defined ICU_EMIOS_0_CH_17_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_17"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_17_ISR_USED) && (defined GPT_EMIOS_0_CH_17_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_17"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_17_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_17_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_17_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 17 for eMios_0 module
-* @details   Process the interrupt of eMios channel 17
-*
-* @note   This will be defined only if eMios channel 17 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_17_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_17_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_17);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_17_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_17);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_17_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_17);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:18 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_18
-*/
-#if  ((defined GPT_EMIOS_0_CH_18_USED) && (defined PWM_EMIOS_0_CH_18_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_18"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_18_USED) && (defined ICU_EMIOS_0_CH_18_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_18"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_18_ISR_USED) && (defined GPT_EMIOS_0_CH_18_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_18"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_18_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_18_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_18_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 18 for eMios_0 module
-* @details   Process the interrupt of eMios channel 18
-*
-* @note   This will be defined only if eMios channel 18 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_18_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_18_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_18);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_18_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_18);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_18_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_18);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:19 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_19
-*/
-#if  ((defined GPT_EMIOS_0_CH_19_USED) && (defined PWM_EMIOS_0_CH_19_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_19"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_19_USED) && (defined ICU_EMIOS_0_CH_19_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_19"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_19_ISR_USED) && (defined GPT_EMIOS_0_CH_19_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_19"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_19_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_19_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_19_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 19 for eMios_0 module
-* @details   Process the interrupt of eMios channel 19
-*
-* @note   This will be defined only if eMios channel 19 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_19_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_19_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_19);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_19_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_19);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_19_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_19);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:20 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_20
-*/
-#if  ((defined GPT_EMIOS_0_CH_20_USED) && (defined PWM_EMIOS_0_CH_20_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_20"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_20_USED) && (defined ICU_EMIOS_0_CH_20_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_20"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_20_ISR_USED) && (defined GPT_EMIOS_0_CH_20_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_20"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_20_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_20_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_20_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 20 for eMios_0 module
-* @details   Process the interrupt of eMios channel 20
-*
-* @note   This will be defined only if eMios channel 20 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_20_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_20_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_20);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_20_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_20);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_20_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_20);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:21 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_21
-*/
-#if  ((defined GPT_EMIOS_0_CH_21_USED) && (defined PWM_EMIOS_0_CH_21_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_21"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_21_USED) && (defined ICU_EMIOS_0_CH_21_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_21"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_21_ISR_USED) && (defined GPT_EMIOS_0_CH_21_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_21"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_21_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_21_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_21_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 21 for eMios_0 module
-* @details   Process the interrupt of eMios channel 21
-*
-* @note   This will be defined only if eMios channel 21 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_21_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_21_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_21);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_21_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_21);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_21_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_21);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:22 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_22
-*/
-#if  ((defined GPT_EMIOS_0_CH_22_USED) && (defined PWM_EMIOS_0_CH_22_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_22"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_22_USED) && (defined ICU_EMIOS_0_CH_22_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_22"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_22_ISR_USED) && (defined GPT_EMIOS_0_CH_22_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_22"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_22_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_22_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_22_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 22 for eMios_0 module
-* @details   Process the interrupt of eMios channel 22
-*
-* @note   This will be defined only if eMios channel 22 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_22_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_22_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_22);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_22_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_22);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_22_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_22);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:23 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_23
-*/
-#if  ((defined GPT_EMIOS_0_CH_23_USED) && (defined PWM_EMIOS_0_CH_23_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_23"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_23_USED) && (defined ICU_EMIOS_0_CH_23_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_23"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_23_ISR_USED) && (defined GPT_EMIOS_0_CH_23_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_23"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_23_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_23_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_23_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 23 for eMios_0 module
-* @details   Process the interrupt of eMios channel 23
-*
-* @note   This will be defined only if eMios channel 23 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_23_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_23_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_23);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_23_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_23);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_23_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_23);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:24 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_24
-*/
-#if  ((defined GPT_EMIOS_0_CH_24_USED) && (defined PWM_EMIOS_0_CH_24_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_24"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_24_USED) && (defined ICU_EMIOS_0_CH_24_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_24"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_24_ISR_USED) && (defined GPT_EMIOS_0_CH_24_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_24"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_24_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_24_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_24_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 24 for eMios_0 module
-* @details   Process the interrupt of eMios channel 24
-*
-* @note   This will be defined only if eMios channel 24 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_24_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_24_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_24);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_24_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_24);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_24_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_24);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:25 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_25
-*/
-#if  ((defined GPT_EMIOS_0_CH_25_USED) && (defined PWM_EMIOS_0_CH_25_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_25"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_25_USED) && (defined ICU_EMIOS_0_CH_25_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_25"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_25_ISR_USED) && (defined GPT_EMIOS_0_CH_25_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_25"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_25_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_25_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_25_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 25 for eMios_0 module
-* @details   Process the interrupt of eMios channel 25
-*
-* @note   This will be defined only if eMios channel 25 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_25_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_25_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_25);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_25_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_25);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_25_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_25);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:26 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_26
-*/
-#if  ((defined GPT_EMIOS_0_CH_26_USED) && (defined PWM_EMIOS_0_CH_26_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_26"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_26_USED) && (defined ICU_EMIOS_0_CH_26_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_26"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_26_ISR_USED) && (defined GPT_EMIOS_0_CH_26_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_26"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_26_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_26_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_26_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 26 for eMios_0 module
-* @details   Process the interrupt of eMios channel 26
-*
-* @note   This will be defined only if eMios channel 26 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_26_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_26_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_26);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_26_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_26);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_26_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_26);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:27 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_27
-*/
-#if  ((defined GPT_EMIOS_0_CH_27_USED) && (defined PWM_EMIOS_0_CH_27_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_27"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_27_USED) && (defined ICU_EMIOS_0_CH_27_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_27"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_27_ISR_USED) && (defined GPT_EMIOS_0_CH_27_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_27"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_27_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_27_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_27_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 27 for eMios_0 module
-* @details   Process the interrupt of eMios channel 27
-*
-* @note   This will be defined only if eMios channel 27 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_27_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_27_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_27);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_27_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_27);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_27_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_27);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:28 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_28
-*/
-#if  ((defined GPT_EMIOS_0_CH_28_USED) && (defined PWM_EMIOS_0_CH_28_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_28"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_28_USED) && (defined ICU_EMIOS_0_CH_28_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_28"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_28_ISR_USED) && (defined GPT_EMIOS_0_CH_28_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_28"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_28_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_28_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_28_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 28 for eMios_0 module
-* @details   Process the interrupt of eMios channel 28
-*
-* @note   This will be defined only if eMios channel 28 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_28_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_28_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_28);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_28_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_28);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_28_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_28);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:29 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_29
-*/
-#if  ((defined GPT_EMIOS_0_CH_29_USED) && (defined PWM_EMIOS_0_CH_29_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_29"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_29_USED) && (defined ICU_EMIOS_0_CH_29_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_29"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_29_ISR_USED) && (defined GPT_EMIOS_0_CH_29_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_29"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_29_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_29_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_29_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 29 for eMios_0 module
-* @details   Process the interrupt of eMios channel 29
-*
-* @note   This will be defined only if eMios channel 29 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_29_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_29_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_29);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_29_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_29);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_29_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_29);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:30 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_30
-*/
-#if  ((defined GPT_EMIOS_0_CH_30_USED) && (defined PWM_EMIOS_0_CH_30_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_30"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_30_USED) && (defined ICU_EMIOS_0_CH_30_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_30"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_30_ISR_USED) && (defined GPT_EMIOS_0_CH_30_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_30"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_30_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_30_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_30_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 30 for eMios_0 module
-* @details   Process the interrupt of eMios channel 30
-*
-* @note   This will be defined only if eMios channel 30 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_30_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_30_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_30);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_30_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_30);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_30_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_30);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:0 channel:31 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_0_CH_31
-*/
-#if  ((defined GPT_EMIOS_0_CH_31_USED) && (defined PWM_EMIOS_0_CH_31_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_0_31"
-#endif
-
-#if  ((defined PWM_EMIOS_0_CH_31_USED) && (defined ICU_EMIOS_0_CH_31_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_0_31"
-#endif
-
-#if  ((defined ICU_EMIOS_0_CH_31_ISR_USED) && (defined GPT_EMIOS_0_CH_31_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_0_31"
-#endif
-
-
-#if ( (defined GPT_EMIOS_0_CH_31_ISR_USED) || \
-      (defined PWM_EMIOS_0_CH_31_ISR_USED) || \
-      (defined ICU_EMIOS_0_CH_31_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 31 for eMios_0 module
-* @details   Process the interrupt of eMios channel 31
-*
-* @note   This will be defined only if eMios channel 31 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_0_CH_31_ISR)
-{
-
-    #if(defined GPT_EMIOS_0_CH_31_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_0_CH_31);
-    #endif
-
-    #if(defined PWM_EMIOS_0_CH_31_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_0_CH_31);
-    #endif
-
-    #if(defined ICU_EMIOS_0_CH_31_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_0_CH_31);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-
-/*********************************** EMIOS 0 independent interrupts END ***************************/
-
-
-
-/*********************************** EMIOS 1 independent interrupts START *************************/
-
-
-/*
-* @brief EMIOS module:1 channel:0 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_0
-*/
-#if  ((defined GPT_EMIOS_1_CH_0_USED) && (defined PWM_EMIOS_1_CH_0_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_0"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_0_USED) && (defined ICU_EMIOS_1_CH_0_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_0"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_0_ISR_USED) && (defined GPT_EMIOS_1_CH_0_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_0"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_0_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_0_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_0_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 0 for eMios_1 module
-* @details   Process the interrupt of eMios channel 0
-*
-* @note   This will be defined only if eMios channel 0 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_0_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_0_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_0);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_0_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_0);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_0_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_0);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:1 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_1
-*/
-#if  ((defined GPT_EMIOS_1_CH_1_USED) && (defined PWM_EMIOS_1_CH_1_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_1"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_1_USED) && (defined ICU_EMIOS_1_CH_1_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_1"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_1_ISR_USED) && (defined GPT_EMIOS_1_CH_1_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_1"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_1_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_1_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_1_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 1 for eMios_1 module
-* @details   Process the interrupt of eMios channel 1
-*
-* @note   This will be defined only if eMios channel 1 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_1_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_1_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_1);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_1_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_1);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_1_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_1);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:2 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_2
-*/
-#if  ((defined GPT_EMIOS_1_CH_2_USED) && (defined PWM_EMIOS_1_CH_2_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_2"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_2_USED) && (defined ICU_EMIOS_1_CH_2_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_2"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_2_ISR_USED) && (defined GPT_EMIOS_1_CH_2_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_2"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_2_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_2_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_2_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 2 for eMios_1 module
-* @details   Process the interrupt of eMios channel 2
-*
-* @note   This will be defined only if eMios channel 2 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_2_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_2_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_2);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_2_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_2);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_2_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_2);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:3 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_3
-*/
-#if  ((defined GPT_EMIOS_1_CH_3_USED) && (defined PWM_EMIOS_1_CH_3_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_3"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_3_USED) && (defined ICU_EMIOS_1_CH_3_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_3"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_3_ISR_USED) && (defined GPT_EMIOS_1_CH_3_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_3"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_3_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_3_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_3_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 3 for eMios_1 module
-* @details   Process the interrupt of eMios channel 3
-*
-* @note   This will be defined only if eMios channel 3 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_3_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_3_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_3);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_3_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_3);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_3_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_3);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:4 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_4
-*/
-#if  ((defined GPT_EMIOS_1_CH_4_USED) && (defined PWM_EMIOS_1_CH_4_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_4"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_4_USED) && (defined ICU_EMIOS_1_CH_4_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_4"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_4_ISR_USED) && (defined GPT_EMIOS_1_CH_4_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_4"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_4_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_4_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_4_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 4 for eMios_1 module
-* @details   Process the interrupt of eMios channel 4
-*
-* @note   This will be defined only if eMios channel 4 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-/*
-
-*/
-ISR(EMIOS_1_CH_4_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_4_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_4);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_4_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_4);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_4_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_4);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:5 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_5
-*/
-#if  ((defined GPT_EMIOS_1_CH_5_USED) && (defined PWM_EMIOS_1_CH_5_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_5"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_5_USED) && (defined ICU_EMIOS_1_CH_5_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_5"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_5_ISR_USED) && (defined GPT_EMIOS_1_CH_5_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_5"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_5_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_5_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_5_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 5 for eMios_1 module
-* @details   Process the interrupt of eMios channel 5
-*
-* @note   This will be defined only if eMios channel 5 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_5_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_5_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_5);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_5_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_5);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_5_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_5);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:6 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_6
-*/
-#if  ((defined GPT_EMIOS_1_CH_6_USED) && (defined PWM_EMIOS_1_CH_6_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_6"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_6_USED) && (defined ICU_EMIOS_1_CH_6_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_6"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_6_ISR_USED) && (defined GPT_EMIOS_1_CH_6_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_6"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_6_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_6_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_6_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 6 for eMios_1 module
-* @details   Process the interrupt of eMios channel 6
-*
-* @note   This will be defined only if eMios channel 6 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_6_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_6_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_6);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_6_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_6);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_6_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_6);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:7 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_7
-*/
-#if  ((defined GPT_EMIOS_1_CH_7_USED) && (defined PWM_EMIOS_1_CH_7_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_7"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_7_USED) && (defined ICU_EMIOS_1_CH_7_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_7"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_7_ISR_USED) && (defined GPT_EMIOS_1_CH_7_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_7"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_7_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_7_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_7_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 7 for eMios_1 module
-* @details   Process the interrupt of eMios channel 7
-*
-* @note   This will be defined only if eMios channel 7 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_7_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_7_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_7);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_7_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_7);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_7_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_7);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:8 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_8
-*/
-#if  ((defined GPT_EMIOS_1_CH_8_USED) && (defined PWM_EMIOS_1_CH_8_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_8"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_8_USED) && (defined ICU_EMIOS_1_CH_8_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_8"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_8_ISR_USED) && (defined GPT_EMIOS_1_CH_8_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_8"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_8_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_8_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_8_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 8 for eMios_1 module
-* @details   Process the interrupt of eMios channel 8
-*
-* @note   This will be defined only if eMios channel 8 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_8_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_8_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_8);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_8_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_8);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_8_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_8);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:9 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_9
-*/
-#if  ((defined GPT_EMIOS_1_CH_9_USED) && (defined PWM_EMIOS_1_CH_9_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_9"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_9_USED) && (defined ICU_EMIOS_1_CH_9_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_9"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_9_ISR_USED) && (defined GPT_EMIOS_1_CH_9_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_9"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_9_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_9_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_9_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 9 for eMios_1 module
-* @details   Process the interrupt of eMios channel 9
-*
-* @note   This will be defined only if eMios channel 9 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_9_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_9_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_9);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_9_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_9);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_9_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_9);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:10 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_10
-*/
-#if  ((defined GPT_EMIOS_1_CH_10_USED) && (defined PWM_EMIOS_1_CH_10_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_10"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_10_USED) && (defined ICU_EMIOS_1_CH_10_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_10"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_10_ISR_USED) && (defined GPT_EMIOS_1_CH_10_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_10"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_10_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_10_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_10_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 10 for eMios_1 module
-* @details   Process the interrupt of eMios channel 10
-*
-* @note      This will be defined only if eMios channel 10 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_10_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_10_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_10);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_10_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_10);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_10_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_10);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:11 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_11
-*/
-#if  ((defined GPT_EMIOS_1_CH_11_USED) && (defined PWM_EMIOS_1_CH_11_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_11"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_11_USED) && (defined ICU_EMIOS_1_CH_11_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_11"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_11_ISR_USED) && (defined GPT_EMIOS_1_CH_11_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_11"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_11_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_11_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_11_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 11 for eMios_1 module
-* @details   Process the interrupt of eMios channel 11
-*
-* @note   This will be defined only if eMios channel 11 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_11_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_11_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_11);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_11_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_11);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_11_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_11);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:12 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_12
-*/
-#if  ((defined GPT_EMIOS_1_CH_12_USED) && (defined PWM_EMIOS_1_CH_12_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_12"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_12__USED) && (defined ICU_EMIOS_1_CH_12_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_12"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_12_ISR_USED) && (defined GPT_EMIOS_1_CH_12_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_12"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_12_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_12_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_12_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 12 for eMios_1 module
-* @details   Process the interrupt of eMios channel 12
-*
-* @note   This will be defined only if eMios channel 12 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_12_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_12_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_12);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_12_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_12);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_12_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_12);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:13 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_13
-*/
-#if  ((defined GPT_EMIOS_1_CH_13_USED) && (defined PWM_EMIOS_1_CH_13_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_13"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_13_USED) && (defined ICU_EMIOS_1_CH_13_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_13"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_13_ISR_USED) && (defined GPT_EMIOS_1_CH_13_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_13"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_13_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_13_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_13_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 13 for eMios_1 module
-* @details   Process the interrupt of eMios channel 13
-*
-* @note   This will be defined only if eMios channel 13 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_13_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_13_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_13);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_13_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_13);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_13_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_13);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:14 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_14
-*/
-#if  ((defined GPT_EMIOS_1_CH_14_USED) && (defined PWM_EMIOS_1_CH_14_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_14"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_14_USED) && (defined ICU_EMIOS_1_CH_14_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_14"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_14_ISR_USED) && (defined GPT_EMIOS_1_CH_14_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_14"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_14_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_14_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_14_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 14 for eMios_1 module
-* @details   Process the interrupt of eMios channel 14
-*
-* @note   This will be defined only if eMios channel 14 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_14_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_14_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_14);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_14_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_14);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_14_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_14);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:15 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_15
-*/
-#if  ((defined GPT_EMIOS_1_CH_15_USED) && (defined PWM_EMIOS_1_CH_15_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_15"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_15_USED) && (defined ICU_EMIOS_1_CH_15_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_15"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_15_ISR_USED) && (defined GPT_EMIOS_1_CH_15_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_15"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_15_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_15_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_15_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 15 for eMios_1 module
-* @details   Process the interrupt of eMios channel 15
-*
-* @note   This will be defined only if eMios channel 15 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_15_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_15_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_15);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_15_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_15);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_15_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_15);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:16 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_16
-*/
-#if  ((defined GPT_EMIOS_1_CH_16_USED) && (defined PWM_EMIOS_1_CH_16_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_16"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_16_USED) && (defined ICU_EMIOS_1_CH_16_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_16"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_16_ISR_USED) && (defined GPT_EMIOS_1_CH_16_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_16"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_16_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_16_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_16_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 16 for eMios_1 module
-* @details   Process the interrupt of eMios channel 16
-*
-* @note   This will be defined only if eMios channel 16 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_16_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_16_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_16);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_16_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_16);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_16_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_16);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:17 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_17
-*/
-#if  ((defined GPT_EMIOS_1_CH_17_USED) && (defined PWM_EMIOS_1_CH_17_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_17"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_17_USED) && (defined ICU_EMIOS_1_CH_17_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_17"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_17_ISR_USED) && (defined GPT_EMIOS_1_CH_17_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_17"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_17_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_17_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_17_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 17 for eMios_1 module
-* @details   Process the interrupt of eMios channel 17
-*
-* @note   This will be defined only if eMios channel 17 is configured in GPT, ICU or PWM mode
-*/
-/*
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_17_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_17_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_17);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_17_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_17);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_17_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_17);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:18 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_18
-*/
-#if  ((defined GPT_EMIOS_1_CH_18_USED) && (defined PWM_EMIOS_1_CH_18_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_18"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_18_USED) && (defined ICU_EMIOS_1_CH_18_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_18"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_18_ISR_USED) && (defined GPT_EMIOS_1_CH_18_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_18"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_18_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_18_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_18_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 18 for eMios_1 module
-* @details   Process the interrupt of eMios channel 18
-*
-* @note   This will be defined only if eMios channel 18 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_18_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_18_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_18);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_18_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_18);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_18_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_18);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:19 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_19
-*/
-#if  ((defined GPT_EMIOS_1_CH_19_USED) && (defined PWM_EMIOS_1_CH_19_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_19"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_19_USED) && (defined ICU_EMIOS_1_CH_19_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_19"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_19_ISR_USED) && (defined GPT_EMIOS_1_CH_19_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_19"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_19_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_19_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_19_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 19 for eMios_1 module
-* @details   Process the interrupt of eMios channel 19
-*
-* @note   This will be defined only if eMios channel 19 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_19_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_19_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_19);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_19_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_19);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_19_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_19);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:20 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_20
-*/
-#if  ((defined GPT_EMIOS_1_CH_20_USED) && (defined PWM_EMIOS_1_CH_20_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_20"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_20_USED) && (defined ICU_EMIOS_1_CH_20_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_20"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_20_ISR_USED) && (defined GPT_EMIOS_1_CH_20_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_20"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_20_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_20_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_20_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 20 for eMios_1 module
-* @details   Process the interrupt of eMios channel 20
-*
-* @note   This will be defined only if eMios channel 20 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_20_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_20_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_20);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_20_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_20);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_20_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_20);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:21 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_21
-*/
-#if  ((defined GPT_EMIOS_1_CH_21_USED) && (defined PWM_EMIOS_1_CH_21_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_21"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_21_USED) && (defined ICU_EMIOS_1_CH_21_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_21"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_21_ISR_USED) && (defined GPT_EMIOS_1_CH_21_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_21"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_21_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_21_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_21_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 21 for eMios_1 module
-* @details   Process the interrupt of eMios channel 21
-*
-* @note   This will be defined only if eMios channel 21 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_21_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_21_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_21);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_21_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_21);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_21_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_21);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/**
-    @brief EMIOS module:1 channel:22 independent interrupt handler
-*/
-
-/**
-    @brief resource conflict check for EMIOS_1_CH_22
-*/
-#if  ((defined GPT_EMIOS_1_CH_22_USED) && (defined PWM_EMIOS_1_CH_22_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_22"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_22_USED) && (defined ICU_EMIOS_1_CH_22_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_22"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_22_ISR_USED) && (defined GPT_EMIOS_1_CH_22_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_22"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_22_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_22_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_22_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 22 for eMios_1 module
-* @details   Process the interrupt of eMios channel 22
-*
-* @note   This will be defined only if eMios channel 22 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_22_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_22_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_22);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_22_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_22);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_22_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_22);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:23 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_23
-*/
-#if  ((defined GPT_EMIOS_1_CH_23_USED) && (defined PWM_EMIOS_1_CH_23_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_23"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_23_USED) && (defined ICU_EMIOS_1_CH_23_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_23"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_23_ISR_USED) && (defined GPT_EMIOS_1_CH_23_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_23"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_23_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_23_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_23_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 23 for eMios_1 module
-* @details   Process the interrupt of eMios channel 23
-*
-* @note   This will be defined only if eMios channel 23 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_23_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_23_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_23);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_23_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_23);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_23_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_23);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:24 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_24
-*/
-#if  ((defined GPT_EMIOS_1_CH_24_USED) && (defined PWM_EMIOS_1_CH_24_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_24"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_24_USED) && (defined ICU_EMIOS_1_CH_24_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_24"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_24_ISR_USED) && (defined GPT_EMIOS_1_CH_24_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_24"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_24_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_24_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_24_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 24 for eMios_1 module
-* @details   Process the interrupt of eMios channel 24
-*
-* @note   This will be defined only if eMios channel 24 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_24_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_24_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_24);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_24_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_24);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_24_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_24);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:25 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_25
-*/
-#if  ((defined GPT_EMIOS_1_CH_25_USED) && (defined PWM_EMIOS_1_CH_25_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_25"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_25_USED) && (defined ICU_EMIOS_1_CH_25_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_25"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_25_ISR_USED) && (defined GPT_EMIOS_1_CH_25_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_25"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_25_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_25_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_25_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 25 for eMios_1 module
-* @details   Process the interrupt of eMios channel 25
-*
-* @note   This will be defined only if eMios channel 25 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_25_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_25_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_25);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_25_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_25);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_25_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_25);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:26 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_26
-*/
-#if  ((defined GPT_EMIOS_1_CH_26_USED) && (defined PWM_EMIOS_1_CH_26_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_26"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_26_USED) && (defined ICU_EMIOS_1_CH_26_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_26"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_26_ISR_USED) && (defined GPT_EMIOS_1_CH_26_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_26"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_26_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_26_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_26_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 26 for eMios_1 module
-* @details   Process the interrupt of eMios channel 26
-*
-* @note   This will be defined only if eMios channel 26 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_26_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_26_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_26);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_26_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_26);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_26_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_26);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:27 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_27
-*/
-#if  ((defined GPT_EMIOS_1_CH_27_USED) && (defined PWM_EMIOS_1_CH_27_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_27"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_27_USED) && (defined ICU_EMIOS_1_CH_27_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_27"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_27_ISR_USED) && (defined GPT_EMIOS_1_CH_27_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_27"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_27_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_27_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_27_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 27 for eMios_1 module
-* @details   Process the interrupt of eMios channel 27
-*
-* @note   This will be defined only if eMios channel 27 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_27_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_27_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_27);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_27_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_27);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_27_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_27);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:28 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_28
-*/
-#if  ((defined GPT_EMIOS_1_CH_28_USED) && (defined PWM_EMIOS_1_CH_28_USED))
-     #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_28"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_28_USED) && (defined ICU_EMIOS_1_CH_28_ISR_USED))
-     #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_28"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_28_ISR_USED) && (defined GPT_EMIOS_1_CH_28_USED))
-     #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_28"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_28_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_28_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_28_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 28 for eMios_1 module
-* @details   Process the interrupt of eMios channel 28
-*
-* @note   This will be defined only if eMios channel 28 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_28_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_28_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_28);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_28_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_28);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_28_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_28);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:29 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_29
-*/
-#if  ((defined GPT_EMIOS_1_CH_29_USED) && (defined PWM_EMIOS_1_CH_29_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_29"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_29_USED) && (defined ICU_EMIOS_1_CH_29_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_29"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_29_ISR_USED) && (defined GPT_EMIOS_1_CH_29_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_29"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_29_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_29_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_29_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 29 for eMios_1 module
-* @details   Process the interrupt of eMios channel 29
-*
-* @note   This will be defined only if eMios channel 29 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_29_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_29_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_29);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_29_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_29);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_29_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_29);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:30 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_30
-*/
-#if  ((defined GPT_EMIOS_1_CH_30_USED) && (defined PWM_EMIOS_1_CH_30_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_30"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_30_USED) && (defined ICU_EMIOS_1_CH_30_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_30"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_30_ISR_USED) && (defined GPT_EMIOS_1_CH_30_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_30"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_30_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_30_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_30_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 30 for eMios_1 module
-* @details   Process the interrupt of eMios channel 30
-*
-* @note   This will be defined only if eMios channel 30 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_30_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_30_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_30);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_30_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_30);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_30_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_30);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:1 channel:31 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_1_CH_31
-*/
-#if  ((defined GPT_EMIOS_1_CH_31_USED) && (defined PWM_EMIOS_1_CH_31_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_1_31"
-#endif
-
-#if  ((defined PWM_EMIOS_1_CH_31_USED) && (defined ICU_EMIOS_1_CH_31_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_1_31"
-#endif
-
-#if  ((defined ICU_EMIOS_1_CH_31_ISR_USED) && (defined GPT_EMIOS_1_CH_31_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_1_31"
-#endif
-
-
-#if ( (defined GPT_EMIOS_1_CH_31_ISR_USED) || \
-      (defined PWM_EMIOS_1_CH_31_ISR_USED) || \
-      (defined ICU_EMIOS_1_CH_31_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 31 for eMios_1 module
-* @details   Process the interrupt of eMios channel 31
-*
-* @note   This will be defined only if eMios channel 31 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_1_CH_31_ISR)
-{
-
-    #if(defined GPT_EMIOS_1_CH_31_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_1_CH_31);
-    #endif
-
-    #if(defined PWM_EMIOS_1_CH_31_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_1_CH_31);
-    #endif
-
-    #if(defined ICU_EMIOS_1_CH_31_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_1_CH_31);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-
-/*********************************** EMIOS 1 independent interrupts END ***************************/
-
-/********************************** EMIOS 2 independent interrupts START **************************/
-
-/*
-* @brief EMIOS module:2 channel:0 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_0
-*/
-#if  ((defined GPT_EMIOS_2_CH_0_USED) && (defined PWM_EMIOS_2_CH_0_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_0"
-#endif
-
-#if  ((defined PWM_EMIOS_2_CH_0_USED) && (defined ICU_EMIOS_2_CH_0_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_0"
-#endif
-
-#if  ((defined ICU_EMIOS_2_CH_0_ISR_USED) && (defined GPT_EMIOS_2_CH_0_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_0"
-#endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_0_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_0_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_0_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 0 for eMios_2 module
-* @details   Process the interrupt of eMios channel 0
-*
-* @note   This will be defined only if eMios channel 0 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_0_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_0_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_0);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_0_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_0);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_0_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_0);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
-#endif
-
-
-/*
-* @brief EMIOS module:2 channel:1 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_1
-*/
-#if  ((defined GPT_EMIOS_2_CH_1_USED) && (defined PWM_EMIOS_2_CH_1_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_1"
+#if ( (defined GPT_EMIOS_0_CH_26_ISR_USED) || (defined GPT_EMIOS_0_CH_27_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_26_ISR_USED) || (defined PWM_EMIOS_0_CH_27_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_26_ISR_USED) || (defined ICU_EMIOS_0_CH_27_ISR_USED) )
+EMIOS_COMMON_ISR(0, 26, 27)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_1_USED) && (defined ICU_EMIOS_2_CH_1_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_1"
+#if ( (defined GPT_EMIOS_0_CH_28_ISR_USED) || (defined GPT_EMIOS_0_CH_29_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_28_ISR_USED) || (defined PWM_EMIOS_0_CH_29_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_28_ISR_USED) || (defined ICU_EMIOS_0_CH_29_ISR_USED) )
+EMIOS_COMMON_ISR(0, 28, 29)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_1_ISR_USED) && (defined GPT_EMIOS_2_CH_1_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_1"
+#if ( (defined GPT_EMIOS_0_CH_30_ISR_USED) || (defined GPT_EMIOS_0_CH_31_ISR_USED) || \
+      (defined PWM_EMIOS_0_CH_30_ISR_USED) || (defined PWM_EMIOS_0_CH_31_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_30_ISR_USED) || (defined ICU_EMIOS_0_CH_31_ISR_USED) )
+EMIOS_COMMON_ISR(0, 30, 31)
 #endif
 
-
-#if ( (defined GPT_EMIOS_2_CH_1_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_1_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_1_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 1 for eMios_2 module
-* @details   Process the interrupt of eMios channel 1
-*
-* @note   This will be defined only if eMios channel 1 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_1_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_1_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_1);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_1_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_1);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_1_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_1);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_0_ISR_USED) || (defined GPT_EMIOS_1_CH_1_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_0_ISR_USED) || (defined PWM_EMIOS_1_CH_1_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_0_ISR_USED) || (defined ICU_EMIOS_1_CH_1_ISR_USED) )
+EMIOS_COMMON_ISR(1, 0, 1)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:2 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_2
-*/
-#if  ((defined GPT_EMIOS_2_CH_2_USED) && (defined PWM_EMIOS_2_CH_2_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_2"
+#if ( (defined GPT_EMIOS_1_CH_2_ISR_USED) || (defined GPT_EMIOS_1_CH_3_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_2_ISR_USED) || (defined PWM_EMIOS_1_CH_3_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_2_ISR_USED) || (defined ICU_EMIOS_1_CH_3_ISR_USED) )
+EMIOS_COMMON_ISR(1, 2, 3)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_2_USED) && (defined ICU_EMIOS_2_CH_2_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_2"
+#if ( (defined GPT_EMIOS_1_CH_4_ISR_USED) || (defined GPT_EMIOS_1_CH_5_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_4_ISR_USED) || (defined PWM_EMIOS_1_CH_5_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_4_ISR_USED) || (defined ICU_EMIOS_1_CH_5_ISR_USED) )
+EMIOS_COMMON_ISR(1, 4, 5)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_2_ISR_USED) && (defined GPT_EMIOS_2_CH_2_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_2"
+#if ( (defined GPT_EMIOS_1_CH_6_ISR_USED) || (defined GPT_EMIOS_1_CH_7_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_6_ISR_USED) || (defined PWM_EMIOS_1_CH_7_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_6_ISR_USED) || (defined ICU_EMIOS_1_CH_7_ISR_USED) )
+EMIOS_COMMON_ISR(1, 6, 7)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_2_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_2_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_2_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 2 for eMios_2 module
-* @details   Process the interrupt of eMios channel 2
-*
-* @note   This will be defined only if eMios channel 2 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_2_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_2_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_2);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_2_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_2);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_2_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_2);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_8_ISR_USED) || (defined GPT_EMIOS_1_CH_9_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_8_ISR_USED) || (defined PWM_EMIOS_1_CH_9_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_8_ISR_USED) || (defined ICU_EMIOS_1_CH_9_ISR_USED) )
+EMIOS_COMMON_ISR(1, 8, 9)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:3 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_3
-*/
-#if  ((defined GPT_EMIOS_2_CH_3_USED) && (defined PWM_EMIOS_2_CH_3_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_3"
+#if ( (defined GPT_EMIOS_1_CH_10_ISR_USED) || (defined GPT_EMIOS_1_CH_11_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_10_ISR_USED) || (defined PWM_EMIOS_1_CH_11_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_10_ISR_USED) || (defined ICU_EMIOS_1_CH_11_ISR_USED) )
+EMIOS_COMMON_ISR(1, 10, 11)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_3_USED) && (defined ICU_EMIOS_2_CH_3_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_3"
+#if ( (defined GPT_EMIOS_1_CH_12_ISR_USED) || (defined GPT_EMIOS_1_CH_13_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_12_ISR_USED) || (defined PWM_EMIOS_1_CH_13_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_12_ISR_USED) || (defined ICU_EMIOS_1_CH_13_ISR_USED) )
+EMIOS_COMMON_ISR(1, 12, 13)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_3_ISR_USED) && (defined GPT_EMIOS_2_CH_3_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_3"
+#if ( (defined GPT_EMIOS_1_CH_14_ISR_USED) || (defined GPT_EMIOS_1_CH_15_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_14_ISR_USED) || (defined PWM_EMIOS_1_CH_15_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_14_ISR_USED) || (defined ICU_EMIOS_1_CH_15_ISR_USED) )
+EMIOS_COMMON_ISR(1, 14, 15)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_3_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_3_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_3_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 3 for eMios_2 module
-* @details   Process the interrupt of eMios channel 3
-*
-* @note   This will be defined only if eMios channel 3 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_3_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_3_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_3);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_3_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_3);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_3_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_3);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_16_ISR_USED) || (defined GPT_EMIOS_1_CH_17_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_16_ISR_USED) || (defined PWM_EMIOS_1_CH_17_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_16_ISR_USED) || (defined ICU_EMIOS_1_CH_17_ISR_USED) )
+EMIOS_COMMON_ISR(1, 16, 17)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:4 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_4
-*/
-#if  ((defined GPT_EMIOS_2_CH_4_USED) && (defined PWM_EMIOS_2_CH_4_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_4"
+#if ( (defined GPT_EMIOS_1_CH_18_ISR_USED) || (defined GPT_EMIOS_1_CH_19_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_18_ISR_USED) || (defined PWM_EMIOS_1_CH_19_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_18_ISR_USED) || (defined ICU_EMIOS_1_CH_19_ISR_USED) )
+EMIOS_COMMON_ISR(1, 18, 19)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_4_USED) && (defined ICU_EMIOS_2_CH_4_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_4"
+#if ( (defined GPT_EMIOS_1_CH_20_ISR_USED) || (defined GPT_EMIOS_1_CH_21_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_20_ISR_USED) || (defined PWM_EMIOS_1_CH_21_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_20_ISR_USED) || (defined ICU_EMIOS_1_CH_21_ISR_USED) )
+EMIOS_COMMON_ISR(1, 20, 21)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_4_ISR_USED) && (defined GPT_EMIOS_2_CH_4_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_4"
+#if ( (defined GPT_EMIOS_1_CH_22_ISR_USED) || (defined GPT_EMIOS_1_CH_23_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_22_ISR_USED) || (defined PWM_EMIOS_1_CH_23_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_22_ISR_USED) || (defined ICU_EMIOS_1_CH_23_ISR_USED) )
+EMIOS_COMMON_ISR(1, 22, 23)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_4_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_4_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_4_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 4 for eMios_2 module
-* @details   Process the interrupt of eMios channel 4
-*
-* @note   This will be defined only if eMios channel 4 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_4_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_4_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_4);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_4_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_4);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_4_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_4);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_24_ISR_USED) || (defined GPT_EMIOS_1_CH_25_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_24_ISR_USED) || (defined PWM_EMIOS_1_CH_25_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_24_ISR_USED) || (defined ICU_EMIOS_1_CH_25_ISR_USED) )
+EMIOS_COMMON_ISR(1, 24, 25)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:5 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_5
-*/
-#if  ((defined GPT_EMIOS_2_CH_5_USED) && (defined PWM_EMIOS_2_CH_5_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_5"
+#if ( (defined GPT_EMIOS_1_CH_26_ISR_USED) || (defined GPT_EMIOS_1_CH_27_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_26_ISR_USED) || (defined PWM_EMIOS_1_CH_27_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_26_ISR_USED) || (defined ICU_EMIOS_1_CH_27_ISR_USED) )
+EMIOS_COMMON_ISR(1, 26, 27)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_5_USED) && (defined ICU_EMIOS_2_CH_5_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_5"
+#if ( (defined GPT_EMIOS_1_CH_28_ISR_USED) || (defined GPT_EMIOS_1_CH_29_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_28_ISR_USED) || (defined PWM_EMIOS_1_CH_29_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_28_ISR_USED) || (defined ICU_EMIOS_1_CH_29_ISR_USED) )
+EMIOS_COMMON_ISR(1, 28, 29)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_5_ISR_USED) && (defined GPT_EMIOS_2_CH_5_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_5"
+#if ( (defined GPT_EMIOS_1_CH_30_ISR_USED) || (defined GPT_EMIOS_1_CH_31_ISR_USED) || \
+      (defined PWM_EMIOS_1_CH_30_ISR_USED) || (defined PWM_EMIOS_1_CH_31_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_30_ISR_USED) || (defined ICU_EMIOS_1_CH_31_ISR_USED) )
+EMIOS_COMMON_ISR(1, 30, 31)
 #endif
 
-
-#if ( (defined GPT_EMIOS_2_CH_5_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_5_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_5_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 5 for eMios_2 module
-* @details   Process the interrupt of eMios channel 5
-*
-* @note   This will be defined only if eMios channel 5 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_5_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_5_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_5);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_5_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_5);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_5_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_5);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_2_CH_0_ISR_USED) || (defined GPT_EMIOS_2_CH_1_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_0_ISR_USED) || (defined PWM_EMIOS_2_CH_1_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_0_ISR_USED) || (defined ICU_EMIOS_2_CH_1_ISR_USED) )
+EMIOS_COMMON_ISR(2, 0, 1)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:6 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_6
-*/
-#if  ((defined GPT_EMIOS_2_CH_6_USED) && (defined PWM_EMIOS_2_CH_6_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_6"
+#if ( (defined GPT_EMIOS_2_CH_2_ISR_USED) || (defined GPT_EMIOS_2_CH_3_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_2_ISR_USED) || (defined PWM_EMIOS_2_CH_3_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_2_ISR_USED) || (defined ICU_EMIOS_2_CH_3_ISR_USED) )
+EMIOS_COMMON_ISR(2, 2, 3)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_6_USED) && (defined ICU_EMIOS_2_CH_6_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_6"
+#if ( (defined GPT_EMIOS_2_CH_4_ISR_USED) || (defined GPT_EMIOS_2_CH_5_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_4_ISR_USED) || (defined PWM_EMIOS_2_CH_5_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_4_ISR_USED) || (defined ICU_EMIOS_2_CH_5_ISR_USED) )
+EMIOS_COMMON_ISR(2, 4, 5)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_6_ISR_USED) && (defined GPT_EMIOS_2_CH_6_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_6"
+#if ( (defined GPT_EMIOS_2_CH_6_ISR_USED) || (defined GPT_EMIOS_2_CH_7_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_6_ISR_USED) || (defined PWM_EMIOS_2_CH_7_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_6_ISR_USED) || (defined ICU_EMIOS_2_CH_7_ISR_USED) )
+EMIOS_COMMON_ISR(2, 6, 7)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_6_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_6_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_6_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 6 for eMios_2 module
-* @details   Process the interrupt of eMios channel 6
-*
-* @note   This will be defined only if eMios channel 6 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_6_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_6_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_6);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_6_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_6);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_6_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_6);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_2_CH_8_ISR_USED) || (defined GPT_EMIOS_2_CH_9_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_8_ISR_USED) || (defined PWM_EMIOS_2_CH_9_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_8_ISR_USED) || (defined ICU_EMIOS_2_CH_9_ISR_USED) )
+EMIOS_COMMON_ISR(2, 8, 9)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:7 independent interrupt handler
-*/
-
-/*
-* @brief resource conflict check for EMIOS_2_CH_7
-*/
-#if  ((defined GPT_EMIOS_2_CH_7_USED) && (defined PWM_EMIOS_2_CH_7_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_7"
+#if ( (defined GPT_EMIOS_2_CH_10_ISR_USED) || (defined GPT_EMIOS_2_CH_11_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_10_ISR_USED) || (defined PWM_EMIOS_2_CH_11_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_10_ISR_USED) || (defined ICU_EMIOS_2_CH_11_ISR_USED) )
+EMIOS_COMMON_ISR(2, 10, 11)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_7_USED) && (defined ICU_EMIOS_2_CH_7_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_7"
+#if ( (defined GPT_EMIOS_2_CH_12_ISR_USED) || (defined GPT_EMIOS_2_CH_13_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_12_ISR_USED) || (defined PWM_EMIOS_2_CH_13_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_12_ISR_USED) || (defined ICU_EMIOS_2_CH_13_ISR_USED) )
+EMIOS_COMMON_ISR(2, 12, 13)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_7_ISR_USED) && (defined GPT_EMIOS_2_CH_7_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_7"
+#if ( (defined GPT_EMIOS_2_CH_14_ISR_USED) || (defined GPT_EMIOS_2_CH_15_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_14_ISR_USED) || (defined PWM_EMIOS_2_CH_15_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_14_ISR_USED) || (defined ICU_EMIOS_2_CH_15_ISR_USED) )
+EMIOS_COMMON_ISR(2, 14, 15)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_7_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_7_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_7_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 7 for eMios_2 module
-* @details   Process the interrupt of eMios channel 7
-*
-* @note   This will be defined only if eMios channel 7 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_7_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_7_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_7);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_7_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_7);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_7_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_7);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_2_CH_16_ISR_USED) || (defined GPT_EMIOS_2_CH_17_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_16_ISR_USED) || (defined PWM_EMIOS_2_CH_17_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_16_ISR_USED) || (defined ICU_EMIOS_2_CH_17_ISR_USED) )
+EMIOS_COMMON_ISR(2, 16, 17)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:8 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_8
-*/
-
-#if  ((defined GPT_EMIOS_2_CH_8_USED) && (defined PWM_EMIOS_2_CH_8_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_8"
+#if ( (defined GPT_EMIOS_2_CH_18_ISR_USED) || (defined GPT_EMIOS_2_CH_19_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_18_ISR_USED) || (defined PWM_EMIOS_2_CH_19_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_18_ISR_USED) || (defined ICU_EMIOS_2_CH_19_ISR_USED) )
+EMIOS_COMMON_ISR(2, 18, 19)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_8_USED) && (defined ICU_EMIOS_2_CH_8_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_8"
+#if ( (defined GPT_EMIOS_2_CH_20_ISR_USED) || (defined GPT_EMIOS_2_CH_21_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_20_ISR_USED) || (defined PWM_EMIOS_2_CH_21_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_20_ISR_USED) || (defined ICU_EMIOS_2_CH_21_ISR_USED) )
+EMIOS_COMMON_ISR(2, 20, 21)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_8_ISR_USED) && (defined GPT_EMIOS_2_CH_8_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_8"
+#if ( (defined GPT_EMIOS_2_CH_22_ISR_USED) || (defined GPT_EMIOS_2_CH_23_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_22_ISR_USED) || (defined PWM_EMIOS_2_CH_23_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_22_ISR_USED) || (defined ICU_EMIOS_2_CH_23_ISR_USED) )
+EMIOS_COMMON_ISR(2, 22, 23)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_8_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_8_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_8_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 8 for eMios_2 module
-* @details   Process the interrupt of eMios channel 8
-*
-* @note   This will be defined only if eMios channel 8 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_8_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_8_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_8);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_8_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_8);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_8_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_8);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_2_CH_24_ISR_USED) || (defined GPT_EMIOS_2_CH_25_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_24_ISR_USED) || (defined PWM_EMIOS_2_CH_25_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_24_ISR_USED) || (defined ICU_EMIOS_2_CH_25_ISR_USED) )
+EMIOS_COMMON_ISR(2, 24, 25)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:9 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_9
-*/
-#if  ((defined GPT_EMIOS_2_CH_9_USED) && (defined PWM_EMIOS_2_CH_9_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_9"
+#if ( (defined GPT_EMIOS_2_CH_26_ISR_USED) || (defined GPT_EMIOS_2_CH_27_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_26_ISR_USED) || (defined PWM_EMIOS_2_CH_27_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_26_ISR_USED) || (defined ICU_EMIOS_2_CH_27_ISR_USED) )
+EMIOS_COMMON_ISR(2, 26, 27)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_9_USED) && (defined ICU_EMIOS_2_CH_9_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_9"
+#if ( (defined GPT_EMIOS_2_CH_28_ISR_USED) || (defined GPT_EMIOS_2_CH_29_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_28_ISR_USED) || (defined PWM_EMIOS_2_CH_29_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_28_ISR_USED) || (defined ICU_EMIOS_2_CH_29_ISR_USED) )
+EMIOS_COMMON_ISR(2, 28, 29)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_9_ISR_USED) && (defined GPT_EMIOS_2_CH_9_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_9"
+#if ( (defined GPT_EMIOS_2_CH_30_ISR_USED) || (defined GPT_EMIOS_2_CH_31_ISR_USED) || \
+      (defined PWM_EMIOS_2_CH_30_ISR_USED) || (defined PWM_EMIOS_2_CH_31_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_30_ISR_USED) || (defined ICU_EMIOS_2_CH_31_ISR_USED) )
+EMIOS_COMMON_ISR(2, 30, 31)
 #endif
 
-
-#if ( (defined GPT_EMIOS_2_CH_9_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_9_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_9_ISR_USED) )
+#else  /* EMIOS_COMMON_ISR_HANDLER == STD_OFF */
+/*================================================================================================*/
+/*                     CHANNEL INDEPENDENT EMIOS INTERRUPT SERVICE ROUTINES DEFINITION            */
 /*================================================================================================*/
 /**
-* @brief     Interrupt handler for eMios channel : 9 for eMios_2 module
-* @details   Process the interrupt of eMios channel 9
-*
-* @note   This will be defined only if eMios channel 9 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
+* @brief   Interrupt handler template for eMios module mod, channel ch.
+* @details Instantiated below only for the channels configured in GPT, ICU or PWM mode with
+*          interrupt.
+* @violates @ref eMios_Common_c_5 This is not a standard library macro
+* @violates @ref eMios_Common_c_9 Function-like macro defined
+* @violates @ref eMios_Common_c_10 Use of ## operator
 */
-ISR(EMIOS_2_CH_9_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_9_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_9);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_9_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_9);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_9_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_9);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
+#define EMIOS_CHANNEL_ISR(mod, ch) \
+ISR(EMIOS_##mod##_CH_##ch##_ISR) \
+{ \
+    eMios_ProcessChannelInterrupt((uint8)(mod##U), (uint8)(ch##U)); \
+    EXIT_INTERRUPT(); \
 }
-#endif
-
 
-/*
-* @brief EMIOS module:2 channel:10 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_10
-*/
-#if  ((defined GPT_EMIOS_2_CH_10_USED) && (defined PWM_EMIOS_2_CH_10_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_10"
+#if ( (defined GPT_EMIOS_0_CH_0_ISR_USED) || (defined PWM_EMIOS_0_CH_0_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_0_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 0)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_10_USED) && (defined ICU_EMIOS_2_CH_10_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_10"
+#if ( (defined GPT_EMIOS_0_CH_1_ISR_USED) || (defined PWM_EMIOS_0_CH_1_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_1_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 1)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_10_ISR_USED) && (defined GPT_EMIOS_2_CH_10_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_10"
+#if ( (defined GPT_EMIOS_0_CH_2_ISR_USED) || (defined PWM_EMIOS_0_CH_2_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_2_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 2)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_10_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_10_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_10_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 10 for eMios_2 module
-* @details   Process the interrupt of eMios channel 10
-*
-* @note   This will be defined only if eMios channel 10 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_10_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_10_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_10);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_10_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_10);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_10_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_10);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_0_CH_3_ISR_USED) || (defined PWM_EMIOS_0_CH_3_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_3_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 3)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:11 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_11
-*/
-#if  ((defined GPT_EMIOS_2_CH_11_USED) && (defined PWM_EMIOS_2_CH_11_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_11"
+#if ( (defined GPT_EMIOS_0_CH_4_ISR_USED) || (defined PWM_EMIOS_0_CH_4_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_4_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 4)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_11_USED) && (defined ICU_EMIOS_2_CH_11_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_11"
+#if ( (defined GPT_EMIOS_0_CH_5_ISR_USED) || (defined PWM_EMIOS_0_CH_5_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_5_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 5)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_11_ISR_USED) && (defined GPT_EMIOS_2_CH_11_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_11"
+#if ( (defined GPT_EMIOS_0_CH_6_ISR_USED) || (defined PWM_EMIOS_0_CH_6_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_6_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 6)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_11_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_11_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_11_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 11 for eMios_2 module
-* @details   Process the interrupt of eMios channel 11
-*
-* @note   This will be defined only if eMios channel 11 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_11_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_11_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_11);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_11_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_11);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_11_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_11);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_0_CH_7_ISR_USED) || (defined PWM_EMIOS_0_CH_7_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_7_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 7)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:12 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_12
-*/
-#if  ((defined GPT_EMIOS_2_CH_12_USED) && (defined PWM_EMIOS_2_CH_12_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_12"
+#if ( (defined GPT_EMIOS_0_CH_8_ISR_USED) || (defined PWM_EMIOS_0_CH_8_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_8_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 8)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_12_USED) && (defined ICU_EMIOS_2_CH_12_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_12"
+#if ( (defined GPT_EMIOS_0_CH_9_ISR_USED) || (defined PWM_EMIOS_0_CH_9_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_9_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 9)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_12_ISR_USED) && (defined GPT_EMIOS_2_CH_12_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_12"
+#if ( (defined GPT_EMIOS_0_CH_10_ISR_USED) || (defined PWM_EMIOS_0_CH_10_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_10_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 10)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_12_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_12_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_12_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 12 for eMios_2 module
-* @details   Process the interrupt of eMios channel 12
-*
-* @note   This will be defined only if eMios channel 12 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_12_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_12_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_12);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_12_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_12);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_12_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_12);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_0_CH_11_ISR_USED) || (defined PWM_EMIOS_0_CH_11_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_11_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 11)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:13 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_13
-*/
-#if  ((defined GPT_EMIOS_2_CH_13_USED) && (defined PWM_EMIOS_2_CH_13_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_13"
+#if ( (defined GPT_EMIOS_0_CH_12_ISR_USED) || (defined PWM_EMIOS_0_CH_12_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_12_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 12)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_13_USED) && (defined ICU_EMIOS_2_CH_13_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_13"
+#if ( (defined GPT_EMIOS_0_CH_13_ISR_USED) || (defined PWM_EMIOS_0_CH_13_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_13_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 13)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_13_ISR_USED) && (defined GPT_EMIOS_2_CH_13_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_13"
+#if ( (defined GPT_EMIOS_0_CH_14_ISR_USED) || (defined PWM_EMIOS_0_CH_14_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_14_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 14)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_13_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_13_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_13_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 13 for eMios_2 module
-* @details   Process the interrupt of eMios channel 13
-*
-* @note   This will be defined only if eMios channel 13 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_13_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_13_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_13);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_13_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_13);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_13_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_13);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_0_CH_15_ISR_USED) || (defined PWM_EMIOS_0_CH_15_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_15_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 15)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:14 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_14
-*/
-#if  ((defined GPT_EMIOS_2_CH_14_USED) && (defined PWM_EMIOS_2_CH_14_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_14"
+#if ( (defined GPT_EMIOS_0_CH_16_ISR_USED) || (defined PWM_EMIOS_0_CH_16_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_16_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 16)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_14_USED) && (defined ICU_EMIOS_2_CH_14_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_14"
+#if ( (defined GPT_EMIOS_0_CH_17_ISR_USED) || (defined PWM_EMIOS_0_CH_17_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_17_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 17)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_14_ISR_USED) && (defined GPT_EMIOS_2_CH_14_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_14"
+#if ( (defined GPT_EMIOS_0_CH_18_ISR_USED) || (defined PWM_EMIOS_0_CH_18_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_18_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 18)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_14_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_14_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_14_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 14 for eMios_2 module
-* @details   Process the interrupt of eMios channel 14
-*
-* @note   This will be defined only if eMios channel 14 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_14_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_14_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_14);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_14_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_14);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_14_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_14);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_0_CH_19_ISR_USED) || (defined PWM_EMIOS_0_CH_19_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_19_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 19)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:15 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_15
-*/
-#if  ((defined GPT_EMIOS_2_CH_15_USED) && (defined PWM_EMIOS_2_CH_15_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_15"
+#if ( (defined GPT_EMIOS_0_CH_20_ISR_USED) || (defined PWM_EMIOS_0_CH_20_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_20_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 20)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_15_USED) && (defined ICU_EMIOS_2_CH_15_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_15"
+#if ( (defined GPT_EMIOS_0_CH_21_ISR_USED) || (defined PWM_EMIOS_0_CH_21_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_21_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 21)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_15_ISR_USED) && (defined GPT_EMIOS_2_CH_15_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_15"
+#if ( (defined GPT_EMIOS_0_CH_22_ISR_USED) || (defined PWM_EMIOS_0_CH_22_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_22_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 22)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_15_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_15_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_15_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 15 for eMios_2 module
-* @details   Process the interrupt of eMios channel 15
-*
-* @note   This will be defined only if eMios channel 15 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_15_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_15_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_15);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_15_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_15);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_15_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_15);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_0_CH_23_ISR_USED) || (defined PWM_EMIOS_0_CH_23_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_23_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 23)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:16 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_16
-*/
-#if  ((defined GPT_EMIOS_2_CH_16_USED) && (defined PWM_EMIOS_2_CH_16_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_16"
+#if ( (defined GPT_EMIOS_0_CH_24_ISR_USED) || (defined PWM_EMIOS_0_CH_24_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_24_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 24)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_16_USED) && (defined ICU_EMIOS_2_CH_16_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_16"
+#if ( (defined GPT_EMIOS_0_CH_25_ISR_USED) || (defined PWM_EMIOS_0_CH_25_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_25_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 25)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_16_ISR_USED) && (defined GPT_EMIOS_2_CH_16_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_16"
+#if ( (defined GPT_EMIOS_0_CH_26_ISR_USED) || (defined PWM_EMIOS_0_CH_26_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_26_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 26)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_16_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_16_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_16_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 16 for eMios_2 module
-* @details   Process the interrupt of eMios channel 16
-*
-* @note   This will be defined only if eMios channel 16 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_16_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_16_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_16);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_16_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_16);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_16_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_16);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_0_CH_27_ISR_USED) || (defined PWM_EMIOS_0_CH_27_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_27_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 27)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:17 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_17
-*/
-#if  ((defined GPT_EMIOS_2_CH_17_USED) && (defined PWM_EMIOS_2_CH_17_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_17"
+#if ( (defined GPT_EMIOS_0_CH_28_ISR_USED) || (defined PWM_EMIOS_0_CH_28_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_28_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 28)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_17_USED) && (defined ICU_EMIOS_2_CH_17_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_17"
+#if ( (defined GPT_EMIOS_0_CH_29_ISR_USED) || (defined PWM_EMIOS_0_CH_29_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_29_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 29)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_17_ISR_USED) && (defined GPT_EMIOS_2_CH_17_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_17"
+#if ( (defined GPT_EMIOS_0_CH_30_ISR_USED) || (defined PWM_EMIOS_0_CH_30_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_30_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 30)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_17_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_17_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_17_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 17 for eMios_2 module
-* @details   Process the interrupt of eMios channel 17
-*
-* @note   This will be defined only if eMios channel 17 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_17_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_17_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_17);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_17_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_17);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_17_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_17);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_0_CH_31_ISR_USED) || (defined PWM_EMIOS_0_CH_31_ISR_USED) || \
+      (defined ICU_EMIOS_0_CH_31_ISR_USED) )
+EMIOS_CHANNEL_ISR(0, 31)
 #endif
 
-
-/*
-* @brief EMIOS module:2 channel:18 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_18
-*/
-#if  ((defined GPT_EMIOS_2_CH_18_USED) && (defined PWM_EMIOS_2_CH_18_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_18"
+#if ( (defined GPT_EMIOS_1_CH_0_ISR_USED) || (defined PWM_EMIOS_1_CH_0_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_0_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 0)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_18_USED) && (defined ICU_EMIOS_2_CH_18_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_18"
+#if ( (defined GPT_EMIOS_1_CH_1_ISR_USED) || (defined PWM_EMIOS_1_CH_1_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_1_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 1)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_18_ISR_USED) && (defined GPT_EMIOS_2_CH_18_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_18"
+#if ( (defined GPT_EMIOS_1_CH_2_ISR_USED) || (defined PWM_EMIOS_1_CH_2_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_2_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 2)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_18_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_18_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_18_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 18 for eMios_2 module
-* @details   Process the interrupt of eMios channel 18
-*
-* @note   This will be defined only if eMios channel 18 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_18_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_18_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_18);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_18_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_18);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_18_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_18);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_3_ISR_USED) || (defined PWM_EMIOS_1_CH_3_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_3_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 3)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:19 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_19
-*/
-#if  ((defined GPT_EMIOS_2_CH_19_USED) && (defined PWM_EMIOS_2_CH_19_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_19"
+#if ( (defined GPT_EMIOS_1_CH_4_ISR_USED) || (defined PWM_EMIOS_1_CH_4_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_4_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 4)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_19_USED) && (defined ICU_EMIOS_2_CH_19_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_19"
+#if ( (defined GPT_EMIOS_1_CH_5_ISR_USED) || (defined PWM_EMIOS_1_CH_5_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_5_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 5)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_19_ISR_USED) && (defined GPT_EMIOS_2_CH_19_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_19"
+#if ( (defined GPT_EMIOS_1_CH_6_ISR_USED) || (defined PWM_EMIOS_1_CH_6_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_6_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 6)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_19_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_19_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_19_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 19 for eMios_2 module
-* @details   Process the interrupt of eMios channel 19
-*
-* @note   This will be defined only if eMios channel 19 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_19_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_19_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_19);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_19_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_19);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_19_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_19);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_7_ISR_USED) || (defined PWM_EMIOS_1_CH_7_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_7_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 7)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:20 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_20
-*/
-#if  ((defined GPT_EMIOS_2_CH_20_USED) && (defined PWM_EMIOS_2_CH_20_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_20"
+#if ( (defined GPT_EMIOS_1_CH_8_ISR_USED) || (defined PWM_EMIOS_1_CH_8_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_8_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 8)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_20_USED) && (defined ICU_EMIOS_2_CH_20_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_20"
+#if ( (defined GPT_EMIOS_1_CH_9_ISR_USED) || (defined PWM_EMIOS_1_CH_9_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_9_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 9)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_20_ISR_USED) && (defined GPT_EMIOS_2_CH_20_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_20"
+#if ( (defined GPT_EMIOS_1_CH_10_ISR_USED) || (defined PWM_EMIOS_1_CH_10_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_10_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 10)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_20_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_20_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_20_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 20 for eMios_2 module
-* @details   Process the interrupt of eMios channel 20
-*
-* @note   This will be defined only if eMios channel 20 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_20_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_20_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_20);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_20_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_20);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_20_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_20);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_11_ISR_USED) || (defined PWM_EMIOS_1_CH_11_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_11_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 11)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:21 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_21
-*/
-#if  ((defined GPT_EMIOS_2_CH_21_USED) && (defined PWM_EMIOS_2_CH_21_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_21"
+#if ( (defined GPT_EMIOS_1_CH_12_ISR_USED) || (defined PWM_EMIOS_1_CH_12_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_12_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 12)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_21_USED) && (defined ICU_EMIOS_2_CH_21_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_21"
+#if ( (defined GPT_EMIOS_1_CH_13_ISR_USED) || (defined PWM_EMIOS_1_CH_13_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_13_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 13)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_21_ISR_USED) && (defined GPT_EMIOS_2_CH_21_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_21"
+#if ( (defined GPT_EMIOS_1_CH_14_ISR_USED) || (defined PWM_EMIOS_1_CH_14_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_14_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 14)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_21_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_21_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_21_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 21 for eMios_2 module
-* @details   Process the interrupt of eMios channel 21
-*
-* @note   This will be defined only if eMios channel 21 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_21_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_21_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_21);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_21_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_21);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_21_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_21);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_15_ISR_USED) || (defined PWM_EMIOS_1_CH_15_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_15_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 15)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:22 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_22
-*/
-#if  ((defined GPT_EMIOS_2_CH_22_USED) && (defined PWM_EMIOS_2_CH_22_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_22"
+#if ( (defined GPT_EMIOS_1_CH_16_ISR_USED) || (defined PWM_EMIOS_1_CH_16_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_16_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 16)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_22_USED) && (defined ICU_EMIOS_2_CH_22_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_22"
+#if ( (defined GPT_EMIOS_1_CH_17_ISR_USED) || (defined PWM_EMIOS_1_CH_17_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_17_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 17)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_22_ISR_USED) && (defined GPT_EMIOS_2_CH_22_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_22"
+#if ( (defined GPT_EMIOS_1_CH_18_ISR_USED) || (defined PWM_EMIOS_1_CH_18_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_18_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 18)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_22_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_22_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_22_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 22 for eMios_2 module
-* @details   Process the interrupt of eMios channel 22
-*
-* @note   This will be defined only if eMios channel 22 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_22_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_22_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_22);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_22_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_22);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_22_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_22);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_19_ISR_USED) || (defined PWM_EMIOS_1_CH_19_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_19_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 19)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:23 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_23
-*/
-#if  ((defined GPT_EMIOS_2_CH_23_USED) && (defined PWM_EMIOS_2_CH_23_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_23"
+#if ( (defined GPT_EMIOS_1_CH_20_ISR_USED) || (defined PWM_EMIOS_1_CH_20_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_20_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 20)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_23_USED) && (defined ICU_EMIOS_2_CH_23_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_23"
+#if ( (defined GPT_EMIOS_1_CH_21_ISR_USED) || (defined PWM_EMIOS_1_CH_21_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_21_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 21)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_23_ISR_USED) && (defined GPT_EMIOS_2_CH_23_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_23"
+#if ( (defined GPT_EMIOS_1_CH_22_ISR_USED) || (defined PWM_EMIOS_1_CH_22_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_22_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 22)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_23_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_23_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_23_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 23 for eMios_2 module
-* @details   Process the interrupt of eMios channel 23
-*
-* @note   This will be defined only if eMios channel 23 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_23_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_23_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_23);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_23_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_23);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_23_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_23);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_23_ISR_USED) || (defined PWM_EMIOS_1_CH_23_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_23_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 23)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:24 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_24
-*/
-#if  ((defined GPT_EMIOS_2_CH_24_USED) && (defined PWM_EMIOS_2_CH_24_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_24"
+#if ( (defined GPT_EMIOS_1_CH_24_ISR_USED) || (defined PWM_EMIOS_1_CH_24_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_24_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 24)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_24_USED) && (defined ICU_EMIOS_2_CH_24_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_24"
+#if ( (defined GPT_EMIOS_1_CH_25_ISR_USED) || (defined PWM_EMIOS_1_CH_25_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_25_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 25)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_24_ISR_USED) && (defined GPT_EMIOS_2_CH_24_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_24"
+#if ( (defined GPT_EMIOS_1_CH_26_ISR_USED) || (defined PWM_EMIOS_1_CH_26_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_26_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 26)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_24_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_24_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_24_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 24 for eMios_2 module
-* @details   Process the interrupt of eMios channel 24
-*
-* @note   This will be defined only if eMios channel 24 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_24_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_24_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_24);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_24_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_24);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_24_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_24);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_27_ISR_USED) || (defined PWM_EMIOS_1_CH_27_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_27_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 27)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:25 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_25
-*/
-#if  ((defined GPT_EMIOS_2_CH_25_USED) && (defined PWM_EMIOS_2_CH_25_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_25"
+#if ( (defined GPT_EMIOS_1_CH_28_ISR_USED) || (defined PWM_EMIOS_1_CH_28_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_28_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 28)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_25_USED) && (defined ICU_EMIOS_2_CH_25_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_25"
+#if ( (defined GPT_EMIOS_1_CH_29_ISR_USED) || (defined PWM_EMIOS_1_CH_29_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_29_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 29)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_25_ISR_USED) && (defined GPT_EMIOS_2_CH_25_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_25"
+#if ( (defined GPT_EMIOS_1_CH_30_ISR_USED) || (defined PWM_EMIOS_1_CH_30_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_30_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 30)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_25_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_25_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_25_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 25 for eMios_2 module
-* @details   Process the interrupt of eMios channel 25
-*
-* @note   This will be defined only if eMios channel 25 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_25_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_25_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_25);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_25_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_25);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_25_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_25);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_1_CH_31_ISR_USED) || (defined PWM_EMIOS_1_CH_31_ISR_USED) || \
+      (defined ICU_EMIOS_1_CH_31_ISR_USED) )
+EMIOS_CHANNEL_ISR(1, 31)
 #endif
 
-
-/*
-* @brief EMIOS module:2 channel:26 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_26
-*/
-#if  ((defined GPT_EMIOS_2_CH_26_USED) && (defined PWM_EMIOS_2_CH_26_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_26"
+#if ( (defined GPT_EMIOS_2_CH_0_ISR_USED) || (defined PWM_EMIOS_2_CH_0_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_0_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 0)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_26_USED) && (defined ICU_EMIOS_2_CH_26_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_26"
+#if ( (defined GPT_EMIOS_2_CH_1_ISR_USED) || (defined PWM_EMIOS_2_CH_1_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_1_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 1)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_26_ISR_USED) && (defined GPT_EMIOS_2_CH_26_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_26"
+#if ( (defined GPT_EMIOS_2_CH_2_ISR_USED) || (defined PWM_EMIOS_2_CH_2_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_2_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 2)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_26_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_26_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_26_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 26 for eMios_2 module
-* @details   Process the interrupt of eMios channel 26
-*
-* @note   This will be defined only if eMios channel 26 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_26_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_26_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_26);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_26_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_26);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_26_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_26);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_2_CH_3_ISR_USED) || (defined PWM_EMIOS_2_CH_3_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_3_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 3)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:27 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_27
-*/
-#if  ((defined GPT_EMIOS_2_CH_27_USED) && (defined PWM_EMIOS_2_CH_27_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_27"
+#if ( (defined GPT_EMIOS_2_CH_4_ISR_USED) || (defined PWM_EMIOS_2_CH_4_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_4_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 4)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_27_USED) && (defined ICU_EMIOS_2_CH_27_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_27"
+#if ( (defined GPT_EMIOS_2_CH_5_ISR_USED) || (defined PWM_EMIOS_2_CH_5_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_5_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 5)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_27_ISR_USED) && (defined GPT_EMIOS_2_CH_27_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_27"
+#if ( (defined GPT_EMIOS_2_CH_6_ISR_USED) || (defined PWM_EMIOS_2_CH_6_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_6_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 6)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_27_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_27_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_27_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 27 for eMios_2 module
-* @details   Process the interrupt of eMios channel 27
-*
-* @note   This will be defined only if eMios channel 27 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_27_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_27_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_27);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_27_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_27);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_27_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_27);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_2_CH_7_ISR_USED) || (defined PWM_EMIOS_2_CH_7_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_7_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 7)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:28 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_28
-*/
-#if  ((defined GPT_EMIOS_2_CH_28_USED) && (defined PWM_EMIOS_2_CH_28_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_28"
+#if ( (defined GPT_EMIOS_2_CH_8_ISR_USED) || (defined PWM_EMIOS_2_CH_8_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_8_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 8)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_28_USED) && (defined ICU_EMIOS_2_CH_28_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_28"
+#if ( (defined GPT_EMIOS_2_CH_9_ISR_USED) || (defined PWM_EMIOS_2_CH_9_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_9_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 9)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_28_ISR_USED) && (defined GPT_EMIOS_2_CH_28_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_28"
+#if ( (defined GPT_EMIOS_2_CH_10_ISR_USED) || (defined PWM_EMIOS_2_CH_10_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_10_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 10)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_28_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_28_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_28_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 28 for eMios_2 module
-* @details   Process the interrupt of eMios channel 28
-*
-* @note   This will be defined only if eMios channel 28 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_28_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_28_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_28);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_28_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_28);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_28_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_28);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_2_CH_11_ISR_USED) || (defined PWM_EMIOS_2_CH_11_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_11_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 11)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:29 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_29
-*/
-#if  ((defined GPT_EMIOS_2_CH_29_USED) && (defined PWM_EMIOS_2_CH_29_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_29"
+#if ( (defined GPT_EMIOS_2_CH_12_ISR_USED) || (defined PWM_EMIOS_2_CH_12_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_12_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 12)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_29_USED) && (defined ICU_EMIOS_2_CH_29_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_29"
+#if ( (defined GPT_EMIOS_2_CH_13_ISR_USED) || (defined PWM_EMIOS_2_CH_13_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_13_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 13)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_29_ISR_USED) && (defined GPT_EMIOS_2_CH_29_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_29"
+#if ( (defined GPT_EMIOS_2_CH_14_ISR_USED) || (defined PWM_EMIOS_2_CH_14_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_14_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 14)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_29_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_29_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_29_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 29 for eMios_2 module
-* @details   Process the interrupt of eMios channel 29
-*
-* @note   This will be defined only if eMios channel 29 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_29_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_29_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_29);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_29_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_29);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_29_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_29);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_2_CH_15_ISR_USED) || (defined PWM_EMIOS_2_CH_15_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_15_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 15)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:30 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_30
-*/
-#if  ((defined GPT_EMIOS_2_CH_30_USED) && (defined PWM_EMIOS_2_CH_30_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_30"
+#if ( (defined GPT_EMIOS_2_CH_16_ISR_USED) || (defined PWM_EMIOS_2_CH_16_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_16_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 16)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_30_USED) && (defined ICU_EMIOS_2_CH_30_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_30"
+#if ( (defined GPT_EMIOS_2_CH_17_ISR_USED) || (defined PWM_EMIOS_2_CH_17_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_17_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 17)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_30_ISR_USED) && (defined GPT_EMIOS_2_CH_30_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_30"
+#if ( (defined GPT_EMIOS_2_CH_18_ISR_USED) || (defined PWM_EMIOS_2_CH_18_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_18_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 18)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_30_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_30_ISR_USED) || \
-      (defined ICU_EMIOS_2_CH_30_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 30 for eMios_2 module
-* @details   Process the interrupt of eMios channel 30
-*
-* @note   This will be defined only if eMios channel 30 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_30_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_30_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_30);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_30_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_30);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_30_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_30);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+#if ( (defined GPT_EMIOS_2_CH_19_ISR_USED) || (defined PWM_EMIOS_2_CH_19_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_19_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 19)
 #endif
-
-
-/*
-* @brief EMIOS module:2 channel:31 independent interrupt handler
-*/
-
-/**
-* @brief resource conflict check for EMIOS_2_CH_31
-*/
-#if  ((defined GPT_EMIOS_2_CH_31_USED) && (defined PWM_EMIOS_2_CH_31_USED))
-    #error "GPT and PWM resource conflict for EMIOS unified channel EMIOS_2_31"
+#if ( (defined GPT_EMIOS_2_CH_20_ISR_USED) || (defined PWM_EMIOS_2_CH_20_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_20_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 20)
 #endif
-
-#if  ((defined PWM_EMIOS_2_CH_31_USED) && (defined ICU_EMIOS_2_CH_31_ISR_USED))
-    #error "PWM and ICU resource conflict for EMIOS unified channel EMIOS_2_31"
+#if ( (defined GPT_EMIOS_2_CH_21_ISR_USED) || (defined PWM_EMIOS_2_CH_21_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_21_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 21)
 #endif
-
-#if  ((defined ICU_EMIOS_2_CH_31_ISR_USED) && (defined GPT_EMIOS_2_CH_31_USED))
-    #error "ICU and GPT resource conflict for EMIOS unified channel EMIOS_2_31"
+#if ( (defined GPT_EMIOS_2_CH_22_ISR_USED) || (defined PWM_EMIOS_2_CH_22_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_22_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 22)
 #endif
-
-
-#if ( (defined GPT_EMIOS_2_CH_31_ISR_USED) || \
-      (defined PWM_EMIOS_2_CH_31_ISR_USED) || \
+#if ( (defined GPT_EMIOS_2_CH_23_ISR_USED) || (defined PWM_EMIOS_2_CH_23_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_23_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 23)
+#endif
+#if ( (defined GPT_EMIOS_2_CH_24_ISR_USED) || (defined PWM_EMIOS_2_CH_24_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_24_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 24)
+#endif
+#if ( (defined GPT_EMIOS_2_CH_25_ISR_USED) || (defined PWM_EMIOS_2_CH_25_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_25_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 25)
+#endif
+#if ( (defined GPT_EMIOS_2_CH_26_ISR_USED) || (defined PWM_EMIOS_2_CH_26_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_26_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 26)
+#endif
+#if ( (defined GPT_EMIOS_2_CH_27_ISR_USED) || (defined PWM_EMIOS_2_CH_27_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_27_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 27)
+#endif
+#if ( (defined GPT_EMIOS_2_CH_28_ISR_USED) || (defined PWM_EMIOS_2_CH_28_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_28_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 28)
+#endif
+#if ( (defined GPT_EMIOS_2_CH_29_ISR_USED) || (defined PWM_EMIOS_2_CH_29_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_29_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 29)
+#endif
+#if ( (defined GPT_EMIOS_2_CH_30_ISR_USED) || (defined PWM_EMIOS_2_CH_30_ISR_USED) || \
+      (defined ICU_EMIOS_2_CH_30_ISR_USED) )
+EMIOS_CHANNEL_ISR(2, 30)
+#endif
+#if ( (defined GPT_EMIOS_2_CH_31_ISR_USED) || (defined PWM_EMIOS_2_CH_31_ISR_USED) || \
       (defined ICU_EMIOS_2_CH_31_ISR_USED) )
-/*================================================================================================*/
-/**
-* @brief     Interrupt handler for eMios channel : 31 for eMios_2 module
-* @details   Process the interrupt of eMios channel 31
-*
-* @note   This will be defined only if eMios channel 31 is configured in GPT, ICU or PWM mode
-* @violates @ref eMios_Common_c_5 This is not a standard library macro,
-*/
-ISR(EMIOS_2_CH_31_ISR)
-{
-
-    #if(defined GPT_EMIOS_2_CH_31_ISR_USED)
-         Gpt_eMios_ProcessCommonInterrupt(EMIOS_2_CH_31);
-    #endif
-
-    #if(defined PWM_EMIOS_2_CH_31_ISR_USED)
-         Pwm_eMios_ProcessCommonInterrupt(EMIOS_2_CH_31);
-    #endif
-
-    #if(defined ICU_EMIOS_2_CH_31_ISR_USED)
-         Icu_eMios_ProcessCommonInterrupt(EMIOS_2_CH_31);
-    #endif
-
-    /** @violates @ref eMios_Common_c_3 Cast from unsigned long to pointer*/
-    EXIT_INTERRUPT();
-}
+EMIOS_CHANNEL_ISR(2, 31)
 #endif
 
-/*********************************** EMIOS 2 independent interrupts END ***************************/
-
 #endif  /* EMIOS_COMMON_ISR_HANDLER == STD_ON */
 #else
 #error "Unknown EMIOS interrupt handler type, EMIOS_COMMON_ISR_HANDLER is undefined";
 #endif /* #ifdef EMIOS_COMMON_ISR_HANDLER */
 
-
 #define MCL_STOP_SEC_CODE
 /**@violates @ref eMios_Common_c_1 only preprocessor statements and comments before "#include"
  **@violates @ref eMios_Common_c_2 Precautions shall be taken in order to prevent...*/
@@ -173,6 +173,53 @@ extern "C"{
 /*==================================================================================================
                                        DEFINES AND MACROS
 ==================================================================================================*/
+#if (MCU_INIT_CLOCK == STD_ON)
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+/**
+* @brief            API service ID for Mcu_SwitchClockProfile function.
+*/
+#define MCU_SWITCHCLOCKPROFILE_ID           ((uint8)0x40U)
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+/**
+* @brief            API service ID for Mcu_GetBootTimeline function.
+*/
+#define MCU_GETBOOTTIMELINE_ID              ((uint8)0x41U)
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief            API service ID for Mcu_BootInitSequence function.
+*/
+#define MCU_BOOTINITSEQUENCE_ID             ((uint8)0x42U)
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
+/**
+* @brief            Boot phases, each event marks the end of its phase.
+* @details          The start-up phases are recorded by Startup_vle.c, the Mcu phases by the Mcu
+*                   driver and the other phases by the code calling the init functions, right after
+*                   each call. The duration of a phase is the time elapsed since the previous event.
+*/
+#define MCU_BOOT_PHASE_STARTUP_RAM_INIT     ((Mcu_BootPhaseType)0x00U)
+#define MCU_BOOT_PHASE_STARTUP              ((Mcu_BootPhaseType)0x01U)
+#define MCU_BOOT_PHASE_MCU_INIT             ((Mcu_BootPhaseType)0x02U)
+#define MCU_BOOT_PHASE_MCU_INIT_RAM         ((Mcu_BootPhaseType)0x03U)
+#define MCU_BOOT_PHASE_MCU_INIT_CLOCK       ((Mcu_BootPhaseType)0x04U)
+#define MCU_BOOT_PHASE_PLL_LOCKED           ((Mcu_BootPhaseType)0x05U)
+#define MCU_BOOT_PHASE_PLL_DISTRIBUTED      ((Mcu_BootPhaseType)0x06U)
+#define MCU_BOOT_PHASE_PORT_INIT            ((Mcu_BootPhaseType)0x10U)
+#define MCU_BOOT_PHASE_CAN_INIT             ((Mcu_BootPhaseType)0x11U)
+#define MCU_BOOT_PHASE_CAN_43_MCAN_INIT     ((Mcu_BootPhaseType)0x12U)
+#define MCU_BOOT_PHASE_SPI_INIT             ((Mcu_BootPhaseType)0x13U)
+#define MCU_BOOT_PHASE_ETH_INIT             ((Mcu_BootPhaseType)0x14U)
+#define MCU_BOOT_PHASE_GPT_INIT             ((Mcu_BootPhaseType)0x15U)
+#define MCU_BOOT_PHASE_FIRST_CAN_FRAME      ((Mcu_BootPhaseType)0x20U)
+/**
+* @brief            First phase ID free for the application.
+*/
+#define MCU_BOOT_PHASE_USER                 ((Mcu_BootPhaseType)0x80U)
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
 
 /*==================================================================================================
                                              ENUMS
@@ -221,6 +268,40 @@ typedef struct
 
 } Mcu_ConfigType;
 
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+/**
+* @brief            Boot phase identifier.
+*/
+typedef uint8 Mcu_BootPhaseType;
+
+/**
+* @brief            Boot timeline event.
+* @details          The time is the core time base, started at reset by Startup_vle.c. The time base
+*                   runs on the system clock, so ticks recorded before and after
+*                   MCU_BOOT_PHASE_PLL_DISTRIBUTED have different lengths.
+*/
+typedef struct
+{
+    VAR( uint32, MCU_VAR) u32Time;                  /**< @brief Time base at the end of the phase. */
+    VAR( Mcu_BootPhaseType, MCU_VAR) Phase;         /**< @brief Phase which ended. */
+} Mcu_BootEventType;
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief            Initialization step run by Mcu_BootInitSequence while the PLL locks.
+* @details          The step shall not depend on the PLL output: its peripheral shall be clocked
+*                   while the system clock runs from the IRC, and its timing shall not be derived
+*                   from the clock frequency read at run time. Typical steps are the ECC
+*                   initialization of RAM sections, the MCAN message RAM clear and the FEC reset.
+*/
+typedef struct
+{
+    P2FUNC( void, MCU_APPL_CODE, pfInit)( void);    /**< @brief Init function of the step. */
+    VAR( Mcu_BootPhaseType, MCU_VAR) Phase;         /**< @brief Phase recorded once it returns. */
+} Mcu_BootInitStepType;
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
+
 /*==================================================================================================
                                  GLOBAL VARIABLE DECLARATIONS
 ==================================================================================================*/
@@ -266,6 +347,9 @@ FUNC (Std_ReturnType, MCU_CODE) Mcu_InitRamSection( VAR(Mcu_RamSectionType, AUTO
 
 #if (MCU_INIT_CLOCK == STD_ON)
 FUNC (Std_ReturnType, MCU_CODE) Mcu_InitClock( VAR(Mcu_ClockType, AUTOMATIC) ClockSetting);
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+FUNC (Std_ReturnType, MCU_CODE) Mcu_SwitchClockProfile( VAR(Mcu_ClockType, AUTOMATIC) ClockSetting);
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 FUNC (void, MCU_CODE) Mcu_SetMode( VAR(Mcu_ModeType, AUTOMATIC) McuMode);
@@ -350,6 +434,23 @@ FUNC( void, MCU_CODE ) Mcu_DisableCmu(VAR (uint8, AUTOMATIC) u8IndexCmu);
 #endif
 #endif
 
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+FUNC( void, MCU_CODE ) Mcu_BootTimelineMark(VAR( Mcu_BootPhaseType, AUTOMATIC) Phase);
+FUNC( uint8, MCU_CODE ) Mcu_GetBootTimeline
+(
+    P2VAR( Mcu_BootEventType, AUTOMATIC, MCU_APPL_DATA) pEvents,
+    VAR( uint8, AUTOMATIC) u8MaxEvents
+);
+#if (MCU_INIT_CLOCK == STD_ON)
+FUNC( Std_ReturnType, MCU_CODE ) Mcu_BootInitSequence
+(
+    VAR( Mcu_ClockType, AUTOMATIC) ClockSetting,
+    P2CONST( Mcu_BootInitStepType, AUTOMATIC, MCU_APPL_CONST) pSteps,
+    VAR( uint8, AUTOMATIC) u8StepCount
+);
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
+
 #define MCU_STOP_SEC_CODE
 /** @violates @ref Mcu_h_REF_1 MISRA 2004 Required Rule 19.15, Repeated include file */
 #include "MemMap.h"
@@ -108,6 +108,38 @@ extern "C"{
 #define MCU_VALIDATE_GLOBAL_CALL        (MCU_DEV_ERROR_DETECT)
 #define MCU_USER_MODE_REG_PROT_ENABLED  (STD_OFF)
 
+/* Mcu_InitRamSection checks every word right after writing it instead of in a second pass.
+   MCU_FIP_01_START then precedes the fill, so faults cannot be injected between fill and check */
+#define MCU_RAM_INIT_FUSED_VERIFY       (STD_OFF)
+
+/* System clock in Hz of each clock setting, indexed by McuClockSettingId, 0 when not known.
+   Used by MCU_CLOCK_PROFILE_API and MCU_FLASH_WS_AUTO_TUNE */
+#define MCU_SYSCLK_HZ_LIST              { 0UL }
+
+/* Mcu_SwitchClockProfile moves between clock settings sharing the PLL setup without relocking */
+#define MCU_CLOCK_PROFILE_API           (STD_OFF)
+
+/* Flash wait states follow the system clock of the active clock setting instead of its configuration */
+#define MCU_FLASH_WS_AUTO_TUNE          (STD_OFF)
+
+#if (MCU_FLASH_WS_AUTO_TUNE == STD_ON)
+/* Minimum flash wait states per maximum system clock, in increasing order, from the device data sheet */
+#define MCU_FLASH_WS_TABLE_SIZE         (4U)
+#define MCU_FLASH_WS_MAX_FREQ_HZ_LIST   { 66000000UL, 133000000UL, 200000000UL, 264000000UL }
+#define MCU_FLASH_WS_SETTING_LIST \
+    { \
+        (MCU_FLASH_READ_WS_U32(1U) | MCU_FLASH_ADDR_PIPELINE_WS_U32(1U)), \
+        (MCU_FLASH_READ_WS_U32(2U) | MCU_FLASH_ADDR_PIPELINE_WS_U32(1U)), \
+        (MCU_FLASH_READ_WS_U32(3U) | MCU_FLASH_ADDR_PIPELINE_WS_U32(1U)), \
+        (MCU_FLASH_READ_WS_U32(5U) | MCU_FLASH_ADDR_PIPELINE_WS_U32(2U)) \
+    }
+#endif /* (MCU_FLASH_WS_AUTO_TUNE == STD_ON) */
+
+/* Mcu_BootTimelineMark records the time base at the end of each init phase, Startup_vle.c built
+   with BOOT_TIMELINE_ENABLE starts the time base at reset and records the start-up phases */
+#define MCU_BOOT_TIMELINE_API           (STD_OFF)
+#define MCU_BOOT_TIMELINE_SIZE          (32U)
+
 /** @violates @ref MCU_SCFG_H_REF_3 MISRA 2004 Advisory Rule 19.7, Function-like macros are used to avoid compiler warnings on unused function parameters. */
 #define MCU_PARAM_UNUSED(param)         ((void)((param)))
 
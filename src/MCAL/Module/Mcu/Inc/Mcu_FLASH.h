@@ -211,6 +211,14 @@ while(0)
 
 /** @violates @ref Mcu_FLASH_h_REF_2 these object are used trough the entire MCU code*/
 extern P2FUNC (void, MCU_CODE, Mcu_FLASH_SetWS) (P2CONST( Mcu_FLASH_ClockConfigType, AUTOMATIC, MCU_APPL_DATA) FLASH_pClockConfigPtr);
+
+#if (MCU_FLASH_WS_AUTO_TUNE == STD_ON)
+FUNC(uint32, MCU_CODE) Mcu_FLASH_GetClockWS
+(
+    VAR(uint32, AUTOMATIC) u32SysClkHz,
+    P2CONST(Mcu_FLASH_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) FLASH_pClockConfigPtr
+);
+#endif /* (MCU_FLASH_WS_AUTO_TUNE == STD_ON) */
 #endif /* (MCU_DISABLE_FLASH_CONFIG == STD_OFF) */
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
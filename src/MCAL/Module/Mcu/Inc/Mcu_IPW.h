@@ -171,6 +171,14 @@ FUNC( void, MCU_CODE) Mcu_Ipw_Init( P2CONST( Mcu_HwIPsConfigType, AUTOMATIC, MCU
 
 #if (MCU_INIT_CLOCK == STD_ON)
 FUNC( void, MCU_CODE) Mcu_Ipw_InitClock( P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr);
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+FUNC( boolean, MCU_CODE) Mcu_Ipw_IsSamePllConfig
+(
+    P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr,
+    P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pOtherClockConfigPtr
+);
+FUNC( Std_ReturnType, MCU_CODE) Mcu_Ipw_SwitchClockProfile( P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr);
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 FUNC( void, MCU_CODE) Mcu_Ipw_SetMode( P2CONST( Mcu_ModeConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pModeConfigPtr);
@@ -242,6 +250,10 @@ FUNC( void, MCU_CODE ) Mcu_Ipw_DisableCmu(VAR(uint8, AUTOMATIC) u8IndexCmu);
 #endif
 #endif
 
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+FUNC( uint32, MCU_CODE) Mcu_Ipw_GetTimeBase( VAR( void, AUTOMATIC));
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
+
 #define MCU_STOP_SEC_CODE
 /** @violates @ref Mcu_IPW_h_REF_1 MISRA 2004 Required Rule 19.15, Repeated include file */
 #include "MemMap.h"
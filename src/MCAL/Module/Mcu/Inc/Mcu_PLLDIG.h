@@ -151,6 +151,13 @@ extern "C"{
 
 #if (MCU_INIT_CLOCK == STD_ON)
 FUNC( void, MCU_CODE) Mcu_PLLDIG_PllConfig(P2CONST( Mcu_PLLDIG_ConfigType, AUTOMATIC, MCU_APPL_CONST) PLLDIG_pConfigPtr);
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+FUNC( boolean, MCU_CODE) Mcu_PLLDIG_IsSameConfig
+(
+    P2CONST( Mcu_PLLDIG_ConfigType, AUTOMATIC, MCU_APPL_CONST) PLLDIG_pConfigPtr,
+    P2CONST( Mcu_PLLDIG_ConfigType, AUTOMATIC, MCU_APPL_CONST) PLLDIG_pOtherConfigPtr
+);
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 #if (MCU_NO_PLL == STD_OFF)
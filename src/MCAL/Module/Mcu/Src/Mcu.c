@@ -66,6 +66,15 @@ extern "C"{
 * Violates MISRA 2004 Required Rule 8.7, Objects shall be defined at block scope if they are only
 * accessed from within a single function
 *
+* @section Mcu_c_REF_8
+* Violates MISRA 2004 Advisory Rule 11.4, A cast should not be performed between a pointer to object
+* type and a different pointer to object type. The RAM section is accessed word wide, the word
+* pointer is only built for word aligned addresses.
+*
+* @section Mcu_c_REF_9
+* Violates MISRA 2004 Advisory Rule 11.3, A cast should not be performed between a pointer type and
+* an integral type. The address is needed to find the first word boundary of the RAM section.
+*
 * @section [global]
 * Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not rely
 * on the significance of more than 31 characters.The used compilers use more than 31 chars for
@@ -195,6 +204,14 @@ typedef enum
 /*==================================================================================================
 *                                       LOCAL MACROS
 ==================================================================================================*/
+#if (MCU_INIT_CLOCK == STD_ON)
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+/**
+* @brief            No clock configuration applied yet.
+*/
+#define MCU_NO_ACTIVE_CLOCK_CONFIG_U8       ((uint8)0xFFU)
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 
 /*==================================================================================================
@@ -217,6 +234,23 @@ typedef enum
 * @brief            Array for saving the Clock configuration Ids.
 */
 static VAR(uint8, MCU_VAR) Mcu_au8ClockConfigIds[MCU_MAX_CLKCONFIGS];
+
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+/**
+* @brief            Index of the first clock configuration with the same PLL setup, per configuration.
+*/
+static VAR(uint8, MCU_VAR) Mcu_au8ClockPllGroup[MCU_MAX_CLKCONFIGS];
+
+/**
+* @brief            Index of the clock configuration currently applied.
+*/
+static VAR(uint8, MCU_VAR) Mcu_u8ActiveClockConfig;
+
+/**
+* @brief            Index of the clock configuration waiting for Mcu_DistributePllClock.
+*/
+static VAR(uint8, MCU_VAR) Mcu_u8PendingClockConfig;
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 
@@ -271,6 +305,51 @@ P2CONST( Mcu_ConfigType, MCU_VAR, MCU_APPL_CONST) Mcu_pConfigPtr = NULL_PTR;
 /** @violates @ref Mcu_c_REF_1 MISRA 2004 Required Rule 19.15, Repeated include files.*/
 #include "MemMap.h"
 
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+#define MCU_START_SEC_VAR_INIT_8
+/**
+* @violates @ref Mcu_c_REF_2 Only preprocessor statements and comments before '#include' MemMap.h */
+/** @violates @ref Mcu_c_REF_1 MISRA 2004 Required Rule 19.15, Repeated include files.*/
+#include "MemMap.h"
+
+/**
+* @brief            Number of events recorded in Mcu_aBootEvents.
+*/
+static VAR(uint8, MCU_VAR) Mcu_u8BootEventCount = 0U;
+
+/**
+* @brief            MCU_BOOT_PHASE_PLL_LOCKED has been recorded.
+*/
+static VAR(boolean, MCU_VAR) Mcu_bBootPllLocked = (boolean)FALSE;
+
+#define MCU_STOP_SEC_VAR_INIT_8
+/**
+* @violates @ref Mcu_c_REF_2 MISRA 2004 Advisory Rule 19.1, only preprocessor statements and
+* comments before '#include' MemMap.h
+*/
+/** @violates @ref Mcu_c_REF_1 MISRA 2004 Required Rule 19.15, Repeated include files.*/
+#include "MemMap.h"
+
+#define MCU_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+* @violates @ref Mcu_c_REF_2 Only preprocessor statements and comments before '#include' MemMap.h */
+/** @violates @ref Mcu_c_REF_1 MISRA 2004 Required Rule 19.15, Repeated include files.*/
+#include "MemMap.h"
+
+/**
+* @brief            Boot events recorded by Mcu_BootTimelineMark.
+*/
+static VAR(Mcu_BootEventType, MCU_VAR) Mcu_aBootEvents[MCU_BOOT_TIMELINE_SIZE];
+
+#define MCU_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+* @violates @ref Mcu_c_REF_2 MISRA 2004 Advisory Rule 19.1, only preprocessor statements and
+* comments before '#include' MemMap.h
+*/
+/** @violates @ref Mcu_c_REF_1 MISRA 2004 Required Rule 19.15, Repeated include files.*/
+#include "MemMap.h"
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
+
 
 /*==================================================================================================
                                        GLOBAL CONSTANTS
@@ -326,6 +405,32 @@ P2CONST( Mcu_DemConfigType, MCU_VAR, MCU_APPL_CONST) Mcu_pDemCfgPtr = NULL_PTR;
 /** @violates @ref Mcu_c_REF_1 MISRA 2004 Required Rule 19.15, Repeated include files.*/
 #include "MemMap.h"
 
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+#define MCU_START_SEC_VAR_INIT_32
+/**
+* @violates @ref Mcu_c_REF_2 MISRA 2004 Advisory Rule 19.1, only preprocessor statements and
+* comments before '#include' MemMap.h
+*/
+/** @violates @ref Mcu_c_REF_1 MISRA 2004 Required Rule 19.15, Repeated include files.*/
+#include "MemMap.h"
+
+/**
+* @brief            Time base at the end of MCU_BOOT_PHASE_STARTUP_RAM_INIT and MCU_BOOT_PHASE_STARTUP.
+* @details          Written by Startup_vle.c right before main, after the initialized data was copied.
+*                   Left at 0 when the start-up code is built without BOOT_TIMELINE_ENABLE.
+* @violates @ref Mcu_c_REF_6 Violates MISRA 2004 Required Rule 8.10, global declaration of function
+*/
+VAR(uint32, MCU_VAR) Mcu_au32BootStartupTime[2] = {0U, 0U};
+
+#define MCU_STOP_SEC_VAR_INIT_32
+/**
+* @violates @ref Mcu_c_REF_2 MISRA 2004 Advisory Rule 19.1, only preprocessor statements and
+* comments before '#include' MemMap.h
+*/
+/** @violates @ref Mcu_c_REF_1 MISRA 2004 Required Rule 19.15, Repeated include files.*/
+#include "MemMap.h"
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
+
 /*==================================================================================================
                                    LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
@@ -346,6 +451,13 @@ static FUNC(Std_ReturnType, MCU_CODE) Mcu_CheckInit(P2CONST( Mcu_ConfigType, AUT
 #if ( MCU_PARAM_CHECK == STD_ON )
 static FUNC(Std_ReturnType, MCU_CODE) Mcu_CheckInitRamSection(VAR( Mcu_RamSectionType, AUTOMATIC) RamSection);
 #endif /* ( MCU_PARAM_CHECK == STD_ON ) */
+static FUNC(Std_ReturnType, MCU_CODE) Mcu_RamSectionPass
+(
+    P2VAR(uint8, AUTOMATIC, MCU_APPL_DATA) pu8RamBase,
+    VAR(Mcu_RamSizeType, AUTOMATIC) RamSize,
+    VAR(uint8, AUTOMATIC) u8Value,
+    VAR(boolean, AUTOMATIC) bFill
+);
 #endif /* ifndef MCU_MAX_NORAMCONFIGS */
 
 
@@ -476,6 +588,100 @@ static FUNC(Std_ReturnType, MCU_CODE) Mcu_CheckInitRamSection(VAR( Mcu_RamSectio
     return (Std_ReturnType) CheckStatus;
 }
 #endif /* ( MCU_PARAM_CHECK == STD_ON ) */
+
+/**
+* @brief            Fills and/or checks a RAM section, word wide.
+* @details          The bytes up to the first 32 bit boundary and the bytes after the last one are
+*                   accessed one at a time, the rest of the section is accessed with aligned 32 bit
+*                   accesses of the value replicated in every byte lane.
+*                   With bFill set the section is written, and each location is read back right
+*                   after being written when MCU_RAM_INIT_FUSED_VERIFY is STD_ON.
+*                   With bFill cleared the section is only read back.
+*                   The read back is served by the data cache when the section is cached, so
+*                   a RAM cell fault is only detected on sections mapped cache-inhibited.
+*
+* @param[in]        pu8RamBase   First byte of the RAM section.
+* @param[in]        RamSize      Size of the RAM section in bytes.
+* @param[in]        u8Value      Value every byte of the section is set to.
+* @param[in]        bFill        TRUE to write the section, FALSE to only check it.
+*
+* @return           Result of the check.
+* @retval           E_OK        No location read back differs from u8Value (or nothing was read).
+* @retval           E_NOT_OK    At least one location read back differs from u8Value.
+*/
+static FUNC(Std_ReturnType, MCU_CODE) Mcu_RamSectionPass
+(
+    P2VAR(uint8, AUTOMATIC, MCU_APPL_DATA) pu8RamBase,
+    VAR(Mcu_RamSizeType, AUTOMATIC) RamSize,
+    VAR(uint8, AUTOMATIC) u8Value,
+    VAR(boolean, AUTOMATIC) bFill
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) RamStatus = (Std_ReturnType)E_OK;
+    /* Volatile keeps the compiler from dropping the read back; it does not bypass the data
+       cache, so over a cached section the check only sees the cache lines, not the RAM array. */
+    P2VAR(volatile uint8, AUTOMATIC, MCU_APPL_DATA) pu8Ram = pu8RamBase;
+    P2VAR(volatile uint32, AUTOMATIC, MCU_APPL_DATA) pu32Ram;
+    VAR(uint32, AUTOMATIC) u32Pattern = (uint32)u8Value * (uint32)0x01010101UL;
+    VAR(Mcu_RamIndexType, AUTOMATIC) RamContor;
+    VAR(Mcu_RamIndexType, AUTOMATIC) HeadBytes;
+    VAR(Mcu_RamIndexType, AUTOMATIC) WordCount;
+#if (MCU_RAM_INIT_FUSED_VERIFY == STD_ON)
+    VAR(boolean, AUTOMATIC) bCheck = (boolean)TRUE;
+#else
+    VAR(boolean, AUTOMATIC) bCheck = (bFill == (boolean)TRUE) ? (boolean)FALSE : (boolean)TRUE;
+#endif
+
+    /* Bytes before the first word boundary. */
+    /** @violates @ref Mcu_c_REF_9 MISRA 2004 Advisory Rule 11.3, cast from pointer to integral type. */
+    HeadBytes = (Mcu_RamIndexType)(((uint32)0x4UL - ((uint32)pu8RamBase & (uint32)0x3UL)) & (uint32)0x3UL);
+    if (HeadBytes > (Mcu_RamIndexType)RamSize)
+    {
+        HeadBytes = (Mcu_RamIndexType)RamSize;
+    }
+    WordCount = (Mcu_RamIndexType)(((Mcu_RamIndexType)RamSize - HeadBytes) >> 2U);
+
+    for (RamContor = (Mcu_RamIndexType)0UL; RamContor < HeadBytes; RamContor++)
+    {
+        if ((boolean)TRUE == bFill)
+        {
+            pu8Ram[RamContor] = u8Value;
+        }
+        if (((boolean)TRUE == bCheck) && (pu8Ram[RamContor] != u8Value))
+        {
+            RamStatus = (Std_ReturnType)E_NOT_OK;
+        }
+    }
+
+    /** @violates @ref Mcu_c_REF_8 MISRA 2004 Advisory Rule 11.4, cast between pointer types. */
+    pu32Ram = (volatile uint32 *)(&pu8Ram[HeadBytes]);
+    for (RamContor = (Mcu_RamIndexType)0UL; RamContor < WordCount; RamContor++)
+    {
+        if ((boolean)TRUE == bFill)
+        {
+            pu32Ram[RamContor] = u32Pattern;
+        }
+        if (((boolean)TRUE == bCheck) && (pu32Ram[RamContor] != u32Pattern))
+        {
+            RamStatus = (Std_ReturnType)E_NOT_OK;
+        }
+    }
+
+    /* Bytes after the last word boundary. */
+    for (RamContor = HeadBytes + (WordCount << 2U); RamContor < (Mcu_RamIndexType)RamSize; RamContor++)
+    {
+        if ((boolean)TRUE == bFill)
+        {
+            pu8Ram[RamContor] = u8Value;
+        }
+        if (((boolean)TRUE == bCheck) && (pu8Ram[RamContor] != u8Value))
+        {
+            RamStatus = (Std_ReturnType)E_NOT_OK;
+        }
+    }
+
+    return RamStatus;
+}
 #endif /* ifndef MCU_MAX_NORAMCONFIGS */
 
 
@@ -743,6 +949,11 @@ FUNC(void, MCU_CODE) Mcu_Init( P2CONST( Mcu_ConfigType, AUTOMATIC, MCU_APPL_CONS
 {
     /* Temporary valirable for looping all the configurations. */
     VAR(uint32, AUTOMATIC) u32NoConfigs;
+#if (MCU_INIT_CLOCK == STD_ON)
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+    VAR(uint32, AUTOMATIC) u32Group;
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
 #if ( ( MCU_VALIDATE_GLOBAL_CALL == STD_ON ) || ( MCU_PARAM_CHECK==STD_ON ) )
     VAR(Std_ReturnType, AUTOMATIC ) checkStatus;
 #endif /*( ( MCU_VALIDATE_GLOBAL_CALL == STD_ON ) || ( MCU_PARAM_CHECK==STD_ON ) )*/
@@ -788,6 +999,24 @@ FUNC(void, MCU_CODE) Mcu_Init( P2CONST( Mcu_ConfigType, AUTOMATIC, MCU_APPL_CONS
             {
                 Mcu_au8ClockConfigIds[(*Mcu_pConfigPtr->Mcu_apClockConfig)[u32NoConfigs].Mcu_ClkConfigId] = (uint8)u32NoConfigs;
             }
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+            /* Group the clock configurations sharing a PLL setup, Mcu_SwitchClockProfile moves
+               inside a group without reprogramming the PLLs. */
+            for(u32NoConfigs = (uint32)0U; u32NoConfigs < Mcu_pConfigPtr->Mcu_NoClkConfigs; u32NoConfigs++)
+            {
+                Mcu_au8ClockPllGroup[u32NoConfigs] = (uint8)u32NoConfigs;
+                for(u32Group = (uint32)0U; u32Group < u32NoConfigs; u32Group++)
+                {
+                    if ((boolean)TRUE == Mcu_Ipw_IsSamePllConfig(&(*Mcu_pConfigPtr->Mcu_apClockConfig)[u32NoConfigs], &(*Mcu_pConfigPtr->Mcu_apClockConfig)[u32Group]))
+                    {
+                        Mcu_au8ClockPllGroup[u32NoConfigs] = Mcu_au8ClockPllGroup[u32Group];
+                        break;
+                    }
+                }
+            }
+            Mcu_u8ActiveClockConfig = MCU_NO_ACTIVE_CLOCK_CONFIG_U8;
+            Mcu_u8PendingClockConfig = MCU_NO_ACTIVE_CLOCK_CONFIG_U8;
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 #ifndef MCU_MAX_NORAMCONFIGS
@@ -798,6 +1027,9 @@ FUNC(void, MCU_CODE) Mcu_Init( P2CONST( Mcu_ConfigType, AUTOMATIC, MCU_APPL_CONS
             }
 #endif /*( 0 != MCU_MAX_RAMCONFIGS )*/
             Mcu_Ipw_Init( Mcu_pConfigPtr->Mcu_pHwIPsConfig);
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+            Mcu_BootTimelineMark(MCU_BOOT_PHASE_MCU_INIT);
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
             /* the driver was initialized, set the proper status */
 
 #if (MCU_PARAM_CHECK==STD_ON)
@@ -849,8 +1081,6 @@ FUNC( Std_ReturnType, MCU_CODE) Mcu_InitRamSection( VAR( Mcu_RamSectionType, AUT
     VAR(Std_ReturnType, AUTOMATIC) RamStatus = (Std_ReturnType)E_NOT_OK;
 
 #ifndef MCU_MAX_NORAMCONFIGS
-    /* Variable for indexinf RAM sections. */
-    VAR(Mcu_RamIndexType, AUTOMATIC) RamContor;
     /* Pointer to RAM configuration: base addr, size, default value. */
     P2CONST( Mcu_RamConfigType, AUTOMATIC, MCU_APPL_CONST) pRamConfigPtr;
 #endif
@@ -870,25 +1100,36 @@ FUNC( Std_ReturnType, MCU_CODE) Mcu_InitRamSection( VAR( Mcu_RamSectionType, AUT
             /* Get Ram settings from the configuration structure. */
             pRamConfigPtr = &(*Mcu_pConfigPtr->Mcu_apRamConfig)[Mcu_au8RamConfigIds[RamSection]];
 
-            for(RamContor = (Mcu_RamIndexType)0UL; RamContor < ((Mcu_RamSizeType)(pRamConfigPtr->Mcu_RamSize)); RamContor++)
-            {
-                (*pRamConfigPtr->Mcu_pu8RamBaseAddr)[RamContor] = pRamConfigPtr->Mcu_u8RamDefaultValue;
-            }
+#if (MCU_RAM_INIT_FUSED_VERIFY == STD_ON)
+            /* The fill and the check are a single pass, so there is no point between them:
+               MCU_FIP_01_START is placed before the fill and a fault injected there is
+               overwritten. Faults in the written RAM can only be injected with
+               MCU_RAM_INIT_FUSED_VERIFY set to STD_OFF. */
+            MCAL_FAULT_INJECTION_POINT(MCU_FIP_01_START);
+
+            /* Write the RAM and check every location right after it was written. */
+            RamStatus = Mcu_RamSectionPass(&(*pRamConfigPtr->Mcu_pu8RamBaseAddr)[0], \
+                                           (Mcu_RamSizeType)(pRamConfigPtr->Mcu_RamSize), \
+                                           pRamConfigPtr->Mcu_u8RamDefaultValue, (boolean)TRUE);
 
-            RamStatus = (Std_ReturnType)E_OK;
+            MCAL_FAULT_INJECTION_POINT(MCU_FIP_02_STOP);
+#else
+            (void)Mcu_RamSectionPass(&(*pRamConfigPtr->Mcu_pu8RamBaseAddr)[0], \
+                                     (Mcu_RamSizeType)(pRamConfigPtr->Mcu_RamSize), \
+                                     pRamConfigPtr->Mcu_u8RamDefaultValue, (boolean)TRUE);
 
             MCAL_FAULT_INJECTION_POINT(MCU_FIP_01_START);
 
             /* Check if RAM was initialized correctly. */
-            for(RamContor = (Mcu_RamIndexType)0UL; RamContor < ((Mcu_RamSizeType)(pRamConfigPtr->Mcu_RamSize)); RamContor++)
-            {
-                if ((*pRamConfigPtr->Mcu_pu8RamBaseAddr)[RamContor] != pRamConfigPtr->Mcu_u8RamDefaultValue)
-                {
-                    RamStatus = (Std_ReturnType)E_NOT_OK;
-                }
-            }
+            RamStatus = Mcu_RamSectionPass(&(*pRamConfigPtr->Mcu_pu8RamBaseAddr)[0], \
+                                           (Mcu_RamSizeType)(pRamConfigPtr->Mcu_RamSize), \
+                                           pRamConfigPtr->Mcu_u8RamDefaultValue, (boolean)FALSE);
 
             MCAL_FAULT_INJECTION_POINT(MCU_FIP_02_STOP);
+#endif /* (MCU_RAM_INIT_FUSED_VERIFY == STD_ON) */
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+            Mcu_BootTimelineMark(MCU_BOOT_PHASE_MCU_INIT_RAM);
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
 #if (MCU_PARAM_CHECK==STD_ON)
         }
 #endif /*(MCU_PARAM_CHECK==STD_ON)*/
@@ -945,6 +1186,18 @@ FUNC( Std_ReturnType, MCU_CODE) Mcu_InitClock( VAR( Mcu_ClockType, AUTOMATIC) Cl
         {
 #endif /*(MCU_PARAM_CHECK==STD_ON)*/
             Mcu_Ipw_InitClock(&(*Mcu_pConfigPtr->Mcu_apClockConfig)[Mcu_au8ClockConfigIds[ClockSetting]]);
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+            Mcu_BootTimelineMark(MCU_BOOT_PHASE_MCU_INIT_CLOCK);
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+#if (MCU_NO_PLL == STD_OFF)
+            /* The clock setting is applied once Mcu_DistributePllClock selected the PLL clock */
+            Mcu_u8ActiveClockConfig = MCU_NO_ACTIVE_CLOCK_CONFIG_U8;
+            Mcu_u8PendingClockConfig = Mcu_au8ClockConfigIds[ClockSetting];
+#else
+            Mcu_u8ActiveClockConfig = Mcu_au8ClockConfigIds[ClockSetting];
+#endif /* (MCU_NO_PLL == STD_OFF) */
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
             /* Command has been accepted. */
             ClockStatus = (Std_ReturnType)E_OK;
 #if (MCU_PARAM_CHECK==STD_ON)
@@ -956,6 +1209,83 @@ FUNC( Std_ReturnType, MCU_CODE) Mcu_InitClock( VAR( Mcu_ClockType, AUTOMATIC) Cl
 #endif /*( MCU_VALIDATE_GLOBAL_CALL == STD_ON )*/
     return (Std_ReturnType)ClockStatus;
 }
+
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+/**
+* @brief            MCU driver fast clock setting switch.
+* @details          Switches to ClockSetting without the full Mcu_InitClock sequence when it uses
+*                   the same PLL setup as the clock setting currently applied and the PLLs are
+*                   locked. Only the dividers, the system clock selection, the wait-states and the
+*                   clock dependent monitors are rewritten, with the system clock on the IRC while
+*                   the dividers change, so the switch does not wait for a PLL lock. The clock
+*                   settings sharing a PLL setup are found by Mcu_Init. A clock setting applied by
+*                   Mcu_InitClock can be switched from once Mcu_DistributePllClock completed it.
+*                   If the PLLs have to be reprogrammed the function does nothing and returns
+*                   E_NOT_OK: the caller then uses Mcu_InitClock and Mcu_DistributePllClock.
+*                   If the PLLs lose their lock during the switch, the system clock is left on the
+*                   IRC and E_NOT_OK is returned: Mcu_DistributePllClock completes the switch.
+*
+* @param[in]        ClockSetting   Clock setting ID from config structure to be used.
+*
+* @return           Command has or has not been accepted.
+* @retval           E_OK        The clock setting is applied.
+* @retval           E_NOT_OK    The driver state or the parameter was invalid, the clock setting
+*                                   needs a PLL reconfiguration, or the PLLs lost their lock.
+*
+* @api
+*
+*/
+/** @violates @ref Mcu_c_REF_6 Violates MISRA 2004 Required Rule 8.10, global declaration of
+  * function */
+FUNC( Std_ReturnType, MCU_CODE) Mcu_SwitchClockProfile( VAR( Mcu_ClockType, AUTOMATIC) ClockSetting)
+{
+    VAR(Std_ReturnType, AUTOMATIC) ClockStatus = (Std_ReturnType)E_NOT_OK;
+    VAR(uint8, AUTOMATIC) u8Config;
+
+#if ( MCU_VALIDATE_GLOBAL_CALL == STD_ON )
+    if((Std_ReturnType)E_OK == (Std_ReturnType)Mcu_HLDChecksEntry(MCU_SWITCHCLOCKPROFILE_ID))
+    {
+#endif /*(MCU_VALIDATE_GLOBAL_CALL == STD_ON)*/
+#if (MCU_PARAM_CHECK==STD_ON)
+        if ( ClockSetting >= (Mcu_pConfigPtr->Mcu_NoClkConfigs) )
+        {
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+            (void) Det_ReportError((uint16)MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_SWITCHCLOCKPROFILE_ID, MCU_E_PARAM_CLOCK);
+#endif /* (MCU_DEV_ERROR_DETECT == STD_ON) */
+        }
+        else
+        {
+#endif /*(MCU_PARAM_CHECK==STD_ON)*/
+            u8Config = Mcu_au8ClockConfigIds[ClockSetting];
+            if ((MCU_NO_ACTIVE_CLOCK_CONFIG_U8 != Mcu_u8ActiveClockConfig) &&
+                (Mcu_au8ClockPllGroup[u8Config] == Mcu_au8ClockPllGroup[Mcu_u8ActiveClockConfig])
+#if (MCU_NO_PLL == STD_OFF)
+                && (MCU_PLL_UNLOCKED != Mcu_Ipw_GetPllStatus())
+#endif /* (MCU_NO_PLL == STD_OFF) */
+               )
+            {
+                if ((Std_ReturnType)E_OK == Mcu_Ipw_SwitchClockProfile(&(*Mcu_pConfigPtr->Mcu_apClockConfig)[u8Config]))
+                {
+                    Mcu_u8ActiveClockConfig = u8Config;
+                    ClockStatus = (Std_ReturnType)E_OK;
+                }
+                else
+                {
+                    /* Left on the IRC until Mcu_DistributePllClock */
+                    Mcu_u8ActiveClockConfig = MCU_NO_ACTIVE_CLOCK_CONFIG_U8;
+                    Mcu_u8PendingClockConfig = u8Config;
+                }
+            }
+#if (MCU_PARAM_CHECK==STD_ON)
+        }
+#endif /*(MCU_PARAM_CHECK==STD_ON)*/
+#if ( MCU_VALIDATE_GLOBAL_CALL == STD_ON )
+        Mcu_HLDChecksExit((Std_ReturnType)E_OK, MCU_SWITCHCLOCKPROFILE_ID);
+    }
+#endif /*( MCU_VALIDATE_GLOBAL_CALL == STD_ON )*/
+    return (Std_ReturnType)ClockStatus;
+}
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 
@@ -1044,6 +1374,12 @@ FUNC( void, MCU_CODE) Mcu_DistributePllClock(VAR( void, AUTOMATIC))
             If the PLL0 is already selected as system clock, then this function will return without
             doing anithing. */
             Mcu_Ipw_DistributePllClock();
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+            Mcu_u8ActiveClockConfig = Mcu_u8PendingClockConfig;
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+            Mcu_BootTimelineMark(MCU_BOOT_PHASE_PLL_DISTRIBUTED);
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
 
 #if ( MCU_PARAM_CHECK==STD_ON )
         }
@@ -1098,6 +1434,14 @@ FUNC( Mcu_PllStatusType, MCU_CODE) Mcu_GetPllStatus( VAR( void, AUTOMATIC))
         /* Get status of the PLL (if enabled in current mode).
            At this point the return value can be only MCU_PLL_LOCKED or MCU_PLL_UNLOCKED. */
         ePllStatus = Mcu_Ipw_GetPllStatus();
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+        /* The first lock seen tells how long the PLL took to lock after Mcu_InitClock. */
+        if ((MCU_PLL_LOCKED == ePllStatus) && ((boolean)FALSE == Mcu_bBootPllLocked))
+        {
+            Mcu_bBootPllLocked = (boolean)TRUE;
+            Mcu_BootTimelineMark(MCU_BOOT_PHASE_PLL_LOCKED);
+        }
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
 #endif /* (MCU_NO_PLL == STD_OFF) */
 #if ( MCU_VALIDATE_GLOBAL_CALL == STD_ON )
         Mcu_HLDChecksExit((Std_ReturnType)E_OK ,MCU_GETPLLSTATUS_ID);
@@ -1717,6 +2061,174 @@ FUNC(void, MCU_CODE ) Mcu_DisableCmu(VAR (uint8, AUTOMATIC) u8IndexCmu)
 #endif
 #endif
 
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+/**
+* @brief            This function records the end of a boot phase.
+* @details          The current time base is stored with the phase. The events past
+*                   MCU_BOOT_TIMELINE_SIZE are dropped. The function can be called before Mcu_Init,
+*                   from the task running the initialization sequence only.
+*
+* @param[in]        Phase   Boot phase which ended.
+*
+* @return           void
+*
+* @api
+*
+*/
+/**
+* @violates @ref Mcu_c_REF_6 Violates MISRA 2004 Required Rule 8.10, global declaration of function
+*/
+FUNC(void, MCU_CODE) Mcu_BootTimelineMark(VAR( Mcu_BootPhaseType, AUTOMATIC) Phase)
+{
+    if (Mcu_u8BootEventCount < (uint8)MCU_BOOT_TIMELINE_SIZE)
+    {
+        Mcu_aBootEvents[Mcu_u8BootEventCount].u32Time = Mcu_Ipw_GetTimeBase();
+        Mcu_aBootEvents[Mcu_u8BootEventCount].Phase = Phase;
+        Mcu_u8BootEventCount++;
+    }
+}
+
+
+/**
+* @brief            This function reads back the boot timeline.
+* @details          The start-up phases recorded by Startup_vle.c come first, followed by the events
+*                   recorded by Mcu_BootTimelineMark, in the order they were recorded.
+*
+* @param[out]       pEvents       Buffer receiving the events.
+* @param[in]        u8MaxEvents   Number of events pEvents can hold.
+*
+* @return           uint8   Number of events written to pEvents.
+*
+* @api
+*
+*/
+/**
+* @violates @ref Mcu_c_REF_6 Violates MISRA 2004 Required Rule 8.10, global declaration of function
+*/
+FUNC(uint8, MCU_CODE) Mcu_GetBootTimeline
+(
+    P2VAR( Mcu_BootEventType, AUTOMATIC, MCU_APPL_DATA) pEvents,
+    VAR( uint8, AUTOMATIC) u8MaxEvents
+)
+{
+    VAR(uint8, AUTOMATIC) u8Count = 0U;
+    VAR(uint8, AUTOMATIC) u8Index;
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    if (NULL_PTR == pEvents)
+    {
+        (void) Det_ReportError((uint16)MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_GETBOOTTIMELINE_ID, MCU_E_PARAM_POINTER);
+    }
+    else
+    {
+#endif /* (MCU_DEV_ERROR_DETECT == STD_ON) */
+        /* The start-up phases are only there when the start-up code recorded them. */
+        if ((uint32)0U != Mcu_au32BootStartupTime[1])
+        {
+            for (u8Index = 0U; (u8Index < (uint8)2U) && (u8Count < u8MaxEvents); u8Index++)
+            {
+                pEvents[u8Count].u32Time = Mcu_au32BootStartupTime[u8Index];
+                pEvents[u8Count].Phase = (Mcu_BootPhaseType)(MCU_BOOT_PHASE_STARTUP_RAM_INIT + u8Index);
+                u8Count++;
+            }
+        }
+
+        for (u8Index = 0U; (u8Index < Mcu_u8BootEventCount) && (u8Count < u8MaxEvents); u8Index++)
+        {
+            pEvents[u8Count] = Mcu_aBootEvents[u8Index];
+            u8Count++;
+        }
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    }
+#endif /* (MCU_DEV_ERROR_DETECT == STD_ON) */
+
+    return u8Count;
+}
+
+
+#if (MCU_INIT_CLOCK == STD_ON)
+/**
+* @brief            This function runs the clock initialization overlapped with other init steps.
+* @details          Mcu_InitClock starts the PLLs and returns without waiting for their lock. The
+*                   steps are then run in order, each one followed by its boot timeline event, so
+*                   that the lock time is spent in useful initialization. The PLL lock is then
+*                   polled for at most MCU_TIMEOUT_LOOPS reads and the PLL clock is distributed.
+*                   The steps are not run if Mcu_InitClock rejects ClockSetting.
+*                   The function shall be called after Mcu_Init, from the task running the
+*                   initialization sequence.
+*
+* @param[in]        ClockSetting   Clock setting ID from config structure to be used.
+* @param[in]        pSteps         Steps to run while the PLLs lock, may be NULL_PTR if u8StepCount
+*                                  is 0.
+* @param[in]        u8StepCount    Number of steps in pSteps.
+*
+* @return           Result of the clock initialization.
+* @retval           E_OK        The clock setting is applied and the PLL clock distributed.
+* @retval           E_NOT_OK    The clock setting was rejected, or the PLL did not lock within
+*                                   MCU_TIMEOUT_LOOPS reads and the system still runs from the IRC.
+*
+* @api
+*
+*/
+/**
+* @violates @ref Mcu_c_REF_6 Violates MISRA 2004 Required Rule 8.10, global declaration of function
+*/
+FUNC(Std_ReturnType, MCU_CODE) Mcu_BootInitSequence
+(
+    VAR( Mcu_ClockType, AUTOMATIC) ClockSetting,
+    P2CONST( Mcu_BootInitStepType, AUTOMATIC, MCU_APPL_CONST) pSteps,
+    VAR( uint8, AUTOMATIC) u8StepCount
+)
+{
+    VAR(Std_ReturnType, AUTOMATIC) ClockStatus = (Std_ReturnType)E_NOT_OK;
+    VAR(uint8, AUTOMATIC) u8Index;
+#if (MCU_NO_PLL == STD_OFF)
+    VAR(uint32, AUTOMATIC) u32TimeOut = MCU_TIMEOUT_LOOPS;
+    VAR(Mcu_PllStatusType, AUTOMATIC) ePllStatus;
+#endif /* (MCU_NO_PLL == STD_OFF) */
+
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    if ((NULL_PTR == pSteps) && ((uint8)0U != u8StepCount))
+    {
+        (void) Det_ReportError((uint16)MCU_MODULE_ID, MCU_INSTANCE_ID, MCU_BOOTINITSEQUENCE_ID, MCU_E_PARAM_POINTER);
+    }
+    else
+    {
+#endif /* (MCU_DEV_ERROR_DETECT == STD_ON) */
+        if ((Std_ReturnType)E_OK == Mcu_InitClock(ClockSetting))
+        {
+            /* The PLLs are locking from here on */
+            for (u8Index = 0U; u8Index < u8StepCount; u8Index++)
+            {
+                pSteps[u8Index].pfInit();
+                Mcu_BootTimelineMark(pSteps[u8Index].Phase);
+            }
+
+#if (MCU_NO_PLL == STD_OFF)
+            do
+            {
+                u32TimeOut--;
+                ePllStatus = Mcu_GetPllStatus();
+            } while ((u32TimeOut > (uint32)0x0U) && (MCU_PLL_LOCKED != ePllStatus));
+
+            if (MCU_PLL_LOCKED == ePllStatus)
+            {
+                Mcu_DistributePllClock();
+                ClockStatus = (Std_ReturnType)E_OK;
+            }
+#else
+            ClockStatus = (Std_ReturnType)E_OK;
+#endif /* (MCU_NO_PLL == STD_OFF) */
+        }
+#if (MCU_DEV_ERROR_DETECT == STD_ON)
+    }
+#endif /* (MCU_DEV_ERROR_DETECT == STD_ON) */
+
+    return ClockStatus;
+}
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
+
 #define MCU_STOP_SEC_CODE
 /**
 * @violates @ref Mcu_c_REF_2 MISRA 2004 Advisory Rule 19.1, only preprocessor statements and
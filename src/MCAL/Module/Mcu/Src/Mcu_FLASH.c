@@ -160,6 +160,34 @@ extern "C"{
 /*==================================================================================================
 *                                      LOCAL CONSTANTS
 ==================================================================================================*/
+#if (MCU_INIT_CLOCK == STD_ON)
+#if (MCU_DISABLE_FLASH_CONFIG == STD_OFF)
+#if (MCU_FLASH_WS_AUTO_TUNE == STD_ON)
+#define MCU_START_SEC_CONST_32
+/**
+* @violates @ref Mcu_FLASH_c_REF_1 MISRA 2004 Advisory Rule 19.1, only preprocessor
+* statements and comments before '#include'
+* @violates @ref Mcu_FLASH_c_REF_2 MISRA 2004 Required Rule 19.15, Repeated include file
+*/
+#include "MemMap.h"
+
+/* Highest system clock supported by each wait-state setting. */
+static CONST(uint32, MCU_CONST) Mcu_FLASH_au32WsMaxFreqHz[MCU_FLASH_WS_TABLE_SIZE] = MCU_FLASH_WS_MAX_FREQ_HZ_LIST;
+
+/* PFCR1[APC] and PFCR1[RWSC] values of each wait-state setting. */
+static CONST(uint32, MCU_CONST) Mcu_FLASH_au32WsSetting[MCU_FLASH_WS_TABLE_SIZE] = MCU_FLASH_WS_SETTING_LIST;
+
+#define MCU_STOP_SEC_CONST_32
+/**
+* @violates @ref Mcu_FLASH_c_REF_1 MISRA 2004 Advisory Rule 19.1, only preprocessor
+* statements and comments before '#include'
+* @violates @ref Mcu_FLASH_c_REF_2 MISRA 2004 Required Rule 19.15, Repeated include file
+*/
+#include "MemMap.h"
+#endif /* (MCU_FLASH_WS_AUTO_TUNE == STD_ON) */
+#endif /* (MCU_DISABLE_FLASH_CONFIG == STD_OFF) */
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
 
 
 /*==================================================================================================
@@ -434,6 +462,68 @@ static FUNC(void, MCU_RAM_CODE) Mcu_FLASH_SetWsRam (P2CONST( Mcu_FLASH_ClockConf
 /** @violates @ref Mcu_FLASH_c_REF_2 MISRA 2004 Required Rule 19.15, Repeated include files.  */
 #include "MemMap.h"
 
+#if (MCU_INIT_CLOCK == STD_ON)
+#if (MCU_DISABLE_FLASH_CONFIG == STD_OFF)
+#if (MCU_FLASH_WS_AUTO_TUNE == STD_ON)
+#define MCU_START_SEC_CODE
+/**
+* @violates @ref Mcu_FLASH_c_REF_1 MISRA 2004 Advisory Rule 19.1, only preprocessor
+* statements and comments before '#include'
+*/
+/** @violates @ref Mcu_FLASH_c_REF_2 MISRA 2004 Required Rule 19.15, Repeated include files.  */
+#include "MemMap.h"
+
+/**
+* @brief            This function returns the flash wait-states for the system clock of a clock setting.
+* @details          The smallest wait-state setting of the table supporting the system clock of the
+*                   clock setting is returned. The configured wait-states are kept when the system
+*                   clock of the clock setting is not known or is above the table.
+*                   The lookup runs from flash, only the register update in Mcu_FLASH_SetWS runs
+*                   from RAM.
+*                   Called by:
+*                       - Mcu_Ipw_SetFlashWS() from IPW.
+*
+* @param[in]        u32SysClkHz             System clock of the clock setting in Hz, 0 if not known.
+* @param[in]        FLASH_pClockConfigPtr   Flash configuration of the clock setting.
+*
+* @return           uint32                  PFCR1[APC] and PFCR1[RWSC] values.
+*
+*/
+FUNC(uint32, MCU_CODE) Mcu_FLASH_GetClockWS
+(
+    VAR(uint32, AUTOMATIC) u32SysClkHz,
+    P2CONST(Mcu_FLASH_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) FLASH_pClockConfigPtr
+)
+{
+    VAR(uint32, AUTOMATIC) u32FlashWS = FLASH_pClockConfigPtr->u32FlashWS;
+    VAR(uint32, AUTOMATIC) u32Index;
+
+    if ((uint32)0U != u32SysClkHz)
+    {
+        for (u32Index = 0U; u32Index < (uint32)MCU_FLASH_WS_TABLE_SIZE; u32Index++)
+        {
+            if (u32SysClkHz <= Mcu_FLASH_au32WsMaxFreqHz[u32Index])
+            {
+                u32FlashWS = Mcu_FLASH_au32WsSetting[u32Index];
+                break;
+            }
+        }
+    }
+
+    return u32FlashWS;
+}
+
+#define MCU_STOP_SEC_CODE
+/**
+* @violates @ref Mcu_FLASH_c_REF_1 MISRA 2004 Advisory Rule 19.1, only preprocessor
+* statements and comments before '#include'
+*/
+/** @violates @ref Mcu_FLASH_c_REF_2 MISRA 2004 Required Rule 19.15, Repeated include files.  */
+#include "MemMap.h"
+#endif /* (MCU_FLASH_WS_AUTO_TUNE == STD_ON) */
+#endif /* (MCU_DISABLE_FLASH_CONFIG == STD_OFF) */
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
 
 #ifdef __cplusplus
 }
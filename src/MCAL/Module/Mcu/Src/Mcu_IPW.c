@@ -360,11 +360,40 @@ extern "C"
 /*==================================================================================================
 *                                       LOCAL MACROS
 ==================================================================================================*/
+#if (MCU_INIT_CLOCK == STD_ON)
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+/* Step of Mcu_Ipw_SwitchClockProfile at which the memory wait-states are written */
+#define MCU_WS_BEFORE_SWITCH_U8     ((uint8)0U)
+#define MCU_WS_ON_IRC_U8            ((uint8)1U)
+#define MCU_WS_AFTER_SWITCH_U8      ((uint8)2U)
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 
 /*==================================================================================================
                                        LOCAL CONSTANTS
 ==================================================================================================*/
+#if (MCU_INIT_CLOCK == STD_ON)
+#if ((MCU_CLOCK_PROFILE_API == STD_ON) || (MCU_FLASH_WS_AUTO_TUNE == STD_ON))
+#define MCU_START_SEC_CONST_32
+/**
+* @violates @ref Mcu_IPW_c_REF_1 MISRA 2004 Required Rule 19.15, Repeated include file
+* @violates @ref Mcu_IPW_c_REF_2 MISRA 2004 Advisory Rule 19.1, only preprocessor
+* statements and comments before '#include'
+*/
+#include "MemMap.h"
+/* System clock of each clock setting, 0 when not known. */
+static CONST( uint32, MCU_CONST) Mcu_Ipw_au32SysClkHz[MCU_MAX_CLKCONFIGS] = MCU_SYSCLK_HZ_LIST;
+
+#define MCU_STOP_SEC_CONST_32
+/**
+* @violates @ref Mcu_IPW_c_REF_1 MISRA 2004 Required Rule 19.15, Repeated include file
+* @violates @ref Mcu_IPW_c_REF_2 MISRA 2004 Advisory Rule 19.1, only preprocessor
+* statements and comments before '#include'
+*/
+#include "MemMap.h"
+#endif /* ((MCU_CLOCK_PROFILE_API == STD_ON) || (MCU_FLASH_WS_AUTO_TUNE == STD_ON)) */
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 
 /*==================================================================================================
@@ -408,6 +437,17 @@ static P2CONST( Mcu_ClockConfigType, MCU_VAR, MCU_APPL_CONST) Mcu_pClockConfig =
 /*==================================================================================================
                                    LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
+#if (MCU_INIT_CLOCK == STD_ON)
+#if ((MCU_CLOCK_PROFILE_API == STD_ON) || (MCU_FLASH_WS_AUTO_TUNE == STD_ON))
+static FUNC( uint32, MCU_CODE) Mcu_Ipw_GetSysClkHz( P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr);
+#endif /* ((MCU_CLOCK_PROFILE_API == STD_ON) || (MCU_FLASH_WS_AUTO_TUNE == STD_ON)) */
+#if (MCU_FLASH_WS_AUTO_TUNE == STD_ON)
+static FUNC( void, MCU_CODE) Mcu_Ipw_SetFlashWS( P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr);
+#endif /* (MCU_FLASH_WS_AUTO_TUNE == STD_ON) */
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+static FUNC( void, MCU_CODE) Mcu_Ipw_SetMemoryWS( P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr);
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 
 /*==================================================================================================
@@ -421,6 +461,79 @@ static P2CONST( Mcu_ClockConfigType, MCU_VAR, MCU_APPL_CONST) Mcu_pClockConfig =
 */
 #include "MemMap.h"
 
+#if (MCU_INIT_CLOCK == STD_ON)
+#if ((MCU_CLOCK_PROFILE_API == STD_ON) || (MCU_FLASH_WS_AUTO_TUNE == STD_ON))
+/**
+* @brief            This function returns the system clock of a clock setting.
+*
+* @param[in]        Mcu_pClockConfigPtr   Pointer to clock configuration structure.
+*
+* @return           uint32   System clock in Hz, 0 if not listed in MCU_SYSCLK_HZ_LIST.
+*
+*/
+static FUNC( uint32, MCU_CODE) Mcu_Ipw_GetSysClkHz( P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr)
+{
+    VAR( uint32, AUTOMATIC) u32SysClkHz = 0U;
+
+    if ((uint32)Mcu_pClockConfigPtr->Mcu_ClkConfigId < (uint32)MCU_MAX_CLKCONFIGS)
+    {
+        u32SysClkHz = Mcu_Ipw_au32SysClkHz[Mcu_pClockConfigPtr->Mcu_ClkConfigId];
+    }
+
+    return u32SysClkHz;
+}
+#endif /* ((MCU_CLOCK_PROFILE_API == STD_ON) || (MCU_FLASH_WS_AUTO_TUNE == STD_ON)) */
+
+#if (MCU_FLASH_WS_AUTO_TUNE == STD_ON)
+/**
+* @brief            This function sets the flash wait-states for the system clock of a clock setting.
+* @details          The wait-states are looked up before entering the RAM function which writes them.
+*
+* @param[in]        Mcu_pClockConfigPtr   Pointer to clock configuration structure.
+*
+* @return           void
+*
+*/
+static FUNC( void, MCU_CODE) Mcu_Ipw_SetFlashWS( P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr)
+{
+    VAR( Mcu_FLASH_ClockConfigType, AUTOMATIC) FlashClockConfig;
+
+    FlashClockConfig.u32FlashWS = Mcu_FLASH_GetClockWS(Mcu_Ipw_GetSysClkHz(Mcu_pClockConfigPtr), Mcu_pClockConfigPtr->FLASH_pClockConfig);
+    Call_Mcu_FLASH_SetWS( &FlashClockConfig);
+}
+#endif /* (MCU_FLASH_WS_AUTO_TUNE == STD_ON) */
+
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+/**
+* @brief            This function sets the flash and RAM wait-states of a clock setting.
+*
+* @param[in]        Mcu_pClockConfigPtr   Pointer to clock configuration structure.
+*
+* @return           void
+*
+*/
+static FUNC( void, MCU_CODE) Mcu_Ipw_SetMemoryWS( P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr)
+{
+#ifdef MCU_PREPARE_MEMORY_CONFIG
+    MCU_PREPARE_MEMORY_CONFIG(MCU_MEMORY_CONFIG_ENTRY_POINT);
+#endif
+#if (STD_OFF == MCU_ENABLE_USER_MODE_SUPPORT)
+#if (MCU_FLASH_WS_AUTO_TUNE == STD_ON)
+    Mcu_Ipw_SetFlashWS( Mcu_pClockConfigPtr);
+#else
+    Call_Mcu_FLASH_SetWS( Mcu_pClockConfigPtr->FLASH_pClockConfig);
+#endif /* (MCU_FLASH_WS_AUTO_TUNE == STD_ON) */
+#endif
+#if (MCU_SRAMC_SUPPORT == STD_ON)
+    Call_Mcu_PRAM_SetRamWS( Mcu_pClockConfigPtr->SRAMC_pClockConfig);
+#endif /* (MCU_SRAMC_SUPPORT == STD_ON) */
+#ifdef MCU_PREPARE_MEMORY_CONFIG
+    MCU_PREPARE_MEMORY_CONFIG(MCU_MEMORY_CONFIG_EXIT_POINT);
+#endif
+}
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
+#endif /* (MCU_INIT_CLOCK == STD_ON) */
+
 
 /*==================================================================================================
                                        GLOBAL FUNCTIONS
@@ -526,7 +639,11 @@ FUNC( void, MCU_CODE) Mcu_Ipw_InitClock( P2CONST( Mcu_ClockConfigType, AUTOMATIC
 #if (STD_OFF == MCU_ENABLE_USER_MODE_SUPPORT)
     /* Every Clock configuration need to adjust the wait-states for RAM and Flash. */
     /* Set the wait-states for Flash. */
+#if (MCU_FLASH_WS_AUTO_TUNE == STD_ON)
+    Mcu_Ipw_SetFlashWS( Mcu_pClockConfigPtr);
+#else
     Call_Mcu_FLASH_SetWS( Mcu_pClockConfigPtr->FLASH_pClockConfig);
+#endif /* (MCU_FLASH_WS_AUTO_TUNE == STD_ON) */
 #endif
 
 #if (MCU_SRAMC_SUPPORT == STD_ON)
@@ -566,6 +683,145 @@ FUNC( void, MCU_CODE) Mcu_Ipw_InitClock( P2CONST( Mcu_ClockConfigType, AUTOMATIC
         }
     }
 }
+
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+/**
+* @brief            This function tells whether two clock settings share the PLL configuration.
+* @details          Called by:
+*                       - Mcu_Init() from HLD, to group the clock settings that
+*                         Mcu_SwitchClockProfile() can move between.
+*
+* @param[in]        Mcu_pClockConfigPtr        First clock setting.
+* @param[in]        Mcu_pOtherClockConfigPtr   Second clock setting.
+*
+* @return           TRUE if the PLLs are programmed the same way by both settings.
+*
+*/
+FUNC( boolean, MCU_CODE) Mcu_Ipw_IsSamePllConfig
+(
+    P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr,
+    P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pOtherClockConfigPtr
+)
+{
+    return Mcu_PLLDIG_IsSameConfig(Mcu_pClockConfigPtr->MC_PLLDIG_pClockConfig, Mcu_pOtherClockConfigPtr->MC_PLLDIG_pClockConfig);
+}
+
+/**
+* @brief            This function switches to a clock setting sharing the PLLs of the current one.
+* @details          The PLLs keep running locked, so there is no lock wait. The system clock runs
+*                   from the IRC while the dividers are rewritten, then the new system clock is
+*                   selected. The system clocks of both settings, from MCU_SYSCLK_HZ_LIST, tell
+*                   where the memory wait-states are written: before the switch when the system
+*                   clock speeds up, after it when it slows down, and during the IRC step when a
+*                   frequency is not known or both are equal.
+*                   If the PLLs lost their lock, the system clock is left on the IRC and the switch
+*                   is completed by Mcu_Ipw_DistributePllClock() once they lock again; the
+*                   wait-states of a slow-down then stay at the higher value of the previous setting.
+*                   Called by:
+*                       - Mcu_SwitchClockProfile() from HLD.
+*
+* @param[in]        Mcu_pClockConfigPtr   Pointer to the clock setting to switch to.
+*
+* @return           Std_ReturnType
+* @retval           E_OK        The new system clock is selected.
+* @retval           E_NOT_OK    The PLLs are not locked, the system clock runs from the IRC.
+*
+*/
+FUNC( Std_ReturnType, MCU_CODE) Mcu_Ipw_SwitchClockProfile( P2CONST( Mcu_ClockConfigType, AUTOMATIC, MCU_APPL_CONST) Mcu_pClockConfigPtr)
+{
+#if (MCU_EMIOS_SUPPORT == STD_ON)
+    VAR (uint8, AUTOMATIC)   u8Index = 0U;
+#endif
+    VAR (Std_ReturnType, AUTOMATIC) SwitchStatus = (Std_ReturnType)E_OK;
+    VAR (uint32, AUTOMATIC)  u32NewSysClkHz = Mcu_Ipw_GetSysClkHz(Mcu_pClockConfigPtr);
+    VAR (uint32, AUTOMATIC)  u32OldSysClkHz = Mcu_Ipw_GetSysClkHz(Mcu_pClockConfig);
+    VAR (uint32, AUTOMATIC)  u32SystemClockConfig = Mcu_pClockConfigPtr->SIU_pClockConfig->u32SystemClockConfig;
+    VAR (uint8, AUTOMATIC)   u8WsStep = MCU_WS_ON_IRC_U8;
+
+    if (((uint32)0U != u32NewSysClkHz) && ((uint32)0U != u32OldSysClkHz))
+    {
+        if (u32NewSysClkHz > u32OldSysClkHz)
+        {
+            u8WsStep = MCU_WS_BEFORE_SWITCH_U8;
+        }
+        else if (u32NewSysClkHz < u32OldSysClkHz)
+        {
+            u8WsStep = MCU_WS_AFTER_SWITCH_U8;
+        }
+        else
+        {
+            /* Same system clock, the wait-states are written during the IRC step */
+        }
+    }
+
+    /* The clock monitors are set up for the current frequencies */
+    if (MCU_CLK_NOTIF_EN == Mcu_pClockConfig->Mcu_ClkNotification)
+    {
+        Call_Mcu_CMU_DeInit();
+    }
+
+    Mcu_pClockConfig = Mcu_pClockConfigPtr;
+
+    if (MCU_WS_BEFORE_SWITCH_U8 == u8WsStep)
+    {
+        Mcu_Ipw_SetMemoryWS( Mcu_pClockConfigPtr);
+    }
+
+    /* if system clock tree is under MCU control, run from the IRC while the dividers change */
+    if(0xFFFFFFFFU != u32SystemClockConfig)
+    {
+        Mcu_SIU_SystemClockConfig(u32SystemClockConfig & ~SIU_SYSDIV_SYSCLKSEL_MASK32);
+    }
+
+    Mcu_SIU_ProgClockSwitchConfig( Mcu_pClockConfigPtr->SIU_pClockConfig ) ;
+
+    if( NULL_PTR != Mcu_pClockConfigPtr->SIU_pClockConfig->apAuxClockConfig )
+    {
+        Mcu_SIU_AuxClockConfig( Mcu_pClockConfigPtr->SIU_pClockConfig );
+    }
+
+    if (MCU_WS_ON_IRC_U8 == u8WsStep)
+    {
+        Mcu_Ipw_SetMemoryWS( Mcu_pClockConfigPtr);
+    }
+
+#if (MCU_NO_PLL == STD_OFF)
+    if (MCU_PLL_LOCKED != Mcu_Ipw_GetPllStatus())
+    {
+        /* Left on the IRC, Mcu_Ipw_DistributePllClock() completes the switch */
+        SwitchStatus = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+#endif /* (MCU_NO_PLL == STD_OFF) */
+    {
+        if(0xFFFFFFFFU != u32SystemClockConfig)
+        {
+            Mcu_SIU_SystemClockConfig(u32SystemClockConfig);
+        }
+
+        if (MCU_WS_AFTER_SWITCH_U8 == u8WsStep)
+        {
+            Mcu_Ipw_SetMemoryWS( Mcu_pClockConfigPtr);
+        }
+
+#if (MCU_EMIOS_SUPPORT == STD_ON)
+        /* configure for eMios modules */
+        for (u8Index = 0U; u8Index < MCU_EMIOS_NB_MODULES; u8Index++)
+        {
+            Mcu_eMios_Init(u8Index, Mcu_pClockConfigPtr->EMIOS_pClockConfig);
+        }
+#endif
+
+        /* Set the Clock Monitoring Units ( CMU0 .. n ). */
+        if ( MCU_CLK_NOTIF_EN == Mcu_pClockConfigPtr->Mcu_ClkNotification)
+        {
+            Call_Mcu_CMU_Init( Mcu_pClockConfigPtr->Mcu_CMU_pConfig);
+        }
+    }
+
+    return SwitchStatus;
+}
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 
@@ -819,6 +1075,40 @@ FUNC( void, MCU_CODE ) Mcu_IPW_EmiosConfigureGpren(VAR (uint8, AUTOMATIC) u8Modu
 }
 #endif /* (MCU_EMIOS_CONFIGURE_GPREN_API == STD_ON) */
 
+/* The boot timeline reads the time base started by the start-up code */
+#if ((MCU_BOOT_TIMELINE_API == STD_ON) && !defined(BOOT_TIMELINE_ENABLE))
+    #error "MCU_BOOT_TIMELINE_API requires the start-up code to be built with BOOT_TIMELINE_ENABLE"
+#endif
+#if ((MCU_BOOT_TIMELINE_API == STD_OFF) && defined(BOOT_TIMELINE_ENABLE))
+    #error "BOOT_TIMELINE_ENABLE requires MCU_BOOT_TIMELINE_API to be STD_ON"
+#endif
+
+#if (MCU_BOOT_TIMELINE_API == STD_ON)
+/**
+* @brief            This function returns the core time base.
+* @details          The time base is started at reset by Startup_vle.c built with
+*                   BOOT_TIMELINE_ENABLE.
+*
+* @return           uint32   Lower word of the time base (TBL, SPR 268).
+*
+*/
+#if (defined(_GREENHILLS_C_MPC5777C_) || defined(_DIABDATA_C_MPC5777C_) || defined(_CODEWARRIOR_C_MPC5777C_))
+ASM_KEYWORD FUNC( uint32, MCU_CODE) Mcu_Ipw_GetTimeBase( VAR( void, AUTOMATIC))
+{
+    mfspr r3, 268
+}
+#elif (defined(_HITECH_C_MPC5777C_) || defined(_LINARO_C_MPC5777C_))
+FUNC( uint32, MCU_CODE) Mcu_Ipw_GetTimeBase( VAR( void, AUTOMATIC))
+{
+    uint32 result;
+    __asm volatile("mfspr %0, 268" : "=r" (result) :);
+    return result;
+}
+#else
+    #error "Mcu_Ipw_GetTimeBase is not implemented for this compiler"
+#endif /* GHS || DIAB || CW */
+#endif /* (MCU_BOOT_TIMELINE_API == STD_ON) */
+
 
 #define MCU_STOP_SEC_CODE
 /**
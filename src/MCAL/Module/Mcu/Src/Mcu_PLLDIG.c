@@ -290,6 +290,47 @@ FUNC( void, MCU_CODE) Mcu_PLLDIG_PllConfig(P2CONST( Mcu_PLLDIG_ConfigType, AUTOM
     }
 
 }
+
+#if (MCU_CLOCK_PROFILE_API == STD_ON)
+/**
+* @brief            Compare two PLL configurations.
+* @details          Two clock settings whose PLLDIG register images are identical can be switched
+*                   without reprogramming the PLLs, which then stay locked.
+*
+* @param[in]        PLLDIG_pConfigPtr        First PLL configuration.
+* @param[in]        PLLDIG_pOtherConfigPtr   Second PLL configuration.
+*
+* @return           TRUE if both write the same values to the same registers.
+*
+*/
+FUNC( boolean, MCU_CODE) Mcu_PLLDIG_IsSameConfig
+(
+    P2CONST( Mcu_PLLDIG_ConfigType, AUTOMATIC, MCU_APPL_CONST) PLLDIG_pConfigPtr,
+    P2CONST( Mcu_PLLDIG_ConfigType, AUTOMATIC, MCU_APPL_CONST) PLLDIG_pOtherConfigPtr
+)
+{
+    VAR(uint32, AUTOMATIC) u32Counter;
+    VAR(boolean, AUTOMATIC) bSame = (boolean)TRUE;
+
+    if (PLLDIG_pConfigPtr != PLLDIG_pOtherConfigPtr)
+    {
+        if (PLLDIG_pConfigPtr->u8NoOfPllDigRegsUnderMcuControl != PLLDIG_pOtherConfigPtr->u8NoOfPllDigRegsUnderMcuControl)
+        {
+            bSame = (boolean)FALSE;
+        }
+        for ( u32Counter = (uint32)0x00U; (u32Counter < (uint32)(PLLDIG_pConfigPtr->u8NoOfPllDigRegsUnderMcuControl)) && ((boolean)TRUE == bSame); u32Counter++)
+        {
+            if (((*PLLDIG_pConfigPtr->apPllDigConfig)[u32Counter].u32RegisterAddr != (*PLLDIG_pOtherConfigPtr->apPllDigConfig)[u32Counter].u32RegisterAddr) ||
+                ((*PLLDIG_pConfigPtr->apPllDigConfig)[u32Counter].u32RegisterData != (*PLLDIG_pOtherConfigPtr->apPllDigConfig)[u32Counter].u32RegisterData))
+            {
+                bSame = (boolean)FALSE;
+            }
+        }
+    }
+
+    return bSame;
+}
+#endif /* (MCU_CLOCK_PROFILE_API == STD_ON) */
 #endif /* (MCU_INIT_CLOCK == STD_ON) */
 
 #if (MCU_NO_PLL == STD_OFF)
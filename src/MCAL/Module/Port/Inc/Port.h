@@ -64,6 +64,7 @@ extern "C" {
 
 #include "Std_Types.h"
 #include "Port_Cfg.h"
+#include "Port_EnvCfg.h"
 #include "Mcal.h"
 
 /*=================================================================================================
@@ -176,6 +177,14 @@ extern "C" {
 *
 */
 #define PORT_SETPINMODE_ID              ((uint8)0x04)
+/**
+* @brief   API service ID for PORT apply pin set.
+* @details Parameters used when raising an error/exception.
+*
+* @api
+*
+*/
+#define PORT_APPLYPINSET_ID             ((uint8)0x20)
 
 /* Errors IDs */
 /**
@@ -339,6 +348,16 @@ FUNC (void, PORT_CODE) Port_GetVersionInfo
 */
 FUNC(void, PORT_CODE) Port_RefreshPortDirection(void);
 
+#if (STD_ON == PORT_APPLY_PIN_SET_API)
+/*
+* Applies a set of pin configurations at once.
+*/
+FUNC(void, PORT_CODE) Port_ApplyPinSet
+(
+    P2CONST(Port_PinSetType, AUTOMATIC, PORT_APPL_CONST) pPinSet
+);
+#endif /* (STD_ON == PORT_APPLY_PIN_SET_API) */
+
 
 #define PORT_STOP_SEC_CODE
 /**
@@ -82,6 +82,18 @@ extern "C"{
 #define PORT_USER_MODE_SOFT_LOCKING    (STD_OFF)
 #define PORT_SERR_NOTIFY_ERROR_ENABLE  (STD_OFF)
 
+/**
+* @brief  Port_SetPinMode() finds the pad function entries through an index sorted by pad and
+*         mode at Port_Init(), instead of scanning Port_aPadFunctIndex[]. Costs two bytes of RAM
+*         per entry of the table.
+*/
+#define PORT_SET_PIN_MODE_SORTED_INDEX (STD_ON)
+
+/**
+* @brief  Adds or removes the service Port_ApplyPinSet() from the code.
+*/
+#define PORT_APPLY_PIN_SET_API         (STD_OFF)
+
 /*==================================================================================================
 *                                             ENUMS
 ==================================================================================================*/
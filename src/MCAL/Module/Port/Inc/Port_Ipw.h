@@ -157,6 +157,13 @@ extern "C"{
 */
 #define Port_Ipw_RefreshPortDirection  (Port_Siu_RefreshPortDirection)
 
+#if (STD_ON == PORT_APPLY_PIN_SET_API)
+/**
+* @brief  Mapping between low level layer and high level layer for Port_Ipw_ApplyPinSet function.
+*/
+#define Port_Ipw_ApplyPinSet           (Port_Siu_ApplyPinSet)
+#endif /* (STD_ON == PORT_APPLY_PIN_SET_API) */
+
 /*=================================================================================================
 *                                             ENUMS
 =================================================================================================*/
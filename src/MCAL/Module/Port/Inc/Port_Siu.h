@@ -63,6 +63,7 @@ extern "C"
 
 #include "modules.h"
 #include "Port_Cfg.h"
+#include "Port_EnvCfg.h"
 #include "Port_Siu_Types.h"
 #include "Siu_IpVersion.h"
 
@@ -261,6 +262,17 @@ FUNC (void, PORT_CODE) Port_Siu_RefreshPortDirection
     P2CONST(Port_ConfigType, AUTOMATIC, PORT_APPL_CONST) pConfigPtr
 );
 
+#if (STD_ON == PORT_APPLY_PIN_SET_API)
+/**
+* @brief   Applies a pin set under a single critical section.
+*/
+FUNC (void, PORT_CODE) Port_Siu_ApplyPinSet
+(
+    P2CONST(Port_PinSetType, AUTOMATIC, PORT_APPL_CONST) pPinSet,
+    P2CONST(Port_ConfigType, AUTOMATIC, PORT_APPL_CONST) pConfigPtr
+);
+#endif /* (STD_ON == PORT_APPLY_PIN_SET_API) */
+
 #define PORT_STOP_SEC_CODE
 /*
 * @violates @ref PORT_SIU_H_REF_1 Violates MISRA 2004 Advisory Rule 19.15, Repeated include
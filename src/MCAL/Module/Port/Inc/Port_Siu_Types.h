@@ -177,6 +177,34 @@ typedef struct
 */
 typedef uint8 Port_Siu_PadSelConfigType;
 
+/**
+* @brief   One pin of a pin set.
+* @details New register values of a configured pin, applied by Port_ApplyPinSet().
+*
+* @api
+*/
+typedef struct
+{
+    VAR(Port_PinType, PORT_VAR) Pin;         /**< @brief Pin ID number, as given to Port_SetPinMode */
+    VAR(uint16,       PORT_VAR) u16PCR;      /**< @brief New Pad Control Register value */
+    VAR(uint16,       PORT_VAR) u16InMuxId;  /**< @brief Muxsel to update, NO_INPUTMUX_U16 for none */
+    VAR(uint8,        PORT_VAR) u8InMuxCode; /**< @brief New Muxsel value */
+    VAR(uint8,        PORT_VAR) u8PDO;       /**< @brief Pad Data Output, PORT_PIN_LEVEL_NOTCHANGED_U8 keeps it */
+} Port_Siu_PinSetEntryType;
+
+/**
+* @brief   Pin set applied at once by Port_ApplyPinSet().
+* @details Entries sorted by pad let consecutive PCRs and Muxsels sharing an Inmux register be
+*          written together.
+*
+* @api
+*/
+typedef struct
+{
+    P2CONST(Port_Siu_PinSetEntryType, PORT_VAR, PORT_APPL_CONST) pEntries; /**< @brief Pins of the set */
+    VAR(uint16, PORT_VAR) u16NumEntries;                                    /**< @brief Number of entries */
+} Port_PinSetType;
+
 /*=================================================================================================
 *                                GLOBAL VARIABLE DECLARATIONS
 =================================================================================================*/
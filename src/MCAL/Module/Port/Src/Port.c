@@ -445,6 +445,76 @@ FUNC(void, PORT_CODE) Port_RefreshPortDirection( void )
     }
 }
 
+#if (STD_ON == PORT_APPLY_PIN_SET_API)
+/**
+* @brief   Applies a set of pin configurations at once.
+* @details The function @p Port_ApplyPinSet() writes the PCR, Inmux and output level of every
+*          pin of the set under a single critical section. It is meant for switching a group of
+*          pins between peripheral configurations at runtime, with precompiled register values.
+* @pre     @p Port_Init() must have been called first. Every pin of the set shall have its mode
+*          changeable.
+*
+* @param[in] pPinSet   Pin set to apply.
+*
+* @api
+*/
+/** @violates @ref PORT_C_REF_4 MISRA 2004 Required Rule 8.10, All declarations and definitions of 
+*   objects or functions at file scope shall have internal linkage unless external linkage is 
+*   required. */
+FUNC(void, PORT_CODE) Port_ApplyPinSet
+(
+    P2CONST(Port_PinSetType, AUTOMATIC, PORT_APPL_CONST) pPinSet
+)
+{
+#if (STD_ON == PORT_DEV_ERROR_DETECT)
+    VAR(uint16,         AUTOMATIC) u16Entry;
+    VAR(Port_PinType,   AUTOMATIC) Pin;
+    VAR(uint8,          AUTOMATIC) u8ErrorId = (uint8)0U;
+
+    /* Check if Port module is initialized */
+    if (NULL_PTR == Port_pConfig)
+    {
+        u8ErrorId = (uint8)PORT_E_UNINIT;
+    }
+    else if ((NULL_PTR == pPinSet) || (NULL_PTR == pPinSet->pEntries))
+    {
+        u8ErrorId = (uint8)PORT_E_PARAM_POINTER;
+    }
+    else
+    {
+        /* The whole set is checked before any pin is touched */
+        for (u16Entry = (uint16)0U; (u16Entry < pPinSet->u16NumEntries) && ((uint8)0U == u8ErrorId); u16Entry++)
+        {
+            /** @violates @ref PORT_C_REF_5 MISRA 2004 Required Rule 17.4, Array indexing shall be the only allowed form of pointer */
+            Pin = pPinSet->pEntries[u16Entry].Pin;
+            if (Pin >= (Port_PinType)Port_pConfig->u16NumPins)
+            {
+                u8ErrorId = (uint8)PORT_E_PARAM_PIN;
+            }
+            /** @violates @ref PORT_C_REF_5 MISRA 2004 Required Rule 17.4, Array indexing shall be the only allowed form of pointer */
+            else if ((boolean)FALSE == (boolean)Port_pConfig->pUsedPadConfig[Pin].bMC)
+            {
+                u8ErrorId = (uint8)PORT_E_MODE_UNCHANGEABLE;
+            }
+            else
+            {
+                /* Pin can be reconfigured */
+            }
+        }
+    }
+
+    if ((uint8)0U != u8ErrorId)
+    {
+        (void)Det_ReportError((uint16)PORT_MODULE_ID, (uint8)PORT_INSTANCE_ID, (uint8)PORT_APPLYPINSET_ID, u8ErrorId);
+    }
+    else
+#endif /* (STD_ON == PORT_DEV_ERROR_DETECT) */
+    {
+        Port_Ipw_ApplyPinSet(pPinSet, Port_pConfig);
+    }
+}
+#endif /* (STD_ON == PORT_APPLY_PIN_SET_API) */
+
 
 #if  (STD_ON == PORT_VERSION_INFO_API)
 /**
@@ -53,6 +53,10 @@ extern "C"{
 *          Violates MISRA 2004 Required Rule 17.4, Array indexing shall be the only allowed form
 *          of pointer. The violation is FALSE: the quantity is unsigned.
 *
+* @section PORT_IPW_C_REF_5
+*          Violates MISRA 2004 Required Rule 8.7, Objects shall be defined at block scope if they are only
+*          accessed from within a single function. The index is built at init and searched by Port_SetPinMode.
+*
 * @section [global]
 *          Violates MISRA 2004 Required Rule 5.1, Identifiers (internal and external) shall not
 *          rely on the significance of more than 31 characters. The used compilers use more than
@@ -67,6 +71,7 @@ extern "C"{
 * 3) internal and external interfaces from this unit
 =================================================================================================*/
 
+#include "Port_EnvCfg.h"
 #include "Port_Ipw.h"
 #include "Port.h"
 
@@ -131,6 +136,19 @@ extern "C"{
   #error "Software Version Numbers of Port_Ipw.c and Port_Ipw.h are different"
 #endif
 
+/* Check if source file and Port_EnvCfg.h file are of the same vendor */
+#if (PORT_VENDOR_ID_IPW_C != PORT_ENVCFG_VENDOR_ID)
+    #error "Port_Ipw.c and Port_EnvCfg.h have different vendor ids"
+#endif
+
+/* Check if source file and Port_EnvCfg.h file are of the same Software version */
+#if ((PORT_SW_MAJOR_VERSION_IPW_C != PORT_ENVCFG_SW_MAJOR_VERSION) || \
+     (PORT_SW_MINOR_VERSION_IPW_C != PORT_ENVCFG_SW_MINOR_VERSION) || \
+     (PORT_SW_PATCH_VERSION_IPW_C != PORT_ENVCFG_SW_PATCH_VERSION)    \
+    )
+  #error "Software Version Numbers of Port_Ipw.c and Port_EnvCfg.h are different"
+#endif
+
 /* Check if source file and Port header file are of the same vendor */
 #if (PORT_VENDOR_ID_IPW_C != PORT_VENDOR_ID)
     #error "Port_Ipw.c and Port.h have different vendor ids"
@@ -160,6 +178,12 @@ extern "C"{
 /*=================================================================================================
 *                                       LOCAL MACROS
 =================================================================================================*/
+#if (STD_ON == PORT_SET_PIN_MODE_API) && (STD_ON == PORT_SET_PIN_MODE_SORTED_INDEX)
+/**
+* @brief   Sort key of a Port_aPadFunctIndex[] entry: the pad number, then the mode.
+*/
+#define PORT_IPW_PAD_FUNCT_KEY_U32(Pad, Mode)   ((((uint32)(Pad)) << 8U) | ((uint32)(Mode)))
+#endif
 
 
 /*=================================================================================================
@@ -170,6 +194,29 @@ extern "C"{
 /*=================================================================================================
 *                                      LOCAL VARIABLES
 =================================================================================================*/
+#if (STD_ON == PORT_SET_PIN_MODE_API) && (STD_ON == PORT_SET_PIN_MODE_SORTED_INDEX)
+#define PORT_START_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+* @violates @ref PORT_IPW_C_REF_2 Precautions shall be taken in order to prevent
+* the contents of a header file being included twice
+*/
+#include "MemMap.h"
+
+/**
+* @brief    Positions of the Port_aPadFunctIndex[] entries, in ascending order of pad and mode.
+* @details  Built by Port_Ipw_Init so that Port_Ipw_GetIndexForEntry can use a binary search.
+*/
+/** @violates @ref PORT_IPW_C_REF_5 MISRA 2004 Required Rule 8.7 */
+static VAR(uint16, PORT_VAR) Port_Ipw_au16SortedPadFunctIndex[PORT_INDEX_TABLE_NUM_ENTRIES_U16];
+
+#define PORT_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
+/**
+* @violates @ref PORT_IPW_C_REF_1 Violates MISRA 2004 Advisory Rule 19.1, Only preprocessor
+* statements and comments before '#include'
+* @violates @ref PORT_IPW_C_REF_2 Violates MISRA 2004 Required Rule 19.15, Repeated include file MemMap.h
+*/
+#include "MemMap.h"
+#endif /* (STD_ON == PORT_SET_PIN_MODE_API) && (STD_ON == PORT_SET_PIN_MODE_SORTED_INDEX) */
 
 
 /*=================================================================================================
@@ -198,6 +245,9 @@ static FUNC(uint16, PORT_CODE) Port_Ipw_GetIndexForEntry
     VAR    (Port_InternalPinIdType, AUTOMATIC) PinPad,
     VAR    (Port_PinModeType,       AUTOMATIC) PinMode
 );
+#if (STD_ON == PORT_SET_PIN_MODE_SORTED_INDEX)
+static FUNC(void, PORT_CODE) Port_Ipw_SortPadFunctIndex(void);
+#endif /* (STD_ON == PORT_SET_PIN_MODE_SORTED_INDEX) */
 #endif /* (STD_ON == PORT_SET_PIN_MODE_API) */
 
 /*=================================================================================================
@@ -205,6 +255,86 @@ static FUNC(uint16, PORT_CODE) Port_Ipw_GetIndexForEntry
 =================================================================================================*/
 
 #if (STD_ON == PORT_SET_PIN_MODE_API)
+#if (STD_ON == PORT_SET_PIN_MODE_SORTED_INDEX)
+/**
+* @brief   Sorts the positions of the Port_aPadFunctIndex[] entries by pad and mode.
+* @details Insertion sort on the position array. The generated table is mostly ordered by pad,
+*          so this is close to a single pass over it.
+* @pre     None
+*
+*/
+static FUNC(void, PORT_CODE) Port_Ipw_SortPadFunctIndex(void)
+{
+    VAR(uint16, AUTOMATIC) u16Counter;
+    VAR(uint16, AUTOMATIC) u16Pos;
+    VAR(uint16, AUTOMATIC) u16Entry;
+    VAR(uint32, AUTOMATIC) u32Key;
+
+    for(u16Counter = (uint16)0U; u16Counter < PORT_INDEX_TABLE_NUM_ENTRIES_U16; u16Counter++)
+    {
+        u32Key = PORT_IPW_PAD_FUNCT_KEY_U32(Port_aPadFunctIndex[u16Counter].u16PCR, Port_aPadFunctIndex[u16Counter].u8Mode);
+        u16Pos = u16Counter;
+        while (u16Pos > (uint16)0U)
+        {
+            u16Entry = Port_Ipw_au16SortedPadFunctIndex[u16Pos - 1U];
+            if (PORT_IPW_PAD_FUNCT_KEY_U32(Port_aPadFunctIndex[u16Entry].u16PCR, Port_aPadFunctIndex[u16Entry].u8Mode) <= u32Key)
+            {
+                break;
+            }
+            Port_Ipw_au16SortedPadFunctIndex[u16Pos] = u16Entry;
+            u16Pos--;
+        }
+        Port_Ipw_au16SortedPadFunctIndex[u16Pos] = u16Counter;
+    }
+}
+
+/**
+* @brief   Searches index in Port_aPadFunctIndex[] table.
+* @details Binary search of the entry having a given Pad number and a given PadMode through the
+*          index sorted by Port_Ipw_SortPadFunctIndex.
+* @pre     Port_Ipw_Init() must have been called first.
+
+* @param[in] PinPad       Number of the pad for which index in Port_aPadFunctIndex is requested.
+* @param[in] PinMode      Mode of the pad for which index in Port_aPadFunctIndex is requested
+*
+* @api
+*/
+static FUNC(uint16, PORT_CODE) Port_Ipw_GetIndexForEntry
+(
+    VAR    (Port_InternalPinIdType, AUTOMATIC) PinPad,
+    VAR    (Port_PinModeType,       AUTOMATIC) PinMode
+)
+{
+    VAR(uint16,         AUTOMATIC) u16ReturnIndex = (uint16)0;
+    VAR(uint16,         AUTOMATIC) u16Low = (uint16)0U;
+    VAR(uint16,         AUTOMATIC) u16High = PORT_INDEX_TABLE_NUM_ENTRIES_U16;
+    VAR(uint16,         AUTOMATIC) u16Middle;
+    VAR(uint16,         AUTOMATIC) u16Entry;
+    VAR(uint32,         AUTOMATIC) u32EntryKey;
+    VAR(uint32,         AUTOMATIC) u32Key = PORT_IPW_PAD_FUNCT_KEY_U32(PinPad, PinMode);
+
+    while (u16Low < u16High)
+    {
+        u16Middle = (uint16)(u16Low + ((uint16)(u16High - u16Low) >> 1U));
+        u16Entry = Port_Ipw_au16SortedPadFunctIndex[u16Middle];
+        u32EntryKey = PORT_IPW_PAD_FUNCT_KEY_U32(Port_aPadFunctIndex[u16Entry].u16PCR, Port_aPadFunctIndex[u16Entry].u8Mode);
+        if (u32EntryKey == u32Key)
+        {
+            u16ReturnIndex = u16Entry;
+            break;
+        }
+        else if (u32EntryKey < u32Key)
+        {
+            u16Low = (uint16)(u16Middle + 1U);
+        }
+        else
+        {
+            u16High = u16Middle;
+        }
+    }
+    return u16ReturnIndex;
+}
+#else
 /**
 * @brief   Searches index in Port_aPadFunctIndex[] table.
 * @details Searches index of an entry having a given Pad number and a given PadMode in 
@@ -235,6 +365,7 @@ static FUNC(uint16, PORT_CODE) Port_Ipw_GetIndexForEntry
     }
     return u16ReturnIndex;
 }
+#endif /* (STD_ON == PORT_SET_PIN_MODE_SORTED_INDEX) */
 #endif /* (STD_ON == PORT_SET_PIN_MODE_API) */
 
 /*=================================================================================================
@@ -259,6 +390,11 @@ FUNC(void, PORT_CODE) Port_Ipw_Init
 {
     /* Initialize all port pins */
     Port_Siu_Init(pConfigPtr);
+
+#if (STD_ON == PORT_SET_PIN_MODE_API) && (STD_ON == PORT_SET_PIN_MODE_SORTED_INDEX)
+    /* Order the pad function table once, Port_SetPinMode then searches it in logarithmic time */
+    Port_Ipw_SortPadFunctIndex();
+#endif
     
     /* Initialize all IGF channels, in case a configuration for IGF is present */
     if(NULL_PTR != pConfigPtr->IgfConfig.pChannelConfig)
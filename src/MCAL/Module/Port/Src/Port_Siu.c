@@ -254,7 +254,7 @@ extern "C" {
 /**
 * @brief    Segment descriptor for data arranged in array
 * @detail   Port_Siu_au16GPIODirChangeability variable is only used by PORT_Siu_SetPinDirection
-*           and PORT_Siu_SetPinMode functions
+*           and PORT_Siu_SetPinMode functions, and updated by Port_Siu_ApplyPinSet
 */
 static VAR(uint16, PORT_VAR) Port_Siu_au16GPIODirChangeability[PAD_16BLOCK_NO_U8];
 #endif /* (STD_ON == PORT_SET_PIN_DIRECTION_API) || (STD_ON == PORT_SET_PIN_MODE_API) */
@@ -848,6 +848,181 @@ FUNC (void, PORT_CODE) Port_Siu_RefreshPortDirection
     }
 }
 
+#if (STD_ON == PORT_APPLY_PIN_SET_API)
+/**
+* @brief   Applies a pin set under a single critical section.
+* @details The output levels are written first, so that pads turning into outputs drive their
+*          level as soon as their PCR is written. Two consecutive entries on an even pad and the pad
+*          after it share a 32 bit aligned word and get their PCRs in a single 32 bit store (big
+*          endian, the lower pad is the upper half). An odd or unpaired pad gets a 16 bit store.
+*          Muxsels of consecutive entries falling in the same Inmux register are merged into one
+*          read-modify-write of that register.
+*          As in Port_SetPinMode(), a pin set to GPIO gets its direction changeable and a pin set
+*          to another function loses it. A GPIO PCR with both buffers disabled may be an analog
+*          pin, its flag is left as it is.
+*
+* @param[in]     pPinSet       Pin set to apply
+* @param[in]     pConfigPtr    A pointer to the structure which contains initialization parameters
+*
+* @return none
+*
+* @pre Port_Init must have been called
+* @post none
+*
+*/
+FUNC (void, PORT_CODE) Port_Siu_ApplyPinSet
+(
+    P2CONST(Port_PinSetType, AUTOMATIC, PORT_APPL_CONST) pPinSet,
+    P2CONST(Port_ConfigType, AUTOMATIC, PORT_APPL_CONST) pConfigPtr
+)
+{
+    VAR(uint16, AUTOMATIC) u16NumEntries = pPinSet->u16NumEntries;
+    VAR(uint16, AUTOMATIC) u16Entry;
+    VAR(uint16, AUTOMATIC) u16PinPad;
+    VAR(uint16, AUTOMATIC) u16NextPad;
+    VAR(uint8,  AUTOMATIC) u8LocalPDO;
+#if (STD_ON == PORT_SET_PIN_DIRECTION_API) || (STD_ON == PORT_SET_PIN_MODE_API)
+    VAR(uint16, AUTOMATIC) u16PCR;
+    VAR(uint16, AUTOMATIC) u16PinDirFlag;
+#endif
+#if (IPV_SIU_00_02_09_00 != IPV_SIU)
+    VAR(uint16, AUTOMATIC) u16InMuxId;
+    VAR(uint8,  AUTOMATIC) u8Inmux = (uint8)0U;
+    VAR(uint8,  AUTOMATIC) u8Muxsel;
+    VAR(uint32, AUTOMATIC) u32InmuxMask = (uint32)0U;
+    VAR(uint32, AUTOMATIC) u32InmuxValue = (uint32)0U;
+    VAR(uint32, AUTOMATIC) u32LocalVar;
+#endif
+
+    /* Enter critical region */
+    SchM_Enter_Port_PORT_EXCLUSIVE_AREA_04();
+
+    for (u16Entry = (uint16)0U; u16Entry < u16NumEntries; u16Entry++)
+    {
+        /** @violates @ref Port_Siu_C_REF_5 Violates MISRA 2004 Required Rule 17.4 */
+        u8LocalPDO = pPinSet->pEntries[u16Entry].u8PDO;
+        if (PORT_PIN_LEVEL_NOTCHANGED_U8 != u8LocalPDO)
+        {
+            /** @violates @ref Port_Siu_C_REF_5 Violates MISRA 2004 Required Rule 17.4 */
+            u16PinPad = (uint16)pConfigPtr->pUsedPadConfig[pPinSet->pEntries[u16Entry].Pin].u16SIUPin;
+            /**
+            * @violates @ref Port_Siu_C_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer.
+            * @violates @ref Port_Siu_C_REF_6 A cast should not be performed between a pointer type and an integral type.
+            */
+            REG_WRITE8(SIU_GPDO_ADDR32((uint32)u16PinPad), u8LocalPDO);
+        }
+    }
+
+    u16Entry = (uint16)0U;
+    while (u16Entry < u16NumEntries)
+    {
+        /** @violates @ref Port_Siu_C_REF_5 Violates MISRA 2004 Required Rule 17.4 */
+        u16PinPad = (uint16)pConfigPtr->pUsedPadConfig[pPinSet->pEntries[u16Entry].Pin].u16SIUPin;
+        u16NextPad = (uint16)0xFFFFU;
+        if ((uint16)(u16Entry + 1U) < u16NumEntries)
+        {
+            /** @violates @ref Port_Siu_C_REF_5 Violates MISRA 2004 Required Rule 17.4 */
+            u16NextPad = (uint16)pConfigPtr->pUsedPadConfig[pPinSet->pEntries[u16Entry + 1U].Pin].u16SIUPin;
+        }
+
+        if ((0U == (u16PinPad & 1U)) && (u16NextPad == (uint16)(u16PinPad + 1U)))
+        {
+            /**
+            * @violates @ref Port_Siu_C_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer.
+            * @violates @ref Port_Siu_C_REF_5 Violates MISRA 2004 Required Rule 17.4
+            * @violates @ref Port_Siu_C_REF_6 A cast should not be performed between a pointer type and an integral type.
+            */
+            REG_WRITE32(SIU_PCR_ADDR32((uint32)u16PinPad), \
+                        (uint32)(((uint32)pPinSet->pEntries[u16Entry].u16PCR << 16U) | (uint32)pPinSet->pEntries[u16Entry + 1U].u16PCR));
+            u16Entry += 2U;
+        }
+        else
+        {
+            /**
+            * @violates @ref Port_Siu_C_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer.
+            * @violates @ref Port_Siu_C_REF_5 Violates MISRA 2004 Required Rule 17.4
+            * @violates @ref Port_Siu_C_REF_6 A cast should not be performed between a pointer type and an integral type.
+            */
+            REG_WRITE16(SIU_PCR_ADDR32((uint32)u16PinPad), pPinSet->pEntries[u16Entry].u16PCR);
+            u16Entry++;
+        }
+    }
+
+#if (STD_ON == PORT_SET_PIN_DIRECTION_API) || (STD_ON == PORT_SET_PIN_MODE_API)
+    for (u16Entry = (uint16)0U; u16Entry < u16NumEntries; u16Entry++)
+    {
+        /** @violates @ref Port_Siu_C_REF_5 Violates MISRA 2004 Required Rule 17.4 */
+        u16PinPad = (uint16)pConfigPtr->pUsedPadConfig[pPinSet->pEntries[u16Entry].Pin].u16SIUPin;
+        /** @violates @ref Port_Siu_C_REF_5 Violates MISRA 2004 Required Rule 17.4 */
+        u16PCR = pPinSet->pEntries[u16Entry].u16PCR;
+        u16PinDirFlag = (uint16)(1UL << ((uint8)u16PinPad & (uint8)0x0F));
+        if ((uint16)((uint16)PORT_GPIO_MODE << SIU_PCR_PA_OFFSET_U16) != (u16PCR & SIU_PCR_PA_U16))
+        {
+            Port_Siu_au16GPIODirChangeability[(uint8)(u16PinPad >> 4)] &= (uint16)(~u16PinDirFlag);
+        }
+        else if ((uint16)0U != (u16PCR & (SIU_PCR_IBE_U16 | SIU_PCR_OBE_U16)))
+        {
+            Port_Siu_au16GPIODirChangeability[(uint8)(u16PinPad >> 4)] |= u16PinDirFlag;
+        }
+        else
+        {
+            /* Analog or unbuffered GPIO pad: keep the flag */
+        }
+    }
+#endif
+
+#if (IPV_SIU_00_02_09_00 != IPV_SIU)
+    for (u16Entry = (uint16)0U; u16Entry < u16NumEntries; u16Entry++)
+    {
+        /** @violates @ref Port_Siu_C_REF_5 Violates MISRA 2004 Required Rule 17.4 */
+        u16InMuxId = pPinSet->pEntries[u16Entry].u16InMuxId;
+        if (NO_INPUTMUX_U16 != u16InMuxId)
+        {
+            /* Flush the pending Muxsels when moving to another Inmux register */
+            if (((uint32)0U != u32InmuxMask) && (u8Inmux != (uint8)(u16InMuxId >> 4)))
+            {
+                /**
+                * @violates @ref Port_Siu_C_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer.
+                * @violates @ref Port_Siu_C_REF_6 A cast should not be performed between a pointer type and an integral type.
+                */
+                u32LocalVar = REG_READ32(SIU_INMUX_ADDR32((uint32)u8Inmux));
+                /**
+                * @violates @ref Port_Siu_C_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer.
+                * @violates @ref Port_Siu_C_REF_6 A cast should not be performed between a pointer type and an integral type.
+                */
+                REG_WRITE32(SIU_INMUX_ADDR32((uint32)u8Inmux), ((u32LocalVar & ~u32InmuxMask) | u32InmuxValue));
+                u32InmuxMask  = (uint32)0U;
+                u32InmuxValue = (uint32)0U;
+            }
+            /* 16 Muxsels of 2 bits per Inmux register */
+            u8Inmux  = (uint8)(u16InMuxId >> 4);
+            u8Muxsel = (uint8)((uint8)u16InMuxId & (uint8)0x0F);
+            u32InmuxMask  |= (uint32)((uint32)SIU_INMUX_MUXSEL_MASK_U32 << ((uint32)u8Muxsel << 1));
+            /** @violates @ref Port_Siu_C_REF_5 Violates MISRA 2004 Required Rule 17.4 */
+            u32InmuxValue = (u32InmuxValue & ~(uint32)((uint32)SIU_INMUX_MUXSEL_MASK_U32 << ((uint32)u8Muxsel << 1))) | \
+                            (uint32)((uint32)pPinSet->pEntries[u16Entry].u8InMuxCode << ((uint32)u8Muxsel << 1));
+        }
+    }
+    if ((uint32)0U != u32InmuxMask)
+    {
+        /**
+        * @violates @ref Port_Siu_C_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer.
+        * @violates @ref Port_Siu_C_REF_6 A cast should not be performed between a pointer type and an integral type.
+        */
+        u32LocalVar = REG_READ32(SIU_INMUX_ADDR32((uint32)u8Inmux));
+        /**
+        * @violates @ref Port_Siu_C_REF_4 Violates MISRA 2004 Required Rule 11.1, cast from unsigned long to pointer.
+        * @violates @ref Port_Siu_C_REF_6 A cast should not be performed between a pointer type and an integral type.
+        */
+        REG_WRITE32(SIU_INMUX_ADDR32((uint32)u8Inmux), ((u32LocalVar & ~u32InmuxMask) | u32InmuxValue));
+    }
+#endif /* (IPV_SIU_00_02_09_00 != IPV_SIU) */
+
+    /* Exit critical region */
+    SchM_Exit_Port_PORT_EXCLUSIVE_AREA_04();
+}
+#endif /* (STD_ON == PORT_APPLY_PIN_SET_API) */
+
 
 #define PORT_STOP_SEC_CODE
 /**
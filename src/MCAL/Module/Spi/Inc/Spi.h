@@ -392,6 +392,13 @@ extern "C"
 */
 #define SPI_SETTSBMODE_ID  ((uint8)0x82u)
 
+/**
+* @brief   Switches Spi_WriteIB_Unchecked on or off.
+* @details Spi_WriteIB_Unchecked writes an internal buffer like Spi_WriteIB without the driver
+*          state and channel checks, for callers which already guarantee them.
+*/
+#define SPI_UNCHECKED_API  (STD_OFF)
+
 #if ((SPI_LEVEL_DELIVERED == LEVEL1) || (SPI_LEVEL_DELIVERED == LEVEL2))
 /**
 * @brief   The number of allowed job priority levels (0..3).
@@ -979,6 +986,14 @@ FUNC (Std_ReturnType, SPI_CODE) Spi_WriteIB
          P2CONST(Spi_DataType, AUTOMATIC, SPI_APPL_CONST) DataBufferPtr
      );
 
+#if (SPI_UNCHECKED_API == STD_ON)
+FUNC (Std_ReturnType, SPI_CODE) Spi_WriteIB_Unchecked
+    (
+        VAR(Spi_ChannelType, AUTOMATIC) Channel,
+         P2CONST(Spi_DataType, AUTOMATIC, SPI_APPL_CONST) DataBufferPtr
+     );
+#endif
+
 FUNC (Std_ReturnType, SPI_CODE) Spi_ReadIB
     (
         VAR(Spi_ChannelType, AUTOMATIC) Channel,
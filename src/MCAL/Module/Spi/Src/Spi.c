@@ -427,6 +427,14 @@ static FUNC(void, SPI_CODE) Spi_ScheduleNextJob
         P2VAR(Spi_HWUnitQueue, AUTOMATIC, SPI_APPL_DATA) pHWUnitQueue
     );
 #endif
+#if ( (SPI_CHANNEL_BUFFERS_ALLOWED == USAGE0) || \
+      (SPI_CHANNEL_BUFFERS_ALLOWED == USAGE2) )
+LOCAL_INLINE FUNC(Std_ReturnType, SPI_CODE) Spi_WriteIBChannel
+    (
+        VAR(Spi_ChannelType, AUTOMATIC) Channel,
+        P2CONST(Spi_DataType, AUTOMATIC, SPI_APPL_CONST) DataBufferPtr
+    );
+#endif
 
 /*==================================================================================================
 *                                       LOCAL FUNCTIONS
@@ -680,6 +688,79 @@ LOCAL_INLINE FUNC(void, SPI_CODE) Spi_ScheduleJob
 }
 #endif /* #if ( (SPI_LEVEL_DELIVERED == LEVEL1) || (SPI_LEVEL_DELIVERED == LEVEL2) ) */
 
+/*================================================================================================*/
+#if ( (SPI_CHANNEL_BUFFERS_ALLOWED == USAGE0) || \
+      (SPI_CHANNEL_BUFFERS_ALLOWED == USAGE2) )
+/**
+* @brief   This function writes the given data into the internal buffer of a valid channel.
+* @details Common part of Spi_WriteIB and Spi_WriteIB_Unchecked, the driver is initialized
+*          and the channel ID is in range.
+*
+* @param[in]      Channel             Channel ID
+* @param[in]      DataBufferPtr       Pointer to source data buffer, NULL_PTR for the default
+*                                     transmit value
+*
+* @return Std_ReturnType
+* @retval E_OK       Data has been written
+* @retval E_NOT_OK   The channel uses an external buffer
+*/
+LOCAL_INLINE FUNC(Std_ReturnType, SPI_CODE) Spi_WriteIBChannel
+    (
+        VAR(Spi_ChannelType, AUTOMATIC) Channel,
+        P2CONST(Spi_DataType, AUTOMATIC, SPI_APPL_CONST) DataBufferPtr
+    )
+{
+    VAR(Std_ReturnType, AUTOMATIC) Status = (Std_ReturnType)E_OK;
+    VAR(uint16, AUTOMATIC) u16Index;
+    P2VAR(Spi_ChannelStateType, AUTOMATIC, SPI_APPL_DATA) pChannelState;
+    P2CONST(Spi_ChannelConfigType, AUTOMATIC, SPI_APPL_CONST) pcChannelConfig;
+    P2VAR(Spi_DataType, AUTOMATIC, SPI_APPL_DATA) pDataBufferDes;
+    P2CONST(Spi_DataType, AUTOMATIC, SPI_APPL_CONST) pcDataBufferSrc;
+
+    pChannelState = &Spi_aSpiChannelState[Channel];
+    pcChannelConfig = &(*Spi_pcSpiConfigPtr->pcChannelConfig)[Channel];
+
+    /* exit early if this is the wrong buffer type */
+    if (EB == pcChannelConfig->BufferType)
+    {
+        Status = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* if DataBufferPtr is zero, then transmit default value */
+        if (NULL_PTR == DataBufferPtr)
+        {
+
+            pChannelState->u8Flags |= SPI_CHANNEL_FLAG_TX_DEFAULT_U8;
+        }
+
+        /* otherwise, copy data from DataBufferPtr to IB */
+        else
+        {
+            pDataBufferDes = pcChannelConfig->pcBufferDescriptor->pBufferTX;
+            pcDataBufferSrc = DataBufferPtr;
+            for (u16Index = 0u; u16Index < pcChannelConfig->Length; u16Index++)
+            {
+                *pDataBufferDes=*pcDataBufferSrc;
+                /*
+                * @violates @ref Spi_c_REF_6 Array indexing shall be
+                *       the only allowed form of pointer arithmetic.
+                */
+                pDataBufferDes++;
+                /*
+                * @violates @ref Spi_c_REF_6 Array indexing shall be
+                *       the only allowed form of pointer arithmetic.
+                */
+                pcDataBufferSrc++;
+            }
+            pChannelState->u8Flags = 
+                (uint8)(pChannelState->u8Flags & ((uint8)(~SPI_CHANNEL_FLAG_TX_DEFAULT_U8)));
+        }
+    }
+    return Status;
+}
+#endif
+
 /*==================================================================================================
 *                                      GLOBAL FUNCTIONS
 ==================================================================================================*/
@@ -1074,11 +1155,6 @@ FUNC(Std_ReturnType, SPI_CODE) Spi_WriteIB
      )
 {
     VAR(Std_ReturnType, AUTOMATIC) Status = (Std_ReturnType)E_OK;
-    VAR(uint16, AUTOMATIC) u16Index;
-    P2VAR(Spi_ChannelStateType, AUTOMATIC, SPI_APPL_DATA) pChannelState;
-    P2CONST(Spi_ChannelConfigType, AUTOMATIC, SPI_APPL_CONST) pcChannelConfig;
-     P2VAR(Spi_DataType, AUTOMATIC, SPI_APPL_DATA) pDataBufferDes;
-    P2CONST(Spi_DataType, AUTOMATIC, SPI_APPL_CONST) pcDataBufferSrc;
  
 #if (SPI_DEV_ERROR_DETECT == STD_ON)
     /* If Development Error Detection is enabled, report error if not */
@@ -1109,61 +1185,56 @@ FUNC(Std_ReturnType, SPI_CODE) Spi_WriteIB
     else
     {
 #endif
-        pChannelState = &Spi_aSpiChannelState[Channel];
-        pcChannelConfig = &(*Spi_pcSpiConfigPtr->pcChannelConfig)[Channel];
-
-        /* exit early if this is the wrong buffer type */
-        if (EB == pcChannelConfig->BufferType)
+        Status = Spi_WriteIBChannel(Channel, DataBufferPtr);
+#if (SPI_DEV_ERROR_DETECT == STD_ON)
+        /* the channel uses an external buffer */
+        if ((Std_ReturnType)E_OK != Status)
         {
-            Status = (Std_ReturnType)E_NOT_OK;
             /* Call Det_ReportError */
-#if (SPI_DEV_ERROR_DETECT == STD_ON)
             /*
             * @violates @ref Spi_c_REF_9 If a function returns error information,
             *           then that error information shall be tested.
             */
             Det_ReportError((uint16) SPI_MODULE_ID,(uint8) 0,SPI_WRITEIB_ID,SPI_E_PARAM_CHANNEL);
-#endif
-        }
-        else
-        {
-            /* if DataBufferPtr is zero, then transmit default value */
-            if (NULL_PTR == DataBufferPtr)
-            {
-
-                pChannelState->u8Flags |= SPI_CHANNEL_FLAG_TX_DEFAULT_U8;
-            }
-
-            /* otherwise, copy data from DataBufferPtr to IB */
-            else
-            {
-                pDataBufferDes = pcChannelConfig->pcBufferDescriptor->pBufferTX;
-                pcDataBufferSrc = DataBufferPtr;
-                for (u16Index = 0u; u16Index < pcChannelConfig->Length; u16Index++)
-                {
-                    *pDataBufferDes=*pcDataBufferSrc;
-                    /*
-                    * @violates @ref Spi_c_REF_6 Array indexing shall be
-                    *       the only allowed form of pointer arithmetic.
-                    */
-                    pDataBufferDes++;
-                    /*
-                    * @violates @ref Spi_c_REF_6 Array indexing shall be
-                    *       the only allowed form of pointer arithmetic.
-                    */
-                    pcDataBufferSrc++;
-                }
-                pChannelState->u8Flags = 
-                    (uint8)(pChannelState->u8Flags & ((uint8)(~SPI_CHANNEL_FLAG_TX_DEFAULT_U8)));
-            }
         }
-#if (SPI_DEV_ERROR_DETECT == STD_ON)
     }
 #endif
 
     /* Return status */
     return Status;
 }
+
+#if (SPI_UNCHECKED_API == STD_ON)
+/*================================================================================================*/
+/**
+* @brief   This function writes the given data into the buffer of a channel without checks.
+* @details Same as Spi_WriteIB for callers which already guarantee an initialized driver and
+*          a valid channel ID. No development error is reported.
+*          - Sync or Async:       Synchronous
+*          - Reentrancy:       Reentrant
+*
+* @param[in]      Channel             Channel ID
+* @param[in]      DataBufferPtr       Pointer to source data buffer
+*
+* @return Std_ReturnType
+* @retval E_OK       Command has been accepted
+* @retval E_NOT_OK   The channel uses an external buffer
+*
+* @pre  Pre-compile parameter SPI_UNCHECKED_API shall be STD_ON.
+*/
+/*
+* @violates @ref Spi_c_REF_4 All declarations and definitions of objects or
+* functions at file scope shall have internal linkage unless external linkage is required.
+*/
+FUNC(Std_ReturnType, SPI_CODE) Spi_WriteIB_Unchecked
+    (
+        VAR(Spi_ChannelType, AUTOMATIC) Channel,
+         P2CONST(Spi_DataType, AUTOMATIC, SPI_APPL_CONST) DataBufferPtr
+     )
+{
+    return Spi_WriteIBChannel(Channel, DataBufferPtr);
+}
+#endif /* (SPI_UNCHECKED_API == STD_ON) */
 #endif
 /*================================================================================================*/
 #if ((SPI_LEVEL_DELIVERED == LEVEL1) || (SPI_LEVEL_DELIVERED == LEVEL2))